@@ -0,0 +1,170 @@
+// Productivity tool to help you track the time you spend on tasks
+// Copyright (C) 2026 Szymon Welgus
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+// Contact:
+//     szymonwelgus at gmail dot com
+
+
+#include "benchmarkdatabase.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <system_error>
+
+#include "../src/common/queryhelper.h"
+
+#include "../src/core/database_migration.h"
+
+namespace tks::Benchmarks
+{
+namespace
+{
+void RemoveDatabaseFiles(const std::string& filePath)
+{
+    std::error_code ec;
+    for (const char* suffix : { "", "-wal", "-shm", "-journal" }) {
+        std::filesystem::remove(filePath + suffix, ec);
+    }
+}
+} // namespace
+
+BenchmarkDatabase::BenchmarkDatabase(std::shared_ptr<spdlog::logger> logger,
+    const std::string& name)
+    : pLogger(logger)
+    , mFilePath((std::filesystem::temp_directory_path() / (name + ".db")).string())
+    , pDb(nullptr)
+{
+    RemoveDatabaseFiles(mFilePath);
+
+    {
+        Core::DatabaseMigration migration(pLogger, mFilePath);
+        auto sqliteResult = migration.Migrate();
+        if (!sqliteResult.Success) {
+            pLogger->error("Failed to migrate benchmark database at \"{0}\"", mFilePath);
+            return;
+        }
+    }
+
+    int rc = sqlite3_open(mFilePath.c_str(), &pDb);
+    if (rc != SQLITE_OK) {
+        pLogger->error("Failed to open benchmark database at \"{0}\"", mFilePath);
+
+        sqlite3_close(pDb);
+        pDb = nullptr;
+        return;
+    }
+
+    for (const char* pragma : { QueryHelper::ForeignKeys,
+             QueryHelper::JournalMode,
+             QueryHelper::Synchronous,
+             QueryHelper::TempStore,
+             QueryHelper::MmapSize }) {
+        Exec(pragma);
+    }
+}
+
+BenchmarkDatabase::~BenchmarkDatabase()
+{
+    sqlite3_close(pDb);
+    RemoveDatabaseFiles(mFilePath);
+}
+
+bool BenchmarkDatabase::IsOpen() const
+{
+    return pDb != nullptr;
+}
+
+bool BenchmarkDatabase::Exec(const std::string& query) const
+{
+    int rc = sqlite3_exec(pDb, query.c_str(), nullptr, nullptr, nullptr);
+    if (rc != SQLITE_OK) {
+        pLogger->error("Benchmark query failed. Error {0}: \"{1}\"", rc, sqlite3_errmsg(pDb));
+        return false;
+    }
+
+    return true;
+}
+
+bool BenchmarkDatabase::SeedTasks(const std::string& fromDate, int days, int tasksPerDay) const
+{
+    const std::string seedTasks =
+        "INSERT INTO employers (name) VALUES ('Acme');"
+        "INSERT INTO projects (name, display_name, employer_id) VALUES ('acme-web', 'Web', 1);"
+        "INSERT INTO categories (name, color, billable, project_id) "
+        "VALUES ('Development', 1, 1, NULL);"
+        "WITH RECURSIVE day(n) AS "
+        "(SELECT 0 UNION ALL SELECT n + 1 FROM day WHERE n + 1 < " +
+        std::to_string(days) +
+        ") "
+        "INSERT INTO workdays (date) SELECT date('" +
+        fromDate +
+        "', '+' || n || ' days') FROM day;"
+        "WITH RECURSIVE task(n) AS "
+        "(SELECT 0 UNION ALL SELECT n + 1 FROM task WHERE n + 1 < " +
+        std::to_string(days * tasksPerDay) +
+        ") "
+        "INSERT INTO tasks "
+        "(billable, unique_identifier, hours, minutes, description, "
+        "project_id, category_id, workday_id) "
+        "SELECT n % 2, CASE WHEN n % 3 = 0 THEN NULL ELSE 'T-' || n END, n % 8, (n % 4) * 15, "
+        "'review the deployment notes and fix the failing build #' || n, "
+        "1, 1, 1 + n / " +
+        std::to_string(tasksPerDay) + " FROM task;";
+
+    return Exec("BEGIN TRANSACTION") && Exec(seedTasks) && Exec("COMMIT");
+}
+
+std::int64_t BenchmarkDatabase::SelectInt64(const std::string& query) const
+{
+    sqlite3_stmt* stmt = nullptr;
+    std::int64_t value = -1;
+
+    int rc = sqlite3_prepare_v2(pDb, query.c_str(), -1, &stmt, nullptr);
+    if (rc == SQLITE_OK && sqlite3_step(stmt) == SQLITE_ROW) {
+        value = sqlite3_column_int64(stmt, 0);
+    } else {
+        pLogger->error("Benchmark query failed. Error {0}: \"{1}\"", rc, sqlite3_errmsg(pDb));
+    }
+
+    sqlite3_finalize(stmt);
+    return value;
+}
+
+void Report(const std::string& name, std::int64_t operations, double seconds)
+{
+    std::printf("%-40s %10lld ops %10.3f s %14.0f ops/s\n",
+        name.c_str(),
+        static_cast<long long>(operations),
+        seconds,
+        seconds > 0 ? operations / seconds : 0.0);
+}
+
+void ReportLatency(const std::string& name, std::vector<double>& seconds)
+{
+    if (seconds.empty()) {
+        return;
+    }
+
+    std::sort(seconds.begin(), seconds.end());
+    std::printf("%-40s %10zu calls median %9.1f us p95 %9.1f us max %9.1f us\n",
+        name.c_str(),
+        seconds.size(),
+        seconds[seconds.size() / 2] * 1e6,
+        seconds[seconds.size() * 95 / 100] * 1e6,
+        seconds.back() * 1e6);
+}
+} // namespace tks::Benchmarks
@@ -0,0 +1,61 @@
+// Productivity tool to help you track the time you spend on tasks
+// Copyright (C) 2026 Szymon Welgus
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+// Contact:
+//     szymonwelgus at gmail dot com
+
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <spdlog/spdlog.h>
+
+#include <sqlite3.h>
+
+namespace tks::Benchmarks
+{
+// A migrated database in the temporary directory that is deleted again when it goes out of
+// scope. The connection is opened with the same pragmas as Persistence::PersistenceBase.
+struct BenchmarkDatabase final {
+    BenchmarkDatabase() = delete;
+    BenchmarkDatabase(const BenchmarkDatabase&) = delete;
+    BenchmarkDatabase(std::shared_ptr<spdlog::logger> logger, const std::string& name);
+    ~BenchmarkDatabase();
+
+    BenchmarkDatabase& operator=(const BenchmarkDatabase&) = delete;
+
+    bool IsOpen() const;
+    bool Exec(const std::string& query) const;
+    // one employer, project and category with tasksPerDay tasks on each of days workdays
+    // starting at fromDate (YYYY-MM-DD)
+    bool SeedTasks(const std::string& fromDate, int days, int tasksPerDay) const;
+    // the first column of the first row the query returns, -1 when it fails
+    std::int64_t SelectInt64(const std::string& query) const;
+
+    std::shared_ptr<spdlog::logger> pLogger;
+    std::string mFilePath;
+    sqlite3* pDb;
+};
+
+// Prints a benchmark result as a single line so that runs are easy to compare
+void Report(const std::string& name, std::int64_t operations, double seconds);
+// Prints the median, 95th percentile and worst of per call latencies, sorting seconds
+void ReportLatency(const std::string& name, std::vector<double>& seconds);
+} // namespace tks::Benchmarks
@@ -0,0 +1,137 @@
+// Productivity tool to help you track the time you spend on tasks
+// Copyright (C) 2026 Szymon Welgus
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+// Contact:
+//     szymonwelgus at gmail dot com
+
+
+// Checks that Persistence::ChangeFeed publishes the rows of a transaction only once its commit has
+// completed, and never the rows of a transaction that was rolled back.
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include <sqlite3.h>
+
+#include "../src/persistence/base/changefeed.h"
+
+namespace
+{
+using tks::Persistence::ChangeFeed;
+using tks::Persistence::RangeChange;
+using tks::Persistence::RowChange;
+
+bool Expect(bool condition, const char* description)
+{
+    if (!condition) {
+        std::fprintf(stderr, "Check failed: %s\n", description);
+    }
+    return condition;
+}
+
+bool Exec(sqlite3* db, const std::string& query)
+{
+    int rc = sqlite3_exec(db, query.c_str(), nullptr, nullptr, nullptr);
+    if (rc != SQLITE_OK) {
+        std::fprintf(stderr, "Query failed. Error %d: \"%s\"\n", rc, sqlite3_errmsg(db));
+        return false;
+    }
+
+    return true;
+}
+
+// counted on a second connection, which only sees rows once their commit has completed
+std::int64_t CountCommittedRows(const std::string& filePath)
+{
+    sqlite3* db = nullptr;
+    sqlite3_stmt* stmt = nullptr;
+    std::int64_t value = -1;
+
+    if (sqlite3_open(filePath.c_str(), &db) == SQLITE_OK &&
+        sqlite3_prepare_v2(db, "SELECT COUNT(*) FROM tasks", -1, &stmt, nullptr) == SQLITE_OK &&
+        sqlite3_step(stmt) == SQLITE_ROW) {
+        value = sqlite3_column_int64(stmt, 0);
+    }
+
+    sqlite3_finalize(stmt);
+    sqlite3_close(db);
+    return value;
+}
+
+void RemoveDatabaseFiles(const std::string& filePath)
+{
+    std::error_code ec;
+    for (const char* suffix : { "", "-wal", "-shm", "-journal" }) {
+        std::filesystem::remove(filePath + suffix, ec);
+    }
+}
+} // namespace
+
+int main()
+{
+    const std::string filePath =
+        (std::filesystem::temp_directory_path() / "taskies-change-feed-test.db").string();
+    RemoveDatabaseFiles(filePath);
+
+    sqlite3* db = nullptr;
+    if (sqlite3_open(filePath.c_str(), &db) != SQLITE_OK ||
+        !Exec(db, "PRAGMA journal_mode = WAL; CREATE TABLE tasks (task_id INTEGER PRIMARY KEY);")) {
+        sqlite3_close(db);
+        return EXIT_FAILURE;
+    }
+
+    // subscribers run inline, so each publish records what a reader could see at that point
+    std::size_t publishedRows = 0;
+    std::int64_t committedRows = -1;
+
+    auto& changeFeed = ChangeFeed::GetInstance();
+    changeFeed.SetDispatcher([](std::function<void()> publish) { publish(); });
+    auto subscriptionId = changeFeed.Subscribe(
+        "tasks",
+        [&](const std::vector<RowChange>& changes) {
+            publishedRows += changes.size();
+            committedRows = CountCommittedRows(filePath);
+        },
+        [](const RangeChange&) {});
+    changeFeed.Attach(db);
+
+    bool succeeded = Exec(db, "INSERT INTO tasks VALUES (1);");
+    succeeded &= Expect(publishedRows == 1, "an autocommit insert is published");
+    succeeded &= Expect(committedRows == 1, "an autocommit insert is published after its commit");
+
+    succeeded &= Exec(db, "BEGIN; INSERT INTO tasks VALUES (2); ROLLBACK;");
+    succeeded &= Expect(publishedRows == 1, "a rolled back insert is not published");
+
+    succeeded &=
+        Exec(db, "BEGIN; INSERT INTO tasks VALUES (3); INSERT INTO tasks VALUES (4); COMMIT;");
+    succeeded &= Expect(publishedRows == 3, "the rows of a transaction are published together");
+    succeeded &= Expect(committedRows == 3, "a transaction is published after its commit");
+
+    changeFeed.Detach(db);
+    changeFeed.Unsubscribe(subscriptionId);
+    changeFeed.SetDispatcher(nullptr);
+
+    sqlite3_close(db);
+    RemoveDatabaseFiles(filePath);
+
+    return succeeded ? EXIT_SUCCESS : EXIT_FAILURE;
+}
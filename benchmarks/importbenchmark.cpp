@@ -0,0 +1,217 @@
+// Productivity tool to help you track the time you spend on tasks
+// Copyright (C) 2026 Szymon Welgus
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+// Contact:
+//     szymonwelgus at gmail dot com
+
+
+// Imports generated tasks into an empty database through Services::Import::TaskImportService,
+// including the tasks_fts maintenance, and reports the rate. Every import is checked: all tasks
+// are stored, none are skipped and tasks_fts matches the tasks table. "check" runs one smaller
+// import with the checks alone, which is how the test runner calls it.
+//
+// Usage: ImportBenchmark [check] | [tasks]
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <random>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include <spdlog/spdlog.h>
+#include <spdlog/sinks/stdout_color_sinks.h>
+
+#include "../src/services/import/taskimportservice.h"
+
+#include "benchmarkdatabase.h"
+
+namespace
+{
+constexpr std::int64_t DefaultTasks = 200000;
+constexpr std::int64_t CheckTasks = 20000;
+// every iteration imports into a fresh database and the median is reported
+constexpr std::size_t Iterations = 5;
+
+const std::string seedReferenceData =
+    "INSERT INTO employers (name) VALUES ('Acme'), ('Globex');"
+    "INSERT INTO projects (name, display_name, employer_id) "
+    "VALUES ('acme-web', 'Web', 1), ('acme-app', 'App', 1), ('globex-web', 'Web', 2);"
+    "INSERT INTO categories (name, color, billable, project_id) "
+    "VALUES ('Development', 1, 1, NULL), ('Meetings', 2, 0, NULL), ('Support', 3, 0, 3);";
+
+// a file laid out like a CSV export with its default column names
+void WriteImportFile(const std::string& filePath, std::int64_t tasks)
+{
+    static const std::array<const char*, 3> projects = { "acme-web", "acme-app", "globex-web" };
+    static const std::array<const char*, 3> categories = { "Development", "Meetings", "Support" };
+    static const std::array<const char*, 16> words = { "review", "fix", "deploy", "meeting",
+        "sync", "refactor", "write", "docs", "test", "build", "plan", "customer", "issue",
+        "design", "database", "migration" };
+
+    std::mt19937 random(42);
+    std::ofstream file(filePath, std::ios::out | std::ios::binary | std::ios::trunc);
+
+    file << "Employer,Project,Category,Date,Description,Billable,Unique ID,Duration\n";
+
+    std::string line;
+    for (std::int64_t i = 0; i < tasks; i++) {
+        const std::size_t project = random() % projects.size();
+
+        line.clear();
+        line += project == 2 ? "Globex," : "Acme,";
+        line += projects[project];
+        line += ',';
+        line += project == 2 ? categories[random() % 3] : categories[random() % 2];
+
+        char date[16];
+        std::snprintf(date,
+            sizeof(date),
+            ",%04u-%02u-%02u,\"",
+            2020 + static_cast<unsigned>(random() % 7),
+            1 + static_cast<unsigned>(random() % 12),
+            1 + static_cast<unsigned>(random() % 28));
+        line += date;
+
+        for (int word = 0; word < 6; word++) {
+            line += words[random() % words.size()];
+            line += ' ';
+        }
+        line += "#" + std::to_string(i) + "\",";
+        line += random() % 2 == 0 ? "Yes" : "No";
+        line += ",T-" + std::to_string(i) + ',';
+
+        char duration[16];
+        std::snprintf(duration,
+            sizeof(duration),
+            "%02u:%02u\n",
+            static_cast<unsigned>(random() % 9),
+            static_cast<unsigned>(random() % 4) * 15);
+        line += duration;
+
+        file << line;
+    }
+}
+bool CheckImport(const tks::Benchmarks::BenchmarkDatabase& database,
+    const tks::Services::Import::TaskImportSummary& summary,
+    std::int64_t tasks)
+{
+    if (static_cast<std::int64_t>(summary.TasksImported) != tasks || summary.RecordsSkipped != 0) {
+        database.pLogger->error("Imported \"{0}\" of \"{1}\" tasks, skipped \"{2}\"",
+            summary.TasksImported,
+            tasks,
+            summary.RecordsSkipped);
+        return false;
+    }
+
+    const std::int64_t storedTasks = database.SelectInt64("SELECT COUNT(*) FROM tasks");
+    const std::int64_t matchedTasks = database.SelectInt64(
+        "SELECT COUNT(*) FROM tasks_fts WHERE tasks_fts MATCH 'description:migration'");
+    const std::int64_t likeTasks =
+        database.SelectInt64("SELECT COUNT(*) FROM tasks WHERE description LIKE '%migration%'");
+    if (storedTasks != tasks || matchedTasks != likeTasks) {
+        database.pLogger->error(
+            "Stored \"{0}\" of \"{1}\" tasks, tasks_fts matched \"{2}\" of \"{3}\"",
+            storedTasks,
+            tasks,
+            matchedTasks,
+            likeTasks);
+        return false;
+    }
+
+    // the tasks_fts backfill has to cover every imported task
+    return database.Exec("INSERT INTO tasks_fts(tasks_fts) VALUES('integrity-check')");
+}
+
+// imports the file into a fresh database and checks the result, seconds is the import alone
+bool ImportAndCheck(std::shared_ptr<spdlog::logger> logger,
+    const std::string& filePath,
+    std::int64_t tasks,
+    double& seconds)
+{
+    tks::Benchmarks::BenchmarkDatabase database(logger, "taskies-import-benchmark");
+    if (!database.IsOpen() || !database.Exec(seedReferenceData)) {
+        return false;
+    }
+
+    tks::Services::Import::TaskImportOptions options;
+    tks::Services::Import::TaskImportSummary summary;
+    tks::ImportResult importResult = tks::ImportResult::OK();
+    {
+        tks::Services::Import::TaskImportService importService(database.mFilePath, logger);
+
+        const auto start = std::chrono::steady_clock::now();
+        importResult = importService.ImportFromFile(filePath, options, summary);
+        seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    if (!importResult.Success) {
+        logger->error("Import failed: \"{0}\"", importResult.ErrorMessage);
+        return false;
+    }
+
+    return CheckImport(database, summary, tasks);
+}
+} // namespace
+
+int main(int argc, char** argv)
+{
+    using namespace tks;
+
+    const bool checkOnly = argc > 1 && std::strcmp(argv[1], "check") == 0;
+    const std::int64_t tasks =
+        checkOnly ? CheckTasks : (argc > 1 ? std::atoll(argv[1]) : DefaultTasks);
+    const std::size_t iterations = checkOnly ? 1 : Iterations;
+
+    auto logger = spdlog::stdout_color_mt("benchmark");
+    logger->set_level(spdlog::level::warn);
+
+    const std::string filePath =
+        (std::filesystem::temp_directory_path() / "taskies-import-benchmark.csv").string();
+    WriteImportFile(filePath, tasks);
+
+    std::vector<double> seconds(iterations);
+    bool succeeded = true;
+    for (std::size_t iteration = 0; iteration < iterations && succeeded; iteration++) {
+        succeeded = ImportAndCheck(logger, filePath, tasks, seconds[iteration]);
+        if (succeeded && !checkOnly) {
+            Benchmarks::Report("import tasks (with tasks_fts)", tasks, seconds[iteration]);
+        }
+    }
+
+    std::error_code ec;
+    std::filesystem::remove(filePath, ec);
+
+    if (!succeeded) {
+        return EXIT_FAILURE;
+    }
+
+    if (!checkOnly) {
+        std::sort(seconds.begin(), seconds.end());
+        Benchmarks::Report("import tasks (with tasks_fts), median", tasks, seconds[iterations / 2]);
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,178 @@
+// Productivity tool to help you track the time you spend on tasks
+// Copyright (C) 2026 Szymon Welgus
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+// Contact:
+//     szymonwelgus at gmail dot com
+
+
+// Measures the latency of a week refresh through Services::TasksService::FilterByDateRange on
+// the calling thread with the synchronous and the asynchronous program logger. The target is
+// built with trace logging enabled, as debug builds are, so every log statement reaches the
+// sinks.
+//
+// Usage: LoggingBenchmark [refreshes]
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include <spdlog/spdlog.h>
+#include <spdlog/async.h>
+#include <spdlog/sinks/daily_file_sink.h>
+#include <spdlog/sinks/msvc_sink.h>
+#include <spdlog/sinks/stdout_color_sinks.h>
+
+#include "../src/services/tasks/tasksservice.h"
+#include "../src/services/tasks/taskviewmodel.h"
+
+#include "../src/utils/daynumber.h"
+
+#include "benchmarkdatabase.h"
+
+namespace
+{
+constexpr int Days = 365;
+constexpr int TasksPerDay = 30;
+// Application::AsyncLogQueueSize
+constexpr std::size_t AsyncLogQueueSize = 8192;
+
+// the sinks and logger of Application::InitializeLogger in debug builds, with the file sink
+// taking every level as well
+template<typename TMutex>
+std::shared_ptr<spdlog::logger> CreateLogger(const std::string& logFilePath, bool asyncLogging)
+{
+    auto dailyFileSink =
+        std::make_shared<spdlog::sinks::daily_file_sink<TMutex>>(logFilePath, 5, 0, false, 5);
+    dailyFileSink->set_pattern("[%Y-%m-%d %H:%M:%S.%e] [%l] %v");
+    dailyFileSink->set_level(spdlog::level::trace);
+
+    std::vector<spdlog::sink_ptr> sinks = { dailyFileSink };
+
+#ifdef _WIN32
+    auto msvcSink = std::make_shared<spdlog::sinks::msvc_sink<TMutex>>();
+    msvcSink->set_level(spdlog::level::trace);
+    msvcSink->set_pattern("*** [%Y-%m-%d %H:%M:%S.%e] [%l] [%!:%#] %v");
+    sinks.push_back(msvcSink);
+#endif // _WIN32
+
+    std::shared_ptr<spdlog::logger> logger;
+    if (asyncLogging) {
+        spdlog::init_thread_pool(AsyncLogQueueSize, 1);
+        logger = std::make_shared<spdlog::async_logger>("TaskiesLogger",
+            sinks.begin(),
+            sinks.end(),
+            spdlog::thread_pool(),
+            spdlog::async_overflow_policy::overrun_oldest);
+    } else {
+        logger = std::make_shared<spdlog::logger>("TaskiesLogger", sinks.begin(), sinks.end());
+    }
+
+    logger->set_level(spdlog::level::trace);
+    logger->flush_on(spdlog::level::err);
+    return logger;
+}
+
+bool MeasureRefreshes(const std::string& databaseFilePath,
+    std::shared_ptr<spdlog::logger> logger,
+    int refreshes,
+    std::vector<double>& seconds)
+{
+    tks::Services::TasksService tasksService(logger, databaseFilePath);
+
+    tks::DayNumber firstDayNumber;
+    tks::DayNumber::TryParse("2026-01-05", firstDayNumber);
+
+    for (int refresh = 0; refresh < refreshes; refresh++) {
+        // step through the year week by week like the date navigation does
+        const tks::DayNumber weekStart = firstDayNumber + (refresh % (Days / 7 - 1)) * 7;
+
+        std::vector<std::string> dates;
+        for (int day = 0; day < 7; day++) {
+            dates.push_back((weekStart + day).ToString());
+        }
+
+        std::map<std::string, std::vector<tks::Services::TaskViewModel>> taskViewModels;
+
+        const auto start = std::chrono::steady_clock::now();
+        auto sqliteResult = tasksService.FilterByDateRange(dates, taskViewModels);
+        seconds.push_back(
+            std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+
+        if (!sqliteResult.Success || taskViewModels.size() != dates.size()) {
+            return false;
+        }
+    }
+
+    return true;
+}
+} // namespace
+
+int main(int argc, char** argv)
+{
+    using namespace tks;
+
+    const int refreshes = argc > 1 ? std::atoi(argv[1]) : 500;
+
+    auto consoleLogger = spdlog::stdout_color_mt("benchmark");
+    consoleLogger->set_level(spdlog::level::warn);
+
+    Benchmarks::BenchmarkDatabase database(consoleLogger, "taskies-logging-benchmark");
+    if (!database.IsOpen() || !database.SeedTasks("2026-01-01", Days, TasksPerDay)) {
+        return EXIT_FAILURE;
+    }
+
+    const auto logDirectory = std::filesystem::temp_directory_path() / "taskies-logging-benchmark";
+    std::filesystem::create_directories(logDirectory);
+
+    std::vector<double> syncSeconds;
+    std::vector<double> asyncSeconds;
+    bool succeeded = false;
+    {
+        auto logger = CreateLogger<std::mutex>((logDirectory / "sync.log").string(), false);
+        succeeded = MeasureRefreshes(database.mFilePath, logger, refreshes, syncSeconds);
+        logger->flush();
+    }
+    if (succeeded) {
+        auto logger =
+            CreateLogger<spdlog::details::null_mutex>((logDirectory / "async.log").string(), true);
+        succeeded = MeasureRefreshes(database.mFilePath, logger, refreshes, asyncSeconds);
+        logger->flush();
+    }
+
+    // joins the async worker before its log files are removed
+    spdlog::shutdown();
+
+    std::error_code ec;
+    std::filesystem::remove_all(logDirectory, ec);
+
+    if (!succeeded) {
+        std::fprintf(stderr, "Failed to filter tasks by date range\n");
+        return EXIT_FAILURE;
+    }
+
+    Benchmarks::ReportLatency("week refresh, synchronous logging", syncSeconds);
+    Benchmarks::ReportLatency("week refresh, asynchronous logging", asyncSeconds);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,167 @@
+// Productivity tool to help you track the time you spend on tasks
+// Copyright (C) 2026 Szymon Welgus
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+// Contact:
+//     szymonwelgus at gmail dot com
+
+
+// Checks that Core::DatabaseMigration upgrades a database whose migration_history was recorded
+// by the resource based migrations, which stored the upper case resource names, and one whose
+// history holds the file stems as they are.
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <system_error>
+
+#include <spdlog/spdlog.h>
+#include <spdlog/sinks/stdout_color_sinks.h>
+
+#include <sqlite3.h>
+
+#include "../src/core/database_migration.h"
+
+namespace
+{
+using tks::Core::DatabaseMigration;
+using tks::Core::EmbeddedMigrations;
+
+// the newest migration that shipped as a MIGRATION resource before they were embedded
+constexpr std::string_view LastResourceMigration =
+    "20260210185522_add_attended_meeting_id_column_to_tasks_table";
+
+bool Expect(bool condition, const char* description)
+{
+    if (!condition) {
+        std::fprintf(stderr, "Check failed: %s\n", description);
+    }
+    return condition;
+}
+
+bool Exec(sqlite3* db, const std::string& query)
+{
+    int rc = sqlite3_exec(db, query.c_str(), nullptr, nullptr, nullptr);
+    if (rc != SQLITE_OK) {
+        std::fprintf(stderr, "Query failed. Error %d: \"%s\"\n", rc, sqlite3_errmsg(db));
+        return false;
+    }
+
+    return true;
+}
+
+std::int64_t SelectInt64(sqlite3* db, const std::string& query)
+{
+    sqlite3_stmt* stmt = nullptr;
+    std::int64_t value = -1;
+
+    if (sqlite3_prepare_v2(db, query.c_str(), -1, &stmt, nullptr) == SQLITE_OK &&
+        sqlite3_step(stmt) == SQLITE_ROW) {
+        value = sqlite3_column_int64(stmt, 0);
+    }
+
+    sqlite3_finalize(stmt);
+    return value;
+}
+
+void RemoveDatabaseFiles(const std::string& filePath)
+{
+    std::error_code ec;
+    for (const char* suffix : { "", "-wal", "-shm", "-journal" }) {
+        std::filesystem::remove(filePath + suffix, ec);
+    }
+}
+
+std::size_t CountResourceMigrations()
+{
+    auto iterator = std::find_if(
+        EmbeddedMigrations.begin(), EmbeddedMigrations.end(), [](const auto& migration) {
+            return std::equal(migration.name.begin(),
+                migration.name.end(),
+                LastResourceMigration.begin(),
+                LastResourceMigration.end(),
+                [](char left, char right) {
+                    return std::toupper(static_cast<unsigned char>(left)) ==
+                           std::toupper(static_cast<unsigned char>(right));
+                });
+        });
+    return iterator == EmbeddedMigrations.end()
+               ? 0
+               : static_cast<std::size_t>(iterator - EmbeddedMigrations.begin()) + 1;
+}
+
+// a database at the last resource based release upgraded to the embedded migrations, with its
+// history rewritten by nameFunction ("UPPER" or "LOWER") before the upgrade
+bool CheckUpgrade(std::shared_ptr<spdlog::logger> logger,
+    const std::string& filePath,
+    const std::string& nameFunction)
+{
+    RemoveDatabaseFiles(filePath);
+
+    const std::size_t resourceMigrations = CountResourceMigrations();
+    if (!Expect(resourceMigrations > 0 && resourceMigrations < EmbeddedMigrations.size(),
+            "the last resource migration is embedded and newer migrations follow it")) {
+        return false;
+    }
+
+    bool succeeded = true;
+    {
+        DatabaseMigration migration(logger, filePath);
+        auto sqliteResult = migration.Migrate(EmbeddedMigrations.data(), resourceMigrations);
+        succeeded &=
+            Expect(sqliteResult.Success, "the resource migrations apply to an empty database");
+        succeeded &= Exec(migration.pDb,
+            "UPDATE migration_history SET name = " + nameFunction + "(name)");
+    }
+
+    {
+        DatabaseMigration migration(logger, filePath);
+        succeeded &= Expect(migration.Migrate().Success, "the upgrade applies");
+        succeeded &= Expect(SelectInt64(migration.pDb, "SELECT COUNT(*) FROM migration_history") ==
+                                static_cast<std::int64_t>(EmbeddedMigrations.size()),
+            "only the migrations missing from the history are applied");
+
+        // a second start finds nothing pending
+        succeeded &= Expect(migration.Migrate().Success, "a migrated database migrates again");
+        succeeded &= Expect(SelectInt64(migration.pDb, "SELECT COUNT(*) FROM migration_history") ==
+                                static_cast<std::int64_t>(EmbeddedMigrations.size()),
+            "a migrated database applies nothing");
+    }
+
+    RemoveDatabaseFiles(filePath);
+    return succeeded;
+}
+} // namespace
+
+int main()
+{
+    auto logger = spdlog::stdout_color_mt("test");
+    logger->set_level(spdlog::level::warn);
+
+    const std::string filePath =
+        (std::filesystem::temp_directory_path() / "taskies-migration-history-test.db").string();
+
+    // the resource names, upper cased by the resource compiler, and the plain file stems
+    bool succeeded = CheckUpgrade(logger, filePath, "UPPER");
+    succeeded &= CheckUpgrade(logger, filePath, "LOWER");
+
+    return succeeded ? EXIT_SUCCESS : EXIT_FAILURE;
+}
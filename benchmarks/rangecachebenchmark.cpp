@@ -0,0 +1,202 @@
+// Productivity tool to help you track the time you spend on tasks
+// Copyright (C) 2026 Szymon Welgus
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+// Contact:
+//     szymonwelgus at gmail dot com
+
+
+// Measures a week step of the date navigation served from Services::TaskRangeCache against the
+// Services::TasksService::FilterByDateRange fetch it replaces. The adjacent weeks are stored the
+// way MainFrame::PrefetchAdjacentDates does, outside the timed part, as the executor fetches
+// them off the UI thread.
+//
+// Usage: RangeCacheBenchmark [days] [tasks per day] [sweeps]
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <spdlog/spdlog.h>
+#include <spdlog/sinks/stdout_color_sinks.h>
+
+#include "../src/services/tasks/taskrangecache.h"
+#include "../src/services/tasks/tasksservice.h"
+#include "../src/services/tasks/taskviewmodel.h"
+
+#include "../src/utils/daynumber.h"
+
+#include "benchmarkdatabase.h"
+
+namespace
+{
+using TasksGroupedByWorkday = std::map<std::string, std::vector<tks::Services::TaskViewModel>>;
+
+constexpr std::int32_t WeekLength = 7;
+
+std::vector<std::string> WeekDates(tks::DayNumber weekStart)
+{
+    std::vector<std::string> dates;
+    for (std::int32_t day = 0; day < WeekLength; day++) {
+        dates.push_back((weekStart + day).ToString());
+    }
+    return dates;
+}
+
+double SecondsSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+bool HaveSameTasks(const TasksGroupedByWorkday& left, const TasksGroupedByWorkday& right)
+{
+    if (left.size() != right.size()) {
+        return false;
+    }
+
+    for (const auto& [date, tasks] : left) {
+        auto iterator = right.find(date);
+        if (iterator == right.end() || iterator->second.size() != tasks.size()) {
+            return false;
+        }
+
+        for (std::size_t i = 0; i < tasks.size(); i++) {
+            if (tasks[i].TaskId != iterator->second[i].TaskId) {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+// MainFrame::PrefetchAdjacentDates, with the fetches run inline
+bool PrefetchAdjacentWeeks(tks::Services::TasksService& tasksService,
+    tks::Services::TaskRangeCache& taskRangeCache,
+    tks::DayNumber weekStart)
+{
+    const tks::DayNumber weekEnd = weekStart + (WeekLength - 1);
+    taskRangeCache.Retain(weekStart - WeekLength, weekEnd + WeekLength);
+
+    for (const auto& adjacentDates :
+        { WeekDates(weekStart - WeekLength), WeekDates(weekStart + WeekLength) }) {
+        if (taskRangeCache.Contains(adjacentDates)) {
+            continue;
+        }
+
+        auto generation = taskRangeCache.GetGeneration();
+        TasksGroupedByWorkday tasksGroupedByWorkday;
+        if (!tasksService.FilterByDateRange(adjacentDates, tasksGroupedByWorkday).Success) {
+            return false;
+        }
+
+        taskRangeCache.Store(tasksGroupedByWorkday, generation);
+    }
+
+    return true;
+}
+} // namespace
+
+int main(int argc, char** argv)
+{
+    using namespace tks;
+
+    const int days = argc > 1 ? std::atoi(argv[1]) : 365;
+    const int tasksPerDay = argc > 2 ? std::atoi(argv[2]) : 30;
+    const int sweeps = argc > 3 ? std::atoi(argv[3]) : 5;
+    const int weeks = days / WeekLength - 1;
+
+    auto logger = spdlog::stdout_color_mt("benchmark");
+    logger->set_level(spdlog::level::warn);
+
+    Benchmarks::BenchmarkDatabase database(logger, "taskies-range-cache-benchmark");
+    if (!database.IsOpen() || !database.SeedTasks("2026-01-01", days, tasksPerDay)) {
+        return EXIT_FAILURE;
+    }
+
+    Services::TasksService tasksService(logger, database.mFilePath);
+    Services::TaskRangeCache taskRangeCache;
+
+    DayNumber firstDayNumber;
+    DayNumber::TryParse("2026-01-01", firstDayNumber);
+
+    std::vector<double> fetchSeconds;
+    std::vector<double> cacheSeconds;
+    std::int64_t misses = 0;
+
+    for (int sweep = 0; sweep < sweeps; sweep++) {
+        taskRangeCache.Clear();
+
+        // the first week is fetched on open, every step after it moves one week forward
+        TasksGroupedByWorkday openTasksGroupedByWorkday;
+        if (!tasksService.FilterByDateRange(WeekDates(firstDayNumber), openTasksGroupedByWorkday)
+                 .Success) {
+            return EXIT_FAILURE;
+        }
+        taskRangeCache.Store(openTasksGroupedByWorkday, taskRangeCache.GetGeneration());
+        if (!PrefetchAdjacentWeeks(tasksService, taskRangeCache, firstDayNumber)) {
+            return EXIT_FAILURE;
+        }
+
+        for (int week = 1; week < weeks; week++) {
+            const DayNumber weekStart = firstDayNumber + week * WeekLength;
+            const auto dates = WeekDates(weekStart);
+
+            TasksGroupedByWorkday fetchedTasksGroupedByWorkday;
+            auto start = std::chrono::steady_clock::now();
+            auto sqliteResult = tasksService.FilterByDateRange(dates, fetchedTasksGroupedByWorkday);
+            fetchSeconds.push_back(SecondsSince(start));
+
+            if (!sqliteResult.Success) {
+                std::fprintf(stderr, "Failed to filter tasks by date range\n");
+                return EXIT_FAILURE;
+            }
+
+            TasksGroupedByWorkday cachedTasksGroupedByWorkday;
+            start = std::chrono::steady_clock::now();
+            bool isCached = taskRangeCache.TryGet(dates, cachedTasksGroupedByWorkday);
+            cacheSeconds.push_back(SecondsSince(start));
+
+            if (!isCached) {
+                misses++;
+                taskRangeCache.Store(fetchedTasksGroupedByWorkday, taskRangeCache.GetGeneration());
+            } else if (!HaveSameTasks(cachedTasksGroupedByWorkday, fetchedTasksGroupedByWorkday)) {
+                std::fprintf(stderr, "Cached week differs from the fetched week\n");
+                return EXIT_FAILURE;
+            }
+
+            if (!PrefetchAdjacentWeeks(tasksService, taskRangeCache, weekStart)) {
+                return EXIT_FAILURE;
+            }
+        }
+    }
+
+    Benchmarks::ReportLatency("week step, FilterByDateRange", fetchSeconds);
+    Benchmarks::ReportLatency("week step, TaskRangeCache::TryGet", cacheSeconds);
+
+    // every step lands on the week prefetched by the step before it
+    if (misses > 0) {
+        std::fprintf(stderr,
+            "%lld of the week steps missed the cache\n",
+            static_cast<long long>(misses));
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,207 @@
+// Productivity tool to help you track the time you spend on tasks
+// Copyright (C) 2026 Szymon Welgus
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+// Contact:
+//     szymonwelgus at gmail dot com
+
+
+// Reads task view rows through Persistence::ReadRows and TaskViewModelColumns and through the
+// hand-written column sequence the task queries used before, over the same statement.
+//
+// Usage: RowMapperBenchmark [days] [tasks per day] [sweeps]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <spdlog/spdlog.h>
+#include <spdlog/sinks/stdout_color_sinks.h>
+
+#include <sqlite3.h>
+
+#include "../src/persistence/base/rowmapper.h"
+
+#include "../src/services/tasks/tasksservice.h"
+#include "../src/services/tasks/taskviewmodel.h"
+
+#include "benchmarkdatabase.h"
+
+namespace
+{
+using tks::Services::TaskViewModel;
+
+// TasksService::ReadTaskViewModel before the row mapper replaced it
+void ReadTaskViewModel(sqlite3_stmt* stmt, int& columnIndex, TaskViewModel& model)
+{
+    model.TaskId = sqlite3_column_int64(stmt, columnIndex++);
+
+    model.Billable = !!sqlite3_column_int(stmt, columnIndex++);
+
+    if (sqlite3_column_type(stmt, columnIndex) == SQLITE_NULL) {
+        model.UniqueIdentifier = std::nullopt;
+    } else {
+        const unsigned char* res = sqlite3_column_text(stmt, columnIndex);
+        model.UniqueIdentifier = std::make_optional(std::string(
+            reinterpret_cast<const char*>(res), sqlite3_column_bytes(stmt, columnIndex)));
+    }
+    columnIndex++;
+
+    model.Hours = sqlite3_column_int(stmt, columnIndex++);
+    model.Minutes = sqlite3_column_int(stmt, columnIndex++);
+
+    const unsigned char* res = sqlite3_column_text(stmt, columnIndex);
+    model.Description =
+        std::string(reinterpret_cast<const char*>(res), sqlite3_column_bytes(stmt, columnIndex++));
+
+    model.DateCreated = sqlite3_column_int(stmt, columnIndex++);
+    model.DateModified = sqlite3_column_int(stmt, columnIndex++);
+    model.IsActive = !!sqlite3_column_int(stmt, columnIndex++);
+
+    model.ProjectId = sqlite3_column_int64(stmt, columnIndex++);
+    model.CategoryId = sqlite3_column_int64(stmt, columnIndex++);
+    model.WorkdayId = sqlite3_column_int64(stmt, columnIndex++);
+}
+
+int ReadHandWritten(sqlite3_stmt* stmt, std::vector<TaskViewModel>& models)
+{
+    int rc = SQLITE_OK;
+    bool done = false;
+    while (!done) {
+        switch (rc = sqlite3_step(stmt)) {
+        case SQLITE_ROW: {
+            TaskViewModel model;
+
+            int columnIndex = 0;
+            ReadTaskViewModel(stmt, columnIndex, model);
+
+            models.push_back(std::move(model));
+            break;
+        }
+        case SQLITE_DONE:
+        default:
+            done = true;
+            break;
+        }
+    }
+
+    return rc;
+}
+
+int ReadMapped(sqlite3_stmt* stmt, std::vector<TaskViewModel>& models)
+{
+    return tks::Persistence::ReadRows(stmt, tks::Services::TaskViewModelColumns, models);
+}
+
+bool IsSameRow(const TaskViewModel& lhs, const TaskViewModel& rhs)
+{
+    return lhs.TaskId == rhs.TaskId && lhs.Billable == rhs.Billable &&
+           lhs.UniqueIdentifier == rhs.UniqueIdentifier && lhs.Hours == rhs.Hours &&
+           lhs.Minutes == rhs.Minutes && lhs.Description == rhs.Description &&
+           lhs.DateCreated == rhs.DateCreated && lhs.DateModified == rhs.DateModified &&
+           lhs.IsActive == rhs.IsActive && lhs.ProjectId == rhs.ProjectId &&
+           lhs.CategoryId == rhs.CategoryId && lhs.WorkdayId == rhs.WorkdayId;
+}
+
+// sweeps the whole range through read, rebuilding the vector every time like a range refresh
+template<typename TRead>
+double Sweep(sqlite3_stmt* stmt, int sweeps, TRead read, std::vector<TaskViewModel>& models)
+{
+    const auto start = std::chrono::steady_clock::now();
+    for (int sweep = 0; sweep < sweeps; sweep++) {
+        models.clear();
+        models.shrink_to_fit();
+
+        read(stmt, models);
+        sqlite3_reset(stmt);
+    }
+
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+} // namespace
+
+int main(int argc, char** argv)
+{
+    using namespace tks;
+
+    const int days = argc > 1 ? std::atoi(argv[1]) : 365;
+    const int tasksPerDay = argc > 2 ? std::atoi(argv[2]) : 30;
+    const int sweeps = argc > 3 ? std::atoi(argv[3]) : 50;
+
+    auto logger = spdlog::stdout_color_mt("benchmark");
+    logger->set_level(spdlog::level::warn);
+
+    Benchmarks::BenchmarkDatabase database(logger, "taskies-rowmapper-benchmark");
+    if (!database.IsOpen() || !database.SeedTasks("2026-01-01", days, tasksPerDay)) {
+        return EXIT_FAILURE;
+    }
+
+    const std::string_view query = Services::TasksService::filterByDayNumberRange;
+
+    sqlite3_stmt* stmt = nullptr;
+    int rc = sqlite3_prepare_v3(
+        database.pDb, query.data(), static_cast<int>(query.size()), 0, &stmt, nullptr);
+    if (rc != SQLITE_OK) {
+        logger->error("Failed to prepare \"{0}\": \"{1}\"", query, sqlite3_errmsg(database.pDb));
+        return EXIT_FAILURE;
+    }
+
+    sqlite3_bind_int(stmt, 1, std::numeric_limits<std::int32_t>::min());
+    sqlite3_bind_int(stmt, 2, std::numeric_limits<std::int32_t>::max());
+
+    std::vector<TaskViewModel> handWritten;
+    std::vector<TaskViewModel> mapped;
+
+    // warm the page cache and check both readers agree before timing them
+    Sweep(stmt, 1, ReadHandWritten, handWritten);
+    Sweep(stmt, 1, ReadMapped, mapped);
+
+    bool same = handWritten.size() == mapped.size() &&
+                handWritten.size() == static_cast<std::size_t>(days) * tasksPerDay;
+    for (std::size_t i = 0; same && i < mapped.size(); i++) {
+        same = IsSameRow(handWritten[i], mapped[i]);
+    }
+    if (!same) {
+        logger->error("The row mapper and the hand-written reader disagree");
+        sqlite3_finalize(stmt);
+        return EXIT_FAILURE;
+    }
+
+    // interleaved so drift in the machine's speed affects both readers alike
+    constexpr int Rounds = 5;
+    const int sweepsPerRound = std::max(1, sweeps / Rounds);
+    const std::int64_t rows =
+        static_cast<std::int64_t>(mapped.size()) * sweepsPerRound * Rounds;
+
+    double handWrittenSeconds = 0.0;
+    double mappedSeconds = 0.0;
+    for (int round = 0; round < Rounds; round++) {
+        handWrittenSeconds += Sweep(stmt, sweepsPerRound, ReadHandWritten, handWritten);
+        mappedSeconds += Sweep(stmt, sweepsPerRound, ReadMapped, mapped);
+    }
+
+    sqlite3_finalize(stmt);
+
+    Benchmarks::Report("task view rows, hand-written", rows, handWrittenSeconds);
+    Benchmarks::Report("task view rows, row mapper", rows, mappedSeconds);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,620 @@
+// Productivity tool to help you track the time you spend on tasks
+// Copyright (C) 2026 Szymon Welgus
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+// Contact:
+//     szymonwelgus at gmail dot com
+
+
+// Checks and measures the date and task id indexes of UI::TaskTreeModel over a year of tasks
+// read through Services::TasksService, and sweeps TaskTreeModel::GetValue over every cell the way
+// repaints do against the node that returned its columns as std::string by value.
+// "check" runs the checks alone, which is how the test runner calls it, otherwise the checks run
+// before the timings.
+//
+// Usage: TaskTreeModelBenchmark [check] | [days] [tasks per day] [rounds]
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <wx/wxprec.h>
+#ifndef WX_PRECOMP
+#include <wx/wx.h>
+#endif
+#include <wx/dataview.h>
+#include <wx/init.h>
+
+#include <spdlog/spdlog.h>
+#include <spdlog/sinks/stdout_color_sinks.h>
+
+#include "../src/core/configuration.h"
+
+#include "../src/services/tasks/tasksservice.h"
+#include "../src/services/tasks/taskviewmodel.h"
+
+#include "../src/ui/dataview/tasktreemodel.h"
+#include "../src/ui/dataview/tasktreemodelnode.h"
+
+#include "../src/utils/daynumber.h"
+
+#include "benchmarkdatabase.h"
+
+namespace
+{
+using tks::Services::TaskViewModel;
+using tks::UI::TaskTreeModel;
+using tks::UI::TaskTreeModelNode;
+using TasksGroupedByWorkday = std::map<std::string, std::vector<TaskViewModel>>;
+
+double SecondsSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+bool Expect(bool condition, const char* description)
+{
+    if (!condition) {
+        std::fprintf(stderr, "Check failed: %s\n", description);
+    }
+    return condition;
+}
+
+bool LoadTasks(const std::string& databaseFilePath,
+    std::shared_ptr<spdlog::logger> logger,
+    const std::string& fromDate,
+    int days,
+    TasksGroupedByWorkday& tasksGroupedByWorkday)
+{
+    tks::DayNumber firstDayNumber;
+    tks::DayNumber::TryParse(fromDate, firstDayNumber);
+
+    std::vector<std::string> dates;
+    for (int day = 0; day < days; day++) {
+        dates.push_back((firstDayNumber + day).ToString());
+    }
+
+    tks::Services::TasksService tasksService(logger, databaseFilePath);
+    return tasksService.FilterByDateRange(dates, tasksGroupedByWorkday).Success &&
+           tasksGroupedByWorkday.size() == dates.size();
+}
+
+// the model as MainFrame fills it for a custom range
+wxObjectDataPtr<TaskTreeModel> BuildModel(std::shared_ptr<tks::Core::Configuration> cfg,
+    std::shared_ptr<spdlog::logger> logger,
+    const TasksGroupedByWorkday& tasksGroupedByWorkday)
+{
+    wxObjectDataPtr<TaskTreeModel> model(new TaskTreeModel({}, cfg, logger));
+    for (const auto& [workdayDate, tasks] : tasksGroupedByWorkday) {
+        model->InsertRootAndChildNodes(workdayDate, tasks);
+    }
+    return model;
+}
+
+unsigned int CountChildren(TaskTreeModel& model, const std::string& date)
+{
+    auto rootItems = model.TryExpandAllDateNodes({ date });
+    if (rootItems.IsEmpty()) {
+        return 0;
+    }
+
+    wxDataViewItemArray children;
+    return model.GetChildren(rootItems.Item(0), children);
+}
+
+// TaskTreeModel::FindChildNode before the indexes, a scan of the roots and then the children
+TaskTreeModelNode* FindChildNodeByScan(const TaskTreeModel& model,
+    const std::string& date,
+    std::int64_t taskId)
+{
+    wxDataViewItemArray roots;
+    model.GetChildren(wxDataViewItem(nullptr), roots);
+    for (std::size_t i = 0; i < roots.GetCount(); i++) {
+        auto rootNode = (TaskTreeModelNode*) roots.Item(i).GetID();
+        if (rootNode->GetDate() != date) {
+            continue;
+        }
+
+        for (const auto& child : rootNode->GetChildren()) {
+            if (child->GetTaskId() == taskId) {
+                return child.get();
+            }
+        }
+        return nullptr;
+    }
+    return nullptr;
+}
+
+// TaskTreeModelNode and TaskTreeModel::GetValue before the nodes held prepared wxStrings
+class LegacyTaskNode final
+{
+public:
+    LegacyTaskNode(TaskViewModel& taskModel)
+        : mDate(taskModel.GetWorkdayDate())
+        , mEmployerName(taskModel.GetEmployerName())
+        , mClientName(taskModel.GetClientName())
+        , mProjectName(taskModel.GetProjectName())
+        , mCategoryName(taskModel.GetCategoryName())
+        , mDuration(taskModel.GetDuration())
+        , bBillable(taskModel.Billable)
+        , mUniqueId(taskModel.TryGetUniqueIdentifier())
+        , mDescription(taskModel.GetTrimmedDescription())
+        , mTaskId(taskModel.TaskId)
+    {
+    }
+
+    std::string GetDate() const
+    {
+        return mDate;
+    }
+
+    std::string GetEmployerName() const
+    {
+        return mEmployerName;
+    }
+
+    std::string GetClientName() const
+    {
+        return mClientName;
+    }
+
+    std::string GetProjectName() const
+    {
+        return mProjectName;
+    }
+
+    std::string GetCategoryName() const
+    {
+        return mCategoryName;
+    }
+
+    std::string GetDuration() const
+    {
+        return mDuration;
+    }
+
+    bool Billable() const
+    {
+        return bBillable;
+    }
+
+    std::string GetUniqueId() const
+    {
+        return mUniqueId;
+    }
+
+    std::string GetDescription() const
+    {
+        return mDescription;
+    }
+
+    std::int64_t GetTaskId() const
+    {
+        return mTaskId;
+    }
+
+private:
+    std::string mDate;
+    std::string mEmployerName;
+    std::string mClientName;
+    std::string mProjectName;
+    std::string mCategoryName;
+    std::string mDuration;
+    bool bBillable;
+    std::string mUniqueId;
+    std::string mDescription;
+    std::int64_t mTaskId;
+};
+
+void GetLegacyValue(wxVariant& variant, const LegacyTaskNode& node, unsigned int col)
+{
+    switch (col) {
+    case TaskTreeModel::Col_Date:
+        variant = node.GetDate();
+        break;
+    case TaskTreeModel::Col_Employer:
+        variant = node.GetEmployerName();
+        break;
+    case TaskTreeModel::Col_Client:
+        variant = node.GetClientName();
+        break;
+    case TaskTreeModel::Col_Project:
+        variant = node.GetProjectName();
+        break;
+    case TaskTreeModel::Col_Category:
+        variant = node.GetCategoryName();
+        break;
+    case TaskTreeModel::Col_Duration:
+        variant = node.GetDuration();
+        break;
+    case TaskTreeModel::Col_Billable:
+        variant = node.Billable();
+        break;
+    case TaskTreeModel::Col_UniqueId:
+        variant = node.GetUniqueId();
+        break;
+    case TaskTreeModel::Col_Description:
+        variant = node.GetDescription();
+        break;
+    case TaskTreeModel::Col_Id:
+        variant = (long) node.GetTaskId();
+        break;
+    default:
+        break;
+    }
+}
+
+// every task row of the model, in the order a fully expanded view lists them
+wxDataViewItemArray CollectTaskItems(const TaskTreeModel& model)
+{
+    wxDataViewItemArray roots;
+    model.GetChildren(wxDataViewItem(nullptr), roots);
+
+    wxDataViewItemArray items;
+    for (std::size_t i = 0; i < roots.GetCount(); i++) {
+        model.GetChildren(roots.Item(i), items);
+    }
+    return items;
+}
+
+bool IsTextColumn(unsigned int col)
+{
+    return col != TaskTreeModel::Col_Billable && col != TaskTreeModel::Col_Id;
+}
+
+bool CheckIndexes(std::shared_ptr<tks::Core::Configuration> cfg,
+    std::shared_ptr<spdlog::logger> logger,
+    TasksGroupedByWorkday tasksGroupedByWorkday)
+{
+    auto model = BuildModel(cfg, logger, tasksGroupedByWorkday);
+
+    std::vector<std::string> dates;
+    for (const auto& [date, tasks] : tasksGroupedByWorkday) {
+        dates.push_back(date);
+    }
+
+    bool succeeded = Expect(model->TryExpandAllDateNodes(dates).size() == dates.size(),
+        "every date resolves to its root node");
+
+    for (const auto& [date, tasks] : tasksGroupedByWorkday) {
+        for (const auto& task : tasks) {
+            std::string taskDate;
+            if (!model->TryGetTaskDate(task.TaskId, taskDate) || taskDate != date) {
+                return Expect(false, "every task resolves to the date it is filed under");
+            }
+        }
+    }
+
+    const std::string& firstDate = dates.front();
+    const std::string& lastDate = dates.back();
+    auto firstTasks = tasksGroupedByWorkday.at(firstDate);
+    const auto& lastTasks = tasksGroupedByWorkday.at(lastDate);
+    const auto firstCount = CountChildren(*model, firstDate);
+    const auto lastCount = CountChildren(*model, lastDate);
+
+    // a task addressed under a date it is not filed under is left alone
+    model->DeleteChild(lastDate, firstTasks.front().TaskId);
+    succeeded &= Expect(CountChildren(*model, firstDate) == firstCount,
+        "DeleteChild ignores a task filed under another date");
+
+    // moving a task re-files it under the root of its new date
+    auto movedTask = firstTasks.front();
+    movedTask.WorkdayId = lastTasks.front().WorkdayId;
+    movedTask.Hours = 12;
+    movedTask.Minutes = 5;
+    movedTask.Billable = true;
+    model->ApplyTaskChanged(movedTask);
+
+    int movedTaskMinutes = 0;
+    bool movedTaskBillable = false;
+    succeeded &=
+        Expect(model->TryGetTaskDuration(movedTask.TaskId, movedTaskMinutes, movedTaskBillable) &&
+                   movedTaskMinutes == 725 && movedTaskBillable,
+        "a changed task resolves to its new duration");
+
+    std::string movedTaskDate;
+    succeeded &= Expect(model->TryGetTaskDate(movedTask.TaskId, movedTaskDate) &&
+                            movedTaskDate == lastDate,
+        "a moved task resolves to its new date");
+    succeeded &= Expect(CountChildren(*model, firstDate) == firstCount - 1 &&
+                            CountChildren(*model, lastDate) == lastCount + 1,
+        "a moved task leaves its old root node for the new one");
+
+    model->ApplyTaskRemoved(movedTask.TaskId);
+    succeeded &= Expect(!model->TryGetTaskDate(movedTask.TaskId, movedTaskDate),
+        "a removed task no longer resolves");
+    succeeded &= Expect(CountChildren(*model, lastDate) == lastCount,
+        "a removed task leaves its root node");
+
+    // clearing a date unindexes its tasks until they are inserted again
+    model->ClearNodeEntriesByDateKey(firstDate);
+    succeeded &= Expect(!model->TryGetTaskDate(firstTasks.back().TaskId, movedTaskDate),
+        "a cleared date no longer resolves its tasks");
+
+    model->InsertChildNodes(firstDate, firstTasks);
+    succeeded &= Expect(model->TryGetTaskDate(firstTasks.back().TaskId, movedTaskDate) &&
+                            movedTaskDate == firstDate,
+        "inserted tasks resolve to their date again");
+
+    model->ClearAll();
+    succeeded &= Expect(model->TryExpandAllDateNodes(dates).IsEmpty(),
+        "ClearAll drops every root node");
+    succeeded &= Expect(!model->TryGetTaskDate(lastTasks.back().TaskId, movedTaskDate),
+        "ClearAll drops every task");
+
+    return succeeded;
+}
+
+bool CheckValues(std::shared_ptr<tks::Core::Configuration> cfg,
+    std::shared_ptr<spdlog::logger> logger,
+    TasksGroupedByWorkday tasksGroupedByWorkday)
+{
+    auto model = BuildModel(cfg, logger, tasksGroupedByWorkday);
+    auto items = CollectTaskItems(*model);
+
+    std::vector<LegacyTaskNode> legacyNodes;
+    for (auto& [date, tasks] : tasksGroupedByWorkday) {
+        for (auto& task : tasks) {
+            legacyNodes.emplace_back(task);
+        }
+    }
+
+    if (!Expect(items.GetCount() == legacyNodes.size(), "every task has a row")) {
+        return false;
+    }
+
+    for (std::size_t i = 0; i < items.GetCount(); i++) {
+        for (unsigned int col = 0; col < TaskTreeModel::Col_Max; col++) {
+            if (!IsTextColumn(col)) {
+                continue;
+            }
+
+            wxVariant value;
+            wxVariant legacyValue;
+            model->GetValue(value, items.Item(i), col);
+            GetLegacyValue(legacyValue, legacyNodes[i], col);
+            if (value.GetString() != legacyValue.GetString()) {
+                return Expect(false, "every cell renders the text the previous node rendered");
+            }
+        }
+    }
+
+    return true;
+}
+
+bool CheckLazyDateNodes(std::shared_ptr<tks::Core::Configuration> cfg,
+    std::shared_ptr<spdlog::logger> logger,
+    TasksGroupedByWorkday tasksGroupedByWorkday)
+{
+    wxObjectDataPtr<TaskTreeModel> model(new TaskTreeModel({}, cfg, logger));
+
+    std::vector<std::string> dates;
+    std::map<std::string, std::int64_t> taskCounts;
+    for (const auto& [date, tasks] : tasksGroupedByWorkday) {
+        dates.push_back(date);
+        taskCounts[date] = static_cast<std::int64_t>(tasks.size());
+    }
+    model->InsertLazyRootNodes(dates, taskCounts);
+
+    if (!Expect(dates.size() > TaskTreeModel::MaxLoadedDateNodes + 1,
+            "the range is wider than the loaded window")) {
+        return false;
+    }
+
+    bool succeeded = Expect(!model->FindDateNode("1999-01-01").IsOk(),
+        "FindDateNode misses a date outside the range");
+
+    const std::string& firstDate = dates.front();
+    const auto& firstTasks = tasksGroupedByWorkday.at(firstDate);
+    auto firstItem = model->FindDateNode(firstDate);
+    succeeded &= Expect(model->RequiresChildNodes(firstItem), "a lazy date node loads on expand");
+
+    model->LoadChildNodes(firstItem, firstTasks);
+    succeeded &= Expect(!model->RequiresChildNodes(firstItem) &&
+                            CountChildren(*model, firstDate) == firstTasks.size(),
+        "a loaded date node holds its tasks");
+
+    // a cleared node leaves the loaded window, so filling the window evicts nothing
+    model->ClearNodeEntriesByDateKey(firstDate);
+    succeeded &= Expect(model->RequiresChildNodes(firstItem),
+        "a cleared lazy date node loads again on expand");
+
+    std::size_t evicted = 0;
+    for (std::size_t i = 1; i <= TaskTreeModel::MaxLoadedDateNodes; i++) {
+        const std::string& date = dates[i];
+        evicted +=
+            model->LoadChildNodes(model->FindDateNode(date), tasksGroupedByWorkday.at(date))
+                .GetCount();
+    }
+    succeeded &= Expect(evicted == 0, "a cleared date node no longer takes a loaded slot");
+
+    model->LoadChildNodes(firstItem, firstTasks);
+    succeeded &= Expect(CountChildren(*model, dates[1]) == 0 &&
+                            CountChildren(*model, firstDate) == firstTasks.size(),
+        "loading past the window evicts the least recently loaded date node");
+
+    return succeeded;
+}
+
+void MeasureIndexes(std::shared_ptr<tks::Core::Configuration> cfg,
+    std::shared_ptr<spdlog::logger> logger,
+    TasksGroupedByWorkday tasksGroupedByWorkday,
+    int rounds)
+{
+    auto model = BuildModel(cfg, logger, tasksGroupedByWorkday);
+
+    std::vector<std::string> dates;
+    std::vector<std::pair<std::string, std::int64_t>> taskKeys;
+    for (const auto& [date, tasks] : tasksGroupedByWorkday) {
+        dates.push_back(date);
+        for (const auto& task : tasks) {
+            taskKeys.emplace_back(date, task.TaskId);
+        }
+    }
+
+    std::int64_t found = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int round = 0; round < rounds; round++) {
+        for (const auto& [date, taskId] : taskKeys) {
+            found += FindChildNodeByScan(*model, date, taskId) != nullptr;
+        }
+    }
+    tks::Benchmarks::Report("task lookup, scan", found, SecondsSince(start));
+
+    found = 0;
+    start = std::chrono::steady_clock::now();
+    for (int round = 0; round < rounds; round++) {
+        std::string date;
+        for (const auto& taskKey : taskKeys) {
+            found += model->TryGetTaskDate(taskKey.second, date);
+        }
+    }
+    tks::Benchmarks::Report("task lookup, TryGetTaskDate", found, SecondsSince(start));
+
+    // edit notifications land on tasks spread over the whole range
+    const std::size_t stride = taskKeys.size() / 500 + 1;
+    std::vector<double> changeSeconds;
+    std::vector<double> moveSeconds;
+    std::vector<double> expandSeconds;
+    for (int round = 0; round < rounds; round++) {
+        for (std::size_t i = 0; i < taskKeys.size(); i += stride) {
+            const auto& [date, taskId] = taskKeys[i];
+            const auto& tasks = tasksGroupedByWorkday.at(date);
+            auto task = tasks.front();
+            for (const auto& candidate : tasks) {
+                if (candidate.TaskId == taskId) {
+                    task = candidate;
+                    break;
+                }
+            }
+
+            auto changeStart = std::chrono::steady_clock::now();
+            model->ApplyTaskChanged(task);
+            changeSeconds.push_back(SecondsSince(changeStart));
+
+            // move the task to the last date and back again
+            auto movedTask = task;
+            movedTask.WorkdayId = tasksGroupedByWorkday.at(dates.back()).front().WorkdayId;
+            auto moveStart = std::chrono::steady_clock::now();
+            model->ApplyTaskChanged(movedTask);
+            model->ApplyTaskChanged(task);
+            moveSeconds.push_back(SecondsSince(moveStart) / 2);
+        }
+
+        auto expandStart = std::chrono::steady_clock::now();
+        model->TryExpandAllDateNodes(dates);
+        expandSeconds.push_back(SecondsSince(expandStart));
+    }
+
+    tks::Benchmarks::ReportLatency("ApplyTaskChanged, same date", changeSeconds);
+    tks::Benchmarks::ReportLatency("ApplyTaskChanged, moved date", moveSeconds);
+    tks::Benchmarks::ReportLatency("TryExpandAllDateNodes, all dates", expandSeconds);
+}
+
+void MeasureGetValueSweeps(std::shared_ptr<tks::Core::Configuration> cfg,
+    std::shared_ptr<spdlog::logger> logger,
+    TasksGroupedByWorkday tasksGroupedByWorkday,
+    int sweeps)
+{
+    auto model = BuildModel(cfg, logger, tasksGroupedByWorkday);
+    auto items = CollectTaskItems(*model);
+
+    std::vector<LegacyTaskNode> legacyNodes;
+    for (auto& [date, tasks] : tasksGroupedByWorkday) {
+        for (auto& task : tasks) {
+            legacyNodes.emplace_back(task);
+        }
+    }
+
+    const std::int64_t cells = static_cast<std::int64_t>(items.GetCount()) *
+                               TaskTreeModel::Col_Max * sweeps;
+
+    // the variant is reused across cells like the renderers of wxDataViewCtrl reuse theirs
+    wxVariant variant;
+    auto start = std::chrono::steady_clock::now();
+    for (int sweep = 0; sweep < sweeps; sweep++) {
+        for (const auto& legacyNode : legacyNodes) {
+            for (unsigned int col = 0; col < TaskTreeModel::Col_Max; col++) {
+                GetLegacyValue(variant, legacyNode, col);
+            }
+        }
+    }
+    tks::Benchmarks::Report("GetValue sweep, std::string by value", cells, SecondsSince(start));
+
+    start = std::chrono::steady_clock::now();
+    for (int sweep = 0; sweep < sweeps; sweep++) {
+        for (std::size_t i = 0; i < items.GetCount(); i++) {
+            for (unsigned int col = 0; col < TaskTreeModel::Col_Max; col++) {
+                model->GetValue(variant, items.Item(i), col);
+            }
+        }
+    }
+    tks::Benchmarks::Report("GetValue sweep, prepared wxString", cells, SecondsSince(start));
+}
+} // namespace
+
+int main(int argc, char** argv)
+{
+    using namespace tks;
+
+    const bool checkOnly = argc > 1 && std::strcmp(argv[1], "check") == 0;
+    const int days = !checkOnly && argc > 1 ? std::atoi(argv[1]) : 365;
+    const int tasksPerDay = !checkOnly && argc > 2 ? std::atoi(argv[2]) : 28;
+    const int rounds = !checkOnly && argc > 3 ? std::atoi(argv[3]) : 5;
+
+    wxInitializer initializer;
+    if (!initializer.IsOk()) {
+        return EXIT_FAILURE;
+    }
+
+    auto logger = spdlog::stdout_color_mt("benchmark");
+    logger->set_level(spdlog::level::warn);
+
+    Benchmarks::BenchmarkDatabase database(logger, "taskies-task-tree-model-benchmark");
+    if (!database.IsOpen() || !database.SeedTasks("2026-01-01", days, tasksPerDay)) {
+        return EXIT_FAILURE;
+    }
+
+    TasksGroupedByWorkday tasksGroupedByWorkday;
+    if (!LoadTasks(database.mFilePath, logger, "2026-01-01", days, tasksGroupedByWorkday)) {
+        std::fprintf(stderr, "Failed to filter tasks by date range\n");
+        return EXIT_FAILURE;
+    }
+
+    // the configuration is only read for the project name column, nothing is loaded from disk
+    auto cfg = std::make_shared<Core::Configuration>(nullptr, logger);
+    cfg->UseProjectDisplayName(false);
+
+    if (!CheckIndexes(cfg, logger, tasksGroupedByWorkday) ||
+        !CheckLazyDateNodes(cfg, logger, tasksGroupedByWorkday) ||
+        !CheckValues(cfg, logger, tasksGroupedByWorkday)) {
+        return EXIT_FAILURE;
+    }
+
+    if (!checkOnly) {
+        MeasureIndexes(cfg, logger, tasksGroupedByWorkday, rounds);
+        MeasureGetValueSweeps(cfg, logger, tasksGroupedByWorkday, rounds * 10);
+    }
+
+    return EXIT_SUCCESS;
+}
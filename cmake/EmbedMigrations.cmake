@@ -0,0 +1,61 @@
+# Generates a header containing a constexpr table of the SQL migration scripts
+# so that migrations can be run without resource lookups or copying
+#
+# Usage:
+#     cmake -DMIGRATIONS_DIR=<dir> -DOUTPUT_FILE=<file> -P EmbedMigrations.cmake
+
+if(NOT DEFINED MIGRATIONS_DIR OR NOT DEFINED OUTPUT_FILE)
+    message(FATAL_ERROR "MIGRATIONS_DIR and OUTPUT_FILE must be defined")
+endif()
+
+file(GLOB MIGRATION_FILES "${MIGRATIONS_DIR}/*.sql")
+
+# migration file names are prefixed with a timestamp so sorting gives the execution order
+list(SORT MIGRATION_FILES)
+list(LENGTH MIGRATION_FILES MIGRATION_COUNT)
+
+set(MIGRATION_ENTRIES "")
+foreach(MIGRATION_FILE IN LISTS MIGRATION_FILES)
+    get_filename_component(MIGRATION_NAME "${MIGRATION_FILE}" NAME_WE)
+    # migration_history holds the upper case names Windows gave the migrations when they were
+    # resources, keep recording new migrations the same way
+    string(TOUPPER "${MIGRATION_NAME}" MIGRATION_NAME)
+    file(READ "${MIGRATION_FILE}" MIGRATION_SQL)
+
+    string(APPEND MIGRATION_ENTRIES
+        "    Migration{ \"${MIGRATION_NAME}\",\n"
+        "        R\"tksmigration(${MIGRATION_SQL})tksmigration\" },\n"
+    )
+endforeach()
+
+set(CONTENT
+"// Generated by cmake/EmbedMigrations.cmake from res/migrations. Do not edit.
+
+#pragma once
+
+#include <array>
+#include <string_view>
+
+namespace tks::Core
+{
+struct Migration {
+    std::string_view name;
+    std::string_view sql;
+};
+
+// clang-format off
+inline constexpr std::array<Migration, ${MIGRATION_COUNT}> EmbeddedMigrations = {
+${MIGRATION_ENTRIES}};
+// clang-format on
+} // namespace tks::Core
+")
+
+# only touch the output when a migration changed so dependents are not needlessly rebuilt
+set(EXISTING_CONTENT "")
+if(EXISTS "${OUTPUT_FILE}")
+    file(READ "${OUTPUT_FILE}" EXISTING_CONTENT)
+endif()
+
+if(NOT EXISTING_CONTENT STREQUAL CONTENT)
+    file(WRITE "${OUTPUT_FILE}" "${CONTENT}")
+endif()
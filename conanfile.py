@@ -1,11 +1,10 @@
-# This file is managed by the Conan Visual Studio Extension, contents will be overwritten.
-# To keep your changes, remove these comment lines, but the plugin won't be able to modify your requirements
-
 from conan import ConanFile
 from conan.tools.microsoft import vs_layout, MSBuildDeps
 class ConanApplication(ConanFile):
     package_type = "application"
     settings = "os", "compiler", "build_type", "arch"
+    # task search (tasks_fts migration) needs SQLite built with FTS5
+    default_options = {"sqlite3/*:enable_fts5": True}
 
     def layout(self):
         vs_layout(self)
@@ -0,0 +1,14 @@
+ALTER TABLE workdays ADD COLUMN day_number INTEGER NULL;
+
+UPDATE workdays SET day_number = CAST(strftime('%s', date) AS INTEGER) / 86400;
+
+CREATE UNIQUE INDEX IF NOT EXISTS idx_workdays_day_number ON workdays(day_number);
+
+CREATE TRIGGER IF NOT EXISTS trg_workdays_day_number
+AFTER INSERT ON workdays
+FOR EACH ROW WHEN NEW.day_number IS NULL
+BEGIN
+    UPDATE workdays
+    SET day_number = CAST(strftime('%s', NEW.date) AS INTEGER) / 86400
+    WHERE workday_id = NEW.workday_id;
+END;
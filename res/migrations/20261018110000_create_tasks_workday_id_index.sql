@@ -0,0 +1 @@
+CREATE INDEX IF NOT EXISTS idx_tasks_workday_id_task_id ON tasks(workday_id, task_id);
@@ -0,0 +1,34 @@
+CREATE VIRTUAL TABLE IF NOT EXISTS tasks_fts USING fts5
+(
+    description,
+    unique_identifier,
+    content='tasks',
+    content_rowid='task_id',
+    prefix='2 3',
+    tokenize='unicode61 remove_diacritics 2'
+);
+
+INSERT INTO tasks_fts(tasks_fts) VALUES('rebuild');
+
+CREATE TRIGGER IF NOT EXISTS trg_tasks_fts_insert
+AFTER INSERT ON tasks
+BEGIN
+    INSERT INTO tasks_fts(rowid, description, unique_identifier)
+    VALUES (NEW.task_id, NEW.description, NEW.unique_identifier);
+END;
+
+CREATE TRIGGER IF NOT EXISTS trg_tasks_fts_delete
+AFTER DELETE ON tasks
+BEGIN
+    INSERT INTO tasks_fts(tasks_fts, rowid, description, unique_identifier)
+    VALUES ('delete', OLD.task_id, OLD.description, OLD.unique_identifier);
+END;
+
+CREATE TRIGGER IF NOT EXISTS trg_tasks_fts_update
+AFTER UPDATE OF description, unique_identifier ON tasks
+BEGIN
+    INSERT INTO tasks_fts(tasks_fts, rowid, description, unique_identifier)
+    VALUES ('delete', OLD.task_id, OLD.description, OLD.unique_identifier);
+    INSERT INTO tasks_fts(rowid, description, unique_identifier)
+    VALUES (NEW.task_id, NEW.description, NEW.unique_identifier);
+END;
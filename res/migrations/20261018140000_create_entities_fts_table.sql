@@ -0,0 +1,152 @@
+-- one row per entity, keyed by rowid = entity id * 8 + entity type:
+-- 1 employers, 2 clients, 3 projects, 4 categories, 5 attribute groups, 6 attributes
+CREATE VIRTUAL TABLE IF NOT EXISTS entities_fts USING fts5
+(
+    name,
+    description,
+    tokenize='trigram'
+);
+
+INSERT INTO entities_fts(rowid, name, description)
+    SELECT employer_id * 8 + 1, name, description FROM employers;
+
+INSERT INTO entities_fts(rowid, name, description)
+    SELECT client_id * 8 + 2, name, description FROM clients;
+
+INSERT INTO entities_fts(rowid, name, description)
+    SELECT project_id * 8 + 3, name, description FROM projects;
+
+INSERT INTO entities_fts(rowid, name, description)
+    SELECT category_id * 8 + 4, name, description FROM categories;
+
+INSERT INTO entities_fts(rowid, name, description)
+    SELECT attribute_group_id * 8 + 5, name, description FROM attribute_groups;
+
+INSERT INTO entities_fts(rowid, name, description)
+    SELECT attribute_id * 8 + 6, name, description FROM attributes;
+
+CREATE TRIGGER IF NOT EXISTS trg_employers_entities_fts_insert
+AFTER INSERT ON employers
+BEGIN
+    INSERT INTO entities_fts(rowid, name, description)
+    VALUES (NEW.employer_id * 8 + 1, NEW.name, NEW.description);
+END;
+
+CREATE TRIGGER IF NOT EXISTS trg_employers_entities_fts_update
+AFTER UPDATE OF name, description ON employers
+BEGIN
+    UPDATE entities_fts
+    SET name = NEW.name, description = NEW.description
+    WHERE rowid = OLD.employer_id * 8 + 1;
+END;
+
+CREATE TRIGGER IF NOT EXISTS trg_employers_entities_fts_delete
+AFTER DELETE ON employers
+BEGIN
+    DELETE FROM entities_fts WHERE rowid = OLD.employer_id * 8 + 1;
+END;
+
+CREATE TRIGGER IF NOT EXISTS trg_clients_entities_fts_insert
+AFTER INSERT ON clients
+BEGIN
+    INSERT INTO entities_fts(rowid, name, description)
+    VALUES (NEW.client_id * 8 + 2, NEW.name, NEW.description);
+END;
+
+CREATE TRIGGER IF NOT EXISTS trg_clients_entities_fts_update
+AFTER UPDATE OF name, description ON clients
+BEGIN
+    UPDATE entities_fts
+    SET name = NEW.name, description = NEW.description
+    WHERE rowid = OLD.client_id * 8 + 2;
+END;
+
+CREATE TRIGGER IF NOT EXISTS trg_clients_entities_fts_delete
+AFTER DELETE ON clients
+BEGIN
+    DELETE FROM entities_fts WHERE rowid = OLD.client_id * 8 + 2;
+END;
+
+CREATE TRIGGER IF NOT EXISTS trg_projects_entities_fts_insert
+AFTER INSERT ON projects
+BEGIN
+    INSERT INTO entities_fts(rowid, name, description)
+    VALUES (NEW.project_id * 8 + 3, NEW.name, NEW.description);
+END;
+
+CREATE TRIGGER IF NOT EXISTS trg_projects_entities_fts_update
+AFTER UPDATE OF name, description ON projects
+BEGIN
+    UPDATE entities_fts
+    SET name = NEW.name, description = NEW.description
+    WHERE rowid = OLD.project_id * 8 + 3;
+END;
+
+CREATE TRIGGER IF NOT EXISTS trg_projects_entities_fts_delete
+AFTER DELETE ON projects
+BEGIN
+    DELETE FROM entities_fts WHERE rowid = OLD.project_id * 8 + 3;
+END;
+
+CREATE TRIGGER IF NOT EXISTS trg_categories_entities_fts_insert
+AFTER INSERT ON categories
+BEGIN
+    INSERT INTO entities_fts(rowid, name, description)
+    VALUES (NEW.category_id * 8 + 4, NEW.name, NEW.description);
+END;
+
+CREATE TRIGGER IF NOT EXISTS trg_categories_entities_fts_update
+AFTER UPDATE OF name, description ON categories
+BEGIN
+    UPDATE entities_fts
+    SET name = NEW.name, description = NEW.description
+    WHERE rowid = OLD.category_id * 8 + 4;
+END;
+
+CREATE TRIGGER IF NOT EXISTS trg_categories_entities_fts_delete
+AFTER DELETE ON categories
+BEGIN
+    DELETE FROM entities_fts WHERE rowid = OLD.category_id * 8 + 4;
+END;
+
+CREATE TRIGGER IF NOT EXISTS trg_attribute_groups_entities_fts_insert
+AFTER INSERT ON attribute_groups
+BEGIN
+    INSERT INTO entities_fts(rowid, name, description)
+    VALUES (NEW.attribute_group_id * 8 + 5, NEW.name, NEW.description);
+END;
+
+CREATE TRIGGER IF NOT EXISTS trg_attribute_groups_entities_fts_update
+AFTER UPDATE OF name, description ON attribute_groups
+BEGIN
+    UPDATE entities_fts
+    SET name = NEW.name, description = NEW.description
+    WHERE rowid = OLD.attribute_group_id * 8 + 5;
+END;
+
+CREATE TRIGGER IF NOT EXISTS trg_attribute_groups_entities_fts_delete
+AFTER DELETE ON attribute_groups
+BEGIN
+    DELETE FROM entities_fts WHERE rowid = OLD.attribute_group_id * 8 + 5;
+END;
+
+CREATE TRIGGER IF NOT EXISTS trg_attributes_entities_fts_insert
+AFTER INSERT ON attributes
+BEGIN
+    INSERT INTO entities_fts(rowid, name, description)
+    VALUES (NEW.attribute_id * 8 + 6, NEW.name, NEW.description);
+END;
+
+CREATE TRIGGER IF NOT EXISTS trg_attributes_entities_fts_update
+AFTER UPDATE OF name, description ON attributes
+BEGIN
+    UPDATE entities_fts
+    SET name = NEW.name, description = NEW.description
+    WHERE rowid = OLD.attribute_id * 8 + 6;
+END;
+
+CREATE TRIGGER IF NOT EXISTS trg_attributes_entities_fts_delete
+AFTER DELETE ON attributes
+BEGIN
+    DELETE FROM entities_fts WHERE rowid = OLD.attribute_id * 8 + 6;
+END;
@@ -0,0 +1 @@
+CREATE INDEX IF NOT EXISTS idx_attended_meetings_entry_id ON attended_meetings(entry_id);
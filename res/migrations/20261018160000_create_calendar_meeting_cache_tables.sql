@@ -0,0 +1,29 @@
+CREATE TABLE IF NOT EXISTS calendar_sync_states
+(
+    calendar_sync_state_id INTEGER PRIMARY KEY NOT NULL,
+
+    provider TEXT NOT NULL,
+    account_name TEXT NOT NULL,
+    date TEXT NOT NULL,
+    sync_token TEXT NOT NULL,
+    date_synced INTEGER NOT NULL DEFAULT (strftime('%s','now')),
+
+    UNIQUE (provider, account_name, date)
+);
+
+CREATE TABLE IF NOT EXISTS calendar_meetings
+(
+    calendar_meeting_id INTEGER PRIMARY KEY NOT NULL,
+
+    calendar_sync_state_id INTEGER NOT NULL,
+    entry_id TEXT NOT NULL,
+    subject TEXT NOT NULL,
+    start TEXT NOT NULL,
+    end TEXT NOT NULL,
+    duration INTEGER NOT NULL,
+    location TEXT NOT NULL,
+
+    UNIQUE (calendar_sync_state_id, entry_id),
+    FOREIGN KEY (calendar_sync_state_id)
+        REFERENCES calendar_sync_states (calendar_sync_state_id) ON DELETE CASCADE
+);
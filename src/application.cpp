@@ -20,12 +20,14 @@
 #include "application.h"
 
 #include <filesystem>
+#include <mutex>
 
 #include <wx/ipc.h>
 #include <wx/richmsgdlg.h>
 #include <wx/taskbarbutton.h>
 
 #include <spdlog/spdlog.h>
+#include <spdlog/async.h>
 #include <spdlog/sinks/dist_sink.h>
 #include <spdlog/sinks/daily_file_sink.h>
 #include <spdlog/sinks/msvc_sink.h>
@@ -38,6 +40,9 @@
 #include "core/environment.h"
 #include "core/configuration.h"
 #include "core/database_migration.h"
+#include "core/startup_profiler.h"
+
+#include "persistence/base/queryprofiler.h"
 // #include "core/translator.h"
 
 #include "ui/wizards/setupwizard.h"
@@ -47,6 +52,16 @@
 
 #define LOGGER_NAME "TaskiesLogger"
 
+// environment variables read to configure the startup report
+#define STARTUP_REPORT_FILE_ENV "TASKIES_STARTUP_REPORT"
+#define STARTUP_THRESHOLD_ENV "TASKIES_STARTUP_THRESHOLD_MS"
+
+// environment variable read to opt in to asynchronous logging ("async")
+#define LOG_MODE_ENV "TASKIES_LOG_MODE"
+
+// environment variable read to enable query profiling with a slow query threshold
+#define SLOW_QUERY_THRESHOLD_ENV "TASKIES_SLOW_QUERY_MS"
+
 namespace tks
 {
 Application::Application()
@@ -69,16 +84,29 @@ bool Application::OnInit()
         return false;
     }
 
-    pEnv = std::make_shared<Core::Environment>();
+    auto& startupProfiler = Core::StartupProfiler::GetInstance();
+
+    {
+        Core::StartupProfiler::ScopedPhase phase("Environment");
+        pEnv = std::make_shared<Core::Environment>();
+    }
+
+    {
+        Core::StartupProfiler::ScopedPhase phase("Logger");
+        InitializeLogger();
+    }
 
-    InitializeLogger();
+    InitializeQueryProfiler();
 
     auto env = pEnv->GetBuildConfiguration();
     SPDLOG_LOGGER_TRACE(pLogger, "Running in \"{0}\" environment", BuildConfigurationToString(env));
 
-    pCfg = std::make_shared<Core::Configuration>(pEnv, pLogger);
-    if (!InitializeConfiguration()) {
-        return false;
+    {
+        Core::StartupProfiler::ScopedPhase phase("Configuration");
+        pCfg = std::make_shared<Core::Configuration>(pEnv, pLogger);
+        if (!InitializeConfiguration()) {
+            return false;
+        }
     }
 
     if (pCfg->GetDatabasePath().empty() || pCfg->GetDatabaseFileName().empty()) {
@@ -96,8 +124,11 @@ bool Application::OnInit()
         std::make_unique<UI::PersistenceManager>(pLogger, pCfg->BuildFullDatabaseFilePath());
     wxPersistenceManager::Set(*pPersistenceManager);
 
-    if (!RunMigrations()) {
-        return false;
+    {
+        Core::StartupProfiler::ScopedPhase phase("Migrations");
+        if (!RunMigrations()) {
+            return false;
+        }
     }
 
     /*if (!InitializeTranslations()) {
@@ -111,8 +142,14 @@ bool Application::OnInit()
     SPDLOG_LOGGER_TRACE(pLogger,
         "Initializing main frame with (WindowState) = \"({0})\"",
         WindowStateToString(pCfg->GetWindowState()));
-    auto frame = new UI::MainFrame(pEnv, pCfg, pLogger);
-    SetTopWindow(frame);
+    UI::MainFrame* frame = nullptr;
+    {
+        Core::StartupProfiler::ScopedPhase phase("MainFrame");
+        frame = new UI::MainFrame(pEnv, pCfg, pLogger);
+        SetTopWindow(frame);
+    }
+
+    auto showPhaseStart = Core::StartupProfiler::Clock::now();
 
     auto windowState = pCfg->GetWindowState();
     switch (windowState) {
@@ -139,6 +176,10 @@ bool Application::OnInit()
         break;
     }
 
+    startupProfiler.Record("MainFrame::Show", showPhaseStart, Core::StartupProfiler::Clock::now());
+    startupProfiler.Finish();
+    ReportStartup();
+
     if (!pEnv->IsSetup()) {
         SPDLOG_LOGGER_TRACE(pLogger, "Program not yet set up, start first start up procedure");
         if (!FirstStartupProcedure(frame)) {
@@ -151,11 +192,17 @@ bool Application::OnInit()
 
 int Application::OnExit()
 {
+    Persistence::QueryProfiler::GetInstance().LogSummary();
+
+    SPDLOG_LOGGER_TRACE(pLogger, "Exiting program... Goodbye.");
+
+    // flush any queued (async) messages before the worker thread is torn down
+    pLogger->flush();
 #ifdef TKS_DEBUG
     // Under VisualStudio, this must be called before main finishes to workaround a known VS issue
     spdlog::drop_all();
 #endif // TKS_DEBUG
-    SPDLOG_LOGGER_TRACE(pLogger, "Exiting program... Goodbye.");
+    spdlog::shutdown();
 
     return wxApp::OnExit();
 }
@@ -163,35 +210,104 @@ int Application::OnExit()
 void Application::InitializeLogger()
 {
     auto logDirectory = pEnv->GetLogFilePath().string();
+    bool asyncLogging = UseAsyncLogging();
+
+    // an async logger writes to its sinks from its one worker thread only, a synchronous
+    // logger writes from whichever thread logs so its sinks take a mutex
+    auto sinks = asyncLogging ? CreateSinks<spdlog::details::null_mutex>(logDirectory)
+                              : CreateSinks<std::mutex>(logDirectory);
 
+    pLogger = CreateLogger(sinks, asyncLogging);
 #ifdef TKS_DEBUG
-    auto msvcSink = std::make_shared<spdlog::sinks::msvc_sink_st>();
-    msvcSink->set_level(spdlog::level::trace);
-    msvcSink->set_pattern("*** [%Y-%m-%d %H:%M:%S.%e] [%l] [%!:%#] %v");
+    pLogger->set_level(spdlog::level::trace);
+#else
+    pLogger->set_level(spdlog::level::warn);
+    pLogger->set_pattern("[%Y-%m-%d %H:%M:%S.%e] [%l] %v");
+#endif // TKS_DEBUG
 
-    auto dailyFileSink =
-        std::make_shared<spdlog::sinks::daily_file_sink_st>(logDirectory, 5, 0, false, 5);
+    // make sure errors reach the log file even if the program terminates right after
+    pLogger->flush_on(spdlog::level::err);
+
+    SPDLOG_LOGGER_TRACE(pLogger, "{0} has been initialized", LOGGER_NAME);
+}
+
+template<typename TMutex>
+std::vector<spdlog::sink_ptr> Application::CreateSinks(const std::string& logDirectory)
+{
+    auto dailyFileSink = std::make_shared<spdlog::sinks::daily_file_sink<TMutex>>(
+        logDirectory, 5, 0, false, 5);
     dailyFileSink->set_pattern("[%Y-%m-%d %H:%M:%S.%e] [%l] %v");
     dailyFileSink->set_level(spdlog::level::warn);
 
-    std::vector<spdlog::sink_ptr> sinks{ msvcSink, dailyFileSink };
+#ifdef TKS_DEBUG
+    auto msvcSink = std::make_shared<spdlog::sinks::msvc_sink<TMutex>>();
+    msvcSink->set_level(spdlog::level::trace);
+    msvcSink->set_pattern("*** [%Y-%m-%d %H:%M:%S.%e] [%l] [%!:%#] %v");
 
-    pLogger = std::make_shared<spdlog::logger>(LOGGER_NAME, sinks.begin(), sinks.end());
-    pLogger->set_level(spdlog::level::trace);
+    return { msvcSink, dailyFileSink };
 #else
-    auto dailyFileSink =
-        std::make_shared<spdlog::sinks::daily_file_sink_st>(logDirectory, 5, 0, false, 5);
-    dailyFileSink->set_level(spdlog::level::warn);
-    dailyFileSink->set_pattern("[%Y-%m-%d %H:%M:%S.%e] [%l] %v");
+    return { dailyFileSink };
+#endif // TKS_DEBUG
+}
+
+std::shared_ptr<spdlog::logger> Application::CreateLogger(std::vector<spdlog::sink_ptr>& sinks,
+    bool asyncLogging)
+{
+    if (!asyncLogging) {
+        return std::make_shared<spdlog::logger>(LOGGER_NAME, sinks.begin(), sinks.end());
+    }
 
-    std::vector<spdlog::sink_ptr> sinks{ dailyFileSink };
+    // a single worker thread drains the bounded queue so the null_mutex sinks are only
+    // ever written to from that thread. When the queue is full the oldest messages
+    // are dropped so that logging never blocks the UI thread
+    spdlog::init_thread_pool(AsyncLogQueueSize, 1);
 
-    pLogger = std::make_shared<spdlog::logger>(LOGGER_NAME, sinks.begin(), sinks.end());
-    pLogger->set_level(spdlog::level::warn);
-    pLogger->set_pattern("[%Y-%m-%d %H:%M:%S.%e] [%l] %v");
+    auto logger = std::make_shared<spdlog::async_logger>(LOGGER_NAME,
+        sinks.begin(),
+        sinks.end(),
+        spdlog::thread_pool(),
+        spdlog::async_overflow_policy::overrun_oldest);
+
+    // the thread pool is owned by the spdlog registry so register the logger with it
+    // so that spdlog::shutdown() flushes and joins the worker on exit
+    spdlog::register_logger(logger);
+
+    return logger;
+}
+
+bool Application::UseAsyncLogging() const
+{
+    wxString logMode;
+    if (wxGetEnv(LOG_MODE_ENV, &logMode) && logMode.IsSameAs("async", false)) {
+        return true;
+    }
+
+    // a week refresh has the same median latency with either logger (see LoggingBenchmark), so
+    // the worker thread is only started on request
+    return false;
+}
+
+void Application::InitializeQueryProfiler()
+{
+    long slowQueryThresholdMilliseconds = -1;
+
+    wxString slowQueryThresholdValue;
+    if (wxGetEnv(SLOW_QUERY_THRESHOLD_ENV, &slowQueryThresholdValue)) {
+        slowQueryThresholdValue.ToLong(&slowQueryThresholdMilliseconds);
+    }
+
+#ifdef TKS_DEBUG
+    if (slowQueryThresholdMilliseconds < 0) {
+        slowQueryThresholdMilliseconds = DefaultSlowQueryThresholdMilliseconds;
+    }
 #endif // TKS_DEBUG
 
-    SPDLOG_LOGGER_TRACE(pLogger, "{0} has been initialized", LOGGER_NAME);
+    if (slowQueryThresholdMilliseconds < 0) {
+        return;
+    }
+
+    Persistence::QueryProfiler::GetInstance().Enable(
+        pLogger, std::chrono::milliseconds(slowQueryThresholdMilliseconds));
 }
 
 bool Application::InitializeConfiguration()
@@ -266,6 +382,30 @@ bool Application::RunMigrations()
     return true;
 }
 
+void Application::ReportStartup()
+{
+    auto& startupProfiler = Core::StartupProfiler::GetInstance();
+
+    std::chrono::milliseconds threshold(DefaultStartupThresholdMilliseconds);
+
+    wxString thresholdValue;
+    long thresholdMilliseconds = 0;
+    if (wxGetEnv(STARTUP_THRESHOLD_ENV, &thresholdValue) &&
+        thresholdValue.ToLong(&thresholdMilliseconds)) {
+        threshold = std::chrono::milliseconds(thresholdMilliseconds);
+    }
+
+    startupProfiler.Report(pLogger, threshold);
+
+    wxString reportFilePath;
+    if (wxGetEnv(STARTUP_REPORT_FILE_ENV, &reportFilePath) && !reportFilePath.empty()) {
+        if (!startupProfiler.WriteReport(reportFilePath.ToStdString(), threshold)) {
+            pLogger->error("Failed to write startup report to \"{0}\"",
+                reportFilePath.ToStdString());
+        }
+    }
+}
+
 // bool Application::InitializeTranslations()
 // {
 //     return UI::Translator::GetInstance().Load(
@@ -20,6 +20,8 @@
 #pragma once
 
 #include <memory>
+#include <string>
+#include <vector>
 
 #include <wx/wxprec.h>
 #ifndef WX_PRECOMP
@@ -53,8 +55,15 @@ class Application : public wxApp
 
 private:
     void InitializeLogger();
+    template<typename TMutex>
+    std::vector<spdlog::sink_ptr> CreateSinks(const std::string& logDirectory);
+    std::shared_ptr<spdlog::logger> CreateLogger(std::vector<spdlog::sink_ptr>& sinks,
+        bool asyncLogging);
+    bool UseAsyncLogging() const;
+    void InitializeQueryProfiler();
     bool InitializeConfiguration();
     bool RunMigrations();
+    void ReportStartup();
     // bool InitializeTranslations();
 
     bool FirstStartupProcedure(wxFrame* frame);
@@ -67,5 +76,9 @@ class Application : public wxApp
     std::shared_ptr<Core::Environment> pEnv;
     std::shared_ptr<Core::Configuration> pCfg;
     std::shared_ptr<UI::PersistenceManager> pPersistenceManager;
+
+    static constexpr int DefaultStartupThresholdMilliseconds = 2000;
+    static constexpr std::size_t AsyncLogQueueSize = 8192;
+    static constexpr int DefaultSlowQueryThresholdMilliseconds = 50;
 };
 } // namespace tks
@@ -150,6 +150,8 @@ const std::string GetWorkdayIdByDateMessage =
 #pragma region AttendedMeetings
 const std::string FilterAttendedMeetingsByTodayDateMessage =
     "Something went wrong while trying get todays attended meetings";
+const std::string FilterAttendedMeetingsByEntryIdsMessage =
+    "Something went wrong while trying get the attended meetings";
 const std::string CreateAttendedMeetingMessage =
     "Something went wrong while trying get save an attended meeting";
 const std::string DeleteAttendedMeetingMessage =
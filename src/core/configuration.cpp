@@ -228,6 +228,7 @@ ConfigResult Configuration::Save()
     root.at(Sections::TaskSection)["reminderInterval"] = mSettings.ReminderInterval;
     root.at(Sections::TaskSection)["openTaskDialogOnOutlookMeetingAttendanceCheck"] =
         mSettings.OpenTaskDialogOnOutlookMeetingAttendanceCheck;
+    root.at(Sections::TaskSection)["calendarIcsFilePath"] = mSettings.CalendarIcsFilePath;
 
     // Tasks View section
     root.at(Sections::TasksViewSection).as_table_fmt().fmt = toml::table_format::multiline;
@@ -356,6 +357,7 @@ ConfigResult Configuration::RestoreDefaults()
     SetReminderInterval(0);
     OpenTaskDialogOnReminderClick(false);
     OpenTaskDialogOnOutlookMeetingAttendanceCheck(false);
+    SetCalendarIcsFilePath("");
 
     TodayAlwaysExpanded(false);
     UseProjectDisplayName(false);
@@ -409,7 +411,8 @@ ConfigResult Configuration::RestoreDefaults()
                     { "useTaskbarFlashing", false },
                     { "reminderInterval", 0 },
                     { "openTaskDialogOnReminderClick", false },
-                    { "openTaskDialogOnOutlookMeetingAttendanceCheck", true }
+                    { "openTaskDialogOnOutlookMeetingAttendanceCheck", true },
+                    { "calendarIcsFilePath", "" }
                 }
             },
             {
@@ -829,6 +832,16 @@ void Configuration::OpenTaskDialogOnOutlookMeetingAttendanceCheck(const bool val
     mSettings.OpenTaskDialogOnOutlookMeetingAttendanceCheck = value;
 }
 
+std::string Configuration::GetCalendarIcsFilePath() const
+{
+    return mSettings.CalendarIcsFilePath;
+}
+
+void Configuration::SetCalendarIcsFilePath(const std::string& value)
+{
+    mSettings.CalendarIcsFilePath = value;
+}
+
 bool Configuration::TodayAlwaysExpanded() const
 {
     return mSettings.TodayAlwaysExpanded;
@@ -1054,6 +1067,9 @@ void Configuration::GetTasksConfig(const toml::value& root)
 
     mSettings.OpenTaskDialogOnOutlookMeetingAttendanceCheck =
         toml::find_or<bool>(taskSection, "openTaskDialogOnOutlookMeetingAttendanceCheck", true);
+
+    mSettings.CalendarIcsFilePath =
+        toml::find_or<std::string>(taskSection, "calendarIcsFilePath", "");
 }
 
 void Configuration::GetTasksViewConfig(const toml::value& root)
@@ -188,6 +188,9 @@ class Configuration
     bool OpenTaskDialogOnOutlookMeetingAttendanceCheck() const;
     void OpenTaskDialogOnOutlookMeetingAttendanceCheck(const bool value);
 
+    std::string GetCalendarIcsFilePath() const;
+    void SetCalendarIcsFilePath(const std::string& value);
+
     bool TodayAlwaysExpanded() const;
     void TodayAlwaysExpanded(const bool value);
 
@@ -249,6 +252,7 @@ class Configuration
         int ReminderInterval;
         bool OpenTaskDialogOnReminderClick;
         bool OpenTaskDialogOnOutlookMeetingAttendanceCheck;
+        std::string CalendarIcsFilePath;
 
         bool TodayAlwaysExpanded;
         bool UseProjectDisplayName;
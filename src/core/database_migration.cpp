@@ -19,62 +19,80 @@
 
 #include "database_migration.h"
 
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <memory>
+#include <vector>
+
 #include "../common/logmessages.h"
 #include "../common/queryhelper.h"
 
 #include "../common/messages/sqlitemessages.h"
 
-#include "../utils/utils.h"
-
-namespace
+namespace tks::Core
 {
-#define WIN32_LEAN_AND_MEAN
-#include <Windows.h>
-static BOOL CALLBACK EnumMigrations(HMODULE hModule,
-    LPCTSTR lpszType,
-    LPTSTR lpszName,
-    LONG_PTR lParam)
+namespace
 {
-    std::vector<tks::Core::Migration>* migrations =
-        reinterpret_cast<std::vector<tks::Core::Migration>*>(lParam);
-
-    HRSRC rc = FindResource(hModule, lpszName, lpszType);
-    if (rc == nullptr) {
-        return FALSE;
+// Logs the duration of the migration phase when Migrate returns, whichever path it returns by
+struct MigrationPhaseTimer final {
+    MigrationPhaseTimer(std::shared_ptr<spdlog::logger> logger)
+        : pLogger(logger)
+        , mStart(std::chrono::steady_clock::now())
+        , mAppliedMigrations(0)
+        , bSucceeded(false)
+    {
     }
 
-    DWORD size = SizeofResource(hModule, rc);
-    HGLOBAL data = LoadResource(hModule, rc);
-    if (data == nullptr) {
-        return false;
+    ~MigrationPhaseTimer()
+    {
+        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - mStart);
+
+        if (!bSucceeded) {
+            pLogger->info("Migration phase failed after {0}ms", elapsed.count());
+        } else if (mAppliedMigrations == 0) {
+            pLogger->info(
+                "Migration phase completed in {0}ms, no pending migrations", elapsed.count());
+        } else {
+            pLogger->info("Migration phase completed in {0}ms, applied {1} migration(s)",
+                elapsed.count(),
+                mAppliedMigrations);
+        }
     }
 
-    const char* buffer = reinterpret_cast<const char*>(LockResource(data));
-
-    tks::Core::Migration m;
-    m.name = tks::Utils::ToStdString(lpszName);
-    m.sql = std::string(buffer, size);
-
-    migrations->push_back(m);
+    std::shared_ptr<spdlog::logger> pLogger;
+    std::chrono::steady_clock::time_point mStart;
+    std::size_t mAppliedMigrations;
+    bool bSucceeded;
+};
 
-    return TRUE;
+// the key a migration name is looked up by in the names SelectMigrationHistory returns
+std::string ToMigrationHistoryKey(std::string_view name)
+{
+    std::string key(name);
+    std::transform(key.begin(), key.end(), key.begin(), [](unsigned char c) {
+        return static_cast<char>(std::toupper(c));
+    });
+    return key;
 }
 } // namespace
 
-namespace tks::Core
-{
 std::string DatabaseMigration::BeginTransactionQuery = "BEGIN TRANSACTION";
 
 std::string DatabaseMigration::CommitTransactionQuery = "COMMIT";
 
+std::string DatabaseMigration::RollbackTransactionQuery = "ROLLBACK";
+
 std::string DatabaseMigration::CreateMigrationHistoryQuery =
     "CREATE TABLE IF NOT EXISTS migration_history("
     "id INTEGER PRIMARY KEY NOT NULL,"
     "name TEXT NOT NULL"
     ");";
 
-std::string DatabaseMigration::SelectMigrationExistsQuery =
-    "SELECT COUNT(*) FROM migration_history WHERE name = ?";
+// names are compared upper case, the resource based migrations recorded them that way
+std::string DatabaseMigration::SelectMigrationHistoryQuery =
+    "SELECT UPPER(name) FROM migration_history";
 
 std::string DatabaseMigration::InsertMigrationHistoryQuery =
     "INSERT INTO migration_history (name) VALUES (?)";
@@ -144,23 +162,46 @@ DatabaseMigration::~DatabaseMigration()
 
 SqliteResult DatabaseMigration::Migrate() const
 {
+    return Migrate(EmbeddedMigrations.data(), EmbeddedMigrations.size());
+}
+
+SqliteResult DatabaseMigration::Migrate(const Migration* migrations, std::size_t count) const
+{
+    MigrationPhaseTimer timer(pLogger);
+
     auto result = CreateMigrationHistoryTable();
     if (!result.Success) {
         return result;
     }
 
-    std::vector<Migration> migrations;
+    if (count == 0) {
+        timer.bSucceeded = true;
+        return SqliteResult::OK();
+    }
+
+    std::unordered_set<std::string> appliedMigrations;
+    result = SelectMigrationHistory(appliedMigrations);
+    if (!result.Success) {
+        return result;
+    }
+
+    // common case: the newest migration has been applied so there is nothing to do
+    // (migrations are ordered oldest to newest by their timestamp prefixed names)
+    const std::string newestMigrationKey = ToMigrationHistoryKey(migrations[count - 1].name);
+    if (appliedMigrations.find(newestMigrationKey) != appliedMigrations.end()) {
+        timer.bSucceeded = true;
+        return SqliteResult::OK();
+    }
 
-    // clang-format off
-    EnumResourceNames(
-        nullptr,
-        TEXT("MIGRATION"),
-        &EnumMigrations,
-        reinterpret_cast<LONG_PTR>(&migrations)
-    );
-    // clang-format on
+    std::vector<const Migration*> pendingMigrations;
+    for (std::size_t i = 0; i < count; i++) {
+        if (appliedMigrations.find(ToMigrationHistoryKey(migrations[i].name)) ==
+            appliedMigrations.end()) {
+            pendingMigrations.push_back(&migrations[i]);
+        }
+    }
 
-    SPDLOG_LOGGER_TRACE(pLogger, "Count of migrations to run: \"{0}\"", migrations.size());
+    SPDLOG_LOGGER_TRACE(pLogger, "Count of migrations to run: \"{0}\"", pendingMigrations.size());
 
     int rc = sqlite3_exec(pDb, BeginTransactionQuery.c_str(), nullptr, nullptr, nullptr);
 
@@ -171,116 +212,65 @@ SqliteResult DatabaseMigration::Migrate() const
         return SqliteResult::FailDetailed(Messages::ExecMessage, rc, std::string(error));
     }
 
-    for (const auto& migration : migrations) {
-        SPDLOG_LOGGER_TRACE(pLogger, "Begin to run migration \"{0}\"", migration.name);
-
-        auto result = MigrationExists(migration.name);
-        if (!result.Success) {
-            return result;
-        }
-        if (result.Success && !result.ConditionCheckFailed) {
-            continue;
-        }
+    sqlite3_stmt* migrationHistoryStmt = nullptr;
 
-        sqlite3_stmt* migrationStmt = nullptr;
-        const char* sql = migration.sql.c_str();
+    rc = sqlite3_prepare_v2(pDb,
+        InsertMigrationHistoryQuery.c_str(),
+        static_cast<int>(InsertMigrationHistoryQuery.size()),
+        &migrationHistoryStmt,
+        nullptr);
 
-        do {
-            int mrc = sqlite3_prepare_v2(pDb, sql, -1, &migrationStmt, &sql);
-
-            if (mrc != SQLITE_OK) {
-                const char* error = sqlite3_errmsg(pDb);
-                pLogger->error(
-                    LogMessages::PrepareStatementTemplate, migration.name.c_str(), rc, error);
-
-                sqlite3_finalize(migrationStmt);
-                return SqliteResult::FailDetailed(
-                    Messages::PrepareStatementMessage, rc, std::string(error));
-            }
-
-            if (migrationStmt == nullptr) {
-                break;
-            }
-
-            mrc = sqlite3_step(migrationStmt);
-
-            if (mrc != SQLITE_OK && mrc != SQLITE_DONE) {
-                const char* error = sqlite3_errmsg(pDb);
-                pLogger->error(LogMessages::ExecStepTemplate, migration.name.c_str(), rc, error);
-
-                sqlite3_finalize(migrationStmt);
-                return SqliteResult::FailDetailed(
-                    Messages::StepStatementMessage, rc, std::string(error));
-            }
-
-            sqlite3_finalize(migrationStmt);
-
-        } while (sql && sql[0] != '\0');
-
-        SPDLOG_LOGGER_TRACE(pLogger, "Completed migration \"{0}\"", migration.name);
-
-        sqlite3_stmt* migrationHistoryStmt = nullptr;
-
-        int mhrc = sqlite3_prepare_v2(
-            pDb, InsertMigrationHistoryQuery.c_str(), -1, &migrationHistoryStmt, nullptr);
-
-        if (mhrc != SQLITE_OK) {
-            const char* error = sqlite3_errmsg(pDb);
-            pLogger->error(LogMessages::PrepareStatementTemplate,
-                InsertMigrationHistoryQuery.c_str(),
-                rc,
-                error);
-
-            sqlite3_finalize(migrationHistoryStmt);
-            return SqliteResult::FailDetailed(
-                Messages::PrepareStatementMessage, rc, std::string(error));
-        }
+    if (rc != SQLITE_OK) {
+        const char* error = sqlite3_errmsg(pDb);
+        pLogger->error(
+            LogMessages::PrepareStatementTemplate, InsertMigrationHistoryQuery.c_str(), rc, error);
 
-        mhrc = sqlite3_bind_text(migrationHistoryStmt,
-            1,
-            migration.name.c_str(),
-            static_cast<int>(migration.name.size()),
-            SQLITE_TRANSIENT);
+        sqlite3_finalize(migrationHistoryStmt);
+        RollbackTransaction();
+        return SqliteResult::FailDetailed(
+            Messages::PrepareStatementMessage, rc, std::string(error));
+    }
 
-        if (mhrc != SQLITE_OK) {
-            const char* error = sqlite3_errmsg(pDb);
-            pLogger->error(
-                LogMessages::BindParameterTemplate, migration.name.c_str(), 1, rc, error);
+    for (const auto* migration : pendingMigrations) {
+        SPDLOG_LOGGER_TRACE(pLogger, "Begin to run migration \"{0}\"", migration->name);
 
+        result = ExecuteMigration(*migration);
+        if (!result.Success) {
             sqlite3_finalize(migrationHistoryStmt);
-            return SqliteResult::FailDetailed(
-                Messages::BindStatementMessage, rc, std::string(error));
+            RollbackTransaction();
+            return result;
         }
 
-        mhrc = sqlite3_step(migrationHistoryStmt);
-
-        if (mhrc != SQLITE_DONE) {
-            const char* error = sqlite3_errmsg(pDb);
-            pLogger->error(LogMessages::ExecStepTemplate, migration.name.c_str(), rc, error);
+        SPDLOG_LOGGER_TRACE(pLogger, "Completed migration \"{0}\"", migration->name);
 
+        result = InsertMigrationHistory(migrationHistoryStmt, migration->name);
+        if (!result.Success) {
             sqlite3_finalize(migrationHistoryStmt);
-            return SqliteResult::FailDetailed(
-                Messages::StepStatementMessage, rc, std::string(error));
+            RollbackTransaction();
+            return result;
         }
 
-        sqlite3_finalize(migrationHistoryStmt);
-
         SPDLOG_LOGGER_TRACE(pLogger,
             "Completed insert of migration \"{0}\" into MigrationHistory table",
-            migration.name);
+            migration->name);
     }
 
+    sqlite3_finalize(migrationHistoryStmt);
+
     rc = sqlite3_exec(pDb, CommitTransactionQuery.c_str(), nullptr, nullptr, nullptr);
 
     if (rc != SQLITE_OK) {
         const char* error = sqlite3_errmsg(pDb);
         pLogger->error(LogMessages::ExecQueryTemplate, CommitTransactionQuery.c_str(), rc, error);
 
+        RollbackTransaction();
         return SqliteResult::FailDetailed(Messages::ExecMessage, rc, std::string(error));
     }
 
     SPDLOG_LOGGER_TRACE(pLogger, "Commit migration transaction");
 
+    timer.mAppliedMigrations = pendingMigrations.size();
+    timer.bSucceeded = true;
     return SqliteResult::OK();
 }
 
@@ -315,62 +305,134 @@ SqliteResult DatabaseMigration::CreateMigrationHistoryTable() const
     return SqliteResult::OK();
 }
 
-SqliteResult DatabaseMigration::MigrationExists(const std::string& name) const
+SqliteResult DatabaseMigration::SelectMigrationHistory(
+    std::unordered_set<std::string>& appliedMigrations) const
 {
     sqlite3_stmt* stmt = nullptr;
 
-    int rc = sqlite3_prepare_v2(pDb, SelectMigrationExistsQuery.c_str(), -1, &stmt, nullptr);
+    int rc = sqlite3_prepare_v2(pDb,
+        SelectMigrationHistoryQuery.c_str(),
+        static_cast<int>(SelectMigrationHistoryQuery.size()),
+        &stmt,
+        nullptr);
 
     if (rc != SQLITE_OK) {
         const char* error = sqlite3_errmsg(pDb);
         pLogger->error(
-            LogMessages::PrepareStatementTemplate, SelectMigrationExistsQuery.c_str(), rc, error);
+            LogMessages::PrepareStatementTemplate, SelectMigrationHistoryQuery.c_str(), rc, error);
 
         sqlite3_finalize(stmt);
         return SqliteResult::FailDetailed(
             Messages::PrepareStatementMessage, rc, std::string(error));
     }
 
-    rc = sqlite3_bind_text(stmt, 1, name.c_str(), static_cast<int>(name.size()), SQLITE_TRANSIENT);
+    bool done = false;
+    while (!done) {
+        switch (rc = sqlite3_step(stmt)) {
+        case SQLITE_ROW: {
 
-    if (rc != SQLITE_OK) {
-        const char* error = sqlite3_errmsg(pDb);
-        pLogger->error(LogMessages::BindParameterTemplate, name.c_str(), 1, rc, error);
-
-        sqlite3_finalize(stmt);
-        return SqliteResult::FailDetailed(Messages::BindStatementMessage, rc, std::string(error));
+            const unsigned char* res = sqlite3_column_text(stmt, 0);
+            appliedMigrations.emplace(
+                reinterpret_cast<const char*>(res), sqlite3_column_bytes(stmt, 0));
+            break;
+        }
+        default:
+            done = true;
+            break;
+        }
     }
 
-    rc = sqlite3_step(stmt);
-
-    if (rc != SQLITE_ROW) {
+    if (rc != SQLITE_DONE) {
         const char* error = sqlite3_errmsg(pDb);
         pLogger->error(
-            LogMessages::ExecStepTemplate, SelectMigrationExistsQuery.c_str(), rc, error);
+            LogMessages::ExecStepTemplate, SelectMigrationHistoryQuery.c_str(), rc, error);
 
         sqlite3_finalize(stmt);
         return SqliteResult::FailDetailed(Messages::StepStatementMessage, rc, std::string(error));
     }
 
-    int count = sqlite3_column_int(stmt, 0);
+    sqlite3_finalize(stmt);
+    SPDLOG_LOGGER_TRACE(pLogger, "Count of applied migrations: \"{0}\"", appliedMigrations.size());
+
+    return SqliteResult::OK();
+}
+
+SqliteResult DatabaseMigration::ExecuteMigration(const Migration& migration) const
+{
+    sqlite3_stmt* migrationStmt = nullptr;
+    const char* sql = migration.sql.data();
+    const char* sqlEnd = migration.sql.data() + migration.sql.size();
+
+    do {
+        int rc = sqlite3_prepare_v2(
+            pDb, sql, static_cast<int>(sqlEnd - sql), &migrationStmt, &sql);
+
+        if (rc != SQLITE_OK) {
+            const char* error = sqlite3_errmsg(pDb);
+            pLogger->error(LogMessages::PrepareStatementTemplate, migration.name, rc, error);
+
+            sqlite3_finalize(migrationStmt);
+            return SqliteResult::FailDetailed(
+                Messages::PrepareStatementMessage, rc, std::string(error));
+        }
+
+        if (migrationStmt == nullptr) {
+            break;
+        }
+
+        rc = sqlite3_step(migrationStmt);
+
+        if (rc != SQLITE_OK && rc != SQLITE_DONE) {
+            const char* error = sqlite3_errmsg(pDb);
+            pLogger->error(LogMessages::ExecStepTemplate, migration.name, rc, error);
+
+            sqlite3_finalize(migrationStmt);
+            return SqliteResult::FailDetailed(
+                Messages::StepStatementMessage, rc, std::string(error));
+        }
+
+        sqlite3_finalize(migrationStmt);
+
+    } while (sql && sql < sqlEnd);
+
+    return SqliteResult::OK();
+}
+
+SqliteResult DatabaseMigration::InsertMigrationHistory(sqlite3_stmt* stmt,
+    std::string_view name) const
+{
+    sqlite3_reset(stmt);
+    sqlite3_clear_bindings(stmt);
+
+    int rc =
+        sqlite3_bind_text(stmt, 1, name.data(), static_cast<int>(name.size()), SQLITE_STATIC);
+
+    if (rc != SQLITE_OK) {
+        const char* error = sqlite3_errmsg(pDb);
+        pLogger->error(LogMessages::BindParameterTemplate, name, 1, rc, error);
+
+        return SqliteResult::FailDetailed(Messages::BindStatementMessage, rc, std::string(error));
+    }
 
     rc = sqlite3_step(stmt);
 
     if (rc != SQLITE_DONE) {
         const char* error = sqlite3_errmsg(pDb);
-        pLogger->warn(LogMessages::ExecQueryDidNotReturnOneResultTemplate, rc, error);
+        pLogger->error(LogMessages::ExecStepTemplate, name, rc, error);
 
-        return SqliteResult::FailDetailed(
-            Messages::StepStatementReturnedMultipleRowsMessage, rc, std::string(error));
+        return SqliteResult::FailDetailed(Messages::StepStatementMessage, rc, std::string(error));
     }
 
-    SPDLOG_LOGGER_TRACE(pLogger, "Migration \"{0}\" status: {1}", name, count > 0 ? "yes" : "no");
+    return SqliteResult::OK();
+}
 
-    sqlite3_finalize(stmt);
-    if (count > 0) {
-        return SqliteResult::OK();
-    } else {
-        return SqliteResult::SoftFailed("Migration not found");
+void DatabaseMigration::RollbackTransaction() const
+{
+    int rc = sqlite3_exec(pDb, RollbackTransactionQuery.c_str(), nullptr, nullptr, nullptr);
+
+    if (rc != SQLITE_OK) {
+        const char* error = sqlite3_errmsg(pDb);
+        pLogger->error(LogMessages::ExecQueryTemplate, RollbackTransactionQuery.c_str(), rc, error);
     }
 }
 } // namespace tks::Core
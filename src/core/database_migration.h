@@ -19,8 +19,11 @@
 
 #pragma once
 
+#include <cstddef>
 #include <memory>
 #include <string>
+#include <string_view>
+#include <unordered_set>
 
 #include <spdlog/spdlog.h>
 
@@ -28,29 +31,31 @@
 
 #include "../common/results/sqliteresult.h"
 
+#include "embedded_migrations.h"
+
 namespace tks::Core
 {
-struct Migration {
-    std::string name;
-    std::string sql;
-};
-
 struct DatabaseMigration final {
     DatabaseMigration(std::shared_ptr<spdlog::logger> logger, const std::string& databaseFilePath);
     ~DatabaseMigration();
 
     SqliteResult Migrate() const;
+    SqliteResult Migrate(const Migration* migrations, std::size_t count) const;
 
     SqliteResult CreateMigrationHistoryTable() const;
-    SqliteResult MigrationExists(const std::string& name) const;
+    SqliteResult SelectMigrationHistory(std::unordered_set<std::string>& appliedMigrations) const;
+    SqliteResult ExecuteMigration(const Migration& migration) const;
+    SqliteResult InsertMigrationHistory(sqlite3_stmt* stmt, std::string_view name) const;
+    void RollbackTransaction() const;
 
     std::shared_ptr<spdlog::logger> pLogger;
     sqlite3* pDb;
 
     static std::string BeginTransactionQuery;
     static std::string CommitTransactionQuery;
+    static std::string RollbackTransactionQuery;
     static std::string CreateMigrationHistoryQuery;
-    static std::string SelectMigrationExistsQuery;
+    static std::string SelectMigrationHistoryQuery;
     static std::string InsertMigrationHistoryQuery;
 };
 } // namespace tks::Core
@@ -0,0 +1,158 @@
+// Productivity tool to help you track the time you spend on tasks
+// Copyright (C) 2026 Szymon Welgus
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+// Contact:
+//     szymonwelgus at gmail dot com
+
+#include "startup_profiler.h"
+
+#include <fstream>
+
+#include <nlohmann/json.hpp>
+
+namespace tks::Core
+{
+namespace
+{
+double ToMilliseconds(std::chrono::microseconds duration)
+{
+    return std::chrono::duration<double, std::milli>(duration).count();
+}
+} // namespace
+
+StartupProfiler::ScopedPhase::ScopedPhase(const std::string& name)
+    : mName(name)
+    , mStart(Clock::now())
+{
+}
+
+StartupProfiler::ScopedPhase::~ScopedPhase()
+{
+    StartupProfiler::GetInstance().Record(mName, mStart, Clock::now());
+}
+
+StartupProfiler& StartupProfiler::GetInstance()
+{
+    static StartupProfiler instance;
+    return instance;
+}
+
+StartupProfiler::StartupProfiler()
+    : mStart(Clock::now())
+    , mEnd()
+    , bFinished(false)
+    , mPhases()
+{
+}
+
+void StartupProfiler::Record(const std::string& name,
+    Clock::time_point start,
+    Clock::time_point end)
+{
+    // phases that complete after startup (e.g. a later refresh of the same code path)
+    // are not part of the startup report
+    if (bFinished) {
+        return;
+    }
+
+    Phase phase;
+    phase.Name = name;
+    phase.Offset = std::chrono::duration_cast<std::chrono::microseconds>(start - mStart);
+    phase.Duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+
+    mPhases.push_back(phase);
+}
+
+void StartupProfiler::Finish()
+{
+    if (bFinished) {
+        return;
+    }
+
+    mEnd = Clock::now();
+    bFinished = true;
+}
+
+bool StartupProfiler::IsFinished() const
+{
+    return bFinished;
+}
+
+std::chrono::microseconds StartupProfiler::GetTotalDuration() const
+{
+    auto end = bFinished ? mEnd : Clock::now();
+    return std::chrono::duration_cast<std::chrono::microseconds>(end - mStart);
+}
+
+const std::vector<StartupProfiler::Phase>& StartupProfiler::GetPhases() const
+{
+    return mPhases;
+}
+
+bool StartupProfiler::ExceedsThreshold(std::chrono::milliseconds threshold) const
+{
+    // a threshold of zero disables the regression check
+    return threshold.count() > 0 && GetTotalDuration() > threshold;
+}
+
+std::string StartupProfiler::ToJson(std::chrono::milliseconds threshold) const
+{
+    nlohmann::json phases = nlohmann::json::array();
+    for (const auto& phase : mPhases) {
+        phases.push_back({
+            { "name", phase.Name },
+            { "offsetMs", ToMilliseconds(phase.Offset) },
+            { "durationMs", ToMilliseconds(phase.Duration) },
+        });
+    }
+
+    nlohmann::json report = {
+        { "totalMs", ToMilliseconds(GetTotalDuration()) },
+        { "thresholdMs", threshold.count() },
+        { "thresholdExceeded", ExceedsThreshold(threshold) },
+        { "phases", phases },
+    };
+
+    return report.dump();
+}
+
+void StartupProfiler::Report(std::shared_ptr<spdlog::logger> logger,
+    std::chrono::milliseconds threshold) const
+{
+    auto report = ToJson(threshold);
+
+    if (ExceedsThreshold(threshold)) {
+        logger->warn("Startup exceeded threshold of {0}ms. Startup report: {1}",
+            threshold.count(),
+            report);
+    } else {
+        logger->info("Startup report: {0}", report);
+    }
+}
+
+bool StartupProfiler::WriteReport(const std::filesystem::path& reportFilePath,
+    std::chrono::milliseconds threshold) const
+{
+    std::ofstream reportFile(reportFilePath, std::ios::out | std::ios::trunc);
+    if (!reportFile.is_open()) {
+        return false;
+    }
+
+    reportFile << ToJson(threshold);
+
+    return reportFile.good();
+}
+} // namespace tks::Core
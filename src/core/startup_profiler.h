@@ -0,0 +1,86 @@
+// Productivity tool to help you track the time you spend on tasks
+// Copyright (C) 2026 Szymon Welgus
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+// Contact:
+//     szymonwelgus at gmail dot com
+
+#pragma once
+
+#include <chrono>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <spdlog/spdlog.h>
+#include <spdlog/logger.h>
+
+namespace tks::Core
+{
+class StartupProfiler final
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    struct Phase {
+        std::string Name;
+        std::chrono::microseconds Offset;
+        std::chrono::microseconds Duration;
+    };
+
+    class ScopedPhase final
+    {
+    public:
+        ScopedPhase() = delete;
+        ScopedPhase(const ScopedPhase&) = delete;
+        explicit ScopedPhase(const std::string& name);
+        ~ScopedPhase();
+
+        ScopedPhase& operator=(const ScopedPhase&) = delete;
+
+    private:
+        std::string mName;
+        Clock::time_point mStart;
+    };
+
+    static StartupProfiler& GetInstance();
+
+    StartupProfiler(const StartupProfiler&) = delete;
+
+    StartupProfiler& operator=(const StartupProfiler&) = delete;
+
+    void Record(const std::string& name, Clock::time_point start, Clock::time_point end);
+    void Finish();
+
+    bool IsFinished() const;
+    std::chrono::microseconds GetTotalDuration() const;
+    const std::vector<Phase>& GetPhases() const;
+    bool ExceedsThreshold(std::chrono::milliseconds threshold) const;
+
+    std::string ToJson(std::chrono::milliseconds threshold) const;
+    void Report(std::shared_ptr<spdlog::logger> logger, std::chrono::milliseconds threshold) const;
+    bool WriteReport(const std::filesystem::path& reportFilePath,
+        std::chrono::milliseconds threshold) const;
+
+private:
+    StartupProfiler();
+
+    Clock::time_point mStart;
+    Clock::time_point mEnd;
+    bool bFinished;
+    std::vector<Phase> mPhases;
+};
+} // namespace tks::Core
@@ -21,6 +21,7 @@
 
 #include <cstdint>
 #include <string>
+#include <tuple>
 
 namespace tks::Model
 {
@@ -44,4 +45,17 @@ struct AttendedMeetingModel {
     const std::string GetDateCreatedString() const;
     const std::string GetDateModifiedString() const;
 };
+
+// columns in the order attended meeting queries select them, see Persistence::ReadRow
+inline constexpr auto AttendedMeetingModelColumns =
+    std::make_tuple(&AttendedMeetingModel::AttendedMeetingId,
+        &AttendedMeetingModel::EntryId,
+        &AttendedMeetingModel::Subject,
+        &AttendedMeetingModel::Start,
+        &AttendedMeetingModel::End,
+        &AttendedMeetingModel::Duration,
+        &AttendedMeetingModel::Location,
+        &AttendedMeetingModel::DateCreated,
+        &AttendedMeetingModel::DateModified,
+        &AttendedMeetingModel::IsActive);
 } // namespace tks::Model
@@ -22,6 +22,7 @@
 #include <cstdint>
 #include <optional>
 #include <string>
+#include <tuple>
 
 namespace tks::Model
 {
@@ -43,4 +44,15 @@ struct AttributeGroupModel {
     const std::string GetDateCreatedString() const;
     const std::string GetDateModifiedString() const;
 };
+
+// columns in the order attribute group queries select them, see Persistence::ReadRow
+inline constexpr auto AttributeGroupModelColumns = std::make_tuple(
+    &AttributeGroupModel::AttributeGroupId,
+    &AttributeGroupModel::Name,
+    &AttributeGroupModel::Description,
+    &AttributeGroupModel::IsStatic,
+    &AttributeGroupModel::IsDefault,
+    &AttributeGroupModel::DateCreated,
+    &AttributeGroupModel::DateModified,
+    &AttributeGroupModel::IsActive);
 } // namespace tks::Model
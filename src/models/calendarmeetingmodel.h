@@ -0,0 +1,77 @@
+// Productivity tool to help you track the time you spend on tasks
+// Copyright (C) 2026 Szymon Welgus
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+// Contact:
+//     szymonwelgus at gmail dot com
+
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <tuple>
+
+namespace tks::Model
+{
+struct CalendarSyncStateModel {
+    CalendarSyncStateModel();
+    ~CalendarSyncStateModel() = default;
+
+    std::int64_t CalendarSyncStateId;
+
+    std::string Provider;
+    std::string AccountName;
+    std::string Date;
+    std::string SyncToken;
+
+    std::int64_t DateSynced;
+};
+
+// columns in the order calendar sync state queries select them, see Persistence::ReadRow
+inline constexpr auto CalendarSyncStateModelColumns =
+    std::make_tuple(&CalendarSyncStateModel::CalendarSyncStateId,
+        &CalendarSyncStateModel::Provider,
+        &CalendarSyncStateModel::AccountName,
+        &CalendarSyncStateModel::Date,
+        &CalendarSyncStateModel::SyncToken,
+        &CalendarSyncStateModel::DateSynced);
+
+struct CalendarMeetingModel {
+    CalendarMeetingModel();
+    ~CalendarMeetingModel() = default;
+
+    std::int64_t CalendarMeetingId;
+    std::int64_t CalendarSyncStateId;
+
+    std::string EntryId;
+    std::string Subject;
+    std::string Start;
+    std::string End;
+    int Duration;
+    std::string Location;
+};
+
+// columns in the order calendar meeting queries select them, see Persistence::ReadRow
+inline constexpr auto CalendarMeetingModelColumns =
+    std::make_tuple(&CalendarMeetingModel::CalendarMeetingId,
+        &CalendarMeetingModel::CalendarSyncStateId,
+        &CalendarMeetingModel::EntryId,
+        &CalendarMeetingModel::Subject,
+        &CalendarMeetingModel::Start,
+        &CalendarMeetingModel::End,
+        &CalendarMeetingModel::Duration,
+        &CalendarMeetingModel::Location);
+} // namespace tks::Model
@@ -22,6 +22,7 @@
 #include <cstdint>
 #include <optional>
 #include <string>
+#include <tuple>
 
 namespace tks::Model
 {
@@ -41,4 +42,15 @@ struct CategoryModel {
     const std::string GetDateCreatedString() const;
     const std::string GetDateModifiedString() const;
 };
+
+// columns in the order category queries select them, see Persistence::ReadRow
+inline constexpr auto CategoryModelColumns = std::make_tuple(&CategoryModel::CategoryId,
+    &CategoryModel::Name,
+    &CategoryModel::Color,
+    &CategoryModel::Billable,
+    &CategoryModel::Description,
+    &CategoryModel::DateCreated,
+    &CategoryModel::DateModified,
+    &CategoryModel::IsActive,
+    &CategoryModel::ProjectId);
 } // namespace tks::Model
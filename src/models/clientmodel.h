@@ -22,6 +22,7 @@
 #include <cstdint>
 #include <optional>
 #include <string>
+#include <tuple>
 
 namespace tks::Model
 {
@@ -39,4 +40,13 @@ struct ClientModel {
     const std::string GetDateCreatedString() const;
     const std::string GetDateModifiedString() const;
 };
+
+// columns in the order client queries select them, see Persistence::ReadRow
+inline constexpr auto ClientModelColumns = std::make_tuple(&ClientModel::ClientId,
+    &ClientModel::Name,
+    &ClientModel::Description,
+    &ClientModel::DateCreated,
+    &ClientModel::DateModified,
+    &ClientModel::IsActive,
+    &ClientModel::EmployerId);
 }
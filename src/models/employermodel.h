@@ -22,6 +22,7 @@
 #include <cstdint>
 #include <optional>
 #include <string>
+#include <tuple>
 
 namespace tks::Model
 {
@@ -39,4 +40,13 @@ struct EmployerModel {
     const std::string GetDateCreatedString() const;
     const std::string GetDateModifiedString() const;
 };
+
+// columns in the order employer queries select them, see Persistence::ReadRow
+inline constexpr auto EmployerModelColumns = std::make_tuple(&EmployerModel::EmployerId,
+    &EmployerModel::Name,
+    &EmployerModel::IsDefault,
+    &EmployerModel::Description,
+    &EmployerModel::DateCreated,
+    &EmployerModel::DateModified,
+    &EmployerModel::IsActive);
 } // namespace tks::Model
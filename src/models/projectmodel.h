@@ -22,6 +22,7 @@
 #include <cstdint>
 #include <optional>
 #include <string>
+#include <tuple>
 
 namespace tks::Model
 {
@@ -42,4 +43,16 @@ struct ProjectModel {
     const std::string GetDateCreatedString() const;
     const std::string GetDateModifiedString() const;
 };
+
+// columns in the order project queries select them, see Persistence::ReadRow
+inline constexpr auto ProjectModelColumns = std::make_tuple(&ProjectModel::ProjectId,
+    &ProjectModel::Name,
+    &ProjectModel::DisplayName,
+    &ProjectModel::IsDefault,
+    &ProjectModel::Description,
+    &ProjectModel::DateCreated,
+    &ProjectModel::DateModified,
+    &ProjectModel::IsActive,
+    &ProjectModel::EmployerId,
+    &ProjectModel::ClientId);
 } // namespace tks::Model
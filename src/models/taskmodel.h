@@ -22,6 +22,7 @@
 #include <cstdint>
 #include <optional>
 #include <string>
+#include <tuple>
 
 namespace tks::Model
 {
@@ -47,6 +48,22 @@ struct TaskModel {
     const std::string GetDateModifiedString() const;
 };
 
+// columns in the order task queries select them, see Persistence::ReadRow
+inline constexpr auto TaskModelColumns = std::make_tuple(&TaskModel::TaskId,
+    &TaskModel::Billable,
+    &TaskModel::UniqueIdentifier,
+    &TaskModel::Hours,
+    &TaskModel::Minutes,
+    &TaskModel::Description,
+    &TaskModel::DateCreated,
+    &TaskModel::DateModified,
+    &TaskModel::IsActive,
+    &TaskModel::ProjectId,
+    &TaskModel::CategoryId,
+    &TaskModel::WorkdayId,
+    &TaskModel::AttributeGroupId,
+    &TaskModel::AttendedMeetingId);
+
 struct TaskDurationModel {
     int Hours;
     int Minutes;
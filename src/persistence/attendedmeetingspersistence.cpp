@@ -19,6 +19,8 @@
 
 #include "attendedmeetingspersistence.h"
 
+#include "base/rowmapper.h"
+
 #include "../common/logmessages.h"
 
 #include "../common/messages/sqlitemessages.h"
@@ -143,6 +145,85 @@ SqliteResult AttendedMeetingsPersistence::GetByEntryId(const std::string& entryI
     return SqliteResult::OK();
 }
 
+SqliteResult AttendedMeetingsPersistence::FilterByEntryIds(const std::vector<std::string>& entryIds,
+    std::vector<Model::AttendedMeetingModel>& attendedMeetingModels) const
+{
+    if (entryIds.empty()) {
+        return SqliteResult::OK();
+    }
+
+    std::string query = std::string(AttendedMeetingsPersistence::filterByEntryIds) + "(" +
+                        Utils::FormatSqlPlaceholders(entryIds.size()) + ")";
+
+    sqlite3_stmt* stmt = nullptr;
+
+    int rc =
+        sqlite3_prepare_v2(pDb, query.c_str(), static_cast<int>(query.size()), &stmt, nullptr);
+
+    if (rc != SQLITE_OK) {
+        const char* error = sqlite3_errmsg(pDb);
+        pLogger->error(LogMessages::PrepareStatementTemplate,
+            "AttendedMeetingsPersistence",
+            query,
+            rc,
+            error);
+
+        sqlite3_finalize(stmt);
+        return SqliteResult::FailDetailed(
+            Messages::PrepareStatementMessage, rc, std::string(error));
+    }
+
+    int bindIndex = 1;
+
+    // entry_id
+    for (const auto& entryId : entryIds) {
+        rc = sqlite3_bind_text(
+            stmt, bindIndex, entryId.c_str(), static_cast<int>(entryId.size()), SQLITE_TRANSIENT);
+
+        if (rc != SQLITE_OK) {
+            const char* error = sqlite3_errmsg(pDb);
+            pLogger->error(LogMessages::BindParameterTemplate,
+                "AttendedMeetingsPersistence",
+                "entry_id",
+                bindIndex,
+                rc,
+                error);
+
+            sqlite3_finalize(stmt);
+            return SqliteResult::FailDetailed(
+                Messages::BindStatementMessage, rc, std::string(error));
+        }
+
+        bindIndex++;
+    }
+
+    rc = ReadRows(stmt,
+        Model::AttendedMeetingModelColumns,
+        attendedMeetingModels,
+        [](Model::AttendedMeetingModel&, int) {});
+
+    if (rc != SQLITE_DONE) {
+        const char* error = sqlite3_errmsg(pDb);
+        pLogger->error(LogMessages::ExecStepTemplate,
+            "AttendedMeetingsPersistence",
+            query,
+            rc,
+            error);
+
+        sqlite3_finalize(stmt);
+        return SqliteResult::FailDetailed(Messages::StepStatementMessage, rc, std::string(error));
+    }
+
+    sqlite3_finalize(stmt);
+
+    SPDLOG_LOGGER_TRACE(pLogger,
+        LogMessages::FilterEntities,
+        attendedMeetingModels.size(),
+        Utils::ConvertListStringToCommaDelimitedString(entryIds));
+
+    return SqliteResult::OK();
+}
+
 SqliteResult AttendedMeetingsPersistence::GetByTodaysDate(const std::int32_t unixFromDateTime,
     const std::int32_t unixToDateTime,
     std::vector<Model::AttendedMeetingModel>& attendedMeetingModels) const
@@ -501,6 +582,25 @@ std::string AttendedMeetingsPersistence::getByEntryId = "SELECT "
                                                         "WHERE entry_id = ? "
                                                         "AND is_active = 1;";
 
+// the IN list is completed with one placeholder per entry id
+constexpr std::string_view AttendedMeetingsPersistence::filterByEntryIds =
+    "SELECT "
+    "attended_meeting_id, "
+    "entry_id, "
+    "subject, "
+    "start, "
+    "end, "
+    "duration, "
+    "location, "
+    "date_created, "
+    "date_modified, "
+    "is_active "
+    "FROM attended_meetings "
+    "WHERE is_active = 1 "
+    "AND entry_id IN ";
+static_assert(CountSelectColumns(AttendedMeetingsPersistence::filterByEntryIds) ==
+              ColumnCount(Model::AttendedMeetingModelColumns));
+
 std::string AttendedMeetingsPersistence::getByTodaysDate = "SELECT "
                                                            "attended_meeting_id, "
                                                            "entry_id, "
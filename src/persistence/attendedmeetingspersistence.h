@@ -22,6 +22,7 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "base/persistencebase.h"
@@ -42,6 +43,8 @@ struct AttendedMeetingsPersistence final : public PersistenceBase {
 
     SqliteResult GetByEntryId(const std::string& entryId,
         /*out*/ Model::AttendedMeetingModel& attendedMeetingModel) const;
+    SqliteResult FilterByEntryIds(const std::vector<std::string>& entryIds,
+        /*out*/ std::vector<Model::AttendedMeetingModel>& attendedMeetingModels) const;
     SqliteResult GetByTodaysDate(const std::int32_t unixFromDateTime,
         const std::int32_t unixToDateTime,
         /*out*/ std::vector<Model::AttendedMeetingModel>& attendedMeetingModels) const;
@@ -51,6 +54,7 @@ struct AttendedMeetingsPersistence final : public PersistenceBase {
 
     static std::string getByEntryId;
     static std::string getByTodaysDate;
+    static const std::string_view filterByEntryIds;
     static std::string create;
     static std::string isActive;
 };
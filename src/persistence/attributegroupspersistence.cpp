@@ -19,6 +19,9 @@
 
 #include "attributegroupspersistence.h"
 
+#include "base/entityversions.h"
+#include "base/rowmapper.h"
+
 #include "../common/logmessages.h"
 
 #include "../common/messages/sqlitemessages.h"
@@ -43,7 +46,7 @@ SqliteResult AttributeGroupsPersistence::Filter(const std::string& searchTerm,
     sqlite3_stmt* stmt = nullptr;
 
     int rc = sqlite3_prepare_v2(pDb,
-        AttributeGroupsPersistence::filter.c_str(),
+        AttributeGroupsPersistence::filter.data(),
         static_cast<int>(AttributeGroupsPersistence::filter.size()),
         &stmt,
         nullptr);
@@ -94,48 +97,7 @@ SqliteResult AttributeGroupsPersistence::Filter(const std::string& searchTerm,
             Messages::BindStatementMessage, rc, std::string(error));
     }
 
-    bool done = false;
-    while (!done) {
-        switch (sqlite3_step(stmt)) {
-        case SQLITE_ROW: {
-            rc = SQLITE_ROW;
-            Model::AttributeGroupModel model;
-
-            int columnIndex = 0;
-            model.AttributeGroupId = sqlite3_column_int64(stmt, columnIndex++);
-
-            const unsigned char* res = sqlite3_column_text(stmt, columnIndex);
-            model.Name = std::string(
-                reinterpret_cast<const char*>(res), sqlite3_column_bytes(stmt, columnIndex++));
-
-            if (sqlite3_column_type(stmt, columnIndex) == SQLITE_NULL) {
-                model.Description = std::nullopt;
-            } else {
-                const unsigned char* res = sqlite3_column_text(stmt, columnIndex);
-                model.Description = std::string(
-                    reinterpret_cast<const char*>(res), sqlite3_column_bytes(stmt, columnIndex));
-            }
-
-            columnIndex++;
-
-            model.IsStatic = !!sqlite3_column_int(stmt, columnIndex++);
-            model.IsDefault = !!sqlite3_column_int(stmt, columnIndex++);
-
-            model.DateCreated = sqlite3_column_int(stmt, columnIndex++);
-            model.DateModified = sqlite3_column_int(stmt, columnIndex++);
-            model.IsActive = !!sqlite3_column_int(stmt, columnIndex++);
-
-            attributeGroupModels.push_back(model);
-            break;
-        }
-        case SQLITE_DONE:
-            rc = SQLITE_DONE;
-            done = true;
-            break;
-        default:
-            break;
-        }
-    }
+    rc = ReadRows(stmt, Model::AttributeGroupModelColumns, attributeGroupModels);
 
     if (rc != SQLITE_DONE) {
         const char* error = sqlite3_errmsg(pDb);
@@ -161,7 +123,7 @@ SqliteResult AttributeGroupsPersistence::FilterByStaticFlag(
     sqlite3_stmt* stmt = nullptr;
 
     int rc = sqlite3_prepare_v2(pDb,
-        AttributeGroupsPersistence::filterStatic.c_str(),
+        AttributeGroupsPersistence::filterStatic.data(),
         static_cast<int>(AttributeGroupsPersistence::filterStatic.size()),
         &stmt,
         nullptr);
@@ -179,48 +141,7 @@ SqliteResult AttributeGroupsPersistence::FilterByStaticFlag(
             Messages::PrepareStatementMessage, rc, std::string(error));
     }
 
-    bool done = false;
-    while (!done) {
-        switch (sqlite3_step(stmt)) {
-        case SQLITE_ROW: {
-            rc = SQLITE_ROW;
-            Model::AttributeGroupModel model;
-
-            int columnIndex = 0;
-            model.AttributeGroupId = sqlite3_column_int64(stmt, columnIndex++);
-
-            const unsigned char* res = sqlite3_column_text(stmt, columnIndex);
-            model.Name = std::string(
-                reinterpret_cast<const char*>(res), sqlite3_column_bytes(stmt, columnIndex++));
-
-            if (sqlite3_column_type(stmt, columnIndex) == SQLITE_NULL) {
-                model.Description = std::nullopt;
-            } else {
-                const unsigned char* res = sqlite3_column_text(stmt, columnIndex);
-                model.Description = std::string(
-                    reinterpret_cast<const char*>(res), sqlite3_column_bytes(stmt, columnIndex));
-            }
-
-            columnIndex++;
-
-            model.IsStatic = !!sqlite3_column_int(stmt, columnIndex++);
-            model.IsDefault = !!sqlite3_column_int(stmt, columnIndex++);
-
-            model.DateCreated = sqlite3_column_int(stmt, columnIndex++);
-            model.DateModified = sqlite3_column_int(stmt, columnIndex++);
-            model.IsActive = !!sqlite3_column_int(stmt, columnIndex++);
-
-            attributeGroupModels.push_back(model);
-            break;
-        }
-        case SQLITE_DONE:
-            rc = SQLITE_DONE;
-            done = true;
-            break;
-        default:
-            break;
-        }
-    }
+    rc = ReadRows(stmt, Model::AttributeGroupModelColumns, attributeGroupModels);
 
     if (rc != SQLITE_DONE) {
         const char* error = sqlite3_errmsg(pDb);
@@ -249,7 +170,7 @@ SqliteResult AttributeGroupsPersistence::GetById(const std::int64_t attributeGro
     sqlite3_stmt* stmt = nullptr;
 
     int rc = sqlite3_prepare_v2(pDb,
-        AttributeGroupsPersistence::getById.c_str(),
+        AttributeGroupsPersistence::getById.data(),
         static_cast<int>(AttributeGroupsPersistence::getById.size()),
         &stmt,
         nullptr);
@@ -300,29 +221,7 @@ SqliteResult AttributeGroupsPersistence::GetById(const std::int64_t attributeGro
             Messages::StepStatementMessage, rc, std::string(error));
     }
 
-    int columnIndex = 0;
-    attributeGroupModel.AttributeGroupId = sqlite3_column_int64(stmt, columnIndex++);
-
-    const unsigned char* res = sqlite3_column_text(stmt, columnIndex);
-    attributeGroupModel.Name =
-        std::string(reinterpret_cast<const char*>(res), sqlite3_column_bytes(stmt, columnIndex++));
-
-    if (sqlite3_column_type(stmt, columnIndex) == SQLITE_NULL) {
-        attributeGroupModel.Description = std::nullopt;
-    } else {
-        const unsigned char* res = sqlite3_column_text(stmt, columnIndex);
-        attributeGroupModel.Description = std::string(
-            reinterpret_cast<const char*>(res), sqlite3_column_bytes(stmt, columnIndex));
-    }
-
-    columnIndex++;
-
-    attributeGroupModel.IsStatic = !!sqlite3_column_int(stmt, columnIndex++);
-    attributeGroupModel.IsDefault = !!sqlite3_column_int(stmt, columnIndex++);
-
-    attributeGroupModel.DateCreated = sqlite3_column_int(stmt, columnIndex++);
-    attributeGroupModel.DateModified = sqlite3_column_int(stmt, columnIndex++);
-    attributeGroupModel.IsActive = !!sqlite3_column_int(stmt, columnIndex++);
+    ReadRow(stmt, Model::AttributeGroupModelColumns, attributeGroupModel);
 
     rc = sqlite3_step(stmt);
 
@@ -454,6 +353,8 @@ SqliteResult AttributeGroupsPersistence::Create(std::int64_t& attributeGroupId,
     attributeGroupId = sqlite3_last_insert_rowid(pDb);
     SPDLOG_LOGGER_TRACE(pLogger, LogMessages::EntityCreated, "attribute_group", attributeGroupId);
 
+    EntityVersions::GetInstance().Bump(VersionedEntity::AttributeGroups);
+
     return SqliteResult::OK();
 }
 
@@ -591,6 +492,8 @@ SqliteResult AttributeGroupsPersistence::Update(
         "attribute_group",
         attributeGroupModel.AttributeGroupId);
 
+    EntityVersions::GetInstance().Bump(VersionedEntity::AttributeGroups);
+
     return SqliteResult::OK();
 }
 
@@ -656,6 +559,8 @@ SqliteResult AttributeGroupsPersistence::Delete(const std::int64_t attributeGrou
     sqlite3_finalize(stmt);
     SPDLOG_LOGGER_TRACE(pLogger, LogMessages::EntityDeleted, "attribute_group", attributeGroupId);
 
+    EntityVersions::GetInstance().Bump(VersionedEntity::AttributeGroups);
+
     return SqliteResult::OK();
 }
 
@@ -933,6 +838,8 @@ SqliteResult AttributeGroupsPersistence::UnsetDefault() const
 
     SPDLOG_LOGGER_TRACE(pLogger, "Unset default \"attribute_group\"");
 
+    EntityVersions::GetInstance().Bump(VersionedEntity::AttributeGroups);
+
     return SqliteResult::OK();
 }
 
@@ -942,7 +849,7 @@ SqliteResult AttributeGroupsPersistence::SelectDefault(
     sqlite3_stmt* stmt = nullptr;
 
     int rc = sqlite3_prepare_v2(pDb,
-        AttributeGroupsPersistence::selectDefault.c_str(),
+        AttributeGroupsPersistence::selectDefault.data(),
         static_cast<int>(AttributeGroupsPersistence::selectDefault.size()),
         &stmt,
         nullptr);
@@ -977,30 +884,7 @@ SqliteResult AttributeGroupsPersistence::SelectDefault(
             Messages::StepStatementMessage, rc, std::string(error));
     }
 
-    int columnIndex = 0;
-
-    attributeGroupModel.AttributeGroupId = sqlite3_column_int64(stmt, columnIndex++);
-
-    const unsigned char* res = sqlite3_column_text(stmt, columnIndex);
-    attributeGroupModel.Name =
-        std::string(reinterpret_cast<const char*>(res), sqlite3_column_bytes(stmt, columnIndex++));
-
-    if (sqlite3_column_type(stmt, columnIndex) == SQLITE_NULL) {
-        attributeGroupModel.Description = std::nullopt;
-    } else {
-        const unsigned char* res = sqlite3_column_text(stmt, columnIndex);
-        attributeGroupModel.Description = std::string(
-            reinterpret_cast<const char*>(res), sqlite3_column_bytes(stmt, columnIndex));
-    }
-
-    columnIndex++;
-
-    attributeGroupModel.IsStatic = !!sqlite3_column_int(stmt, columnIndex++);
-    attributeGroupModel.IsDefault = !!sqlite3_column_int(stmt, columnIndex++);
-
-    attributeGroupModel.DateCreated = sqlite3_column_int(stmt, columnIndex++);
-    attributeGroupModel.DateModified = sqlite3_column_int(stmt, columnIndex++);
-    attributeGroupModel.IsActive = !!sqlite3_column_int(stmt, columnIndex++);
+    ReadRow(stmt, Model::AttributeGroupModelColumns, attributeGroupModel);
 
     rc = sqlite3_step(stmt);
 
@@ -1023,44 +907,50 @@ SqliteResult AttributeGroupsPersistence::SelectDefault(
     ;
 }
 
-std::string AttributeGroupsPersistence::filter = "SELECT "
-                                                 "attribute_group_id, "
-                                                 "name, "
-                                                 "description, "
-                                                 "is_static, "
-                                                 "is_default, "
-                                                 "date_created, "
-                                                 "date_modified, "
-                                                 "is_active "
-                                                 "FROM attribute_groups "
-                                                 "WHERE is_active = 1 "
-                                                 "AND (name LIKE ? "
-                                                 "OR description LIKE ?)";
-
-std::string AttributeGroupsPersistence::filterStatic = "SELECT "
-                                                       "attribute_group_id, "
-                                                       "name, "
-                                                       "description, "
-                                                       "is_static, "
-                                                       "is_default, "
-                                                       "date_created, "
-                                                       "date_modified, "
-                                                       "is_active "
-                                                       "FROM attribute_groups "
-                                                       "WHERE is_active = 1 "
-                                                       "AND is_static = 1";
-
-std::string AttributeGroupsPersistence::getById = "SELECT "
-                                                  "attribute_group_id, "
-                                                  "name, "
-                                                  "description, "
-                                                  "is_static, "
-                                                  "is_default, "
-                                                  "date_created, "
-                                                  "date_modified, "
-                                                  "is_active "
-                                                  "FROM attribute_groups "
-                                                  "WHERE attribute_group_id = ?";
+constexpr std::string_view AttributeGroupsPersistence::filter = "SELECT "
+                                                                "attribute_group_id, "
+                                                                "name, "
+                                                                "description, "
+                                                                "is_static, "
+                                                                "is_default, "
+                                                                "date_created, "
+                                                                "date_modified, "
+                                                                "is_active "
+                                                                "FROM attribute_groups "
+                                                                "WHERE is_active = 1 "
+                                                                "AND (name LIKE ? "
+                                                                "OR description LIKE ?)";
+static_assert(CountSelectColumns(AttributeGroupsPersistence::filter) ==
+              ColumnCount(Model::AttributeGroupModelColumns));
+
+constexpr std::string_view AttributeGroupsPersistence::filterStatic = "SELECT "
+                                                                      "attribute_group_id, "
+                                                                      "name, "
+                                                                      "description, "
+                                                                      "is_static, "
+                                                                      "is_default, "
+                                                                      "date_created, "
+                                                                      "date_modified, "
+                                                                      "is_active "
+                                                                      "FROM attribute_groups "
+                                                                      "WHERE is_active = 1 "
+                                                                      "AND is_static = 1";
+static_assert(CountSelectColumns(AttributeGroupsPersistence::filterStatic) ==
+              ColumnCount(Model::AttributeGroupModelColumns));
+
+constexpr std::string_view AttributeGroupsPersistence::getById = "SELECT "
+                                                                 "attribute_group_id, "
+                                                                 "name, "
+                                                                 "description, "
+                                                                 "is_static, "
+                                                                 "is_default, "
+                                                                 "date_created, "
+                                                                 "date_modified, "
+                                                                 "is_active "
+                                                                 "FROM attribute_groups "
+                                                                 "WHERE attribute_group_id = ?";
+static_assert(CountSelectColumns(AttributeGroupsPersistence::getById) ==
+              ColumnCount(Model::AttributeGroupModelColumns));
 
 std::string AttributeGroupsPersistence::create = "INSERT INTO "
                                                  "attribute_groups "
@@ -1132,17 +1022,19 @@ std::string AttributeGroupsPersistence::checkAttributeGroupStaticAttributesUsage
     "WHERE attribute_groups.attribute_group_id = ? "
     "AND attribute_groups.is_static = 1";
 
-std::string AttributeGroupsPersistence::selectDefault = "SELECT "
-                                                        "attribute_group_id, "
-                                                        "name, "
-                                                        "description, "
-                                                        "is_static, "
-                                                        "is_default, "
-                                                        "date_created, "
-                                                        "date_modified, "
-                                                        "is_active "
-                                                        "FROM attribute_groups "
-                                                        "WHERE is_default = 1";
+constexpr std::string_view AttributeGroupsPersistence::selectDefault = "SELECT "
+                                                                       "attribute_group_id, "
+                                                                       "name, "
+                                                                       "description, "
+                                                                       "is_static, "
+                                                                       "is_default, "
+                                                                       "date_created, "
+                                                                       "date_modified, "
+                                                                       "is_active "
+                                                                       "FROM attribute_groups "
+                                                                       "WHERE is_default = 1";
+static_assert(CountSelectColumns(AttributeGroupsPersistence::selectDefault) ==
+              ColumnCount(Model::AttributeGroupModelColumns));
 
 std::string AttributeGroupsPersistence::unsetDefault = "UPDATE attribute_groups "
                                                        "SET "
@@ -22,6 +22,7 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "base/persistencebase.h"
@@ -61,9 +62,9 @@ struct AttributeGroupsPersistence final : public PersistenceBase {
     SqliteResult UnsetDefault() const;
     SqliteResult SelectDefault(Model::AttributeGroupModel& attributeGroupModel) const;
 
-    static std::string filter;
-    static std::string filterStatic;
-    static std::string getById;
+    static const std::string_view filter;
+    static const std::string_view filterStatic;
+    static const std::string_view getById;
     static std::string create;
     static std::string update;
     static std::string updateIfInUse;
@@ -72,6 +73,6 @@ struct AttributeGroupsPersistence final : public PersistenceBase {
     static std::string checkAttributeGroupAttributesUsage;
     static std::string checkAttributeGroupStaticAttributesUsage;
     static std::string unsetDefault;
-    static std::string selectDefault;
+    static const std::string_view selectDefault;
 };
 } // namespace tks::Persistence
@@ -0,0 +1,318 @@
+// Productivity tool to help you track the time you spend on tasks
+// Copyright (C) 2026 Szymon Welgus
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+// Contact:
+//     szymonwelgus at gmail dot com
+
+
+#include "changefeed.h"
+
+#include <algorithm>
+
+namespace tks::Persistence
+{
+ChangeFeed& ChangeFeed::GetInstance()
+{
+    static ChangeFeed instance;
+    return instance;
+}
+
+ChangeFeed::ChangeFeed()
+    : mMutex()
+    , mDispatcher()
+    , mNextSubscriptionId(1)
+    , mSubscriptions()
+    , mConnections()
+    , mTableNames()
+    , mSubscribedTables()
+    , mSubscribedTablesVersion(1)
+{
+}
+
+void ChangeFeed::SetDispatcher(Dispatcher dispatcher)
+{
+    std::scoped_lock lock(mMutex);
+    mDispatcher = std::move(dispatcher);
+}
+
+std::uint64_t ChangeFeed::Subscribe(const std::string& table,
+    Subscriber subscriber,
+    RangeSubscriber rangeSubscriber)
+{
+    std::scoped_lock lock(mMutex);
+
+    auto subscriptionId = mNextSubscriptionId++;
+    mSubscriptions[subscriptionId] =
+        Subscription{ Intern(table), std::move(subscriber), std::move(rangeSubscriber) };
+    RefreshSubscribedTables();
+
+    return subscriptionId;
+}
+
+void ChangeFeed::Unsubscribe(std::uint64_t subscriptionId)
+{
+    std::scoped_lock lock(mMutex);
+    mSubscriptions.erase(subscriptionId);
+    RefreshSubscribedTables();
+}
+
+void ChangeFeed::Attach(sqlite3* db)
+{
+    if (db == nullptr) {
+        return;
+    }
+
+    Connection* connection = nullptr;
+    {
+        std::scoped_lock lock(mMutex);
+
+        auto& entry = mConnections[db];
+        entry = std::make_unique<Connection>();
+        entry->Feed = this;
+        entry->SubscribedTablesVersion = 0;
+        connection = entry.get();
+    }
+
+    sqlite3_update_hook(db, &ChangeFeed::UpdateHook, connection);
+    sqlite3_commit_hook(db, &ChangeFeed::CommitHook, connection);
+    sqlite3_rollback_hook(db, &ChangeFeed::RollbackHook, connection);
+    sqlite3_wal_hook(db, &ChangeFeed::WalHook, connection);
+}
+
+void ChangeFeed::Detach(sqlite3* db)
+{
+    if (db == nullptr) {
+        return;
+    }
+
+    sqlite3_update_hook(db, nullptr, nullptr);
+    sqlite3_commit_hook(db, nullptr, nullptr);
+    sqlite3_rollback_hook(db, nullptr, nullptr);
+    sqlite3_wal_hook(db, nullptr, nullptr);
+
+    std::scoped_lock lock(mMutex);
+    mConnections.erase(db);
+}
+
+void ChangeFeed::Suspend(sqlite3* db)
+{
+    if (db == nullptr) {
+        return;
+    }
+
+    sqlite3_update_hook(db, nullptr, nullptr);
+}
+
+void ChangeFeed::Resume(sqlite3* db)
+{
+    if (db == nullptr) {
+        return;
+    }
+
+    Connection* connection = nullptr;
+    {
+        std::scoped_lock lock(mMutex);
+
+        auto iterator = mConnections.find(db);
+        if (iterator == mConnections.end()) {
+            return;
+        }
+        connection = iterator->second.get();
+    }
+
+    sqlite3_update_hook(db, &ChangeFeed::UpdateHook, connection);
+}
+
+void ChangeFeed::PublishRange(const std::string& table,
+    DayNumber fromDayNumber,
+    DayNumber toDayNumber)
+{
+    Dispatcher dispatcher;
+    RangeChange change;
+    {
+        std::scoped_lock lock(mMutex);
+        dispatcher = mDispatcher;
+        change = RangeChange{ *Intern(table), fromDayNumber, toDayNumber };
+    }
+
+    if (dispatcher) {
+        dispatcher([this, change]() { Publish(change); });
+    }
+}
+
+void ChangeFeed::UpdateHook(void* context,
+    int operation,
+    const char* databaseName,
+    const char* tableName,
+    sqlite3_int64 rowId)
+{
+    auto connection = static_cast<Connection*>(context);
+
+    auto table = connection->Feed->FindSubscribedTable(*connection, tableName);
+    if (table == nullptr) {
+        return;
+    }
+
+    RowChange change;
+    change.Table = *table;
+    change.RowId = static_cast<std::int64_t>(rowId);
+
+    switch (operation) {
+    case SQLITE_INSERT:
+        change.Operation = RowChangeOperation::Insert;
+        break;
+    case SQLITE_UPDATE:
+        change.Operation = RowChangeOperation::Update;
+        break;
+    case SQLITE_DELETE:
+    default:
+        change.Operation = RowChangeOperation::Delete;
+        break;
+    }
+
+    connection->PendingChanges.push_back(change);
+}
+
+int ChangeFeed::CommitHook(void* context)
+{
+    auto connection = static_cast<Connection*>(context);
+
+    // the commit can still fail after this hook returns, so the changes are only staged here and
+    // published by the WAL hook once the commit has completed; a busy commit leaves the
+    // transaction open and a retried commit stages its later changes alongside these
+    connection->CommittingChanges.insert(connection->CommittingChanges.end(),
+        connection->PendingChanges.begin(),
+        connection->PendingChanges.end());
+    connection->PendingChanges.clear();
+
+    return 0;
+}
+
+void ChangeFeed::RollbackHook(void* context)
+{
+    auto connection = static_cast<Connection*>(context);
+    connection->PendingChanges.clear();
+    connection->CommittingChanges.clear();
+}
+
+int ChangeFeed::WalHook(void* context, sqlite3* db, const char* databaseName, int pages)
+{
+    auto connection = static_cast<Connection*>(context);
+    if (!connection->CommittingChanges.empty()) {
+        auto changes = std::make_shared<std::vector<RowChange>>();
+        changes->swap(connection->CommittingChanges);
+
+        auto feed = connection->Feed;
+
+        Dispatcher dispatcher;
+        {
+            std::scoped_lock lock(feed->mMutex);
+            dispatcher = feed->mDispatcher;
+        }
+
+        // delivery is deferred to the dispatcher which runs subscribers once the committing call
+        // has returned
+        if (dispatcher) {
+            dispatcher([feed, changes]() { feed->Publish(*changes); });
+        }
+    }
+
+    // registering a WAL hook replaces the automatic checkpoint, so do what it would have done
+    if (pages >= WalAutoCheckpointPages) {
+        sqlite3_wal_checkpoint_v2(db, databaseName, SQLITE_CHECKPOINT_PASSIVE, nullptr, nullptr);
+    }
+
+    return SQLITE_OK;
+}
+
+const std::string* ChangeFeed::Intern(const std::string& table)
+{
+    auto iterator = std::find(mTableNames.begin(), mTableNames.end(), table);
+    if (iterator != mTableNames.end()) {
+        return &*iterator;
+    }
+
+    return &mTableNames.emplace_back(table);
+}
+
+void ChangeFeed::RefreshSubscribedTables()
+{
+    mSubscribedTables.clear();
+    for (const auto& [subscriptionId, subscription] : mSubscriptions) {
+        if (std::find(mSubscribedTables.begin(), mSubscribedTables.end(), subscription.Table) ==
+            mSubscribedTables.end()) {
+            mSubscribedTables.push_back(subscription.Table);
+        }
+    }
+
+    mSubscribedTablesVersion++;
+}
+
+const std::string* ChangeFeed::FindSubscribedTable(Connection& connection, const char* tableName)
+{
+    // only a subscribe or unsubscribe since the last row takes the lock
+    if (connection.SubscribedTablesVersion != mSubscribedTablesVersion.load()) {
+        std::scoped_lock lock(mMutex);
+        connection.SubscribedTables = mSubscribedTables;
+        connection.SubscribedTablesVersion = mSubscribedTablesVersion.load();
+    }
+
+    for (const auto table : connection.SubscribedTables) {
+        if (*table == tableName) {
+            return table;
+        }
+    }
+
+    return nullptr;
+}
+
+std::vector<ChangeFeed::Subscription> ChangeFeed::GetSubscriptions() const
+{
+    std::vector<Subscription> subscriptions;
+
+    std::scoped_lock lock(mMutex);
+    for (const auto& [subscriptionId, subscription] : mSubscriptions) {
+        subscriptions.push_back(subscription);
+    }
+
+    return subscriptions;
+}
+
+void ChangeFeed::Publish(const std::vector<RowChange>& changes) const
+{
+    for (const auto& subscription : GetSubscriptions()) {
+        std::vector<RowChange> tableChanges;
+        for (const auto& change : changes) {
+            if (change.Table == *subscription.Table) {
+                tableChanges.push_back(change);
+            }
+        }
+
+        if (!tableChanges.empty() && subscription.Callback) {
+            subscription.Callback(tableChanges);
+        }
+    }
+}
+
+void ChangeFeed::Publish(const RangeChange& change) const
+{
+    for (const auto& subscription : GetSubscriptions()) {
+        if (change.Table == *subscription.Table && subscription.RangeCallback) {
+            subscription.RangeCallback(change);
+        }
+    }
+}
+} // namespace tks::Persistence
@@ -0,0 +1,146 @@
+// Productivity tool to help you track the time you spend on tasks
+// Copyright (C) 2026 Szymon Welgus
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+// Contact:
+//     szymonwelgus at gmail dot com
+
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <sqlite3.h>
+
+#include "../../utils/daynumber.h"
+
+namespace tks::Persistence
+{
+enum class RowChangeOperation : int { Insert = 0, Update, Delete };
+
+struct RowChange {
+    // interned by the feed, valid for the lifetime of the process
+    std::string_view Table;
+    std::int64_t RowId;
+    RowChangeOperation Operation;
+};
+
+/// <summary>
+/// Published by a bulk writer in place of its row changes, any row dated within the range of
+/// workday day numbers may have been inserted, updated or deleted
+/// </summary>
+struct RangeChange {
+    std::string_view Table;
+    DayNumber FromDayNumber;
+    DayNumber ToDayNumber;
+};
+
+/// <summary>
+/// Publishes the rows changed by each committed transaction on any attached connection, the
+/// connections run in WAL mode so that a commit is only published once it has succeeded
+/// </summary>
+class ChangeFeed final
+{
+public:
+    using Subscriber = std::function<void(const std::vector<RowChange>&)>;
+    using RangeSubscriber = std::function<void(const RangeChange&)>;
+    using Dispatcher = std::function<void(std::function<void()>)>;
+
+    static ChangeFeed& GetInstance();
+
+    ChangeFeed(const ChangeFeed&) = delete;
+
+    ChangeFeed& operator=(const ChangeFeed&) = delete;
+
+    /// <summary>
+    /// Committed changes are handed to the dispatcher, no dispatcher means nothing is published
+    /// </summary>
+    void SetDispatcher(Dispatcher dispatcher);
+
+    std::uint64_t Subscribe(const std::string& table,
+        Subscriber subscriber,
+        RangeSubscriber rangeSubscriber);
+    void Unsubscribe(std::uint64_t subscriptionId);
+
+    void Attach(sqlite3* db);
+    void Detach(sqlite3* db);
+
+    /// <summary>
+    /// Stop recording the row changes of a connection, for bulk writers that publish a range
+    /// once they have committed instead
+    /// </summary>
+    void Suspend(sqlite3* db);
+    void Resume(sqlite3* db);
+
+    void PublishRange(const std::string& table, DayNumber fromDayNumber, DayNumber toDayNumber);
+
+private:
+    struct Connection {
+        ChangeFeed* Feed;
+        std::vector<RowChange> PendingChanges;
+        // changes of a commit in progress, published once the commit is known to have succeeded
+        std::vector<RowChange> CommittingChanges;
+        // copy of the subscribed tables so the update hook neither locks nor allocates
+        std::uint64_t SubscribedTablesVersion;
+        std::vector<const std::string*> SubscribedTables;
+    };
+
+    struct Subscription {
+        const std::string* Table;
+        Subscriber Callback;
+        RangeSubscriber RangeCallback;
+    };
+
+    // the page count SQLite checkpoints at when no WAL hook is registered
+    static constexpr int WalAutoCheckpointPages = 1000;
+
+    ChangeFeed();
+
+    static void UpdateHook(void* context,
+        int operation,
+        const char* databaseName,
+        const char* tableName,
+        sqlite3_int64 rowId);
+    static int CommitHook(void* context);
+    static void RollbackHook(void* context);
+    static int WalHook(void* context, sqlite3* db, const char* databaseName, int pages);
+
+    const std::string* Intern(const std::string& table);
+    void RefreshSubscribedTables();
+    const std::string* FindSubscribedTable(Connection& connection, const char* tableName);
+    std::vector<Subscription> GetSubscriptions() const;
+    void Publish(const std::vector<RowChange>& changes) const;
+    void Publish(const RangeChange& change) const;
+
+    mutable std::mutex mMutex;
+    Dispatcher mDispatcher;
+    std::uint64_t mNextSubscriptionId;
+    std::unordered_map<std::uint64_t, Subscription> mSubscriptions;
+    std::unordered_map<sqlite3*, std::unique_ptr<Connection>> mConnections;
+    // never shrinks, so interned names outlive every change that points at them
+    std::deque<std::string> mTableNames;
+    std::vector<const std::string*> mSubscribedTables;
+    std::atomic<std::uint64_t> mSubscribedTablesVersion;
+};
+} // namespace tks::Persistence
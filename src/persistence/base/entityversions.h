@@ -0,0 +1,55 @@
+// Productivity tool to help you track the time you spend on tasks
+// Copyright (C) 2026 Szymon Welgus
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+// Contact:
+//     szymonwelgus at gmail dot com
+
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace tks::Persistence
+{
+enum class VersionedEntity : int { Employers = 0, Clients, Projects, Categories, AttributeGroups };
+
+/// <summary>
+/// Write counters of the rarely changing reference tables. The persistence write paths bump them
+/// once a write has succeeded, so copies of those tables held in memory can tell they are stale
+/// </summary>
+class EntityVersions final
+{
+public:
+    static EntityVersions& GetInstance();
+
+    EntityVersions(const EntityVersions&) = delete;
+
+    EntityVersions& operator=(const EntityVersions&) = delete;
+
+    std::uint64_t Get(VersionedEntity entity) const;
+    void Bump(VersionedEntity entity);
+
+private:
+    static constexpr std::size_t EntityCount = 5;
+
+    EntityVersions();
+
+    std::array<std::atomic<std::uint64_t>, EntityCount> mVersions;
+};
+} // namespace tks::Persistence
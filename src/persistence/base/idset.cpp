@@ -0,0 +1,102 @@
+// Productivity tool to help you track the time you spend on tasks
+// Copyright (C) 2026 Szymon Welgus
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+// Contact:
+//     szymonwelgus at gmail dot com
+
+
+#include "idset.h"
+
+namespace tks::Persistence
+{
+namespace
+{
+constexpr const char* CreateIdSet =
+    "CREATE TEMP TABLE IF NOT EXISTS id_set (id INTEGER PRIMARY KEY)";
+constexpr const char* ClearIdSet = "DELETE FROM temp.id_set";
+constexpr const char* InsertId = "INSERT OR IGNORE INTO temp.id_set (id) VALUES (?)";
+
+// a savepoint nests inside a caller's transaction and starts one when there is none, so the
+// inserts are committed together instead of one journaled write each
+constexpr const char* SavepointIdSet = "SAVEPOINT id_set";
+constexpr const char* ReleaseIdSet = "RELEASE id_set";
+constexpr const char* RollbackIdSet = "ROLLBACK TO id_set; RELEASE id_set";
+
+int InsertIds(sqlite3* db, const std::vector<std::int64_t>& ids)
+{
+    int rc = sqlite3_exec(db, ClearIdSet, nullptr, nullptr, nullptr);
+    if (rc != SQLITE_OK) {
+        return rc;
+    }
+
+    sqlite3_stmt* stmt = nullptr;
+
+    rc = sqlite3_prepare_v2(db, InsertId, -1, &stmt, nullptr);
+    if (rc != SQLITE_OK) {
+        sqlite3_finalize(stmt);
+        return rc;
+    }
+
+    for (const auto id : ids) {
+        rc = sqlite3_bind_int64(stmt, 1, id);
+        if (rc != SQLITE_OK) {
+            break;
+        }
+
+        rc = sqlite3_step(stmt);
+        if (rc != SQLITE_DONE) {
+            break;
+        }
+
+        rc = SQLITE_OK;
+        sqlite3_reset(stmt);
+    }
+
+    sqlite3_finalize(stmt);
+    return rc;
+}
+} // namespace
+
+int BindIdSet(sqlite3* db, const std::vector<std::int64_t>& ids, std::string& error)
+{
+    int rc = sqlite3_exec(db, CreateIdSet, nullptr, nullptr, nullptr);
+
+    if (rc == SQLITE_OK) {
+        rc = sqlite3_exec(db, SavepointIdSet, nullptr, nullptr, nullptr);
+    }
+
+    if (rc != SQLITE_OK) {
+        error = sqlite3_errmsg(db);
+        return rc;
+    }
+
+    rc = InsertIds(db, ids);
+
+    if (rc != SQLITE_OK) {
+        error = sqlite3_errmsg(db);
+        sqlite3_exec(db, RollbackIdSet, nullptr, nullptr, nullptr);
+        return rc;
+    }
+
+    rc = sqlite3_exec(db, ReleaseIdSet, nullptr, nullptr, nullptr);
+
+    if (rc != SQLITE_OK) {
+        error = sqlite3_errmsg(db);
+    }
+
+    return rc;
+}
+} // namespace tks::Persistence
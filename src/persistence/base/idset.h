@@ -0,0 +1,48 @@
+// Productivity tool to help you track the time you spend on tasks
+// Copyright (C) 2026 Szymon Welgus
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+// Contact:
+//     szymonwelgus at gmail dot com
+
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <sqlite3.h>
+
+namespace tks::Persistence
+{
+/*
+ * Id sets are bound through the per-connection temp table temp.id_set instead of being
+ * formatted into the SQL as "IN (1,2,3)" or "IN (?,?,?)", e.g.
+ *
+ *     "WHERE projects.employer_id IN (SELECT id FROM temp.id_set)"
+ *
+ * so the statement text is the same whatever the number of ids and never runs into the
+ * SQL length or host parameter limits. One set is bound per connection at a time, binding
+ * another replaces it
+ */
+
+/// <summary>
+/// Replace the ids in temp.id_set with ids, creating the table on first use.
+/// Duplicates are dropped. Returns SQLITE_OK, or the failing result code with its message
+/// in error, copied before the partial set is rolled back
+/// </summary>
+int BindIdSet(sqlite3* db, const std::vector<std::int64_t>& ids, /*out*/ std::string& error);
+} // namespace tks::Persistence
@@ -19,6 +19,9 @@
 
 #include "persistencebase.h"
 
+#include "changefeed.h"
+#include "queryprofiler.h"
+
 #include "../../common/logmessages.h"
 #include "../../common/queryhelper.h"
 
@@ -105,10 +108,15 @@ PersistenceBase::PersistenceBase(std::shared_ptr<spdlog::logger> logger,
         result = PersistenceResult(rc, std::string(error));
         return;
     }
+
+    QueryProfiler::GetInstance().Attach(pDb);
+    ChangeFeed::GetInstance().Attach(pDb);
 }
 
 PersistenceBase::~PersistenceBase()
 {
+    ChangeFeed::GetInstance().Detach(pDb);
+    QueryProfiler::GetInstance().Detach(pDb);
     sqlite3_close(pDb);
     SPDLOG_LOGGER_TRACE(pLogger, LogMessages::CloseDatabaseConnection);
 }
@@ -0,0 +1,279 @@
+// Productivity tool to help you track the time you spend on tasks
+// Copyright (C) 2026 Szymon Welgus
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+// Contact:
+//     szymonwelgus at gmail dot com
+
+#include "queryprofiler.h"
+
+#include <algorithm>
+#include <cctype>
+
+namespace tks::Persistence
+{
+QueryStatistics::QueryStatistics()
+    : Sql()
+    , Calls(0)
+    , Rows(0)
+    , TotalDuration(0)
+    , MaxDuration(0)
+{
+}
+
+QueryProfiler& QueryProfiler::GetInstance()
+{
+    static QueryProfiler instance;
+    return instance;
+}
+
+QueryProfiler::QueryProfiler()
+    : bEnabled(false)
+    , pLogger(nullptr)
+    , mSlowQueryThreshold(0)
+    , mMutex()
+    , mStatistics()
+    , mConnections()
+{
+}
+
+void QueryProfiler::Enable(std::shared_ptr<spdlog::logger> logger,
+    std::chrono::milliseconds slowQueryThreshold)
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        pLogger = logger;
+        mSlowQueryThreshold = slowQueryThreshold;
+    }
+
+    bEnabled = true;
+
+    SPDLOG_LOGGER_TRACE(pLogger,
+        "Query profiling enabled with slow query threshold of {0}ms",
+        slowQueryThreshold.count());
+}
+
+bool QueryProfiler::IsEnabled() const
+{
+    return bEnabled;
+}
+
+void QueryProfiler::Attach(sqlite3* db)
+{
+    if (!bEnabled || db == nullptr) {
+        return;
+    }
+
+    auto connection = std::make_unique<Connection>();
+    connection->Profiler = this;
+
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    sqlite3_trace_v2(db,
+        SQLITE_TRACE_PROFILE | SQLITE_TRACE_ROW,
+        &QueryProfiler::TraceCallback,
+        connection.get());
+    mConnections[db] = std::move(connection);
+}
+
+void QueryProfiler::Detach(sqlite3* db)
+{
+    if (db == nullptr) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    auto it = mConnections.find(db);
+    if (it == mConnections.end()) {
+        return;
+    }
+
+    sqlite3_trace_v2(db, 0, nullptr, nullptr);
+    mConnections.erase(it);
+}
+
+std::vector<QueryStatistics> QueryProfiler::GetStatistics() const
+{
+    std::vector<QueryStatistics> statistics;
+
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        statistics.reserve(mStatistics.size());
+        for (const auto& [sql, queryStatistics] : mStatistics) {
+            statistics.push_back(queryStatistics);
+        }
+    }
+
+    std::sort(statistics.begin(),
+        statistics.end(),
+        [](const QueryStatistics& lhs, const QueryStatistics& rhs) {
+            return lhs.TotalDuration > rhs.TotalDuration;
+        });
+
+    return statistics;
+}
+
+void QueryProfiler::LogSummary(std::size_t maximumStatements) const
+{
+    if (!bEnabled || pLogger == nullptr) {
+        return;
+    }
+
+    auto statistics = GetStatistics();
+
+    pLogger->warn("Query profile summary: {0} distinct statement(s), showing the top {1} by "
+                  "total time",
+        statistics.size(),
+        std::min(statistics.size(), maximumStatements));
+
+    std::size_t count = 0;
+    for (const auto& queryStatistics : statistics) {
+        if (count++ >= maximumStatements) {
+            break;
+        }
+
+        using Milliseconds = std::chrono::duration<double, std::milli>;
+        auto totalMilliseconds = Milliseconds(queryStatistics.TotalDuration).count();
+        auto maxMilliseconds = Milliseconds(queryStatistics.MaxDuration).count();
+
+        pLogger->warn("Query profile: calls={0} total={1:.3f}ms avg={2:.3f}ms max={3:.3f}ms "
+                      "rows={4} sql=\"{5}\"",
+            queryStatistics.Calls,
+            totalMilliseconds,
+            totalMilliseconds / static_cast<double>(queryStatistics.Calls),
+            maxMilliseconds,
+            queryStatistics.Rows,
+            queryStatistics.Sql);
+    }
+}
+
+std::string QueryProfiler::NormalizeSql(const char* sql)
+{
+    // collapse whitespace and replace numeric literals outside of string literals with "?"
+    // so that statements built with inlined values (e.g. IN lists) share the same key
+    std::string normalized;
+    if (sql == nullptr) {
+        return normalized;
+    }
+
+    bool inStringLiteral = false;
+    bool pendingSpace = false;
+    char previous = '\0';
+
+    for (const char* c = sql; *c != '\0'; c++) {
+        unsigned char current = static_cast<unsigned char>(*c);
+
+        if (inStringLiteral) {
+            normalized += *c;
+            if (*c == '\'') {
+                inStringLiteral = false;
+            }
+            previous = *c;
+            continue;
+        }
+
+        if (std::isspace(current)) {
+            pendingSpace = !normalized.empty();
+            continue;
+        }
+
+        if (pendingSpace) {
+            normalized += ' ';
+            pendingSpace = false;
+            previous = ' ';
+        }
+
+        if (*c == '\'') {
+            inStringLiteral = true;
+            normalized += *c;
+        } else if (std::isdigit(current) &&
+                   !(std::isalnum(static_cast<unsigned char>(previous)) || previous == '_')) {
+            while (std::isdigit(static_cast<unsigned char>(*(c + 1))) || *(c + 1) == '.') {
+                c++;
+            }
+            normalized += '?';
+        } else {
+            normalized += *c;
+        }
+
+        previous = normalized.back();
+    }
+
+    return normalized;
+}
+
+int QueryProfiler::TraceCallback(unsigned int type, void* context, void* p, void* x)
+{
+    auto* connection = static_cast<Connection*>(context);
+    auto* stmt = static_cast<sqlite3_stmt*>(p);
+
+    switch (type) {
+    case SQLITE_TRACE_ROW:
+        connection->RowsInFlight[stmt]++;
+        break;
+    case SQLITE_TRACE_PROFILE: {
+        std::uint64_t rows = 0;
+
+        auto it = connection->RowsInFlight.find(stmt);
+        if (it != connection->RowsInFlight.end()) {
+            rows = it->second;
+            connection->RowsInFlight.erase(it);
+        }
+
+        connection->Profiler->OnProfile(
+            stmt, rows, std::chrono::nanoseconds(*static_cast<sqlite3_int64*>(x)));
+        break;
+    }
+    default:
+        break;
+    }
+
+    return 0;
+}
+
+void QueryProfiler::OnProfile(sqlite3_stmt* stmt,
+    std::uint64_t rows,
+    std::chrono::nanoseconds duration)
+{
+    auto normalizedSql = NormalizeSql(sqlite3_sql(stmt));
+
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        auto& queryStatistics = mStatistics[normalizedSql];
+        if (queryStatistics.Calls == 0) {
+            queryStatistics.Sql = normalizedSql;
+        }
+
+        queryStatistics.Calls++;
+        queryStatistics.Rows += rows;
+        queryStatistics.TotalDuration += duration;
+        queryStatistics.MaxDuration = std::max(queryStatistics.MaxDuration, duration);
+    }
+
+    if (mSlowQueryThreshold.count() > 0 && duration >= mSlowQueryThreshold) {
+        char* expandedSql = sqlite3_expanded_sql(stmt);
+
+        pLogger->warn("Slow query took {0:.3f}ms and returned {1} row(s): \"{2}\"",
+            std::chrono::duration<double, std::milli>(duration).count(),
+            rows,
+            expandedSql != nullptr ? expandedSql : normalizedSql.c_str());
+
+        sqlite3_free(expandedSql);
+    }
+}
+} // namespace tks::Persistence
@@ -0,0 +1,92 @@
+// Productivity tool to help you track the time you spend on tasks
+// Copyright (C) 2026 Szymon Welgus
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+// Contact:
+//     szymonwelgus at gmail dot com
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <spdlog/spdlog.h>
+#include <spdlog/logger.h>
+
+#include <sqlite3.h>
+
+namespace tks::Persistence
+{
+struct QueryStatistics {
+    std::string Sql;
+    std::uint64_t Calls;
+    std::uint64_t Rows;
+    std::chrono::nanoseconds TotalDuration;
+    std::chrono::nanoseconds MaxDuration;
+
+    QueryStatistics();
+    ~QueryStatistics() = default;
+};
+
+class QueryProfiler final
+{
+public:
+    static QueryProfiler& GetInstance();
+
+    QueryProfiler(const QueryProfiler&) = delete;
+
+    QueryProfiler& operator=(const QueryProfiler&) = delete;
+
+    void Enable(std::shared_ptr<spdlog::logger> logger,
+        std::chrono::milliseconds slowQueryThreshold);
+    bool IsEnabled() const;
+
+    void Attach(sqlite3* db);
+    void Detach(sqlite3* db);
+
+    std::vector<QueryStatistics> GetStatistics() const;
+    void LogSummary(std::size_t maximumStatements = 20) const;
+
+    static std::string NormalizeSql(const char* sql);
+
+private:
+    /* Trace context of one attached connection, rows are counted without taking the lock since
+     * a connection is only stepped by one thread at a time */
+    struct Connection {
+        QueryProfiler* Profiler;
+        std::unordered_map<sqlite3_stmt*, std::uint64_t> RowsInFlight;
+    };
+
+    QueryProfiler();
+
+    static int TraceCallback(unsigned int type, void* context, void* p, void* x);
+
+    void OnProfile(sqlite3_stmt* stmt, std::uint64_t rows, std::chrono::nanoseconds duration);
+
+    std::atomic<bool> bEnabled;
+    std::shared_ptr<spdlog::logger> pLogger;
+    std::chrono::milliseconds mSlowQueryThreshold;
+
+    mutable std::mutex mMutex;
+    std::unordered_map<std::string, QueryStatistics> mStatistics;
+    std::unordered_map<sqlite3*, std::unique_ptr<Connection>> mConnections;
+};
+} // namespace tks::Persistence
@@ -0,0 +1,206 @@
+// Productivity tool to help you track the time you spend on tasks
+// Copyright (C) 2026 Szymon Welgus
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+// Contact:
+//     szymonwelgus at gmail dot com
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include <sqlite3.h>
+
+namespace tks::Persistence
+{
+/*
+ * Row mapping for models that declare their columns as a constexpr tuple of member pointers
+ * in the order a SELECT returns them, e.g.
+ *
+ *     inline constexpr auto TaskModelColumns = std::make_tuple(&TaskModel::TaskId, ...);
+ *
+ * CountSelectColumns(query) == ColumnCount(TaskModelColumns) is checked with a static_assert
+ * next to each query, so a column added to one but not the other fails to compile
+ */
+template<typename T>
+struct ColumnReader;
+
+template<>
+struct ColumnReader<bool> {
+    static void Read(sqlite3_stmt* stmt, int column, bool& value)
+    {
+        value = !!sqlite3_column_int(stmt, column);
+    }
+};
+
+template<>
+struct ColumnReader<int> {
+    static void Read(sqlite3_stmt* stmt, int column, int& value)
+    {
+        value = sqlite3_column_int(stmt, column);
+    }
+};
+
+template<>
+struct ColumnReader<std::uint32_t> {
+    static void Read(sqlite3_stmt* stmt, int column, std::uint32_t& value)
+    {
+        value = static_cast<std::uint32_t>(sqlite3_column_int64(stmt, column));
+    }
+};
+
+template<>
+struct ColumnReader<std::int64_t> {
+    static void Read(sqlite3_stmt* stmt, int column, std::int64_t& value)
+    {
+        value = sqlite3_column_int64(stmt, column);
+    }
+};
+
+template<>
+struct ColumnReader<std::string> {
+    static void Read(sqlite3_stmt* stmt, int column, std::string& value)
+    {
+        const unsigned char* res = sqlite3_column_text(stmt, column);
+        if (res == nullptr) {
+            value.clear();
+            return;
+        }
+
+        value.assign(reinterpret_cast<const char*>(res), sqlite3_column_bytes(stmt, column));
+    }
+};
+
+template<typename T>
+struct ColumnReader<std::optional<T>> {
+    static void Read(sqlite3_stmt* stmt, int column, std::optional<T>& value)
+    {
+        if (sqlite3_column_type(stmt, column) == SQLITE_NULL) {
+            value = std::nullopt;
+            return;
+        }
+
+        ColumnReader<T>::Read(stmt, column, value.emplace());
+    }
+};
+
+template<typename TColumns>
+constexpr std::size_t ColumnCount(const TColumns&)
+{
+    return std::tuple_size_v<TColumns>;
+}
+
+/// <summary>
+/// Count of the top level expressions between SELECT and FROM in a query
+/// </summary>
+constexpr std::size_t CountSelectColumns(std::string_view query)
+{
+    constexpr std::string_view select = "SELECT ";
+    constexpr std::string_view from = "FROM ";
+
+    std::size_t position = query.find(select);
+    if (position == std::string_view::npos) {
+        return 0;
+    }
+
+    std::size_t count = 1;
+    int depth = 0;
+    bool quoted = false;
+    for (position += select.size(); position < query.size(); position++) {
+        char character = query[position];
+        if (character == '\'') {
+            quoted = !quoted;
+        } else if (quoted) {
+            continue;
+        } else if (character == '(') {
+            depth++;
+        } else if (character == ')') {
+            depth--;
+        } else if (character == ',' && depth == 0) {
+            count++;
+        } else if (depth == 0 && query.substr(position, from.size()) == from &&
+                   (query[position - 1] == ' ' || query[position - 1] == ',')) {
+            return count;
+        }
+    }
+
+    return 0;
+}
+
+/// <summary>
+/// Read the columns of the current row into model, starting at columnIndex.
+/// Returns the index of the first column after the mapped ones
+/// </summary>
+template<typename TModel, typename... TMembers>
+int ReadRow(sqlite3_stmt* stmt,
+    const std::tuple<TMembers TModel::*...>& columns,
+    TModel& model,
+    int columnIndex = 0)
+{
+    std::apply(
+        [&](auto... members) {
+            (ColumnReader<std::remove_reference_t<decltype(model.*members)>>::Read(
+                 stmt, columnIndex++, model.*members),
+                ...);
+        },
+        columns);
+
+    return columnIndex;
+}
+
+/// <summary>
+/// Step through every row of stmt constructing each model in place at the back of models.
+/// onRow receives the model and the index of its first unmapped column for any extra columns.
+/// Returns the last step result, SQLITE_DONE when all rows were read
+/// </summary>
+template<typename TModel, typename TColumns, typename TOnRow>
+int ReadRows(sqlite3_stmt* stmt,
+    const TColumns& columns,
+    std::vector<TModel>& models,
+    TOnRow&& onRow)
+{
+    int rc = SQLITE_OK;
+    bool done = false;
+    while (!done) {
+        switch (rc = sqlite3_step(stmt)) {
+        case SQLITE_ROW: {
+            auto& model = models.emplace_back();
+            int columnIndex = ReadRow(stmt, columns, model);
+            onRow(model, columnIndex);
+            break;
+        }
+        case SQLITE_DONE:
+        default:
+            done = true;
+            break;
+        }
+    }
+
+    return rc;
+}
+
+template<typename TModel, typename TColumns>
+int ReadRows(sqlite3_stmt* stmt, const TColumns& columns, std::vector<TModel>& models)
+{
+    return ReadRows(stmt, columns, models, [](TModel&, int) {});
+}
+} // namespace tks::Persistence
@@ -0,0 +1,93 @@
+// Productivity tool to help you track the time you spend on tasks
+// Copyright (C) 2026 Szymon Welgus
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+// Contact:
+//     szymonwelgus at gmail dot com
+
+
+#include "workdayidcache.h"
+
+namespace tks::Persistence
+{
+WorkdayIdCache& WorkdayIdCache::GetInstance()
+{
+    static WorkdayIdCache instance;
+    return instance;
+}
+
+WorkdayIdCache::WorkdayIdCache()
+    : mMutex()
+    , mDatabaseFilePath()
+    , mEntries()
+    , mEntriesByDate()
+{
+}
+
+bool WorkdayIdCache::TryGet(const std::string& databaseFilePath,
+    const std::string& date,
+    std::int64_t& workdayId)
+{
+    std::scoped_lock lock(mMutex);
+
+    if (databaseFilePath != mDatabaseFilePath) {
+        return false;
+    }
+
+    auto iterator = mEntriesByDate.find(date);
+    if (iterator == mEntriesByDate.end()) {
+        return false;
+    }
+
+    mEntries.splice(mEntries.begin(), mEntries, iterator->second);
+    workdayId = iterator->second->second;
+    return true;
+}
+
+void WorkdayIdCache::Put(const std::string& databaseFilePath,
+    const std::string& date,
+    std::int64_t workdayId)
+{
+    std::scoped_lock lock(mMutex);
+
+    SwitchDatabase(databaseFilePath);
+
+    auto iterator = mEntriesByDate.find(date);
+    if (iterator != mEntriesByDate.end()) {
+        iterator->second->second = workdayId;
+        mEntries.splice(mEntries.begin(), mEntries, iterator->second);
+        return;
+    }
+
+    if (mEntries.size() == Capacity) {
+        mEntriesByDate.erase(mEntries.back().first);
+        mEntries.pop_back();
+    }
+
+    mEntries.emplace_front(date, workdayId);
+    mEntriesByDate.emplace(date, mEntries.begin());
+}
+
+void WorkdayIdCache::SwitchDatabase(const std::string& databaseFilePath)
+{
+    if (databaseFilePath == mDatabaseFilePath) {
+        return;
+    }
+
+    mDatabaseFilePath = databaseFilePath;
+    mEntries.clear();
+    mEntriesByDate.clear();
+}
+} // namespace tks::Persistence
@@ -0,0 +1,67 @@
+// Productivity tool to help you track the time you spend on tasks
+// Copyright (C) 2026 Szymon Welgus
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+// Contact:
+//     szymonwelgus at gmail dot com
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace tks::Persistence
+{
+/// <summary>
+/// Process-wide, least recently used bounded map of workday dates to their ids. Workdays are
+/// never updated or deleted, so an entry stays valid for as long as its database file is in use
+/// </summary>
+class WorkdayIdCache final
+{
+public:
+    static constexpr std::size_t Capacity = 512;
+
+    static WorkdayIdCache& GetInstance();
+
+    WorkdayIdCache(const WorkdayIdCache&) = delete;
+
+    WorkdayIdCache& operator=(const WorkdayIdCache&) = delete;
+
+    bool TryGet(const std::string& databaseFilePath,
+        const std::string& date,
+        /*out*/ std::int64_t& workdayId);
+    void Put(const std::string& databaseFilePath, const std::string& date, std::int64_t workdayId);
+
+private:
+    using Entry = std::pair<std::string, std::int64_t>;
+
+    WorkdayIdCache();
+
+    // a different database file invalidates every entry
+    void SwitchDatabase(const std::string& databaseFilePath);
+
+    std::mutex mMutex;
+    std::string mDatabaseFilePath;
+    // most recently used first
+    std::list<Entry> mEntries;
+    std::unordered_map<std::string, std::list<Entry>::iterator> mEntriesByDate;
+};
+} // namespace tks::Persistence
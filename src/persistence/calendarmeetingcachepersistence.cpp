@@ -0,0 +1,803 @@
+// Productivity tool to help you track the time you spend on tasks
+// Copyright (C) 2026 Szymon Welgus
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+// Contact:
+//     szymonwelgus at gmail dot com
+
+
+#include "calendarmeetingcachepersistence.h"
+
+#include "base/rowmapper.h"
+
+#include "../common/logmessages.h"
+
+#include "../common/messages/sqlitemessages.h"
+
+#include "../utils/utils.h"
+
+namespace tks::Persistence
+{
+CalendarMeetingCachePersistence::CalendarMeetingCachePersistence(
+    std::shared_ptr<spdlog::logger> logger,
+    const std::string& databaseFilePath)
+    : PersistenceBase(logger, databaseFilePath)
+{
+}
+
+CalendarMeetingCachePersistence::~CalendarMeetingCachePersistence() {}
+
+SqliteResult CalendarMeetingCachePersistence::GetSyncState(const std::string& provider,
+    const std::string& accountName,
+    const std::string& date,
+    std::optional<Model::CalendarSyncStateModel>& syncStateModel) const
+{
+    sqlite3_stmt* stmt = nullptr;
+
+    int rc = sqlite3_prepare_v2(pDb,
+        CalendarMeetingCachePersistence::getSyncState.data(),
+        static_cast<int>(CalendarMeetingCachePersistence::getSyncState.size()),
+        &stmt,
+        nullptr);
+
+    if (rc != SQLITE_OK) {
+        const char* error = sqlite3_errmsg(pDb);
+        pLogger->error(LogMessages::PrepareStatementTemplate,
+            CalendarMeetingCachePersistence::getSyncState,
+            rc,
+            error);
+
+        sqlite3_finalize(stmt);
+        return SqliteResult::FailDetailed(
+            Messages::PrepareStatementMessage, rc, std::string(error));
+    }
+
+    int bindIndex = 1;
+
+    // provider
+    rc = sqlite3_bind_text(
+        stmt, bindIndex, provider.c_str(), static_cast<int>(provider.size()), SQLITE_TRANSIENT);
+
+    if (rc != SQLITE_OK) {
+        const char* error = sqlite3_errmsg(pDb);
+        pLogger->error(LogMessages::BindParameterTemplate, "provider", bindIndex, rc, error);
+
+        sqlite3_finalize(stmt);
+        return SqliteResult::FailDetailed(Messages::BindStatementMessage, rc, std::string(error));
+    }
+
+    bindIndex++;
+
+    // account_name
+    rc = sqlite3_bind_text(stmt,
+        bindIndex,
+        accountName.c_str(),
+        static_cast<int>(accountName.size()),
+        SQLITE_TRANSIENT);
+
+    if (rc != SQLITE_OK) {
+        const char* error = sqlite3_errmsg(pDb);
+        pLogger->error(LogMessages::BindParameterTemplate, "account_name", bindIndex, rc, error);
+
+        sqlite3_finalize(stmt);
+        return SqliteResult::FailDetailed(Messages::BindStatementMessage, rc, std::string(error));
+    }
+
+    bindIndex++;
+
+    // date
+    rc = sqlite3_bind_text(
+        stmt, bindIndex, date.c_str(), static_cast<int>(date.size()), SQLITE_TRANSIENT);
+
+    if (rc != SQLITE_OK) {
+        const char* error = sqlite3_errmsg(pDb);
+        pLogger->error(LogMessages::BindParameterTemplate, "date", bindIndex, rc, error);
+
+        sqlite3_finalize(stmt);
+        return SqliteResult::FailDetailed(Messages::BindStatementMessage, rc, std::string(error));
+    }
+
+    bindIndex++;
+
+    std::vector<Model::CalendarSyncStateModel> syncStateModels;
+    rc = ReadRows(stmt, Model::CalendarSyncStateModelColumns, syncStateModels);
+
+    if (rc != SQLITE_DONE) {
+        const char* error = sqlite3_errmsg(pDb);
+        pLogger->error(LogMessages::ExecStepTemplate,
+            CalendarMeetingCachePersistence::getSyncState,
+            rc,
+            error);
+
+        sqlite3_finalize(stmt);
+        return SqliteResult::FailDetailed(Messages::StepStatementMessage, rc, std::string(error));
+    }
+
+    sqlite3_finalize(stmt);
+
+    if (!syncStateModels.empty()) {
+        syncStateModel = std::move(syncStateModels.front());
+    }
+
+    SPDLOG_LOGGER_TRACE(pLogger,
+        "Calendar sync state for \"{0}\" \"{1}\" \"{2}\" {3}",
+        provider,
+        accountName,
+        date,
+        syncStateModel.has_value() ? "found" : "not found");
+
+    return SqliteResult::OK();
+}
+
+SqliteResult CalendarMeetingCachePersistence::FilterBySyncStateId(
+    const std::int64_t calendarSyncStateId,
+    std::vector<Model::CalendarMeetingModel>& meetingModels) const
+{
+    sqlite3_stmt* stmt = nullptr;
+
+    int rc = sqlite3_prepare_v2(pDb,
+        CalendarMeetingCachePersistence::filterBySyncStateId.data(),
+        static_cast<int>(CalendarMeetingCachePersistence::filterBySyncStateId.size()),
+        &stmt,
+        nullptr);
+
+    if (rc != SQLITE_OK) {
+        const char* error = sqlite3_errmsg(pDb);
+        pLogger->error(LogMessages::PrepareStatementTemplate,
+            CalendarMeetingCachePersistence::filterBySyncStateId,
+            rc,
+            error);
+
+        sqlite3_finalize(stmt);
+        return SqliteResult::FailDetailed(
+            Messages::PrepareStatementMessage, rc, std::string(error));
+    }
+
+    int bindIndex = 1;
+
+    // calendar_sync_state_id
+    rc = sqlite3_bind_int64(stmt, bindIndex, calendarSyncStateId);
+
+    if (rc != SQLITE_OK) {
+        const char* error = sqlite3_errmsg(pDb);
+        pLogger->error(
+            LogMessages::BindParameterTemplate, "calendar_sync_state_id", bindIndex, rc, error);
+
+        sqlite3_finalize(stmt);
+        return SqliteResult::FailDetailed(Messages::BindStatementMessage, rc, std::string(error));
+    }
+
+    bindIndex++;
+
+    rc = ReadRows(stmt, Model::CalendarMeetingModelColumns, meetingModels);
+
+    if (rc != SQLITE_DONE) {
+        const char* error = sqlite3_errmsg(pDb);
+        pLogger->error(LogMessages::ExecStepTemplate,
+            CalendarMeetingCachePersistence::filterBySyncStateId,
+            rc,
+            error);
+
+        sqlite3_finalize(stmt);
+        return SqliteResult::FailDetailed(Messages::StepStatementMessage, rc, std::string(error));
+    }
+
+    sqlite3_finalize(stmt);
+
+    SPDLOG_LOGGER_TRACE(
+        pLogger, LogMessages::FilterEntities, meetingModels.size(), calendarSyncStateId);
+
+    return SqliteResult::OK();
+}
+
+SqliteResult CalendarMeetingCachePersistence::Sync(
+    const Model::CalendarSyncStateModel& syncStateModel,
+    const std::vector<Model::CalendarMeetingModel>& meetingModels,
+    int& changedMeetings) const
+{
+    changedMeetings = 0;
+
+    int rc = sqlite3_exec(
+        pDb, CalendarMeetingCachePersistence::beginTransaction.c_str(), nullptr, nullptr, nullptr);
+
+    if (rc != SQLITE_OK) {
+        const char* error = sqlite3_errmsg(pDb);
+        pLogger->error(LogMessages::ExecQueryTemplate,
+            CalendarMeetingCachePersistence::beginTransaction,
+            rc,
+            error);
+
+        return SqliteResult::FailDetailed(Messages::ExecMessage, rc, std::string(error));
+    }
+
+    std::int64_t calendarSyncStateId = -1;
+
+    auto result = UpsertSyncState(syncStateModel, calendarSyncStateId);
+    if (result.Success) {
+        result = UpsertMeetings(calendarSyncStateId, meetingModels, changedMeetings);
+    }
+    if (result.Success) {
+        result = DeleteStaleMeetings(calendarSyncStateId, meetingModels, changedMeetings);
+    }
+
+    int evictedSyncStates = 0;
+    if (result.Success) {
+        result = DeleteExpiredSyncStates(evictedSyncStates);
+    }
+
+    if (!result.Success) {
+        rc = sqlite3_exec(pDb,
+            CalendarMeetingCachePersistence::rollbackTransaction.c_str(),
+            nullptr,
+            nullptr,
+            nullptr);
+
+        if (rc != SQLITE_OK) {
+            const char* error = sqlite3_errmsg(pDb);
+            pLogger->error(LogMessages::ExecQueryTemplate,
+                CalendarMeetingCachePersistence::rollbackTransaction,
+                rc,
+                error);
+        }
+
+        changedMeetings = 0;
+        return result;
+    }
+
+    rc = sqlite3_exec(
+        pDb, CalendarMeetingCachePersistence::commitTransaction.c_str(), nullptr, nullptr, nullptr);
+
+    if (rc != SQLITE_OK) {
+        const char* error = sqlite3_errmsg(pDb);
+        pLogger->error(LogMessages::ExecQueryTemplate,
+            CalendarMeetingCachePersistence::commitTransaction,
+            rc,
+            error);
+
+        sqlite3_exec(pDb,
+            CalendarMeetingCachePersistence::rollbackTransaction.c_str(),
+            nullptr,
+            nullptr,
+            nullptr);
+
+        changedMeetings = 0;
+        return SqliteResult::FailDetailed(Messages::ExecMessage, rc, std::string(error));
+    }
+
+    SPDLOG_LOGGER_TRACE(pLogger,
+        "Synced \"{0}\" calendar meetings, \"{1}\" changed, for sync state ID \"{2}\", "
+        "evicted \"{3}\" expired sync states",
+        meetingModels.size(),
+        changedMeetings,
+        calendarSyncStateId,
+        evictedSyncStates);
+
+    return SqliteResult::OK();
+}
+
+SqliteResult CalendarMeetingCachePersistence::UpsertSyncState(
+    const Model::CalendarSyncStateModel& syncStateModel,
+    std::int64_t& calendarSyncStateId) const
+{
+    sqlite3_stmt* stmt = nullptr;
+
+    int rc = sqlite3_prepare_v2(pDb,
+        CalendarMeetingCachePersistence::upsertSyncState.data(),
+        static_cast<int>(CalendarMeetingCachePersistence::upsertSyncState.size()),
+        &stmt,
+        nullptr);
+
+    if (rc != SQLITE_OK) {
+        const char* error = sqlite3_errmsg(pDb);
+        pLogger->error(LogMessages::PrepareStatementTemplate,
+            CalendarMeetingCachePersistence::upsertSyncState,
+            rc,
+            error);
+
+        sqlite3_finalize(stmt);
+        return SqliteResult::FailDetailed(
+            Messages::PrepareStatementMessage, rc, std::string(error));
+    }
+
+    int bindIndex = 1;
+
+    // provider
+    rc = sqlite3_bind_text(stmt,
+        bindIndex,
+        syncStateModel.Provider.c_str(),
+        static_cast<int>(syncStateModel.Provider.size()),
+        SQLITE_TRANSIENT);
+
+    if (rc != SQLITE_OK) {
+        const char* error = sqlite3_errmsg(pDb);
+        pLogger->error(LogMessages::BindParameterTemplate, "provider", bindIndex, rc, error);
+
+        sqlite3_finalize(stmt);
+        return SqliteResult::FailDetailed(Messages::BindStatementMessage, rc, std::string(error));
+    }
+
+    bindIndex++;
+
+    // account_name
+    rc = sqlite3_bind_text(stmt,
+        bindIndex,
+        syncStateModel.AccountName.c_str(),
+        static_cast<int>(syncStateModel.AccountName.size()),
+        SQLITE_TRANSIENT);
+
+    if (rc != SQLITE_OK) {
+        const char* error = sqlite3_errmsg(pDb);
+        pLogger->error(LogMessages::BindParameterTemplate, "account_name", bindIndex, rc, error);
+
+        sqlite3_finalize(stmt);
+        return SqliteResult::FailDetailed(Messages::BindStatementMessage, rc, std::string(error));
+    }
+
+    bindIndex++;
+
+    // date
+    rc = sqlite3_bind_text(stmt,
+        bindIndex,
+        syncStateModel.Date.c_str(),
+        static_cast<int>(syncStateModel.Date.size()),
+        SQLITE_TRANSIENT);
+
+    if (rc != SQLITE_OK) {
+        const char* error = sqlite3_errmsg(pDb);
+        pLogger->error(LogMessages::BindParameterTemplate, "date", bindIndex, rc, error);
+
+        sqlite3_finalize(stmt);
+        return SqliteResult::FailDetailed(Messages::BindStatementMessage, rc, std::string(error));
+    }
+
+    bindIndex++;
+
+    // sync_token
+    rc = sqlite3_bind_text(stmt,
+        bindIndex,
+        syncStateModel.SyncToken.c_str(),
+        static_cast<int>(syncStateModel.SyncToken.size()),
+        SQLITE_TRANSIENT);
+
+    if (rc != SQLITE_OK) {
+        const char* error = sqlite3_errmsg(pDb);
+        pLogger->error(LogMessages::BindParameterTemplate, "sync_token", bindIndex, rc, error);
+
+        sqlite3_finalize(stmt);
+        return SqliteResult::FailDetailed(Messages::BindStatementMessage, rc, std::string(error));
+    }
+
+    bindIndex++;
+
+    rc = sqlite3_step(stmt);
+
+    if (rc != SQLITE_ROW) {
+        const char* error = sqlite3_errmsg(pDb);
+        pLogger->error(LogMessages::ExecStepTemplate,
+            CalendarMeetingCachePersistence::upsertSyncState,
+            rc,
+            error);
+
+        sqlite3_finalize(stmt);
+        return SqliteResult::FailDetailed(Messages::StepStatementMessage, rc, std::string(error));
+    }
+
+    // RETURNING calendar_sync_state_id
+    calendarSyncStateId = sqlite3_column_int64(stmt, 0);
+
+    sqlite3_finalize(stmt);
+
+    SPDLOG_LOGGER_TRACE(
+        pLogger, LogMessages::EntityUpdated, "calendar_sync_states", calendarSyncStateId);
+
+    return SqliteResult::OK();
+}
+
+SqliteResult CalendarMeetingCachePersistence::UpsertMeetings(const std::int64_t calendarSyncStateId,
+    const std::vector<Model::CalendarMeetingModel>& meetingModels,
+    int& changedMeetings) const
+{
+    sqlite3_stmt* stmt = nullptr;
+
+    int rc = sqlite3_prepare_v2(pDb,
+        CalendarMeetingCachePersistence::upsertMeeting.data(),
+        static_cast<int>(CalendarMeetingCachePersistence::upsertMeeting.size()),
+        &stmt,
+        nullptr);
+
+    if (rc != SQLITE_OK) {
+        const char* error = sqlite3_errmsg(pDb);
+        pLogger->error(LogMessages::PrepareStatementTemplate,
+            CalendarMeetingCachePersistence::upsertMeeting,
+            rc,
+            error);
+
+        sqlite3_finalize(stmt);
+        return SqliteResult::FailDetailed(
+            Messages::PrepareStatementMessage, rc, std::string(error));
+    }
+
+    // one statement reset per meeting; the upsert only writes rows whose values differ
+    for (const auto& meetingModel : meetingModels) {
+        int bindIndex = 1;
+
+        // calendar_sync_state_id
+        rc = sqlite3_bind_int64(stmt, bindIndex, calendarSyncStateId);
+
+        if (rc != SQLITE_OK) {
+            const char* error = sqlite3_errmsg(pDb);
+            pLogger->error(
+                LogMessages::BindParameterTemplate, "calendar_sync_state_id", bindIndex, rc, error);
+
+            sqlite3_finalize(stmt);
+            return SqliteResult::FailDetailed(
+                Messages::BindStatementMessage, rc, std::string(error));
+        }
+
+        bindIndex++;
+
+        // entry_id
+        rc = sqlite3_bind_text(stmt,
+            bindIndex,
+            meetingModel.EntryId.c_str(),
+            static_cast<int>(meetingModel.EntryId.size()),
+            SQLITE_TRANSIENT);
+
+        if (rc != SQLITE_OK) {
+            const char* error = sqlite3_errmsg(pDb);
+            pLogger->error(LogMessages::BindParameterTemplate, "entry_id", bindIndex, rc, error);
+
+            sqlite3_finalize(stmt);
+            return SqliteResult::FailDetailed(
+                Messages::BindStatementMessage, rc, std::string(error));
+        }
+
+        bindIndex++;
+
+        // subject
+        rc = sqlite3_bind_text(stmt,
+            bindIndex,
+            meetingModel.Subject.c_str(),
+            static_cast<int>(meetingModel.Subject.size()),
+            SQLITE_TRANSIENT);
+
+        if (rc != SQLITE_OK) {
+            const char* error = sqlite3_errmsg(pDb);
+            pLogger->error(LogMessages::BindParameterTemplate, "subject", bindIndex, rc, error);
+
+            sqlite3_finalize(stmt);
+            return SqliteResult::FailDetailed(
+                Messages::BindStatementMessage, rc, std::string(error));
+        }
+
+        bindIndex++;
+
+        // start
+        rc = sqlite3_bind_text(stmt,
+            bindIndex,
+            meetingModel.Start.c_str(),
+            static_cast<int>(meetingModel.Start.size()),
+            SQLITE_TRANSIENT);
+
+        if (rc != SQLITE_OK) {
+            const char* error = sqlite3_errmsg(pDb);
+            pLogger->error(LogMessages::BindParameterTemplate, "start", bindIndex, rc, error);
+
+            sqlite3_finalize(stmt);
+            return SqliteResult::FailDetailed(
+                Messages::BindStatementMessage, rc, std::string(error));
+        }
+
+        bindIndex++;
+
+        // end
+        rc = sqlite3_bind_text(stmt,
+            bindIndex,
+            meetingModel.End.c_str(),
+            static_cast<int>(meetingModel.End.size()),
+            SQLITE_TRANSIENT);
+
+        if (rc != SQLITE_OK) {
+            const char* error = sqlite3_errmsg(pDb);
+            pLogger->error(LogMessages::BindParameterTemplate, "end", bindIndex, rc, error);
+
+            sqlite3_finalize(stmt);
+            return SqliteResult::FailDetailed(
+                Messages::BindStatementMessage, rc, std::string(error));
+        }
+
+        bindIndex++;
+
+        // duration
+        rc = sqlite3_bind_int(stmt, bindIndex, meetingModel.Duration);
+
+        if (rc != SQLITE_OK) {
+            const char* error = sqlite3_errmsg(pDb);
+            pLogger->error(LogMessages::BindParameterTemplate, "duration", bindIndex, rc, error);
+
+            sqlite3_finalize(stmt);
+            return SqliteResult::FailDetailed(
+                Messages::BindStatementMessage, rc, std::string(error));
+        }
+
+        bindIndex++;
+
+        // location
+        rc = sqlite3_bind_text(stmt,
+            bindIndex,
+            meetingModel.Location.c_str(),
+            static_cast<int>(meetingModel.Location.size()),
+            SQLITE_TRANSIENT);
+
+        if (rc != SQLITE_OK) {
+            const char* error = sqlite3_errmsg(pDb);
+            pLogger->error(LogMessages::BindParameterTemplate, "location", bindIndex, rc, error);
+
+            sqlite3_finalize(stmt);
+            return SqliteResult::FailDetailed(
+                Messages::BindStatementMessage, rc, std::string(error));
+        }
+
+        bindIndex++;
+
+        rc = sqlite3_step(stmt);
+
+        if (rc != SQLITE_DONE) {
+            const char* error = sqlite3_errmsg(pDb);
+            pLogger->error(LogMessages::ExecStepTemplate,
+                CalendarMeetingCachePersistence::upsertMeeting,
+                rc,
+                error);
+
+            sqlite3_finalize(stmt);
+            return SqliteResult::FailDetailed(
+                Messages::StepStatementMessage, rc, std::string(error));
+        }
+
+        changedMeetings += sqlite3_changes(pDb);
+
+        sqlite3_reset(stmt);
+        sqlite3_clear_bindings(stmt);
+    }
+
+    sqlite3_finalize(stmt);
+
+    return SqliteResult::OK();
+}
+
+SqliteResult CalendarMeetingCachePersistence::DeleteStaleMeetings(
+    const std::int64_t calendarSyncStateId,
+    const std::vector<Model::CalendarMeetingModel>& meetingModels,
+    int& changedMeetings) const
+{
+    std::string query = CalendarMeetingCachePersistence::deleteMeetingsBySyncStateId;
+    if (!meetingModels.empty()) {
+        query +=
+            " AND entry_id NOT IN (" + Utils::FormatSqlPlaceholders(meetingModels.size()) + ")";
+    }
+
+    sqlite3_stmt* stmt = nullptr;
+
+    int rc = sqlite3_prepare_v2(pDb,
+        query.data(),
+        static_cast<int>(query.size()),
+        &stmt,
+        nullptr);
+
+    if (rc != SQLITE_OK) {
+        const char* error = sqlite3_errmsg(pDb);
+        pLogger->error(LogMessages::PrepareStatementTemplate, query, rc, error);
+
+        sqlite3_finalize(stmt);
+        return SqliteResult::FailDetailed(
+            Messages::PrepareStatementMessage, rc, std::string(error));
+    }
+
+    int bindIndex = 1;
+
+    // calendar_sync_state_id
+    rc = sqlite3_bind_int64(stmt, bindIndex, calendarSyncStateId);
+
+    if (rc != SQLITE_OK) {
+        const char* error = sqlite3_errmsg(pDb);
+        pLogger->error(
+            LogMessages::BindParameterTemplate, "calendar_sync_state_id", bindIndex, rc, error);
+
+        sqlite3_finalize(stmt);
+        return SqliteResult::FailDetailed(Messages::BindStatementMessage, rc, std::string(error));
+    }
+
+    bindIndex++;
+
+    // entry_id
+    for (const auto& meetingModel : meetingModels) {
+        rc = sqlite3_bind_text(stmt,
+            bindIndex,
+            meetingModel.EntryId.c_str(),
+            static_cast<int>(meetingModel.EntryId.size()),
+            SQLITE_TRANSIENT);
+
+        if (rc != SQLITE_OK) {
+            const char* error = sqlite3_errmsg(pDb);
+            pLogger->error(LogMessages::BindParameterTemplate, "entry_id", bindIndex, rc, error);
+
+            sqlite3_finalize(stmt);
+            return SqliteResult::FailDetailed(
+                Messages::BindStatementMessage, rc, std::string(error));
+        }
+
+        bindIndex++;
+    }
+
+    rc = sqlite3_step(stmt);
+
+    if (rc != SQLITE_DONE) {
+        const char* error = sqlite3_errmsg(pDb);
+        pLogger->error(LogMessages::ExecStepTemplate, query, rc, error);
+
+        sqlite3_finalize(stmt);
+        return SqliteResult::FailDetailed(Messages::StepStatementMessage, rc, std::string(error));
+    }
+
+    changedMeetings += sqlite3_changes(pDb);
+
+    sqlite3_finalize(stmt);
+
+    return SqliteResult::OK();
+}
+
+SqliteResult CalendarMeetingCachePersistence::DeleteExpiredSyncStates(int& evictedSyncStates) const
+{
+    evictedSyncStates = 0;
+
+    sqlite3_stmt* stmt = nullptr;
+
+    int rc = sqlite3_prepare_v2(pDb,
+        CalendarMeetingCachePersistence::deleteExpiredSyncStates.c_str(),
+        static_cast<int>(CalendarMeetingCachePersistence::deleteExpiredSyncStates.size()),
+        &stmt,
+        nullptr);
+
+    if (rc != SQLITE_OK) {
+        const char* error = sqlite3_errmsg(pDb);
+        pLogger->error(LogMessages::PrepareStatementTemplate,
+            CalendarMeetingCachePersistence::deleteExpiredSyncStates,
+            rc,
+            error);
+
+        sqlite3_finalize(stmt);
+        return SqliteResult::FailDetailed(
+            Messages::PrepareStatementMessage, rc, std::string(error));
+    }
+
+    int bindIndex = 1;
+
+    rc = sqlite3_bind_int64(stmt, bindIndex, CalendarMeetingCachePersistence::RetentionSeconds);
+
+    if (rc != SQLITE_OK) {
+        const char* error = sqlite3_errmsg(pDb);
+        pLogger->error(LogMessages::BindParameterTemplate, "date_synced", bindIndex, rc, error);
+
+        sqlite3_finalize(stmt);
+        return SqliteResult::FailDetailed(Messages::BindStatementMessage, rc, std::string(error));
+    }
+
+    rc = sqlite3_step(stmt);
+
+    if (rc != SQLITE_DONE) {
+        const char* error = sqlite3_errmsg(pDb);
+        pLogger->error(LogMessages::ExecStepTemplate,
+            CalendarMeetingCachePersistence::deleteExpiredSyncStates,
+            rc,
+            error);
+
+        sqlite3_finalize(stmt);
+        return SqliteResult::FailDetailed(Messages::StepStatementMessage, rc, std::string(error));
+    }
+
+    evictedSyncStates = sqlite3_changes(pDb);
+
+    sqlite3_finalize(stmt);
+
+    return SqliteResult::OK();
+}
+
+constexpr std::string_view CalendarMeetingCachePersistence::getSyncState =
+    "SELECT "
+    "calendar_sync_state_id, "
+    "provider, "
+    "account_name, "
+    "date, "
+    "sync_token, "
+    "date_synced "
+    "FROM calendar_sync_states "
+    "WHERE provider = ? "
+    "AND account_name = ? "
+    "AND date = ?;";
+static_assert(CountSelectColumns(CalendarMeetingCachePersistence::getSyncState) ==
+              ColumnCount(Model::CalendarSyncStateModelColumns));
+
+constexpr std::string_view CalendarMeetingCachePersistence::filterBySyncStateId =
+    "SELECT "
+    "calendar_meeting_id, "
+    "calendar_sync_state_id, "
+    "entry_id, "
+    "subject, "
+    "start, "
+    "end, "
+    "duration, "
+    "location "
+    "FROM calendar_meetings "
+    "WHERE calendar_sync_state_id = ? "
+    "ORDER BY start, calendar_meeting_id;";
+static_assert(CountSelectColumns(CalendarMeetingCachePersistence::filterBySyncStateId) ==
+              ColumnCount(Model::CalendarMeetingModelColumns));
+
+std::string CalendarMeetingCachePersistence::upsertSyncState =
+    "INSERT INTO "
+    "calendar_sync_states "
+    "("
+    "provider, "
+    "account_name, "
+    "date, "
+    "sync_token, "
+    "date_synced"
+    ") "
+    "VALUES (?, ?, ?, ?, strftime('%s','now')) "
+    "ON CONFLICT (provider, account_name, date) DO UPDATE SET "
+    "sync_token = excluded.sync_token, "
+    "date_synced = excluded.date_synced "
+    "RETURNING calendar_sync_state_id;";
+
+std::string CalendarMeetingCachePersistence::upsertMeeting =
+    "INSERT INTO "
+    "calendar_meetings "
+    "("
+    "calendar_sync_state_id, "
+    "entry_id, "
+    "subject, "
+    "start, "
+    "end, "
+    "duration, "
+    "location"
+    ") "
+    "VALUES (?, ?, ?, ?, ?, ?, ?) "
+    "ON CONFLICT (calendar_sync_state_id, entry_id) DO UPDATE SET "
+    "subject = excluded.subject, "
+    "start = excluded.start, "
+    "end = excluded.end, "
+    "duration = excluded.duration, "
+    "location = excluded.location "
+    "WHERE subject IS NOT excluded.subject "
+    "OR start IS NOT excluded.start "
+    "OR end IS NOT excluded.end "
+    "OR duration IS NOT excluded.duration "
+    "OR location IS NOT excluded.location;";
+
+std::string CalendarMeetingCachePersistence::deleteMeetingsBySyncStateId =
+    "DELETE FROM calendar_meetings "
+    "WHERE calendar_sync_state_id = ?";
+
+// calendar_meetings rows go with their sync state through ON DELETE CASCADE
+std::string CalendarMeetingCachePersistence::deleteExpiredSyncStates =
+    "DELETE FROM calendar_sync_states "
+    "WHERE date_synced < strftime('%s','now') - ?";
+
+std::string CalendarMeetingCachePersistence::beginTransaction = "BEGIN TRANSACTION";
+
+std::string CalendarMeetingCachePersistence::commitTransaction = "COMMIT";
+
+std::string CalendarMeetingCachePersistence::rollbackTransaction = "ROLLBACK";
+} // namespace tks::Persistence
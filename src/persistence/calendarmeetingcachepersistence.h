@@ -0,0 +1,80 @@
+// Productivity tool to help you track the time you spend on tasks
+// Copyright (C) 2026 Szymon Welgus
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+// Contact:
+//     szymonwelgus at gmail dot com
+
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "base/persistencebase.h"
+
+#include "../models/calendarmeetingmodel.h"
+
+#include "../common/results/sqliteresult.h"
+
+namespace tks::Persistence
+{
+struct CalendarMeetingCachePersistence final : public PersistenceBase {
+    CalendarMeetingCachePersistence() = delete;
+    CalendarMeetingCachePersistence(const CalendarMeetingCachePersistence&) = delete;
+    CalendarMeetingCachePersistence(std::shared_ptr<spdlog::logger> logger,
+        const std::string& databaseFilePath);
+    virtual ~CalendarMeetingCachePersistence();
+
+    CalendarMeetingCachePersistence& operator=(const CalendarMeetingCachePersistence&) = delete;
+
+    SqliteResult GetSyncState(const std::string& provider,
+        const std::string& accountName,
+        const std::string& date,
+        /*out*/ std::optional<Model::CalendarSyncStateModel>& syncStateModel) const;
+    SqliteResult FilterBySyncStateId(const std::int64_t calendarSyncStateId,
+        /*out*/ std::vector<Model::CalendarMeetingModel>& meetingModels) const;
+    SqliteResult Sync(const Model::CalendarSyncStateModel& syncStateModel,
+        const std::vector<Model::CalendarMeetingModel>& meetingModels,
+        /*out*/ int& changedMeetings) const;
+
+    SqliteResult UpsertSyncState(const Model::CalendarSyncStateModel& syncStateModel,
+        /*out*/ std::int64_t& calendarSyncStateId) const;
+    SqliteResult UpsertMeetings(const std::int64_t calendarSyncStateId,
+        const std::vector<Model::CalendarMeetingModel>& meetingModels,
+        /*out*/ int& changedMeetings) const;
+    SqliteResult DeleteStaleMeetings(const std::int64_t calendarSyncStateId,
+        const std::vector<Model::CalendarMeetingModel>& meetingModels,
+        /*out*/ int& changedMeetings) const;
+    SqliteResult DeleteExpiredSyncStates(/*out*/ int& evictedSyncStates) const;
+
+    // days not fetched for this long are dropped, their meetings go with them
+    static constexpr std::int64_t RetentionSeconds = 30 * 24 * 60 * 60;
+
+    static const std::string_view getSyncState;
+    static const std::string_view filterBySyncStateId;
+    static std::string upsertSyncState;
+    static std::string upsertMeeting;
+    static std::string deleteMeetingsBySyncStateId;
+    static std::string deleteExpiredSyncStates;
+    static std::string beginTransaction;
+    static std::string commitTransaction;
+    static std::string rollbackTransaction;
+};
+} // namespace tks::Persistence
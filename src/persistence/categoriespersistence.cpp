@@ -19,6 +19,9 @@
 
 #include "categoriespersistence.h"
 
+#include "base/entityversions.h"
+#include "base/rowmapper.h"
+
 #include "../common/logmessages.h"
 
 #include "../common/messages/sqlitemessages.h"
@@ -43,7 +46,7 @@ SqliteResult CategoriesPersistence::Filter(const std::string& searchTerm,
     auto formattedSearchTerm = Utils::FormatSqlSearchTerm(searchTerm);
 
     int rc = sqlite3_prepare_v2(pDb,
-        CategoriesPersistence::filter.c_str(),
+        CategoriesPersistence::filter.data(),
         static_cast<int>(CategoriesPersistence::filter.size()),
         &stmt,
         nullptr);
@@ -92,56 +95,7 @@ SqliteResult CategoriesPersistence::Filter(const std::string& searchTerm,
         return SqliteResult::FailDetailed(Messages::BindStatementMessage, rc, std::string(error));
     }
 
-    bool done = false;
-    while (!done) {
-        switch (sqlite3_step(stmt)) {
-        case SQLITE_ROW: {
-            rc = SQLITE_ROW;
-
-            Model::CategoryModel categoryModel;
-            int columnIndex = 0;
-
-            categoryModel.CategoryId = sqlite3_column_int64(stmt, columnIndex++);
-
-            const unsigned char* res = sqlite3_column_text(stmt, columnIndex);
-            categoryModel.Name = std::string(
-                reinterpret_cast<const char*>(res), sqlite3_column_bytes(stmt, columnIndex++));
-
-            categoryModel.Color = sqlite3_column_int(stmt, columnIndex++);
-            categoryModel.Billable = !!sqlite3_column_int(stmt, columnIndex++);
-
-            if (sqlite3_column_type(stmt, columnIndex) == SQLITE_NULL) {
-                categoryModel.Description = std::nullopt;
-            } else {
-                const unsigned char* res = sqlite3_column_text(stmt, columnIndex);
-                categoryModel.Description = std::string(
-                    reinterpret_cast<const char*>(res), sqlite3_column_bytes(stmt, columnIndex));
-            }
-
-            columnIndex++;
-
-            categoryModel.DateCreated = sqlite3_column_int(stmt, columnIndex++);
-            categoryModel.DateModified = sqlite3_column_int(stmt, columnIndex++);
-            categoryModel.IsActive = !!sqlite3_column_int(stmt, columnIndex++);
-
-            if (sqlite3_column_type(stmt, columnIndex) == SQLITE_NULL) {
-                categoryModel.ProjectId = std::nullopt;
-            } else {
-                categoryModel.ProjectId =
-                    std::make_optional<std::int64_t>(sqlite3_column_int64(stmt, columnIndex));
-            }
-
-            categoryModels.push_back(categoryModel);
-            break;
-        }
-        case SQLITE_DONE:
-            rc = SQLITE_DONE;
-            done = true;
-            break;
-        default:
-            break;
-        }
-    }
+    rc = ReadRows(stmt, Model::CategoryModelColumns, categoryModels);
 
     if (rc != SQLITE_DONE) {
         const char* error = sqlite3_errmsg(pDb);
@@ -164,7 +118,7 @@ SqliteResult CategoriesPersistence::GetById(const std::int64_t categoryId,
     sqlite3_stmt* stmt = nullptr;
 
     int rc = sqlite3_prepare_v2(pDb,
-        CategoriesPersistence::getById.c_str(),
+        CategoriesPersistence::getById.data(),
         static_cast<int>(CategoriesPersistence::getById.size()),
         &stmt,
         nullptr);
@@ -201,37 +155,7 @@ SqliteResult CategoriesPersistence::GetById(const std::int64_t categoryId,
         return SqliteResult::FailDetailed(Messages::StepStatementMessage, rc, std::string(error));
     }
 
-    int columnIndex = 0;
-
-    categoryModel.CategoryId = sqlite3_column_int64(stmt, columnIndex++);
-
-    const unsigned char* res = sqlite3_column_text(stmt, columnIndex);
-    categoryModel.Name =
-        std::string(reinterpret_cast<const char*>(res), sqlite3_column_bytes(stmt, columnIndex++));
-
-    categoryModel.Color = sqlite3_column_int(stmt, columnIndex++);
-    categoryModel.Billable = !!sqlite3_column_int(stmt, columnIndex++);
-
-    if (sqlite3_column_type(stmt, columnIndex) == SQLITE_NULL) {
-        categoryModel.Description = std::nullopt;
-    } else {
-        const unsigned char* res = sqlite3_column_text(stmt, columnIndex);
-        categoryModel.Description = std::string(
-            reinterpret_cast<const char*>(res), sqlite3_column_bytes(stmt, columnIndex));
-    }
-
-    columnIndex++;
-
-    categoryModel.DateCreated = sqlite3_column_int(stmt, columnIndex++);
-    categoryModel.DateModified = sqlite3_column_int(stmt, columnIndex++);
-    categoryModel.IsActive = !!sqlite3_column_int(stmt, columnIndex++);
-
-    if (sqlite3_column_type(stmt, columnIndex) == SQLITE_NULL) {
-        categoryModel.ProjectId = std::nullopt;
-    } else {
-        categoryModel.ProjectId =
-            std::make_optional<std::int64_t>(sqlite3_column_int64(stmt, columnIndex));
-    }
+    ReadRow(stmt, Model::CategoryModelColumns, categoryModel);
 
     rc = sqlite3_step(stmt);
 
@@ -362,6 +286,8 @@ SqliteResult CategoriesPersistence::Create(std::int64_t& categoryId,
     categoryId = rowId;
     SPDLOG_LOGGER_TRACE(pLogger, LogMessages::EntityCreated, "category", rowId);
 
+    EntityVersions::GetInstance().Bump(VersionedEntity::Categories);
+
     return SqliteResult::OK();
 }
 
@@ -505,6 +431,8 @@ SqliteResult CategoriesPersistence::Update(const Model::CategoryModel& categoryM
     sqlite3_finalize(stmt);
     SPDLOG_LOGGER_TRACE(pLogger, LogMessages::EntityUpdated, "category", categoryModel.CategoryId);
 
+    EntityVersions::GetInstance().Bump(VersionedEntity::Categories);
+
     return SqliteResult::OK();
 }
 
@@ -565,36 +493,43 @@ SqliteResult CategoriesPersistence::Delete(const std::int64_t categoryId) const
     sqlite3_finalize(stmt);
     SPDLOG_LOGGER_TRACE(pLogger, LogMessages::EntityDeleted, "category", categoryId);
 
+    EntityVersions::GetInstance().Bump(VersionedEntity::Categories);
+
     return SqliteResult::OK();
 }
 
-std::string CategoriesPersistence::filter = "SELECT "
-                                            "category_id, "
-                                            "name, "
-                                            "color, "
-                                            "description, "
-                                            "date_created, "
-                                            "date_modified, "
-                                            "is_active, "
-                                            "project_id "
-                                            "FROM categories "
-                                            "WHERE is_active = 1 "
-                                            "AND (name LIKE ? "
-                                            "OR description LIKE ?);";
-
-std::string CategoriesPersistence::getById = "SELECT "
-                                             "category_id, "
-                                             "name, "
-                                             "color, "
-                                             "billable, "
-                                             "description, "
-                                             "date_created, "
-                                             "date_modified, "
-                                             "is_active, "
-                                             "project_id "
-                                             "FROM categories "
-                                             "WHERE category_id = ? "
-                                             "AND is_active = 1;";
+constexpr std::string_view CategoriesPersistence::filter = "SELECT "
+                                                           "category_id, "
+                                                           "name, "
+                                                           "color, "
+                                                           "billable, "
+                                                           "description, "
+                                                           "date_created, "
+                                                           "date_modified, "
+                                                           "is_active, "
+                                                           "project_id "
+                                                           "FROM categories "
+                                                           "WHERE is_active = 1 "
+                                                           "AND (name LIKE ? "
+                                                           "OR description LIKE ?);";
+static_assert(CountSelectColumns(CategoriesPersistence::filter) ==
+              ColumnCount(Model::CategoryModelColumns));
+
+constexpr std::string_view CategoriesPersistence::getById = "SELECT "
+                                                            "category_id, "
+                                                            "name, "
+                                                            "color, "
+                                                            "billable, "
+                                                            "description, "
+                                                            "date_created, "
+                                                            "date_modified, "
+                                                            "is_active, "
+                                                            "project_id "
+                                                            "FROM categories "
+                                                            "WHERE category_id = ? "
+                                                            "AND is_active = 1;";
+static_assert(CountSelectColumns(CategoriesPersistence::getById) ==
+              ColumnCount(Model::CategoryModelColumns));
 
 std::string CategoriesPersistence::create = "INSERT INTO "
                                             "categories "
@@ -22,6 +22,7 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "base/persistencebase.h"
@@ -49,8 +50,8 @@ struct CategoriesPersistence final : public PersistenceBase {
     SqliteResult Update(const Model::CategoryModel& categoryModel) const;
     SqliteResult Delete(const std::int64_t categoryId) const;
 
-    static std::string filter;
-    static std::string getById;
+    static const std::string_view filter;
+    static const std::string_view getById;
     static std::string create;
     static std::string update;
     static std::string isActive;
@@ -19,6 +19,9 @@
 
 #include "clientspersistence.h"
 
+#include "base/entityversions.h"
+#include "base/rowmapper.h"
+
 #include "../common/logmessages.h"
 
 #include "../common/messages/sqlitemessages.h"
@@ -43,7 +46,7 @@ SqliteResult ClientsPersistence::Filter(const std::string& searchTerm,
     auto formattedSearchTerm = Utils::FormatSqlSearchTerm(searchTerm);
 
     int rc = sqlite3_prepare_v2(pDb,
-        ClientsPersistence::filter.c_str(),
+        ClientsPersistence::filter.data(),
         static_cast<int>(ClientsPersistence::filter.size()),
         &stmt,
         nullptr);
@@ -113,48 +116,7 @@ SqliteResult ClientsPersistence::Filter(const std::string& searchTerm,
             Messages::BindStatementMessage, rc, std::string(error));
     }
 
-    bool done = false;
-    while (!done) {
-        switch (sqlite3_step(stmt)) {
-        case SQLITE_ROW: {
-            rc = SQLITE_ROW;
-
-            Model::ClientModel clientModel;
-            int columnIndex = 0;
-
-            clientModel.ClientId = sqlite3_column_int64(stmt, columnIndex++);
-
-            const unsigned char* res = sqlite3_column_text(stmt, columnIndex);
-            clientModel.Name = std::string(
-                reinterpret_cast<const char*>(res), sqlite3_column_bytes(stmt, columnIndex++));
-
-            if (sqlite3_column_type(stmt, columnIndex) == SQLITE_NULL) {
-                clientModel.Description = std::nullopt;
-            } else {
-                const unsigned char* res = sqlite3_column_text(stmt, columnIndex);
-                clientModel.Description = std::string(
-                    reinterpret_cast<const char*>(res), sqlite3_column_bytes(stmt, columnIndex));
-            }
-
-            columnIndex++;
-
-            clientModel.DateCreated = sqlite3_column_int(stmt, columnIndex++);
-            clientModel.DateModified = sqlite3_column_int(stmt, columnIndex++);
-            clientModel.IsActive = !!sqlite3_column_int(stmt, columnIndex++);
-
-            clientModel.EmployerId = sqlite3_column_int64(stmt, columnIndex++);
-
-            clientModels.push_back(clientModel);
-            break;
-        }
-        case SQLITE_DONE:
-            rc = SQLITE_DONE;
-            done = true;
-            break;
-        default:
-            break;
-        }
-    }
+    rc = ReadRows(stmt, Model::ClientModelColumns, clientModels);
 
     if (rc != SQLITE_DONE) {
         const char* error = sqlite3_errmsg(pDb);
@@ -178,7 +140,7 @@ SqliteResult ClientsPersistence::FilterByEmployerId(const std::int64_t employerI
     sqlite3_stmt* stmt = nullptr;
 
     int rc = sqlite3_prepare_v2(pDb,
-        ClientsPersistence::filterByEmployerId.c_str(),
+        ClientsPersistence::filterByEmployerId.data(),
         static_cast<int>(ClientsPersistence::filterByEmployerId.size()),
         &stmt,
         nullptr);
@@ -209,48 +171,7 @@ SqliteResult ClientsPersistence::FilterByEmployerId(const std::int64_t employerI
             Messages::BindStatementMessage, rc, std::string(error));
     }
 
-    bool done = false;
-    while (!done) {
-        switch (sqlite3_step(stmt)) {
-        case SQLITE_ROW: {
-            rc = SQLITE_ROW;
-
-            Model::ClientModel clientModel;
-            int columnIndex = 0;
-
-            clientModel.ClientId = sqlite3_column_int64(stmt, columnIndex++);
-
-            const unsigned char* res = sqlite3_column_text(stmt, columnIndex);
-            clientModel.Name = std::string(
-                reinterpret_cast<const char*>(res), sqlite3_column_bytes(stmt, columnIndex++));
-
-            if (sqlite3_column_type(stmt, columnIndex) == SQLITE_NULL) {
-                clientModel.Description = std::nullopt;
-            } else {
-                const unsigned char* res = sqlite3_column_text(stmt, columnIndex);
-                clientModel.Description = std::string(
-                    reinterpret_cast<const char*>(res), sqlite3_column_bytes(stmt, columnIndex));
-            }
-
-            columnIndex++;
-
-            clientModel.DateCreated = sqlite3_column_int(stmt, columnIndex++);
-            clientModel.DateModified = sqlite3_column_int(stmt, columnIndex++);
-            clientModel.IsActive = !!sqlite3_column_int(stmt, columnIndex++);
-
-            clientModel.EmployerId = sqlite3_column_int64(stmt, columnIndex++);
-
-            clientModels.push_back(clientModel);
-            break;
-        }
-        case SQLITE_DONE:
-            rc = SQLITE_DONE;
-            done = true;
-            break;
-        default:
-            break;
-        }
-    }
+    rc = ReadRows(stmt, Model::ClientModelColumns, clientModels);
 
     if (rc != SQLITE_DONE) {
         const char* error = sqlite3_errmsg(pDb);
@@ -276,7 +197,7 @@ SqliteResult ClientsPersistence::GetById(const std::int64_t clientId,
     sqlite3_stmt* stmt = nullptr;
 
     int rc = sqlite3_prepare_v2(pDb,
-        ClientsPersistence::getById.c_str(),
+        ClientsPersistence::getById.data(),
         static_cast<int>(ClientsPersistence::getById.size()),
         &stmt,
         nullptr);
@@ -315,29 +236,7 @@ SqliteResult ClientsPersistence::GetById(const std::int64_t clientId,
             Messages::StepStatementMessage, rc, std::string(error));
     }
 
-    int columnIndex = 0;
-
-    clientModel.ClientId = sqlite3_column_int64(stmt, columnIndex++);
-
-    const unsigned char* res = sqlite3_column_text(stmt, columnIndex);
-    clientModel.Name =
-        std::string(reinterpret_cast<const char*>(res), sqlite3_column_bytes(stmt, columnIndex++));
-
-    if (sqlite3_column_type(stmt, columnIndex) == SQLITE_NULL) {
-        clientModel.Description = std::nullopt;
-    } else {
-        const unsigned char* res = sqlite3_column_text(stmt, columnIndex);
-        clientModel.Description = std::string(
-            reinterpret_cast<const char*>(res), sqlite3_column_bytes(stmt, columnIndex));
-    }
-
-    columnIndex++;
-
-    clientModel.DateCreated = sqlite3_column_int(stmt, columnIndex++);
-    clientModel.DateModified = sqlite3_column_int(stmt, columnIndex++);
-    clientModel.IsActive = !!sqlite3_column_int(stmt, columnIndex++);
-
-    clientModel.EmployerId = sqlite3_column_int64(stmt, columnIndex++);
+    ReadRow(stmt, Model::ClientModelColumns, clientModel);
 
     rc = sqlite3_step(stmt);
 
@@ -444,6 +343,8 @@ SqliteResult ClientsPersistence::Create(std::int64_t& clientId,
     clientId = rowId;
     SPDLOG_LOGGER_TRACE(pLogger, LogMessages::EntityCreated, "client", rowId);
 
+    EntityVersions::GetInstance().Bump(VersionedEntity::Clients);
+
     return SqliteResult::OK();
 }
 
@@ -556,6 +457,8 @@ SqliteResult ClientsPersistence::Update(const Model::ClientModel& clientModel) c
 
     SPDLOG_LOGGER_TRACE(pLogger, LogMessages::EntityUpdated, "client", clientModel.ClientId);
 
+    EntityVersions::GetInstance().Bump(VersionedEntity::Clients);
+
     return SqliteResult::OK();
 }
 
@@ -621,48 +524,58 @@ SqliteResult ClientsPersistence::Delete(const std::int64_t clientId) const
 
     SPDLOG_LOGGER_TRACE(pLogger, LogMessages::EntityDeleted, "client", clientId);
 
+    EntityVersions::GetInstance().Bump(VersionedEntity::Clients);
+
     return SqliteResult::OK();
 }
 
-std::string ClientsPersistence::filter = "SELECT "
-                                         "clients.client_id, "
-                                         "clients.name AS client_name, "
-                                         "clients.description AS client_description, "
-                                         "clients.date_created, "
-                                         "clients.date_modified, "
-                                         "clients.is_active, "
-                                         "clients.employer_id, "
-                                         "employers.name AS employer_name "
-                                         "FROM clients "
-                                         "INNER JOIN employers "
-                                         "ON clients.employer_id = employers.employer_id "
-                                         "WHERE clients.is_active = 1 "
-                                         "AND (client_name LIKE ? "
-                                         "OR client_description LIKE ? "
-                                         "OR employer_name LIKE ?); ";
-
-std::string ClientsPersistence::filterByEmployerId = "SELECT "
-                                                     "clients.client_id, "
-                                                     "clients.name, "
-                                                     "clients.description, "
-                                                     "clients.date_created, "
-                                                     "clients.date_modified, "
-                                                     "clients.is_active, "
-                                                     "clients.employer_id "
-                                                     "FROM clients "
-                                                     "WHERE clients.is_active = 1 "
-                                                     "AND employer_id = ?";
-
-std::string ClientsPersistence::getById = "SELECT "
-                                          "clients.client_id, "
-                                          "clients.name, "
-                                          "clients.description, "
-                                          "clients.date_created, "
-                                          "clients.date_modified, "
-                                          "clients.is_active, "
-                                          "clients.employer_id "
-                                          "FROM clients "
-                                          "WHERE clients.client_id = ?";
+constexpr std::string_view ClientsPersistence::filter =
+    "SELECT "
+    "clients.client_id, "
+    "clients.name AS client_name, "
+    "clients.description AS client_description, "
+    "clients.date_created, "
+    "clients.date_modified, "
+    "clients.is_active, "
+    "clients.employer_id, "
+    "employers.name AS employer_name "
+    "FROM clients "
+    "INNER JOIN employers "
+    "ON clients.employer_id = employers.employer_id "
+    "WHERE clients.is_active = 1 "
+    "AND (client_name LIKE ? "
+    "OR client_description LIKE ? "
+    "OR employer_name LIKE ?); ";
+// employer_name trails the model columns so the search term can match it
+static_assert(CountSelectColumns(ClientsPersistence::filter) ==
+              ColumnCount(Model::ClientModelColumns) + 1);
+
+constexpr std::string_view ClientsPersistence::filterByEmployerId = "SELECT "
+                                                                    "clients.client_id, "
+                                                                    "clients.name, "
+                                                                    "clients.description, "
+                                                                    "clients.date_created, "
+                                                                    "clients.date_modified, "
+                                                                    "clients.is_active, "
+                                                                    "clients.employer_id "
+                                                                    "FROM clients "
+                                                                    "WHERE clients.is_active = 1 "
+                                                                    "AND employer_id = ?";
+static_assert(CountSelectColumns(ClientsPersistence::filterByEmployerId) ==
+              ColumnCount(Model::ClientModelColumns));
+
+constexpr std::string_view ClientsPersistence::getById = "SELECT "
+                                                         "clients.client_id, "
+                                                         "clients.name, "
+                                                         "clients.description, "
+                                                         "clients.date_created, "
+                                                         "clients.date_modified, "
+                                                         "clients.is_active, "
+                                                         "clients.employer_id "
+                                                         "FROM clients "
+                                                         "WHERE clients.client_id = ?";
+static_assert(CountSelectColumns(ClientsPersistence::getById) ==
+              ColumnCount(Model::ClientModelColumns));
 
 std::string ClientsPersistence::create = "INSERT INTO "
                                          "clients "
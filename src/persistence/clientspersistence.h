@@ -21,6 +21,8 @@
 
 #include <cstdint>
 #include <memory>
+#include <string>
+#include <string_view>
 #include <vector>
 
 #include "base/persistencebase.h"
@@ -50,9 +52,9 @@ struct ClientsPersistence final : public PersistenceBase {
     SqliteResult Update(const Model::ClientModel& clientModel) const;
     SqliteResult Delete(const std::int64_t clientId) const;
 
-    static std::string filter;
-    static std::string filterByEmployerId;
-    static std::string getById;
+    static const std::string_view filter;
+    static const std::string_view filterByEmployerId;
+    static const std::string_view getById;
     static std::string create;
     static std::string update;
     static std::string isActive;
@@ -19,6 +19,9 @@
 
 #include "employerspersistence.h"
 
+#include "base/entityversions.h"
+#include "base/rowmapper.h"
+
 #include "../common/logmessages.h"
 
 #include "../common/messages/sqlitemessages.h"
@@ -43,7 +46,7 @@ SqliteResult EmployersPersistence::Filter(const std::string& searchTerm,
     sqlite3_stmt* stmt = nullptr;
 
     int rc = sqlite3_prepare_v2(pDb,
-        EmployersPersistence::filter.c_str(),
+        EmployersPersistence::filter.data(),
         static_cast<int>(EmployersPersistence::filter.size()),
         &stmt,
         nullptr);
@@ -94,48 +97,7 @@ SqliteResult EmployersPersistence::Filter(const std::string& searchTerm,
             Messages::BindStatementMessage, rc, std::string(error));
     }
 
-    bool done = false;
-    while (!done) {
-        switch (sqlite3_step(stmt)) {
-        case SQLITE_ROW: {
-            rc = SQLITE_ROW;
-            Model::EmployerModel employerModel;
-
-            int columnIndex = 0;
-
-            employerModel.EmployerId = sqlite3_column_int64(stmt, columnIndex++);
-
-            const unsigned char* res = sqlite3_column_text(stmt, columnIndex);
-            employerModel.Name = std::string(
-                reinterpret_cast<const char*>(res), sqlite3_column_bytes(stmt, columnIndex++));
-
-            employerModel.IsDefault = !!sqlite3_column_int(stmt, columnIndex++);
-
-            if (sqlite3_column_type(stmt, columnIndex) == SQLITE_NULL) {
-                employerModel.Description = std::nullopt;
-            } else {
-                const unsigned char* res = sqlite3_column_text(stmt, columnIndex);
-                employerModel.Description = std::string(
-                    reinterpret_cast<const char*>(res), sqlite3_column_bytes(stmt, columnIndex));
-            }
-
-            columnIndex++;
-
-            employerModel.DateCreated = sqlite3_column_int(stmt, columnIndex++);
-            employerModel.DateModified = sqlite3_column_int(stmt, columnIndex++);
-            employerModel.IsActive = !!sqlite3_column_int(stmt, columnIndex++);
-
-            employerModels.push_back(employerModel);
-            break;
-        }
-        case SQLITE_DONE:
-            rc = SQLITE_DONE;
-            done = true;
-            break;
-        default:
-            break;
-        }
-    }
+    rc = ReadRows(stmt, Model::EmployerModelColumns, employerModels);
 
     if (rc != SQLITE_DONE) {
         const char* error = sqlite3_errmsg(pDb);
@@ -162,7 +124,7 @@ SqliteResult EmployersPersistence::GetById(const std::int64_t employerId,
     sqlite3_stmt* stmt = nullptr;
 
     int rc = sqlite3_prepare_v2(pDb,
-        EmployersPersistence::getById.c_str(),
+        EmployersPersistence::getById.data(),
         static_cast<int>(EmployersPersistence::getById.size()),
         &stmt,
         nullptr);
@@ -201,29 +163,7 @@ SqliteResult EmployersPersistence::GetById(const std::int64_t employerId,
             Messages::StepStatementMessage, rc, std::string(error));
     }
 
-    int columnIndex = 0;
-
-    employerModel.EmployerId = sqlite3_column_int64(stmt, columnIndex++);
-
-    const unsigned char* res = sqlite3_column_text(stmt, columnIndex);
-    employerModel.Name =
-        std::string(reinterpret_cast<const char*>(res), sqlite3_column_bytes(stmt, columnIndex++));
-
-    employerModel.IsDefault = !!sqlite3_column_int(stmt, columnIndex++);
-
-    if (sqlite3_column_type(stmt, columnIndex) == SQLITE_NULL) {
-        employerModel.Description = std::nullopt;
-    } else {
-        const unsigned char* res = sqlite3_column_text(stmt, columnIndex);
-        employerModel.Description = std::string(
-            reinterpret_cast<const char*>(res), sqlite3_column_bytes(stmt, columnIndex));
-    }
-
-    columnIndex++;
-
-    employerModel.DateCreated = sqlite3_column_int(stmt, columnIndex++);
-    employerModel.DateModified = sqlite3_column_int(stmt, columnIndex++);
-    employerModel.IsActive = sqlite3_column_int(stmt, columnIndex++);
+    ReadRow(stmt, Model::EmployerModelColumns, employerModel);
 
     rc = sqlite3_step(stmt);
 
@@ -335,6 +275,8 @@ SqliteResult EmployersPersistence::Create(std::int64_t& employerId,
     employerId = sqlite3_last_insert_rowid(pDb);
     SPDLOG_LOGGER_TRACE(pLogger, LogMessages::EntityCreated, "employer", employerId);
 
+    EntityVersions::GetInstance().Bump(VersionedEntity::Employers);
+
     return SqliteResult::OK();
 }
 
@@ -449,6 +391,8 @@ SqliteResult EmployersPersistence::Update(const Model::EmployerModel& employerMo
     sqlite3_finalize(stmt);
     SPDLOG_LOGGER_TRACE(pLogger, LogMessages::EntityUpdated, "employer", employerModel.EmployerId);
 
+    EntityVersions::GetInstance().Bump(VersionedEntity::Employers);
+
     return SqliteResult::OK();
 }
 
@@ -512,6 +456,8 @@ SqliteResult EmployersPersistence::Delete(const std::int64_t employerId) const
     sqlite3_finalize(stmt);
     SPDLOG_LOGGER_TRACE(pLogger, LogMessages::EntityDeleted, "employer", employerId);
 
+    EntityVersions::GetInstance().Bump(VersionedEntity::Employers);
+
     return SqliteResult::OK();
 }
 
@@ -563,6 +509,8 @@ SqliteResult EmployersPersistence::UnsetDefault() const
 
     SPDLOG_LOGGER_TRACE(pLogger, "Unset default \"employer\"");
 
+    EntityVersions::GetInstance().Bump(VersionedEntity::Employers);
+
     return SqliteResult::OK();
 }
 
@@ -571,7 +519,7 @@ SqliteResult EmployersPersistence::SelectDefault(Model::EmployerModel& employerM
     sqlite3_stmt* stmt = nullptr;
 
     int rc = sqlite3_prepare_v2(pDb,
-        EmployersPersistence::selectDefault.c_str(),
+        EmployersPersistence::selectDefault.data(),
         static_cast<int>(EmployersPersistence::selectDefault.size()),
         &stmt,
         nullptr);
@@ -605,29 +553,7 @@ SqliteResult EmployersPersistence::SelectDefault(Model::EmployerModel& employerM
             Messages::StepStatementMessage, rc, std::string(error));
     }
 
-    int columnIndex = 0;
-
-    employerModel.EmployerId = sqlite3_column_int64(stmt, columnIndex++);
-
-    const unsigned char* res = sqlite3_column_text(stmt, columnIndex);
-    employerModel.Name =
-        std::string(reinterpret_cast<const char*>(res), sqlite3_column_bytes(stmt, columnIndex++));
-
-    employerModel.IsDefault = !!sqlite3_column_int(stmt, columnIndex++);
-
-    if (sqlite3_column_type(stmt, columnIndex) == SQLITE_NULL) {
-        employerModel.Description = std::nullopt;
-    } else {
-        const unsigned char* res = sqlite3_column_text(stmt, columnIndex);
-        employerModel.Description = std::string(
-            reinterpret_cast<const char*>(res), sqlite3_column_bytes(stmt, columnIndex));
-    }
-
-    columnIndex++;
-
-    employerModel.DateCreated = sqlite3_column_int(stmt, columnIndex++);
-    employerModel.DateModified = sqlite3_column_int(stmt, columnIndex++);
-    employerModel.IsActive = sqlite3_column_int(stmt, columnIndex++);
+    ReadRow(stmt, Model::EmployerModelColumns, employerModel);
 
     rc = sqlite3_step(stmt);
 
@@ -650,29 +576,33 @@ SqliteResult EmployersPersistence::SelectDefault(Model::EmployerModel& employerM
     return SqliteResult::OK();
 }
 
-std::string EmployersPersistence::filter = "SELECT "
-                                           "employer_id, "
-                                           "name, "
-                                           "is_default, "
-                                           "description, "
-                                           "date_created, "
-                                           "date_modified, "
-                                           "is_active "
-                                           "FROM employers "
-                                           "WHERE is_active = 1 "
-                                           "AND (name LIKE ? "
-                                           "OR description LIKE ?)";
-
-std::string EmployersPersistence::getById = "SELECT "
-                                            "employer_id, "
-                                            "name, "
-                                            "is_default, "
-                                            "description, "
-                                            "date_created, "
-                                            "date_modified, "
-                                            "is_active "
-                                            "FROM employers "
-                                            "WHERE employer_id = ?";
+constexpr std::string_view EmployersPersistence::filter = "SELECT "
+                                                          "employer_id, "
+                                                          "name, "
+                                                          "is_default, "
+                                                          "description, "
+                                                          "date_created, "
+                                                          "date_modified, "
+                                                          "is_active "
+                                                          "FROM employers "
+                                                          "WHERE is_active = 1 "
+                                                          "AND (name LIKE ? "
+                                                          "OR description LIKE ?)";
+static_assert(CountSelectColumns(EmployersPersistence::filter) ==
+              ColumnCount(Model::EmployerModelColumns));
+
+constexpr std::string_view EmployersPersistence::getById = "SELECT "
+                                                           "employer_id, "
+                                                           "name, "
+                                                           "is_default, "
+                                                           "description, "
+                                                           "date_created, "
+                                                           "date_modified, "
+                                                           "is_active "
+                                                           "FROM employers "
+                                                           "WHERE employer_id = ?";
+static_assert(CountSelectColumns(EmployersPersistence::getById) ==
+              ColumnCount(Model::EmployerModelColumns));
 
 std::string EmployersPersistence::create = "INSERT INTO "
                                            "employers "
@@ -702,14 +632,16 @@ std::string EmployersPersistence::unsetDefault = "UPDATE employers "
                                                  "is_default = 0, "
                                                  "date_modified = ?";
 
-std::string EmployersPersistence::selectDefault = "SELECT "
-                                                  "employer_id, "
-                                                  "name, "
-                                                  "is_default, "
-                                                  "description, "
-                                                  "date_created, "
-                                                  "date_modified, "
-                                                  "is_active "
-                                                  "FROM employers "
-                                                  "WHERE is_default = 1";
+constexpr std::string_view EmployersPersistence::selectDefault = "SELECT "
+                                                                 "employer_id, "
+                                                                 "name, "
+                                                                 "is_default, "
+                                                                 "description, "
+                                                                 "date_created, "
+                                                                 "date_modified, "
+                                                                 "is_active "
+                                                                 "FROM employers "
+                                                                 "WHERE is_default = 1";
+static_assert(CountSelectColumns(EmployersPersistence::selectDefault) ==
+              ColumnCount(Model::EmployerModelColumns));
 } // namespace tks::Persistence
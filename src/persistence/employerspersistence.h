@@ -22,6 +22,7 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "base/persistencebase.h"
@@ -53,13 +54,13 @@ struct EmployersPersistence final : public PersistenceBase {
     SqliteResult UnsetDefault() const;
     SqliteResult SelectDefault(/*out*/ Model::EmployerModel& employerModel) const;
 
-    static std::string filter;
-    static std::string getById;
+    static const std::string_view filter;
+    static const std::string_view getById;
     static std::string create;
     static std::string update;
     static std::string isActive;
     static std::string unsetDefault;
-    static std::string selectDefault;
+    static const std::string_view selectDefault;
 };
 } // namespace Persistence
 } // namespace tks
@@ -19,6 +19,9 @@
 
 #include "projectspersistence.h"
 
+#include "base/entityversions.h"
+#include "base/rowmapper.h"
+
 #include "../common/logmessages.h"
 
 #include "../common/messages/sqlitemessages.h"
@@ -43,7 +46,7 @@ SqliteResult ProjectsPersistence::Filter(const std::string& searchTerm,
     auto formattedSearchTerm = Utils::FormatSqlSearchTerm(searchTerm);
 
     int rc = sqlite3_prepare_v2(pDb,
-        ProjectsPersistence::filter.c_str(),
+        ProjectsPersistence::filter.data(),
         static_cast<int>(ProjectsPersistence::filter.size()),
         &stmt,
         nullptr);
@@ -144,60 +147,7 @@ SqliteResult ProjectsPersistence::Filter(const std::string& searchTerm,
         return SqliteResult::FailDetailed(Messages::BindStatementMessage, rc, std::string(error));
     }
 
-    bool done = false;
-    while (!done) {
-        switch (sqlite3_step(stmt)) {
-        case SQLITE_ROW: {
-            rc = SQLITE_ROW;
-
-            Model::ProjectModel projectModel;
-            int columnIndex = 0;
-
-            projectModel.ProjectId = sqlite3_column_int64(stmt, columnIndex++);
-
-            const unsigned char* res = sqlite3_column_text(stmt, columnIndex);
-            projectModel.Name = std::string(
-                reinterpret_cast<const char*>(res), sqlite3_column_bytes(stmt, columnIndex++));
-
-            const unsigned char* res2 = sqlite3_column_text(stmt, columnIndex);
-            projectModel.DisplayName = std::string(
-                reinterpret_cast<const char*>(res2), sqlite3_column_bytes(stmt, columnIndex++));
-
-            projectModel.IsDefault = !!sqlite3_column_int(stmt, columnIndex++);
-
-            if (sqlite3_column_type(stmt, columnIndex) == SQLITE_NULL) {
-                projectModel.Description = std::nullopt;
-            } else {
-                const unsigned char* res = sqlite3_column_text(stmt, columnIndex);
-                projectModel.Description = std::make_optional(std::string(
-                    reinterpret_cast<const char*>(res), sqlite3_column_bytes(stmt, columnIndex)));
-            }
-
-            columnIndex++;
-
-            projectModel.DateCreated = sqlite3_column_int(stmt, columnIndex++);
-            projectModel.DateModified = sqlite3_column_int(stmt, columnIndex++);
-            projectModel.IsActive = !!sqlite3_column_int(stmt, columnIndex++);
-
-            projectModel.EmployerId = sqlite3_column_int64(stmt, columnIndex++);
-
-            if (sqlite3_column_type(stmt, columnIndex) == SQLITE_NULL) {
-                projectModel.ClientId = std::nullopt;
-            } else {
-                projectModel.ClientId = std::make_optional(sqlite3_column_int64(stmt, columnIndex));
-            }
-
-            projectModels.push_back(projectModel);
-            break;
-        }
-        case SQLITE_DONE:
-            rc = SQLITE_DONE;
-            done = true;
-            break;
-        default:
-            break;
-        }
-    }
+    rc = ReadRows(stmt, Model::ProjectModelColumns, projectModels);
 
     if (rc != SQLITE_DONE) {
         const char* error = sqlite3_errmsg(pDb);
@@ -221,7 +171,7 @@ SqliteResult ProjectsPersistence::FilterByEmployerIdOrClientId(
     sqlite3_stmt* stmt = nullptr;
 
     int rc = sqlite3_prepare_v2(pDb,
-        ProjectsPersistence::filterByEmployerIdAndOrClientId.c_str(),
+        ProjectsPersistence::filterByEmployerIdAndOrClientId.data(),
         static_cast<int>(ProjectsPersistence::filterByEmployerIdAndOrClientId.size()),
         &stmt,
         nullptr);
@@ -272,60 +222,7 @@ SqliteResult ProjectsPersistence::FilterByEmployerIdOrClientId(
         return SqliteResult::FailDetailed(Messages::BindStatementMessage, rc, std::string(error));
     }
 
-    bool done = false;
-    while (!done) {
-        switch (sqlite3_step(stmt)) {
-        case SQLITE_ROW: {
-            rc = SQLITE_ROW;
-
-            Model::ProjectModel projectModel;
-            int columnIndex = 0;
-
-            projectModel.ProjectId = sqlite3_column_int64(stmt, columnIndex++);
-
-            const unsigned char* res = sqlite3_column_text(stmt, columnIndex);
-            projectModel.Name = std::string(
-                reinterpret_cast<const char*>(res), sqlite3_column_bytes(stmt, columnIndex++));
-
-            const unsigned char* res2 = sqlite3_column_text(stmt, columnIndex);
-            projectModel.DisplayName = std::string(
-                reinterpret_cast<const char*>(res2), sqlite3_column_bytes(stmt, columnIndex++));
-
-            projectModel.IsDefault = !!sqlite3_column_int(stmt, columnIndex++);
-
-            if (sqlite3_column_type(stmt, columnIndex) == SQLITE_NULL) {
-                projectModel.Description = std::nullopt;
-            } else {
-                const unsigned char* res = sqlite3_column_text(stmt, columnIndex);
-                projectModel.Description = std::make_optional(std::string(
-                    reinterpret_cast<const char*>(res), sqlite3_column_bytes(stmt, columnIndex)));
-            }
-
-            columnIndex++;
-
-            projectModel.DateCreated = sqlite3_column_int(stmt, columnIndex++);
-            projectModel.DateModified = sqlite3_column_int(stmt, columnIndex++);
-            projectModel.IsActive = !!sqlite3_column_int(stmt, columnIndex++);
-
-            projectModel.EmployerId = sqlite3_column_int64(stmt, columnIndex++);
-
-            if (sqlite3_column_type(stmt, columnIndex) == SQLITE_NULL) {
-                projectModel.ClientId = std::nullopt;
-            } else {
-                projectModel.ClientId = std::make_optional(sqlite3_column_int64(stmt, columnIndex));
-            }
-
-            projectModels.push_back(projectModel);
-            break;
-        }
-        case SQLITE_DONE:
-            rc = SQLITE_DONE;
-            done = true;
-            break;
-        default:
-            break;
-        }
-    }
+    rc = ReadRows(stmt, Model::ProjectModelColumns, projectModels);
 
     if (rc != SQLITE_DONE) {
         const char* error = sqlite3_errmsg(pDb);
@@ -351,7 +248,7 @@ SqliteResult ProjectsPersistence::FilterByEmployerId(std::optional<std::int64_t>
     sqlite3_stmt* stmt = nullptr;
 
     int rc = sqlite3_prepare_v2(pDb,
-        ProjectsPersistence::filterByEmployerId.c_str(),
+        ProjectsPersistence::filterByEmployerId.data(),
         static_cast<int>(ProjectsPersistence::filterByEmployerId.size()),
         &stmt,
         nullptr);
@@ -385,60 +282,7 @@ SqliteResult ProjectsPersistence::FilterByEmployerId(std::optional<std::int64_t>
         return SqliteResult::FailDetailed(Messages::BindStatementMessage, rc, std::string(error));
     }
 
-    bool done = false;
-    while (!done) {
-        switch (sqlite3_step(stmt)) {
-        case SQLITE_ROW: {
-            rc = SQLITE_ROW;
-
-            Model::ProjectModel projectModel;
-            int columnIndex = 0;
-
-            projectModel.ProjectId = sqlite3_column_int64(stmt, columnIndex++);
-
-            const unsigned char* res = sqlite3_column_text(stmt, columnIndex);
-            projectModel.Name = std::string(
-                reinterpret_cast<const char*>(res), sqlite3_column_bytes(stmt, columnIndex++));
-
-            const unsigned char* res2 = sqlite3_column_text(stmt, columnIndex);
-            projectModel.DisplayName = std::string(
-                reinterpret_cast<const char*>(res2), sqlite3_column_bytes(stmt, columnIndex++));
-
-            projectModel.IsDefault = !!sqlite3_column_int(stmt, columnIndex++);
-
-            if (sqlite3_column_type(stmt, columnIndex) == SQLITE_NULL) {
-                projectModel.Description = std::nullopt;
-            } else {
-                const unsigned char* res = sqlite3_column_text(stmt, columnIndex);
-                projectModel.Description = std::make_optional(std::string(
-                    reinterpret_cast<const char*>(res), sqlite3_column_bytes(stmt, columnIndex)));
-            }
-
-            columnIndex++;
-
-            projectModel.DateCreated = sqlite3_column_int(stmt, columnIndex++);
-            projectModel.DateModified = sqlite3_column_int(stmt, columnIndex++);
-            projectModel.IsActive = !!sqlite3_column_int(stmt, columnIndex++);
-
-            projectModel.EmployerId = sqlite3_column_int64(stmt, columnIndex++);
-
-            if (sqlite3_column_type(stmt, columnIndex) == SQLITE_NULL) {
-                projectModel.ClientId = std::nullopt;
-            } else {
-                projectModel.ClientId = std::make_optional(sqlite3_column_int64(stmt, columnIndex));
-            }
-
-            projectModels.push_back(projectModel);
-            break;
-        }
-        case SQLITE_DONE:
-            rc = SQLITE_DONE;
-            done = true;
-            break;
-        default:
-            break;
-        }
-    }
+    rc = ReadRows(stmt, Model::ProjectModelColumns, projectModels);
 
     if (rc != SQLITE_DONE) {
         const char* error = sqlite3_errmsg(pDb);
@@ -466,7 +310,7 @@ SqliteResult ProjectsPersistence::GetById(const std::int64_t projectId,
     sqlite3_stmt* stmt = nullptr;
 
     int rc = sqlite3_prepare_v2(pDb,
-        ProjectsPersistence::getById.c_str(),
+        ProjectsPersistence::getById.data(),
         static_cast<int>(ProjectsPersistence::getById.size()),
         &stmt,
         nullptr);
@@ -503,41 +347,7 @@ SqliteResult ProjectsPersistence::GetById(const std::int64_t projectId,
         return SqliteResult::FailDetailed(Messages::StepStatementMessage, rc, std::string(error));
     }
 
-    int columnIndex = 0;
-
-    projectModel.ProjectId = sqlite3_column_int64(stmt, columnIndex++);
-
-    const unsigned char* res = sqlite3_column_text(stmt, columnIndex);
-    projectModel.Name =
-        std::string(reinterpret_cast<const char*>(res), sqlite3_column_bytes(stmt, columnIndex++));
-
-    const unsigned char* res2 = sqlite3_column_text(stmt, columnIndex);
-    projectModel.DisplayName =
-        std::string(reinterpret_cast<const char*>(res2), sqlite3_column_bytes(stmt, columnIndex++));
-
-    projectModel.IsDefault = !!sqlite3_column_int(stmt, columnIndex++);
-
-    if (sqlite3_column_type(stmt, columnIndex) == SQLITE_NULL) {
-        projectModel.Description = std::nullopt;
-    } else {
-        const unsigned char* res = sqlite3_column_text(stmt, columnIndex);
-        projectModel.Description = std::make_optional(std::string(
-            reinterpret_cast<const char*>(res), sqlite3_column_bytes(stmt, columnIndex)));
-    }
-
-    columnIndex++;
-
-    projectModel.DateCreated = sqlite3_column_int(stmt, columnIndex++);
-    projectModel.DateModified = sqlite3_column_int(stmt, columnIndex++);
-    projectModel.IsActive = !!sqlite3_column_int(stmt, columnIndex++);
-
-    projectModel.EmployerId = sqlite3_column_int64(stmt, columnIndex++);
-
-    if (sqlite3_column_type(stmt, columnIndex) == SQLITE_NULL) {
-        projectModel.ClientId = std::nullopt;
-    } else {
-        projectModel.ClientId = std::make_optional(sqlite3_column_int64(stmt, columnIndex));
-    }
+    ReadRow(stmt, Model::ProjectModelColumns, projectModel);
 
     rc = sqlite3_step(stmt);
     if (rc != SQLITE_DONE) {
@@ -691,6 +501,8 @@ SqliteResult ProjectsPersistence::Create(std::int64_t& projectId,
     projectId = rowId;
     SPDLOG_LOGGER_TRACE(pLogger, LogMessages::EntityCreated, "project", rowId);
 
+    EntityVersions::GetInstance().Bump(VersionedEntity::Projects);
+
     return SqliteResult::OK();
 }
 
@@ -854,6 +666,8 @@ SqliteResult ProjectsPersistence::Update(const Model::ProjectModel& projectModel
     sqlite3_finalize(stmt);
     SPDLOG_LOGGER_TRACE(pLogger, LogMessages::EntityUpdated, "project", projectModel.ProjectId);
 
+    EntityVersions::GetInstance().Bump(VersionedEntity::Projects);
+
     return SqliteResult::OK();
 }
 
@@ -914,6 +728,8 @@ SqliteResult ProjectsPersistence::Delete(const std::int64_t projectId) const
     sqlite3_finalize(stmt);
     SPDLOG_LOGGER_TRACE(pLogger, LogMessages::EntityDeleted, "project", projectId);
 
+    EntityVersions::GetInstance().Bump(VersionedEntity::Projects);
+
     return SqliteResult::OK();
 }
 
@@ -964,10 +780,12 @@ SqliteResult ProjectsPersistence::UnsetDefault() const
     sqlite3_finalize(stmt);
     SPDLOG_LOGGER_TRACE(pLogger, "Unset default project");
 
+    EntityVersions::GetInstance().Bump(VersionedEntity::Projects);
+
     return SqliteResult::OK();
 }
 
-std::string ProjectsPersistence::filter =
+constexpr std::string_view ProjectsPersistence::filter =
     "SELECT "
     "projects.project_id, "
     "projects.name AS project_name, "
@@ -990,20 +808,25 @@ std::string ProjectsPersistence::filter =
     "OR project_description LIKE ? "
     "OR employer_name LIKE ? "
     "OR client_name LIKE ?);";
-
-std::string ProjectsPersistence::getById = "SELECT "
-                                           "projects.project_id, "
-                                           "projects.name, "
-                                           "projects.display_name, "
-                                           "projects.is_default, "
-                                           "projects.description, "
-                                           "projects.date_created, "
-                                           "projects.date_modified, "
-                                           "projects.is_active, "
-                                           "projects.employer_id, "
-                                           "projects.client_id "
-                                           "FROM projects "
-                                           "WHERE projects.project_id = ?;";
+// employer_name and client_name trail the model columns so the search term can match them
+static_assert(CountSelectColumns(ProjectsPersistence::filter) ==
+              ColumnCount(Model::ProjectModelColumns) + 2);
+
+constexpr std::string_view ProjectsPersistence::getById = "SELECT "
+                                                          "projects.project_id, "
+                                                          "projects.name, "
+                                                          "projects.display_name, "
+                                                          "projects.is_default, "
+                                                          "projects.description, "
+                                                          "projects.date_created, "
+                                                          "projects.date_modified, "
+                                                          "projects.is_active, "
+                                                          "projects.employer_id, "
+                                                          "projects.client_id "
+                                                          "FROM projects "
+                                                          "WHERE projects.project_id = ?;";
+static_assert(CountSelectColumns(ProjectsPersistence::getById) ==
+              ColumnCount(Model::ProjectModelColumns));
 
 std::string ProjectsPersistence::create = "INSERT INTO "
                                           "projects"
@@ -1039,7 +862,7 @@ std::string ProjectsPersistence::unsetDefault = "UPDATE projects "
                                                 "is_default = 0, "
                                                 "date_modified = ?";
 
-std::string ProjectsPersistence::filterByEmployerId =
+constexpr std::string_view ProjectsPersistence::filterByEmployerId =
     "SELECT "
     "projects.project_id, "
     "projects.name, "
@@ -1056,8 +879,10 @@ std::string ProjectsPersistence::filterByEmployerId =
     "ON projects.employer_id = employers.employer_id "
     "WHERE projects.is_active = 1 "
     "AND employers.employer_id = ? ";
+static_assert(CountSelectColumns(ProjectsPersistence::filterByEmployerId) ==
+              ColumnCount(Model::ProjectModelColumns));
 
-std::string ProjectsPersistence::filterByEmployerIdAndOrClientId =
+constexpr std::string_view ProjectsPersistence::filterByEmployerIdAndOrClientId =
     "SELECT "
     "projects.project_id, "
     "projects.name, "
@@ -1080,4 +905,6 @@ std::string ProjectsPersistence::filterByEmployerIdAndOrClientId =
     "clients.client_id IS NULL "
     "OR "
     "clients.client_id = ?)";
+static_assert(CountSelectColumns(ProjectsPersistence::filterByEmployerIdAndOrClientId) ==
+              ColumnCount(Model::ProjectModelColumns));
 } // namespace tks::Persistence
@@ -22,6 +22,7 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "base/persistencebase.h"
@@ -54,13 +55,13 @@ struct ProjectsPersistence final : public PersistenceBase {
     SqliteResult Delete(const std::int64_t projectId) const;
     SqliteResult UnsetDefault() const;
 
-    static std::string filter;
-    static std::string getById;
+    static const std::string_view filter;
+    static const std::string_view getById;
     static std::string create;
     static std::string update;
     static std::string isActive;
     static std::string unsetDefault;
-    static std::string filterByEmployerId;
-    static std::string filterByEmployerIdAndOrClientId;
+    static const std::string_view filterByEmployerId;
+    static const std::string_view filterByEmployerIdAndOrClientId;
 };
 } // namespace tks::Persistence
@@ -19,6 +19,8 @@
 
 #include "staticattributevaluespersistence.h"
 
+#include "base/idset.h"
+
 #include "../common/logmessages.h"
 
 #include "../common/messages/sqlitemessages.h"
@@ -446,17 +448,30 @@ SqliteResult StaticAttributeValuesPersistence::UpdateMultiple(
 SqliteResult StaticAttributeValuesPersistence::Delete(
     const std::vector<std::int64_t>& staticAttributeValueIds) const
 {
-    std::string idsInCsvFormat =
-        Utils::ConvertListIdsToCommaDelimitedString(staticAttributeValueIds);
-    std::string sql = StaticAttributeValuesPersistence::isActive + "(" + idsInCsvFormat + ")";
+    std::string idSetError;
+
+    int rc = BindIdSet(pDb, staticAttributeValueIds, idSetError);
+
+    if (rc != SQLITE_OK) {
+        pLogger->error(LogMessages::ExecQueryTemplate, "temp.id_set", rc, idSetError);
+
+        return SqliteResult::FailDetailed(Messages::BindStatementMessage, rc, idSetError);
+    }
 
     sqlite3_stmt* stmt = nullptr;
 
-    int rc = sqlite3_prepare_v2(pDb, sql.c_str(), static_cast<int>(sql.size()), &stmt, nullptr);
+    rc = sqlite3_prepare_v2(pDb,
+        StaticAttributeValuesPersistence::isActive.c_str(),
+        static_cast<int>(StaticAttributeValuesPersistence::isActive.size()),
+        &stmt,
+        nullptr);
 
     if (rc != SQLITE_OK) {
         const char* error = sqlite3_errmsg(pDb);
-        pLogger->error(LogMessages::PrepareStatementTemplate, sql, rc, error);
+        pLogger->error(LogMessages::PrepareStatementTemplate,
+            StaticAttributeValuesPersistence::isActive,
+            rc,
+            error);
 
         sqlite3_finalize(stmt);
         return SqliteResult::FailDetailed(
@@ -479,15 +494,18 @@ SqliteResult StaticAttributeValuesPersistence::Delete(
 
     if (rc != SQLITE_DONE) {
         const char* error = sqlite3_errmsg(pDb);
-        pLogger->error(LogMessages::ExecStepTemplate, sql, rc, error);
+        pLogger->error(
+            LogMessages::ExecStepTemplate, StaticAttributeValuesPersistence::isActive, rc, error);
 
         sqlite3_finalize(stmt);
         return SqliteResult::FailDetailed(Messages::BindStatementMessage, rc, std::string(error));
     }
 
     sqlite3_finalize(stmt);
-    SPDLOG_LOGGER_TRACE(
-        pLogger, LogMessages::EntityDeleted, "static_attribute_values", idsInCsvFormat);
+    SPDLOG_LOGGER_TRACE(pLogger,
+        LogMessages::EntityDeleted,
+        "static_attribute_values",
+        Utils::ConvertListIdsToCommaDelimitedString(staticAttributeValueIds));
 
     return SqliteResult::OK();
 }
@@ -496,16 +514,30 @@ SqliteResult StaticAttributeValuesPersistence::CheckUsage(
     const std::vector<std::int64_t>& attributeIds,
     bool& value) const
 {
-    std::string csvIds = Utils::ConvertListIdsToCommaDelimitedString(attributeIds);
-    std::string sql = StaticAttributeValuesPersistence::checkUsage + "(" + csvIds + ")";
+    std::string idSetError;
+
+    int rc = BindIdSet(pDb, attributeIds, idSetError);
+
+    if (rc != SQLITE_OK) {
+        pLogger->error(LogMessages::ExecQueryTemplate, "temp.id_set", rc, idSetError);
+
+        return SqliteResult::FailDetailed(Messages::BindStatementMessage, rc, idSetError);
+    }
 
     sqlite3_stmt* stmt = nullptr;
 
-    int rc = sqlite3_prepare_v2(pDb, sql.c_str(), static_cast<int>(sql.size()), &stmt, nullptr);
+    rc = sqlite3_prepare_v2(pDb,
+        StaticAttributeValuesPersistence::checkUsage.c_str(),
+        static_cast<int>(StaticAttributeValuesPersistence::checkUsage.size()),
+        &stmt,
+        nullptr);
 
     if (rc != SQLITE_OK) {
         const char* error = sqlite3_errmsg(pDb);
-        pLogger->error(LogMessages::PrepareStatementTemplate, sql, rc, error);
+        pLogger->error(LogMessages::PrepareStatementTemplate,
+            StaticAttributeValuesPersistence::checkUsage,
+            rc,
+            error);
 
         sqlite3_finalize(stmt);
         return SqliteResult::FailDetailed(
@@ -516,7 +548,8 @@ SqliteResult StaticAttributeValuesPersistence::CheckUsage(
 
     if (rc != SQLITE_ROW) {
         const char* error = sqlite3_errmsg(pDb);
-        pLogger->error(LogMessages::ExecStepTemplate, sql, rc, error);
+        pLogger->error(
+            LogMessages::ExecStepTemplate, StaticAttributeValuesPersistence::checkUsage, rc, error);
 
         sqlite3_finalize(stmt);
         return SqliteResult::FailDetailed(Messages::StepStatementMessage, rc, std::string(error));
@@ -538,8 +571,11 @@ SqliteResult StaticAttributeValuesPersistence::CheckUsage(
     }
 
     sqlite3_finalize(stmt);
-    SPDLOG_LOGGER_TRACE(
-        pLogger, LogMessages::EntityUsage, "static_attribute_values", csvIds, value);
+    SPDLOG_LOGGER_TRACE(pLogger,
+        LogMessages::EntityUsage,
+        "static_attribute_values",
+        Utils::ConvertListIdsToCommaDelimitedString(attributeIds),
+        value);
 
     return SqliteResult::OK();
 }
@@ -584,7 +620,8 @@ std::string StaticAttributeValuesPersistence::update = "UPDATE static_attribute_
 std::string StaticAttributeValuesPersistence::isActive = "UPDATE static_attribute_values "
                                                          "SET date_modified = ?, "
                                                          "is_active = 0 "
-                                                         "WHERE static_attribute_value_id IN ";
+                                                         "WHERE static_attribute_value_id IN "
+                                                         "(SELECT id FROM temp.id_set)";
 
 std::string StaticAttributeValuesPersistence::checkUsage =
     "SELECT "
@@ -599,5 +636,5 @@ std::string StaticAttributeValuesPersistence::checkUsage =
     "ON attributes.attribute_id = static_attribute_values.attribute_id "
     "INNER JOIN task_attribute_values "
     "ON attributes.attribute_id = task_attribute_values.attribute_id "
-    "WHERE attributes.attribute_id IN ";
+    "WHERE attributes.attribute_id IN (SELECT id FROM temp.id_set)";
 } // namespace tks::Persistence
@@ -19,6 +19,8 @@
 
 #include "taskspersistence.h"
 
+#include "base/rowmapper.h"
+
 #include "../common/logmessages.h"
 
 #include "../common/messages/sqlitemessages.h"
@@ -40,7 +42,7 @@ SqliteResult TasksPersistence::GetById(const std::int64_t taskId, Model::TaskMod
     sqlite3_stmt* stmt = nullptr;
 
     int rc = sqlite3_prepare_v2(pDb,
-        TasksPersistence::getById.c_str(),
+        TasksPersistence::getById.data(),
         static_cast<int>(TasksPersistence::getById.size()),
         &stmt,
         nullptr);
@@ -76,54 +78,7 @@ SqliteResult TasksPersistence::GetById(const std::int64_t taskId, Model::TaskMod
         return SqliteResult::FailDetailed(Messages::BindStatementMessage, rc, std::string(error));
     }
 
-    int columnIndex = 0;
-
-    taskModel.TaskId = sqlite3_column_int64(stmt, columnIndex++);
-
-    taskModel.Billable = !!sqlite3_column_int(stmt, columnIndex++);
-
-    if (sqlite3_column_type(stmt, columnIndex) == SQLITE_NULL) {
-        taskModel.UniqueIdentifier = std::nullopt;
-    } else {
-        const unsigned char* res = sqlite3_column_text(stmt, columnIndex);
-        taskModel.UniqueIdentifier = std::make_optional(std::string(
-            reinterpret_cast<const char*>(res), sqlite3_column_bytes(stmt, columnIndex)));
-    }
-
-    columnIndex++;
-
-    taskModel.Hours = sqlite3_column_int(stmt, columnIndex++);
-    taskModel.Minutes = sqlite3_column_int(stmt, columnIndex++);
-
-    const unsigned char* res = sqlite3_column_text(stmt, columnIndex);
-    taskModel.Description =
-        std::string(reinterpret_cast<const char*>(res), sqlite3_column_bytes(stmt, columnIndex++));
-
-    taskModel.DateCreated = sqlite3_column_int(stmt, columnIndex++);
-    taskModel.DateModified = sqlite3_column_int(stmt, columnIndex++);
-    taskModel.IsActive = !!sqlite3_column_int(stmt, columnIndex++);
-
-    taskModel.ProjectId = sqlite3_column_int64(stmt, columnIndex++);
-    taskModel.CategoryId = sqlite3_column_int64(stmt, columnIndex++);
-    taskModel.WorkdayId = sqlite3_column_int64(stmt, columnIndex++);
-
-    if (sqlite3_column_type(stmt, columnIndex) == SQLITE_NULL) {
-        taskModel.AttributeGroupId = std::nullopt;
-    } else {
-        taskModel.AttributeGroupId =
-            std::make_optional<std::int64_t>(sqlite3_column_int64(stmt, columnIndex));
-    }
-
-    columnIndex++;
-
-    if (sqlite3_column_type(stmt, columnIndex) == SQLITE_NULL) {
-        taskModel.AttendedMeetingId = std::nullopt;
-    } else {
-        taskModel.AttendedMeetingId =
-            std::make_optional<std::int64_t>(sqlite3_column_int64(stmt, columnIndex));
-    }
-
-    columnIndex++;
+    ReadRow(stmt, Model::TaskModelColumns, taskModel);
 
     rc = sqlite3_step(stmt);
 
@@ -656,20 +611,20 @@ SqliteResult TasksPersistence::GetDescriptionById(const std::int64_t taskId,
     return SqliteResult::OK();
 }
 
-SqliteResult TasksPersistence::IsDeleted(const std::int64_t taskId, bool& value)
+SqliteResult TasksPersistence::IsActive(const std::int64_t taskId, bool& isActive)
 {
     sqlite3_stmt* stmt = nullptr;
 
     int rc = sqlite3_prepare_v2(pDb,
-        TasksPersistence::isDeleted.c_str(),
-        static_cast<int>(TasksPersistence::isDeleted.size()),
+        TasksPersistence::getIsActiveById.c_str(),
+        static_cast<int>(TasksPersistence::getIsActiveById.size()),
         &stmt,
         nullptr);
 
     if (rc != SQLITE_OK) {
         const char* error = sqlite3_errmsg(pDb);
         pLogger->error(
-            LogMessages::PrepareStatementTemplate, TasksPersistence::isDeleted, rc, error);
+            LogMessages::PrepareStatementTemplate, TasksPersistence::getIsActiveById, rc, error);
 
         sqlite3_finalize(stmt);
         return SqliteResult::FailDetailed(
@@ -689,9 +644,19 @@ SqliteResult TasksPersistence::IsDeleted(const std::int64_t taskId, bool& value)
 
     rc = sqlite3_step(stmt);
 
+    // a task that was hard deleted, or never existed, is as good as inactive
+    if (rc == SQLITE_DONE) {
+        sqlite3_finalize(stmt);
+        isActive = false;
+
+        SPDLOG_LOGGER_TRACE(pLogger, "Task \"{0}\" does not exist", taskId);
+
+        return SqliteResult::OK();
+    }
+
     if (rc != SQLITE_ROW) {
         const char* error = sqlite3_errmsg(pDb);
-        pLogger->error(LogMessages::ExecStepTemplate, TasksPersistence::isDeleted, rc, error);
+        pLogger->error(LogMessages::ExecStepTemplate, TasksPersistence::getIsActiveById, rc, error);
 
         sqlite3_finalize(stmt);
         return SqliteResult::FailDetailed(Messages::StepStatementMessage, rc, std::string(error));
@@ -699,7 +664,7 @@ SqliteResult TasksPersistence::IsDeleted(const std::int64_t taskId, bool& value)
 
     int columnIndex = 0;
 
-    value = !!sqlite3_column_int(stmt, columnIndex);
+    isActive = !!sqlite3_column_int(stmt, columnIndex);
 
     rc = sqlite3_step(stmt);
 
@@ -713,28 +678,30 @@ SqliteResult TasksPersistence::IsDeleted(const std::int64_t taskId, bool& value)
     }
 
     sqlite3_finalize(stmt);
-    SPDLOG_LOGGER_TRACE(pLogger, "Checked if task \"{0}\" is deleted", taskId);
+    SPDLOG_LOGGER_TRACE(pLogger, "Checked if task \"{0}\" is active", taskId);
 
     return SqliteResult::OK();
 }
 
-std::string TasksPersistence::getById = "SELECT "
-                                        "task_id, "
-                                        "billable, "
-                                        "unique_identifier, "
-                                        "hours, "
-                                        "minutes, "
-                                        "description, "
-                                        "date_created, "
-                                        "date_modified, "
-                                        "is_active, "
-                                        "project_id, "
-                                        "category_id, "
-                                        "workday_id, "
-                                        "attribute_group_id, "
-                                        "attended_meeting_id "
-                                        "FROM tasks "
-                                        "WHERE task_id = ?;";
+constexpr std::string_view TasksPersistence::getById = "SELECT "
+                                                       "task_id, "
+                                                       "billable, "
+                                                       "unique_identifier, "
+                                                       "hours, "
+                                                       "minutes, "
+                                                       "description, "
+                                                       "date_created, "
+                                                       "date_modified, "
+                                                       "is_active, "
+                                                       "project_id, "
+                                                       "category_id, "
+                                                       "workday_id, "
+                                                       "attribute_group_id, "
+                                                       "attended_meeting_id "
+                                                       "FROM tasks "
+                                                       "WHERE task_id = ?;";
+static_assert(CountSelectColumns(TasksPersistence::getById) ==
+              ColumnCount(Model::TaskModelColumns));
 
 std::string TasksPersistence::create = "INSERT INTO "
                                        "tasks "
@@ -777,8 +744,8 @@ std::string TasksPersistence::getDescriptionById = "SELECT "
                                                    "FROM tasks "
                                                    "WHERE task_id = ?;";
 
-std::string TasksPersistence::isDeleted = "SELECT "
-                                          "is_active "
-                                          "FROM tasks "
-                                          "WHERE task_id = ?;";
+std::string TasksPersistence::getIsActiveById = "SELECT "
+                                                "is_active "
+                                                "FROM tasks "
+                                                "WHERE task_id = ?;";
 } // namespace tks::Persistence
@@ -22,6 +22,7 @@
 #include <cstdint>
 #include <map>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "base/persistencebase.h"
@@ -50,13 +51,13 @@ struct TasksPersistence final : public PersistenceBase {
     SqliteResult Delete(const std::int64_t taskId);
     SqliteResult GetDescriptionById(const std::int64_t taskId,
         std::string& description) const;
-    SqliteResult IsDeleted(const std::int64_t taskId, bool& value);
+    SqliteResult IsActive(const std::int64_t taskId, /*out*/ bool& isActive);
 
-    static std::string getById;
+    static const std::string_view getById;
     static std::string create;
     static std::string update;
     static std::string isActive;
     static std::string getDescriptionById;
-    static std::string isDeleted;
+    static std::string getIsActiveById;
 };
 } // namespace tks::Persistence
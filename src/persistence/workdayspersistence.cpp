@@ -19,10 +19,13 @@
 
 #include "workdayspersistence.h"
 
+#include "base/workdayidcache.h"
+
 #include "../common/logmessages.h"
 
 #include "../common/messages/sqlitemessages.h"
 
+#include "../utils/daynumber.h"
 #include "../utils/utils.h"
 
 namespace tks::Persistence
@@ -30,6 +33,7 @@ namespace tks::Persistence
 WorkdaysPersistence::WorkdaysPersistence(std::shared_ptr<spdlog::logger> logger,
     const std::string& databaseFilePath)
     : PersistenceBase(logger, databaseFilePath)
+    , mDatabaseFilePath(databaseFilePath)
 {
 }
 
@@ -117,96 +121,35 @@ SqliteResult WorkdaysPersistence::FilterByDate(const std::string& date,
 SqliteResult WorkdaysPersistence::GetWorkdayIdByDate(std::int64_t& workdayId,
     const std::string& date) const
 {
-    sqlite3_stmt* stmt = nullptr;
-
-    int rc = sqlite3_prepare_v2(pDb,
-        WorkdaysPersistence::getWorkdayIdByDate.c_str(),
-        static_cast<int>(WorkdaysPersistence::getWorkdayIdByDate.size()),
-        &stmt,
-        nullptr);
-
-    if (rc != SQLITE_OK) {
-        const char* error = sqlite3_errmsg(pDb);
-        pLogger->error(LogMessages::PrepareStatementTemplate,
-            WorkdaysPersistence::getWorkdayIdByDate,
-            rc,
-            error);
-
-        sqlite3_finalize(stmt);
-        return SqliteResult::FailDetailed(
-            Messages::PrepareStatementMessage, rc, std::string(error));
-    }
-
-    int bindIndex = 1;
-
-    rc = sqlite3_bind_text(
-        stmt, bindIndex++, date.c_str(), static_cast<int>(date.size()), SQLITE_TRANSIENT);
-
-    if (rc != SQLITE_OK) {
-        const char* error = sqlite3_errmsg(pDb);
-        pLogger->error(LogMessages::BindParameterTemplate, "date", bindIndex, rc, error);
-
-        sqlite3_finalize(stmt);
-        return SqliteResult::FailDetailed(Messages::BindStatementMessage, rc, std::string(error));
-    }
-
-    rc = sqlite3_step(stmt);
-
-    if (rc != SQLITE_ROW && rc != SQLITE_DONE) {
-        const char* error = sqlite3_errmsg(pDb);
-        pLogger->error(
-            LogMessages::ExecStepTemplate, WorkdaysPersistence::getWorkdayIdByDate, rc, error);
-
-        sqlite3_finalize(stmt);
-        return SqliteResult::FailDetailed(Messages::StepStatementMessage, rc, std::string(error));
-    }
-
-    if (sqlite3_column_type(stmt, 0) == SQLITE_NULL) {
-        auto sqliteResult = Create(workdayId, date);
-
-        if (!sqliteResult.Success) {
-            return sqliteResult;
-        }
-
-        sqlite3_finalize(stmt);
+    if (WorkdayIdCache::GetInstance().TryGet(mDatabaseFilePath, date, workdayId)) {
         SPDLOG_LOGGER_TRACE(pLogger, LogMessages::EntityGetById, "workday", date);
-
         return SqliteResult::OK();
-    } else {
-        workdayId = sqlite3_column_int64(stmt, 0);
     }
 
-    rc = sqlite3_step(stmt);
-
-    if (rc != SQLITE_DONE) {
-        const char* error = sqlite3_errmsg(pDb);
-        pLogger->warn(LogMessages::ExecQueryDidNotReturnOneResultTemplate, rc, error);
-
-        sqlite3_finalize(stmt);
-        return SqliteResult::FailDetailed(
-            Messages::StepStatementReturnedMultipleRowsMessage, rc, std::string(error));
+    auto sqliteResult = Upsert(workdayId, date);
+    if (!sqliteResult.Success) {
+        return sqliteResult;
     }
 
-    sqlite3_finalize(stmt);
-    SPDLOG_LOGGER_TRACE(pLogger, LogMessages::EntityGetById, "workdays", date);
+    WorkdayIdCache::GetInstance().Put(mDatabaseFilePath, date, workdayId);
 
     return SqliteResult::OK();
 }
 
-SqliteResult WorkdaysPersistence::Create(std::int64_t& workdayId, const std::string& date) const
+SqliteResult WorkdaysPersistence::Upsert(std::int64_t& workdayId, const std::string& date) const
 {
     sqlite3_stmt* stmt = nullptr;
 
     int rc = sqlite3_prepare_v2(pDb,
-        WorkdaysPersistence::create.c_str(),
-        static_cast<int>(WorkdaysPersistence::create.size()),
+        WorkdaysPersistence::upsert.c_str(),
+        static_cast<int>(WorkdaysPersistence::upsert.size()),
         &stmt,
         nullptr);
 
     if (rc != SQLITE_OK) {
         const char* error = sqlite3_errmsg(pDb);
         pLogger->error(
-            LogMessages::PrepareStatementTemplate, WorkdaysPersistence::create, rc, error);
+            LogMessages::PrepareStatementTemplate, WorkdaysPersistence::upsert, rc, error);
 
         sqlite3_finalize(stmt);
         return SqliteResult::FailDetailed(
@@ -226,35 +169,54 @@ SqliteResult WorkdaysPersistence::Create(std::int64_t& workdayId, const std::str
         return SqliteResult::FailDetailed(Messages::BindStatementMessage, rc, std::string(error));
     }
 
-    rc = sqlite3_step(stmt);
+    bindIndex++;
 
-    if (rc != SQLITE_DONE) {
+    // an unparsable date is left to the insert trigger that derives day_number from date
+    DayNumber dayNumber;
+    if (DayNumber::TryParse(date, dayNumber)) {
+        rc = sqlite3_bind_int(stmt, bindIndex, dayNumber.Value);
+    } else {
+        rc = sqlite3_bind_null(stmt, bindIndex);
+    }
+
+    if (rc != SQLITE_OK) {
         const char* error = sqlite3_errmsg(pDb);
-        pLogger->error(LogMessages::ExecStepTemplate, WorkdaysPersistence::create, rc, error);
+        pLogger->error(LogMessages::BindParameterTemplate, "day_number", bindIndex, rc, error);
 
         sqlite3_finalize(stmt);
         return SqliteResult::FailDetailed(Messages::BindStatementMessage, rc, std::string(error));
     }
 
+    rc = sqlite3_step(stmt);
+
+    if (rc != SQLITE_ROW) {
+        const char* error = sqlite3_errmsg(pDb);
+        pLogger->error(LogMessages::ExecStepTemplate, WorkdaysPersistence::upsert, rc, error);
+
+        sqlite3_finalize(stmt);
+        return SqliteResult::FailDetailed(Messages::StepStatementMessage, rc, std::string(error));
+    }
+
+    // RETURNING workday_id, of the new row or of the one already on that date
+    workdayId = sqlite3_column_int64(stmt, 0);
+
     sqlite3_finalize(stmt);
 
-    workdayId = sqlite3_last_insert_rowid(pDb);
-    SPDLOG_LOGGER_TRACE(pLogger, LogMessages::EntityCreated, "workday", workdayId);
+    SPDLOG_LOGGER_TRACE(pLogger, LogMessages::EntityGetById, "workday", date);
 
     return SqliteResult::OK();
 }
 
-std::string WorkdaysPersistence::create = "INSERT INTO "
-                                          "workdays (date) "
-                                          "VALUES (?)";
+// a conflicting insert is turned into a no-op update so RETURNING yields the existing row too
+std::string WorkdaysPersistence::upsert = "INSERT INTO "
+                                          "workdays (date, day_number) "
+                                          "VALUES (?, ?) "
+                                          "ON CONFLICT(date) DO UPDATE SET date = excluded.date "
+                                          "RETURNING workday_id";
 
 std::string WorkdaysPersistence::filterByDate = "SELECT workday_id, "
                                                 "date, "
                                                 "date_created "
                                                 "FROM workdays "
                                                 "WHERE date = ?";
-
-std::string WorkdaysPersistence::getWorkdayIdByDate = "SELECT workday_id "
-                                                      "FROM workdays "
-                                                      "WHERE date = ?";
 } // namespace tks::Persistence
@@ -21,6 +21,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <string>
 
 #include "base/persistencebase.h"
 
@@ -41,10 +42,12 @@ struct WorkdaysPersistence final : public PersistenceBase {
 
     SqliteResult FilterByDate(const std::string& date, Model::WorkdayModel model) const;
     SqliteResult GetWorkdayIdByDate(std::int64_t& workdayId, const std::string& date) const;
-    SqliteResult Create(std::int64_t& workdayId, const std::string& date) const;
+    SqliteResult Upsert(std::int64_t& workdayId, const std::string& date) const;
 
-    static std::string getWorkdayIdByDate;
     static std::string filterByDate;
-    static std::string create;
+    static std::string upsert;
+
+private:
+    std::string mDatabaseFilePath;
 };
 } // namespace tks::Persistence
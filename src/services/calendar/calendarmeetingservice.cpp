@@ -0,0 +1,175 @@
+// Productivity tool to help you track the time you spend on tasks
+// Copyright (C) 2026 Szymon Welgus
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+// Contact:
+//     szymonwelgus at gmail dot com
+
+
+#include "calendarmeetingservice.h"
+
+#include <optional>
+
+#include <wx/string.h>
+
+#include "../../persistence/calendarmeetingcachepersistence.h"
+
+#include "../../utils/utils.h"
+
+namespace tks::Services::Calendar
+{
+CalendarMeetingService::CalendarMeetingService(std::shared_ptr<spdlog::logger> logger,
+    const std::string& databaseFilePath,
+    std::unique_ptr<CalendarProvider> provider)
+    : pLogger(logger)
+    , mDatabaseFilePath(databaseFilePath)
+    , pProvider(std::move(provider))
+{
+}
+
+Outlook::OutlookResult CalendarMeetingService::FetchAccountNames(
+    std::vector<std::string>& accountNames)
+{
+    return pProvider->FetchAccountNames(accountNames);
+}
+
+Outlook::OutlookResult CalendarMeetingService::FetchCalendarMeetings(const std::string& accountName,
+    const std::string& date,
+    std::vector<Outlook::OutlookMeetingModel>& meetingModels,
+    bool forceRefresh)
+{
+    Persistence::CalendarMeetingCachePersistence cachePersistence(pLogger, mDatabaseFilePath);
+
+    const std::string syncToken = pProvider->GetSyncToken(accountName, date);
+
+    std::optional<Model::CalendarSyncStateModel> syncStateModel;
+    auto sqliteResult =
+        cachePersistence.GetSyncState(pProvider->GetName(), accountName, date, syncStateModel);
+
+    // a failing cache only costs the fetch it would have saved
+    if (!sqliteResult.Success) {
+        pLogger->warn("Failed to read cached calendar meetings, fetching from \"{0}\"",
+            pProvider->GetName());
+    }
+
+    if (!forceRefresh && syncStateModel.has_value() &&
+        IsCacheUsable(syncStateModel.value(), syncToken)) {
+        std::vector<Model::CalendarMeetingModel> cachedMeetingModels;
+        sqliteResult = cachePersistence.FilterBySyncStateId(
+            syncStateModel->CalendarSyncStateId, cachedMeetingModels);
+
+        if (sqliteResult.Success) {
+            for (const auto& cachedMeetingModel : cachedMeetingModels) {
+                Outlook::OutlookMeetingModel meetingModel;
+                meetingModel.EntryId = cachedMeetingModel.EntryId;
+                meetingModel.Subject =
+                    wxString::FromUTF8(cachedMeetingModel.Subject.c_str()).ToStdWstring();
+                meetingModel.Start = cachedMeetingModel.Start;
+                meetingModel.End = cachedMeetingModel.End;
+                meetingModel.Duration = cachedMeetingModel.Duration;
+                meetingModel.Location = cachedMeetingModel.Location;
+
+                meetingModels.push_back(std::move(meetingModel));
+            }
+
+            SPDLOG_LOGGER_TRACE(pLogger,
+                "Served \"{0}\" meetings for \"{1}\" on \"{2}\" from the cache",
+                cachedMeetingModels.size(),
+                accountName,
+                date);
+
+            if (cachedMeetingModels.empty()) {
+                return Outlook::OutlookResult::PartialOK("No meetings found");
+            }
+
+            return Outlook::OutlookResult::OK();
+        }
+
+        pLogger->warn("Failed to read cached calendar meetings, fetching from \"{0}\"",
+            pProvider->GetName());
+    }
+
+    std::vector<Outlook::OutlookMeetingModel> fetchedMeetingModels;
+    auto result = pProvider->FetchCalendarMeetings(accountName, date, fetchedMeetingModels);
+    if (!result.Success) {
+        return result;
+    }
+
+    WriteToCache(accountName, date, syncToken, fetchedMeetingModels);
+
+    meetingModels.insert(meetingModels.end(),
+        std::make_move_iterator(fetchedMeetingModels.begin()),
+        std::make_move_iterator(fetchedMeetingModels.end()));
+
+    return result;
+}
+
+bool CalendarMeetingService::IsCacheUsable(const Model::CalendarSyncStateModel& syncStateModel,
+    const std::string& syncToken) const
+{
+    if (!syncToken.empty()) {
+        return syncToken == syncStateModel.SyncToken;
+    }
+
+    return Utils::UnixTimestamp() - syncStateModel.DateSynced < CacheFreshnessSeconds;
+}
+
+void CalendarMeetingService::WriteToCache(const std::string& accountName,
+    const std::string& date,
+    const std::string& syncToken,
+    const std::vector<Outlook::OutlookMeetingModel>& meetingModels)
+{
+    Model::CalendarSyncStateModel syncStateModel;
+    syncStateModel.Provider = pProvider->GetName();
+    syncStateModel.AccountName = accountName;
+    syncStateModel.Date = date;
+    syncStateModel.SyncToken = syncToken;
+
+    std::vector<Model::CalendarMeetingModel> cachedMeetingModels;
+    cachedMeetingModels.reserve(meetingModels.size());
+
+    for (const auto& meetingModel : meetingModels) {
+        Model::CalendarMeetingModel cachedMeetingModel;
+        cachedMeetingModel.EntryId = meetingModel.EntryId;
+        cachedMeetingModel.Subject = wxString(meetingModel.Subject).ToUTF8().data();
+        cachedMeetingModel.Start = meetingModel.Start;
+        cachedMeetingModel.End = meetingModel.End;
+        cachedMeetingModel.Duration = meetingModel.Duration;
+        cachedMeetingModel.Location = meetingModel.Location;
+
+        cachedMeetingModels.push_back(std::move(cachedMeetingModel));
+    }
+
+    int changedMeetings = 0;
+
+    Persistence::CalendarMeetingCachePersistence cachePersistence(pLogger, mDatabaseFilePath);
+    auto sqliteResult = cachePersistence.Sync(syncStateModel, cachedMeetingModels, changedMeetings);
+
+    if (!sqliteResult.Success) {
+        pLogger->warn("Failed to cache \"{0}\" meetings for \"{1}\" on \"{2}\"",
+            meetingModels.size(),
+            accountName,
+            date);
+        return;
+    }
+
+    SPDLOG_LOGGER_TRACE(pLogger,
+        "Cached \"{0}\" meetings for \"{1}\" on \"{2}\", \"{3}\" changed",
+        meetingModels.size(),
+        accountName,
+        date,
+        changedMeetings);
+}
+} // namespace tks::Services::Calendar
@@ -0,0 +1,74 @@
+// Productivity tool to help you track the time you spend on tasks
+// Copyright (C) 2026 Szymon Welgus
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+// Contact:
+//     szymonwelgus at gmail dot com
+
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <spdlog/logger.h>
+
+#include "calendarprovider.h"
+
+#include "../../models/calendarmeetingmodel.h"
+
+namespace tks::Services::Calendar
+{
+/*
+ * Serves a day's meetings from the calendar_meetings cache while the provider's sync token
+ * is unchanged (or, for providers without one, while the cached day is fresh) and otherwise
+ * fetches from the provider and writes back only the meetings that changed
+ */
+class CalendarMeetingService final
+{
+public:
+    CalendarMeetingService() = delete;
+    CalendarMeetingService(const CalendarMeetingService&) = delete;
+    CalendarMeetingService(std::shared_ptr<spdlog::logger> logger,
+        const std::string& databaseFilePath,
+        std::unique_ptr<CalendarProvider> provider);
+    ~CalendarMeetingService() = default;
+
+    CalendarMeetingService& operator=(const CalendarMeetingService&) = delete;
+
+    Outlook::OutlookResult FetchAccountNames(/*out*/ std::vector<std::string>& accountNames);
+    Outlook::OutlookResult FetchCalendarMeetings(const std::string& accountName,
+        const std::string& date,
+        /*out*/ std::vector<Outlook::OutlookMeetingModel>& meetingModels,
+        bool forceRefresh = false);
+
+    // how long a cached day is served for providers that cannot produce a sync token
+    static constexpr std::int64_t CacheFreshnessSeconds = 5 * 60;
+
+private:
+    bool IsCacheUsable(const Model::CalendarSyncStateModel& syncStateModel,
+        const std::string& syncToken) const;
+    void WriteToCache(const std::string& accountName,
+        const std::string& date,
+        const std::string& syncToken,
+        const std::vector<Outlook::OutlookMeetingModel>& meetingModels);
+
+    std::shared_ptr<spdlog::logger> pLogger;
+    std::string mDatabaseFilePath;
+    std::unique_ptr<CalendarProvider> pProvider;
+};
+} // namespace tks::Services::Calendar
@@ -0,0 +1,61 @@
+// Productivity tool to help you track the time you spend on tasks
+// Copyright (C) 2026 Szymon Welgus
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+// Contact:
+//     szymonwelgus at gmail dot com
+
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <spdlog/logger.h>
+
+#include "../outlook/outlookmeetingmodel.h"
+#include "../outlook/outlookresult.h"
+
+namespace tks::Services::Calendar
+{
+/*
+ * A source of calendar meetings for the meetings view. Outlook (classic) over COM is one,
+ * an iCalendar (.ics) file another; CalendarMeetingService puts a local cache in front of either
+ */
+class CalendarProvider
+{
+public:
+    virtual ~CalendarProvider() = default;
+
+    // stable name stored with the cached meetings so providers do not share cache entries
+    virtual std::string GetName() const = 0;
+
+    virtual Outlook::OutlookResult FetchAccountNames(
+        /*out*/ std::vector<std::string>& accountNames) = 0;
+
+    // cheap fingerprint of the source that changes when its meetings may have changed,
+    // empty when the provider cannot tell without fetching
+    virtual std::string GetSyncToken(const std::string& accountName, const std::string& date) = 0;
+
+    virtual Outlook::OutlookResult FetchCalendarMeetings(const std::string& accountName,
+        const std::string& date,
+        /*out*/ std::vector<Outlook::OutlookMeetingModel>& meetingModels) = 0;
+};
+
+// the ics file provider when a file is configured, otherwise Outlook (classic)
+std::unique_ptr<CalendarProvider> CreateCalendarProvider(std::shared_ptr<spdlog::logger> logger,
+    const std::string& icsFilePath);
+} // namespace tks::Services::Calendar
@@ -0,0 +1,747 @@
+// Productivity tool to help you track the time you spend on tasks
+// Copyright (C) 2026 Szymon Welgus
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+// Contact:
+//     szymonwelgus at gmail dot com
+
+
+#include "icscalendarprovider.h"
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <charconv>
+#include <fstream>
+#include <optional>
+#include <system_error>
+#include <unordered_set>
+
+#include <date/date.h>
+
+#include <spdlog/spdlog.h>
+
+#include <wx/datetime.h>
+#include <wx/string.h>
+
+namespace tks::Services::Calendar
+{
+namespace
+{
+struct IcsEvent {
+    std::string Uid;
+    std::string RecurrenceId;
+    std::string Summary;
+    std::string Location;
+    std::string Status;
+    std::string RecurrenceRule;
+    std::vector<std::string> ExceptionDates;
+    wxDateTime Start;
+    wxDateTime End;
+    long DurationMinutes = -1;
+};
+
+enum class Frequency { Daily, Weekly };
+
+// the subset of an RRULE value that is expanded, see ParseRecurrenceRule
+struct RecurrenceRule {
+    Frequency Freq = Frequency::Daily;
+    long Interval = 1;
+    std::optional<long> Count;
+    std::optional<wxDateTime> Until;
+    bool UntilIsDate = false;
+    /* weekdays the rule repeats on, indexed like date::weekday::c_encoding (Sunday is 0) */
+    std::array<bool, 7> ByDay{};
+    bool HasByDay = false;
+    unsigned WeekStart = 1;
+};
+
+void TrimCarriageReturn(std::string& line)
+{
+    if (!line.empty() && line.back() == '\r') {
+        line.pop_back();
+    }
+}
+
+// reads one content line, joining folded lines (a line break followed by a space or tab)
+bool ReadUnfoldedLine(std::istream& stream, std::string& line)
+{
+    if (!std::getline(stream, line)) {
+        return false;
+    }
+    TrimCarriageReturn(line);
+
+    while (stream.peek() == ' ' || stream.peek() == '\t') {
+        std::string continuation;
+        std::getline(stream, continuation);
+        TrimCarriageReturn(continuation);
+
+        line.append(continuation, 1, std::string::npos);
+    }
+
+    return true;
+}
+
+// splits "NAME;PARAM=VALUE:value" into its upper cased name, parameters and value
+bool SplitContentLine(const std::string& line,
+    std::string& name,
+    std::string& parameters,
+    std::string& value)
+{
+    bool quoted = false;
+    std::size_t colon = std::string::npos;
+    for (std::size_t i = 0; i < line.size(); i++) {
+        if (line[i] == '"') {
+            quoted = !quoted;
+        } else if (line[i] == ':' && !quoted) {
+            colon = i;
+            break;
+        }
+    }
+
+    if (colon == std::string::npos) {
+        return false;
+    }
+
+    std::size_t nameEnd = std::min(line.find(';'), colon);
+
+    name = line.substr(0, nameEnd);
+    std::transform(name.begin(), name.end(), name.begin(), [](unsigned char c) {
+        return static_cast<char>(std::toupper(c));
+    });
+    parameters = nameEnd < colon ? line.substr(nameEnd + 1, colon - nameEnd - 1) : "";
+    value = line.substr(colon + 1);
+
+    return true;
+}
+
+std::string UnescapeText(const std::string& value)
+{
+    std::string text;
+    text.reserve(value.size());
+
+    for (std::size_t i = 0; i < value.size(); i++) {
+        if (value[i] == '\\' && i + 1 < value.size()) {
+            char escaped = value[++i];
+            text += escaped == 'n' || escaped == 'N' ? '\n' : escaped;
+        } else {
+            text += value[i];
+        }
+    }
+
+    return text;
+}
+
+bool ParseNumber(const std::string& value, std::size_t offset, std::size_t length, int& number)
+{
+    if (offset + length > value.size()) {
+        return false;
+    }
+
+    const char* first = value.data() + offset;
+    const char* last = first + length;
+    auto [ptr, ec] = std::from_chars(first, last, number);
+
+    return ec == std::errc() && ptr == last;
+}
+
+// DATE (YYYYMMDD) or DATE-TIME (YYYYMMDDTHHMMSS, Z suffixed when in UTC)
+bool ParseDateTime(const std::string& value, wxDateTime& dateTime)
+{
+    int year = 0, month = 0, day = 0, hour = 0, minute = 0, second = 0;
+
+    if (!ParseNumber(value, 0, 4, year) || !ParseNumber(value, 4, 2, month) ||
+        !ParseNumber(value, 6, 2, day)) {
+        return false;
+    }
+
+    bool hasTime = value.size() >= 15 && value[8] == 'T';
+    if (hasTime && (!ParseNumber(value, 9, 2, hour) || !ParseNumber(value, 11, 2, minute) ||
+                       !ParseNumber(value, 13, 2, second))) {
+        return false;
+    }
+
+    if (month < 1 || month > 12 || hour > 23 || minute > 59 || second > 60) {
+        return false;
+    }
+
+    auto wxMonth = static_cast<wxDateTime::Month>(month - 1);
+    if (day < 1 || day > wxDateTime::GetNumberOfDays(wxMonth, year)) {
+        return false;
+    }
+
+    dateTime = wxDateTime(static_cast<wxDateTime::wxDateTime_t>(day),
+        wxMonth,
+        year,
+        static_cast<wxDateTime::wxDateTime_t>(hour),
+        static_cast<wxDateTime::wxDateTime_t>(minute),
+        static_cast<wxDateTime::wxDateTime_t>(std::min(second, 59)));
+
+    if (hasTime && value.back() == 'Z') {
+        dateTime.MakeFromUTC();
+    }
+
+    return dateTime.IsValid();
+}
+
+// DURATION values such as P1W, P1D, PT1H30M or P1DT2H
+bool ParseDurationMinutes(const std::string& value, long& minutes)
+{
+    std::size_t start = !value.empty() && value[0] == '+' ? 1 : 0;
+    if (value.size() <= start + 1 || value[start] != 'P') {
+        return false;
+    }
+
+    long total = 0;
+    long number = 0;
+    bool hasNumber = false;
+
+    for (std::size_t i = start + 1; i < value.size(); i++) {
+        char c = value[i];
+        if (std::isdigit(static_cast<unsigned char>(c))) {
+            number = number * 10 + (c - '0');
+            hasNumber = true;
+            continue;
+        }
+
+        if (c == 'T') {
+            continue;
+        }
+
+        if (!hasNumber) {
+            return false;
+        }
+
+        switch (c) {
+        case 'W':
+            total += number * 7 * 24 * 60;
+            break;
+        case 'D':
+            total += number * 24 * 60;
+            break;
+        case 'H':
+            total += number * 60;
+            break;
+        case 'M':
+            total += number;
+            break;
+        case 'S':
+            total += number / 60;
+            break;
+        default:
+            return false;
+        }
+
+        number = 0;
+        hasNumber = false;
+    }
+
+    minutes = total;
+    return !hasNumber;
+}
+
+bool ParseWeekday(const std::string& value, unsigned& weekday)
+{
+    static constexpr std::array<const char*, 7> weekdays = {
+        "SU", "MO", "TU", "WE", "TH", "FR", "SA"
+    };
+
+    for (unsigned i = 0; i < weekdays.size(); i++) {
+        if (value == weekdays[i]) {
+            weekday = i;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// FREQ=DAILY or FREQ=WEEKLY with INTERVAL, COUNT, UNTIL, plain weekday BYDAY and WKST parts,
+// any other rule is left unexpanded
+bool ParseRecurrenceRule(const std::string& value, RecurrenceRule& rule)
+{
+    bool hasFrequency = false;
+
+    std::size_t partStart = 0;
+    while (partStart < value.size()) {
+        std::size_t partEnd = std::min(value.find(';', partStart), value.size());
+        std::string part = value.substr(partStart, partEnd - partStart);
+        partStart = partEnd + 1;
+
+        std::size_t equals = part.find('=');
+        if (equals == std::string::npos) {
+            return false;
+        }
+
+        std::string name = part.substr(0, equals);
+        std::string partValue = part.substr(equals + 1);
+
+        if (name == "FREQ") {
+            if (partValue == "DAILY") {
+                rule.Freq = Frequency::Daily;
+            } else if (partValue == "WEEKLY") {
+                rule.Freq = Frequency::Weekly;
+            } else {
+                return false;
+            }
+            hasFrequency = true;
+        } else if (name == "INTERVAL") {
+            int interval = 0;
+            if (!ParseNumber(partValue, 0, partValue.size(), interval) || interval < 1) {
+                return false;
+            }
+            rule.Interval = interval;
+        } else if (name == "COUNT") {
+            int count = 0;
+            if (!ParseNumber(partValue, 0, partValue.size(), count) || count < 1) {
+                return false;
+            }
+            rule.Count = count;
+        } else if (name == "UNTIL") {
+            wxDateTime until;
+            if (!ParseDateTime(partValue, until)) {
+                return false;
+            }
+            rule.Until = until;
+            rule.UntilIsDate = partValue.size() == 8;
+        } else if (name == "BYDAY") {
+            std::size_t dayStart = 0;
+            while (dayStart < partValue.size()) {
+                std::size_t dayEnd = std::min(partValue.find(',', dayStart), partValue.size());
+
+                // ordinal weekdays such as 1MO only mean something to MONTHLY and YEARLY rules
+                unsigned weekday = 0;
+                if (!ParseWeekday(partValue.substr(dayStart, dayEnd - dayStart), weekday)) {
+                    return false;
+                }
+
+                rule.ByDay[weekday] = true;
+                rule.HasByDay = true;
+                dayStart = dayEnd + 1;
+            }
+        } else if (name == "WKST") {
+            if (!ParseWeekday(partValue, rule.WeekStart)) {
+                return false;
+            }
+        } else {
+            return false;
+        }
+    }
+
+    return hasFrequency;
+}
+
+long ToDayNumber(const wxDateTime& dateTime)
+{
+    auto yearMonthDay = date::year{ dateTime.GetYear() } /
+                        date::month{ static_cast<unsigned>(dateTime.GetMonth()) + 1 } /
+                        date::day{ static_cast<unsigned>(dateTime.GetDay()) };
+
+    return static_cast<long>(date::sys_days{ yearMonthDay }.time_since_epoch().count());
+}
+
+unsigned ToWeekday(long dayNumber)
+{
+    return date::weekday{ date::sys_days{ date::days{ dayNumber } } }.c_encoding();
+}
+
+class Recurrence final
+{
+public:
+    Recurrence(const RecurrenceRule& rule, const wxDateTime& start)
+        : mRule(rule)
+        , mStart(start)
+        , mStartDayNumber(ToDayNumber(start))
+    {
+        if (mRule.Freq == Frequency::Weekly && !mRule.HasByDay) {
+            mRule.ByDay[ToWeekday(mStartDayNumber)] = true;
+        }
+    }
+
+    // the local start of the occurrence on the day, when the rule has one there
+    std::optional<wxDateTime> OccurrenceOn(long dayNumber) const
+    {
+        if (!Matches(dayNumber)) {
+            return std::nullopt;
+        }
+
+        wxDateTime occurrence = mStart + wxDateSpan::Days(dayNumber - mStartDayNumber);
+
+        if (mRule.Until.has_value()) {
+            bool isPastUntil = mRule.UntilIsDate ? dayNumber > ToDayNumber(*mRule.Until)
+                                                 : occurrence > *mRule.Until;
+            if (isPastUntil) {
+                return std::nullopt;
+            }
+        }
+
+        // occurrences are counted from the start, the walk stops at COUNT so it stays short
+        if (mRule.Count.has_value()) {
+            long occurrences = 0;
+            for (long day = mStartDayNumber; day < dayNumber; day++) {
+                if (Matches(day) && ++occurrences >= *mRule.Count) {
+                    return std::nullopt;
+                }
+            }
+        }
+
+        return occurrence;
+    }
+
+private:
+    bool Matches(long dayNumber) const
+    {
+        if (dayNumber < mStartDayNumber) {
+            return false;
+        }
+
+        if (mRule.Freq == Frequency::Daily) {
+            return (dayNumber - mStartDayNumber) % mRule.Interval == 0 &&
+                   (!mRule.HasByDay || mRule.ByDay[ToWeekday(dayNumber)]);
+        }
+
+        long weeks = (WeekStartOf(dayNumber) - WeekStartOf(mStartDayNumber)) / 7;
+        return weeks % mRule.Interval == 0 && mRule.ByDay[ToWeekday(dayNumber)];
+    }
+
+    long WeekStartOf(long dayNumber) const
+    {
+        return dayNumber - static_cast<long>((ToWeekday(dayNumber) + 7 - mRule.WeekStart) % 7);
+    }
+
+    RecurrenceRule mRule;
+    wxDateTime mStart;
+    long mStartDayNumber;
+};
+
+// the key that ties an occurrence of a recurring event to the RECURRENCE-ID event replacing it
+std::string ToOccurrenceId(const std::string& uid, const wxDateTime& occurrenceStart)
+{
+    return uid + "_" + occurrenceStart.Format("%Y%m%dT%H%M%S").ToStdString();
+}
+
+wxDateTime ResolveEnd(const IcsEvent& event, const wxDateTime& start)
+{
+    if (event.End.IsValid()) {
+        return start + (event.End - event.Start);
+    }
+
+    return start + wxTimeSpan::Minutes(std::max(event.DurationMinutes, 0L));
+}
+
+// converts an occurrence when it overlaps the day, using the same window as the Outlook
+// restriction
+bool ToMeetingModel(const IcsEvent& event,
+    const std::string& entryId,
+    const wxDateTime& start,
+    const wxDateTime& dayStart,
+    const wxDateTime& dayEnd,
+    Outlook::OutlookMeetingModel& meetingModel)
+{
+    wxDateTime end = ResolveEnd(event, start);
+
+    // an event ending exactly at midnight belongs to the previous day
+    if (start > dayEnd || end < dayStart || (end == dayStart && end > start)) {
+        return false;
+    }
+
+    meetingModel.EntryId = entryId;
+    meetingModel.Subject = wxString::FromUTF8(event.Summary.c_str()).ToStdWstring();
+    meetingModel.Start = start.Format("%Y-%m-%d %H:%M").ToStdString();
+    meetingModel.End = end.Format("%Y-%m-%d %H:%M").ToStdString();
+    meetingModel.Duration = static_cast<int>((end - start).GetMinutes());
+    meetingModel.Location = event.Location;
+
+    return true;
+}
+
+bool IsExceptionDate(const IcsEvent& event, const wxDateTime& occurrenceStart)
+{
+    for (const auto& exceptionDate : event.ExceptionDates) {
+        wxDateTime exception;
+        if (!ParseDateTime(exceptionDate, exception)) {
+            continue;
+        }
+
+        bool isDate = exceptionDate.size() == 8;
+        if (isDate ? exception.IsSameDate(occurrenceStart) : exception == occurrenceStart) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// expands the occurrences that can overlap the day, an occurrence lasting several days may
+// have started on one of the days before it
+void ExpandOccurrences(const IcsEvent& event,
+    const RecurrenceRule& rule,
+    const wxDateTime& dayStart,
+    const wxDateTime& dayEnd,
+    std::vector<Outlook::OutlookMeetingModel>& meetingModels)
+{
+    Recurrence recurrence(rule, event.Start);
+
+    long durationDays = (ResolveEnd(event, event.Start) - event.Start).GetDays();
+    long dayNumber = ToDayNumber(dayStart);
+
+    for (long day = dayNumber - durationDays - 1; day <= dayNumber; day++) {
+        auto occurrenceStart = recurrence.OccurrenceOn(day);
+        if (!occurrenceStart.has_value() || IsExceptionDate(event, *occurrenceStart)) {
+            continue;
+        }
+
+        Outlook::OutlookMeetingModel meetingModel;
+        if (ToMeetingModel(event,
+                ToOccurrenceId(event.Uid, *occurrenceStart),
+                *occurrenceStart,
+                dayStart,
+                dayEnd,
+                meetingModel)) {
+            meetingModels.push_back(std::move(meetingModel));
+        }
+    }
+}
+
+void ReadEvent(std::shared_ptr<spdlog::logger> logger,
+    const IcsEvent& event,
+    const wxDateTime& dayStart,
+    const wxDateTime& dayEnd,
+    std::vector<Outlook::OutlookMeetingModel>& meetingModels,
+    std::vector<Outlook::OutlookMeetingModel>& occurrenceModels,
+    std::unordered_set<std::string>& replacedOccurrenceIds)
+{
+    if (event.Uid.empty() || !event.Start.IsValid()) {
+        return;
+    }
+
+    Outlook::OutlookMeetingModel meetingModel;
+
+    if (!event.RecurrenceId.empty()) {
+        wxDateTime recurrenceId;
+        if (!ParseDateTime(event.RecurrenceId, recurrenceId)) {
+            logger->warn("Failed to parse \"RECURRENCE-ID\" value \"{0}\"", event.RecurrenceId);
+            return;
+        }
+
+        // the replaced occurrence is dropped even when its replacement moved to another day
+        auto occurrenceId = ToOccurrenceId(event.Uid, recurrenceId);
+        replacedOccurrenceIds.insert(occurrenceId);
+
+        if (event.Status != "CANCELLED" &&
+            ToMeetingModel(event, occurrenceId, event.Start, dayStart, dayEnd, meetingModel)) {
+            meetingModels.push_back(std::move(meetingModel));
+        }
+        return;
+    }
+
+    if (event.Status == "CANCELLED") {
+        return;
+    }
+
+    if (!event.RecurrenceRule.empty()) {
+        RecurrenceRule rule;
+        if (ParseRecurrenceRule(event.RecurrenceRule, rule)) {
+            ExpandOccurrences(event, rule, dayStart, dayEnd, occurrenceModels);
+            return;
+        }
+
+        logger->warn("Recurrence rule \"{0}\" of event \"{1}\" is not supported, only its first "
+                     "occurrence is shown",
+            event.RecurrenceRule,
+            event.Uid);
+    }
+
+    if (ToMeetingModel(event, event.Uid, event.Start, dayStart, dayEnd, meetingModel)) {
+        meetingModels.push_back(std::move(meetingModel));
+    }
+}
+} // namespace
+
+IcsCalendarProvider::IcsCalendarProvider(std::shared_ptr<spdlog::logger> logger,
+    const std::string& icsFilePath)
+    : pLogger(logger)
+    , mIcsFilePath(icsFilePath)
+{
+}
+
+std::string IcsCalendarProvider::GetName() const
+{
+    return "ics";
+}
+
+Outlook::OutlookResult IcsCalendarProvider::FetchAccountNames(
+    std::vector<std::string>& accountNames)
+{
+    std::error_code ec;
+    if (!std::filesystem::is_regular_file(mIcsFilePath, ec)) {
+        pLogger->error("Calendar file \"{0}\" was not found", mIcsFilePath.string());
+        return Outlook::OutlookResult::Fail(
+            fmt::format("Calendar file \"{0}\" was not found", mIcsFilePath.string()));
+    }
+
+    accountNames.push_back(mIcsFilePath.stem().string());
+
+    return Outlook::OutlookResult::OK();
+}
+
+std::string IcsCalendarProvider::GetSyncToken(const std::string& accountName,
+    const std::string& date)
+{
+    // any edit to the file changes its size or write time, which invalidates every cached day
+    std::error_code ec;
+
+    auto fileSize = std::filesystem::file_size(mIcsFilePath, ec);
+    if (ec) {
+        return "";
+    }
+
+    auto lastWriteTime = std::filesystem::last_write_time(mIcsFilePath, ec);
+    if (ec) {
+        return "";
+    }
+
+    return fmt::format("{0}-{1}", fileSize, lastWriteTime.time_since_epoch().count());
+}
+
+Outlook::OutlookResult IcsCalendarProvider::FetchCalendarMeetings(const std::string& accountName,
+    const std::string& date,
+    std::vector<Outlook::OutlookMeetingModel>& meetingModels)
+{
+    wxDateTime dayStart;
+    if (!dayStart.ParseFormat(wxString(date), "%Y/%m/%d")) {
+        pLogger->error("Failed to parse meetings date \"{0}\"", date);
+        return Outlook::OutlookResult::Fail(fmt::format("Invalid meetings date \"{0}\"", date));
+    }
+
+    dayStart.ResetTime();
+    wxDateTime dayEnd = dayStart;
+    dayEnd.SetHour(23).SetMinute(59).SetSecond(59);
+
+    std::ifstream stream(mIcsFilePath, std::ios::binary);
+    if (!stream.is_open()) {
+        pLogger->error("Failed to open calendar file \"{0}\"", mIcsFilePath.string());
+        return Outlook::OutlookResult::Fail(
+            fmt::format("Failed to open calendar file \"{0}\"", mIcsFilePath.string()));
+    }
+
+    std::size_t firstMeeting = meetingModels.size();
+    std::size_t eventCount = 0;
+
+    // occurrences of recurring events are held back until every RECURRENCE-ID event that
+    // replaces one of them has been read, wherever it sits in the file
+    std::vector<Outlook::OutlookMeetingModel> occurrenceModels;
+    std::unordered_set<std::string> replacedOccurrenceIds;
+
+    std::optional<IcsEvent> event;
+    int nestedComponents = 0;
+
+    std::string line, name, parameters, value;
+    while (ReadUnfoldedLine(stream, line)) {
+        if (!SplitContentLine(line, name, parameters, value)) {
+            continue;
+        }
+
+        if (name == "BEGIN") {
+            if (event.has_value()) {
+                // e.g. a VALARM, whose properties must not overwrite the event's
+                nestedComponents++;
+            } else if (value == "VEVENT") {
+                event.emplace();
+            }
+            continue;
+        }
+
+        if (name == "END") {
+            if (nestedComponents > 0) {
+                nestedComponents--;
+            } else if (event.has_value() && value == "VEVENT") {
+                eventCount++;
+                ReadEvent(pLogger,
+                    *event,
+                    dayStart,
+                    dayEnd,
+                    meetingModels,
+                    occurrenceModels,
+                    replacedOccurrenceIds);
+                event.reset();
+            }
+            continue;
+        }
+
+        if (!event.has_value() || nestedComponents > 0) {
+            continue;
+        }
+
+        if (name == "UID") {
+            event->Uid = value;
+        } else if (name == "RECURRENCE-ID") {
+            event->RecurrenceId = value;
+        } else if (name == "SUMMARY") {
+            event->Summary = UnescapeText(value);
+        } else if (name == "LOCATION") {
+            event->Location = UnescapeText(value);
+        } else if (name == "STATUS") {
+            event->Status = value;
+        } else if (name == "DTSTART") {
+            if (!ParseDateTime(value, event->Start)) {
+                pLogger->warn("Failed to parse \"DTSTART\" value \"{0}\"", value);
+            }
+        } else if (name == "DTEND") {
+            if (!ParseDateTime(value, event->End)) {
+                pLogger->warn("Failed to parse \"DTEND\" value \"{0}\"", value);
+            }
+        } else if (name == "RRULE") {
+            event->RecurrenceRule = value;
+        } else if (name == "EXDATE") {
+            std::size_t dateStart = 0;
+            while (dateStart < value.size()) {
+                std::size_t dateEnd = std::min(value.find(',', dateStart), value.size());
+                event->ExceptionDates.push_back(value.substr(dateStart, dateEnd - dateStart));
+                dateStart = dateEnd + 1;
+            }
+        } else if (name == "DURATION") {
+            if (!ParseDurationMinutes(value, event->DurationMinutes)) {
+                pLogger->warn("Failed to parse \"DURATION\" value \"{0}\"", value);
+            }
+        }
+    }
+
+    for (auto& occurrenceModel : occurrenceModels) {
+        if (replacedOccurrenceIds.count(occurrenceModel.EntryId) == 0) {
+            meetingModels.push_back(std::move(occurrenceModel));
+        }
+    }
+
+    std::stable_sort(meetingModels.begin() + firstMeeting,
+        meetingModels.end(),
+        [](const Outlook::OutlookMeetingModel& lhs, const Outlook::OutlookMeetingModel& rhs) {
+            return lhs.Start < rhs.Start;
+        });
+
+    SPDLOG_LOGGER_TRACE(pLogger,
+        "Read \"{0}\" events from \"{1}\", \"{2}\" on \"{3}\"",
+        eventCount,
+        mIcsFilePath.string(),
+        meetingModels.size() - firstMeeting,
+        date);
+
+    if (meetingModels.size() == firstMeeting) {
+        return Outlook::OutlookResult::PartialOK("No meetings found");
+    }
+
+    return Outlook::OutlookResult::OK();
+}
+} // namespace tks::Services::Calendar
@@ -0,0 +1,63 @@
+// Productivity tool to help you track the time you spend on tasks
+// Copyright (C) 2026 Szymon Welgus
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+// Contact:
+//     szymonwelgus at gmail dot com
+
+
+#pragma once
+
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <spdlog/logger.h>
+
+#include "calendarprovider.h"
+
+namespace tks::Services::Calendar
+{
+/*
+ * Reads meetings for a day from an iCalendar (RFC 5545) file, one unfolded content line at a
+ * time, so only the event being read is held in memory. The file is the single "account".
+ * UTC times are converted to local time and TZID times are taken as local.
+ * DAILY and WEEKLY recurrences (INTERVAL, COUNT, UNTIL, BYDAY and WKST) are expanded onto the
+ * day, minus EXDATE dates and occurrences replaced by a RECURRENCE-ID event. Other rules are
+ * logged and only appear on their first occurrence
+ */
+class IcsCalendarProvider final : public CalendarProvider
+{
+public:
+    IcsCalendarProvider(std::shared_ptr<spdlog::logger> logger, const std::string& icsFilePath);
+    virtual ~IcsCalendarProvider() = default;
+
+    std::string GetName() const override;
+
+    Outlook::OutlookResult FetchAccountNames(
+        /*out*/ std::vector<std::string>& accountNames) override;
+
+    std::string GetSyncToken(const std::string& accountName, const std::string& date) override;
+
+    Outlook::OutlookResult FetchCalendarMeetings(const std::string& accountName,
+        const std::string& date,
+        /*out*/ std::vector<Outlook::OutlookMeetingModel>& meetingModels) override;
+
+private:
+    std::shared_ptr<spdlog::logger> pLogger;
+    std::filesystem::path mIcsFilePath;
+};
+} // namespace tks::Services::Calendar
@@ -0,0 +1,56 @@
+// Productivity tool to help you track the time you spend on tasks
+// Copyright (C) 2026 Szymon Welgus
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+// Contact:
+//     szymonwelgus at gmail dot com
+
+
+#include "outlookcalendarprovider.h"
+
+namespace tks::Services::Calendar
+{
+OutlookCalendarProvider::OutlookCalendarProvider(std::shared_ptr<spdlog::logger> logger)
+    : mOutlookService(logger)
+{
+}
+
+std::string OutlookCalendarProvider::GetName() const
+{
+    return "outlook";
+}
+
+Outlook::OutlookResult OutlookCalendarProvider::FetchAccountNames(
+    std::vector<std::string>& accountNames)
+{
+    return mOutlookService.FetchAccountNames(accountNames);
+}
+
+std::string OutlookCalendarProvider::GetSyncToken(const std::string& accountName,
+    const std::string& date)
+{
+    // Outlook has no change marker for a day short of walking its items over COM,
+    // which is the expensive part, so the cache falls back to its freshness window
+    return "";
+}
+
+Outlook::OutlookResult OutlookCalendarProvider::FetchCalendarMeetings(
+    const std::string& accountName,
+    const std::string& date,
+    std::vector<Outlook::OutlookMeetingModel>& meetingModels)
+{
+    return mOutlookService.FetchCalendarMeetings(accountName, date, meetingModels);
+}
+} // namespace tks::Services::Calendar
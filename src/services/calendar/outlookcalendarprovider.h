@@ -0,0 +1,55 @@
+// Productivity tool to help you track the time you spend on tasks
+// Copyright (C) 2026 Szymon Welgus
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+// Contact:
+//     szymonwelgus at gmail dot com
+
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <spdlog/logger.h>
+
+#include "calendarprovider.h"
+
+#include "../outlook/outlookclassicservice.h"
+
+namespace tks::Services::Calendar
+{
+class OutlookCalendarProvider final : public CalendarProvider
+{
+public:
+    OutlookCalendarProvider(std::shared_ptr<spdlog::logger> logger);
+    virtual ~OutlookCalendarProvider() = default;
+
+    std::string GetName() const override;
+
+    Outlook::OutlookResult FetchAccountNames(
+        /*out*/ std::vector<std::string>& accountNames) override;
+
+    std::string GetSyncToken(const std::string& accountName, const std::string& date) override;
+
+    Outlook::OutlookResult FetchCalendarMeetings(const std::string& accountName,
+        const std::string& date,
+        /*out*/ std::vector<Outlook::OutlookMeetingModel>& meetingModels) override;
+
+private:
+    Outlook::OutlookClassicService mOutlookService;
+};
+} // namespace tks::Services::Calendar
@@ -0,0 +1,131 @@
+// Productivity tool to help you track the time you spend on tasks
+// Copyright (C) 2026 Szymon Welgus
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+// Contact:
+//     szymonwelgus at gmail dot com
+
+#include "databaseexecutor.h"
+
+namespace tks::Services
+{
+CancellationToken::CancellationToken()
+    : pCancelled(std::make_shared<std::atomic<bool>>(false))
+{
+}
+
+void CancellationToken::Cancel()
+{
+    pCancelled->store(true);
+}
+
+bool CancellationToken::IsCancelled() const
+{
+    return pCancelled->load();
+}
+
+DatabaseExecutorContext::DatabaseExecutorContext(std::shared_ptr<spdlog::logger> logger,
+    const std::string& databaseFilePath)
+    : Tasks(logger, databaseFilePath)
+    , TaskDurations(logger, databaseFilePath)
+    , FilterEntities(logger, databaseFilePath)
+    , Employers(logger, databaseFilePath)
+{
+}
+
+DatabaseExecutor::DatabaseExecutor(std::shared_ptr<spdlog::logger> logger,
+    const std::string& databaseFilePath,
+    Dispatcher dispatcher)
+    : pLogger(logger)
+    , mDatabaseFilePath(databaseFilePath)
+    , mDispatcher(std::move(dispatcher))
+    , mMutex()
+    , mCondition()
+    , mJobs()
+    , bStopping(false)
+    , mWorker()
+{
+    mWorker = std::thread(&DatabaseExecutor::Run, this);
+}
+
+DatabaseExecutor::~DatabaseExecutor()
+{
+    Stop();
+}
+
+void DatabaseExecutor::Stop()
+{
+    {
+        std::scoped_lock lock(mMutex);
+        if (bStopping) {
+            return;
+        }
+
+        bStopping = true;
+        SPDLOG_LOGGER_TRACE(
+            pLogger, "Stop database executor with \"{0}\" queued jobs", mJobs.size());
+
+        // queued jobs are dropped, their futures report broken_promise
+        mJobs.clear();
+    }
+
+    mCondition.notify_one();
+
+    if (mWorker.joinable()) {
+        mWorker.join();
+    }
+}
+
+void DatabaseExecutor::Enqueue(Job job)
+{
+    {
+        std::scoped_lock lock(mMutex);
+        if (bStopping) {
+            return;
+        }
+
+        mJobs.push_back(std::move(job));
+    }
+
+    mCondition.notify_one();
+}
+
+void DatabaseExecutor::Run()
+{
+    // the connections are opened here so they belong to the worker thread for their lifetime
+    DatabaseExecutorContext context(pLogger, mDatabaseFilePath);
+
+    while (true) {
+        Job job;
+        {
+            std::unique_lock lock(mMutex);
+            mCondition.wait(lock, [this] { return bStopping || !mJobs.empty(); });
+
+            if (bStopping) {
+                break;
+            }
+
+            job = std::move(mJobs.front());
+            mJobs.pop_front();
+        }
+
+        try {
+            job(context);
+        } catch (const std::exception& e) {
+            pLogger->error("DatabaseExecutor - Query job threw an exception: {0}", e.what());
+        }
+    }
+}
+} // namespace tks::Services
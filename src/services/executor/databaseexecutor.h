@@ -0,0 +1,153 @@
+// Productivity tool to help you track the time you spend on tasks
+// Copyright (C) 2026 Szymon Welgus
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+// Contact:
+//     szymonwelgus at gmail dot com
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include <spdlog/spdlog.h>
+#include <spdlog/logger.h>
+
+#include "../../persistence/employerspersistence.h"
+
+#include "../filterentity/filterentityservice.h"
+#include "../taskduration/taskdurationservice.h"
+#include "../tasks/tasksservice.h"
+
+namespace tks::Services
+{
+/// <summary>
+/// Shared flag a caller flips to discard the result of a query that has been superseded
+/// </summary>
+class CancellationToken final
+{
+public:
+    CancellationToken();
+
+    void Cancel();
+    bool IsCancelled() const;
+
+private:
+    std::shared_ptr<std::atomic<bool>> pCancelled;
+};
+
+/// <summary>
+/// Services owned by the executor worker thread, their connections are never used elsewhere
+/// </summary>
+struct DatabaseExecutorContext final {
+    DatabaseExecutorContext(std::shared_ptr<spdlog::logger> logger,
+        const std::string& databaseFilePath);
+
+    TasksService Tasks;
+    TaskDurationService TaskDurations;
+    FilterEntityService FilterEntities;
+    Persistence::EmployersPersistence Employers;
+};
+
+/// <summary>
+/// Runs database queries on a dedicated worker thread, in submission order
+/// </summary>
+class DatabaseExecutor final
+{
+public:
+    using Dispatcher = std::function<void(std::function<void()>)>;
+    using Job = std::function<void(DatabaseExecutorContext&)>;
+
+    DatabaseExecutor() = delete;
+    DatabaseExecutor(const DatabaseExecutor&) = delete;
+    /// <param name="dispatcher">Marshals completion callbacks onto the UI thread</param>
+    DatabaseExecutor(std::shared_ptr<spdlog::logger> logger,
+        const std::string& databaseFilePath,
+        Dispatcher dispatcher);
+    ~DatabaseExecutor();
+
+    DatabaseExecutor& operator=(const DatabaseExecutor&) = delete;
+
+    template<typename TResult>
+    std::future<TResult> Submit(std::function<TResult(DatabaseExecutorContext&)> query);
+
+    /// <summary>
+    /// Run the query on the worker thread and hand its result to the completion callback on the
+    /// dispatcher thread, unless the token was cancelled before either point
+    /// </summary>
+    template<typename TResult>
+    void Post(CancellationToken token,
+        std::function<TResult(DatabaseExecutorContext&)> query,
+        std::function<void(TResult&)> completion);
+
+    void Stop();
+
+private:
+    void Enqueue(Job job);
+    void Run();
+
+    std::shared_ptr<spdlog::logger> pLogger;
+    std::string mDatabaseFilePath;
+    Dispatcher mDispatcher;
+
+    std::mutex mMutex;
+    std::condition_variable mCondition;
+    std::deque<Job> mJobs;
+    bool bStopping;
+
+    std::thread mWorker;
+};
+
+template<typename TResult>
+std::future<TResult> DatabaseExecutor::Submit(
+    std::function<TResult(DatabaseExecutorContext&)> query)
+{
+    auto task = std::make_shared<std::packaged_task<TResult(DatabaseExecutorContext&)>>(
+        std::move(query));
+    auto future = task->get_future();
+
+    Enqueue([task](DatabaseExecutorContext& context) { (*task)(context); });
+
+    return future;
+}
+
+template<typename TResult>
+void DatabaseExecutor::Post(CancellationToken token,
+    std::function<TResult(DatabaseExecutorContext&)> query,
+    std::function<void(TResult&)> completion)
+{
+    Enqueue([this, token, query = std::move(query), completion = std::move(completion)](
+                DatabaseExecutorContext& context) {
+        if (token.IsCancelled()) {
+            return;
+        }
+
+        auto result = std::make_shared<TResult>(query(context));
+
+        mDispatcher([token, completion, result]() {
+            if (!token.IsCancelled()) {
+                completion(*result);
+            }
+        });
+    });
+}
+} // namespace tks::Services
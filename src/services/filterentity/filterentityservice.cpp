@@ -19,20 +19,74 @@
 
 #include "filterentityservice.h"
 
+#include <algorithm>
+#include <cctype>
+
 #include "../../common/logmessages.h"
 
+#include "../../persistence/base/rowmapper.h"
+
 #include "../../common/messages/sqlitemessages.h"
 
 #include "../../utils/utils.h"
 
 namespace tks::Services
 {
+namespace
+{
+// the trigram tokenizer of entities_fts cannot match anything shorter than three characters
+bool UseEntityIndex(const std::string& searchTerm)
+{
+    std::size_t characters = 0;
+    for (const char c : searchTerm) {
+        // count UTF-8 lead bytes, continuation bytes are 10xxxxxx
+        if ((static_cast<unsigned char>(c) & 0xC0) != 0x80) {
+            characters++;
+        }
+    }
+
+    return characters >= 3;
+}
+
+bool ContainsIgnoreCase(const std::string& source, const std::string& searchTerm)
+{
+    auto it = std::search(source.begin(),
+        source.end(),
+        searchTerm.begin(),
+        searchTerm.end(),
+        [](char left, char right) {
+            return std::tolower(static_cast<unsigned char>(left)) ==
+                   std::tolower(static_cast<unsigned char>(right));
+        });
+
+    return it != source.end();
+}
+
+std::string ReadTextColumn(sqlite3_stmt* stmt, int column)
+{
+    std::string value;
+    Persistence::ColumnReader<std::string>::Read(stmt, column, value);
+    return value;
+}
+
+std::string ReadFlagColumn(sqlite3_stmt* stmt, int column)
+{
+    return sqlite3_column_int(stmt, column) ? "Yes" : "No";
+}
+} // namespace
+
+FilterEntityModel::FilterEntityModel()
+    : FilterEntityModel(EditListEntityType::Employers)
+{
+}
+
 FilterEntityModel::FilterEntityModel(EditListEntityType type)
     : Type(type)
     , EntityId(-1)
     , EntityName("")
     , EntityDateModified(-1)
     , Metadata()
+    , EntityDescription()
 {
 }
 
@@ -46,6 +100,7 @@ FilterEntityModel::FilterEntityModel(EditListEntityType type,
     , EntityName(entityName)
     , EntityDateModified(entityDateModified)
     , Metadata(metadata)
+    , EntityDescription()
 {
 }
 
@@ -60,101 +115,38 @@ FilterEntityService::~FilterEntityService() {}
 SqliteResult FilterEntityService::FilterClients(const std::string& searchTerm,
     std::vector<FilterEntityModel>& models)
 {
-    sqlite3_stmt* stmt = nullptr;
-
-    auto formattedSearchTerm = Utils::FormatSqlSearchTerm(searchTerm);
-
-    int rc = sqlite3_prepare_v2(pDb,
-        FilterEntityService::filterClients.c_str(),
-        static_cast<int>(FilterEntityService::filterClients.size()),
-        &stmt,
-        nullptr);
-
-    if (rc != SQLITE_OK) {
-        const char* error = sqlite3_errmsg(pDb);
-        pLogger->error(
-            LogMessages::PrepareStatementTemplate, FilterEntityService::filterClients, rc, error);
-
-        sqlite3_finalize(stmt);
-        return SqliteResult::FailDetailed(
-            Messages::PrepareStatementMessage, rc, std::string(error));
+    const bool useEntityIndex = UseEntityIndex(searchTerm);
+    const std::string_view query =
+        useEntityIndex ? FilterEntityService::searchClients : FilterEntityService::filterClients;
+
+    std::vector<std::string> terms;
+    if (useEntityIndex) {
+        // the client itself or the name of its employer
+        const auto phraseTerm = Utils::FormatFtsPhraseTerm(searchTerm);
+        terms = { phraseTerm, "name : " + phraseTerm };
+    } else {
+        const auto formattedSearchTerm = Utils::FormatSqlSearchTerm(searchTerm);
+        terms = { formattedSearchTerm, formattedSearchTerm };
     }
 
-    int bindIndex = 1;
-
-    // client name
-    rc = sqlite3_bind_text(stmt,
-        bindIndex,
-        formattedSearchTerm.c_str(),
-        static_cast<int>(formattedSearchTerm.size()),
-        SQLITE_TRANSIENT);
-
-    if (rc != SQLITE_OK) {
-        const char* error = sqlite3_errmsg(pDb);
-        pLogger->error(LogMessages::BindParameterTemplate, "name", bindIndex, rc, error);
-
-        sqlite3_finalize(stmt);
-        return SqliteResult::FailDetailed(Messages::BindStatementMessage, rc, std::string(error));
-    }
-
-    bindIndex++;
-
-    // linked employer name
-    rc = sqlite3_bind_text(stmt,
-        bindIndex,
-        formattedSearchTerm.c_str(),
-        static_cast<int>(formattedSearchTerm.size()),
-        SQLITE_TRANSIENT);
-
-    if (rc != SQLITE_OK) {
-        const char* error = sqlite3_errmsg(pDb);
-
-        pLogger->error(LogMessages::BindParameterTemplate, "employer_name", bindIndex, rc, error);
+    sqlite3_stmt* stmt = nullptr;
 
-        sqlite3_finalize(stmt);
-        return SqliteResult::FailDetailed(Messages::BindStatementMessage, rc, std::string(error));
+    auto sqliteResult = PrepareFilterStatement(query, terms, &stmt);
+    if (!sqliteResult.Success) {
+        return sqliteResult;
     }
 
-    bool done = false;
-    while (!done) {
-        switch (sqlite3_step(stmt)) {
-        case SQLITE_ROW: {
-            rc = SQLITE_ROW;
-
-            FilterEntityModel clientModel(EditListEntityType::Clients);
-            std::vector<std::string> metadata;
-            int columnIndex = 0;
-
-            clientModel.EntityId = sqlite3_column_int64(stmt, columnIndex++);
-
-            const unsigned char* res = sqlite3_column_text(stmt, columnIndex);
-            clientModel.EntityName = std::string(
-                reinterpret_cast<const char*>(res), sqlite3_column_bytes(stmt, columnIndex++));
-
-            clientModel.EntityDateModified = sqlite3_column_int(stmt, columnIndex++);
-
-            res = sqlite3_column_text(stmt, columnIndex);
-            std::string value = std::string(
-                reinterpret_cast<const char*>(res), sqlite3_column_bytes(stmt, columnIndex++));
-            metadata.push_back(value);
-            clientModel.Metadata = metadata;
+    int rc = Persistence::ReadRows(
+        stmt, FilterEntityModelColumns, models, [&](FilterEntityModel& model, int columnIndex) {
+            model.Type = EditListEntityType::Clients;
 
-            models.push_back(clientModel);
-            break;
-        }
-        case SQLITE_DONE:
-            rc = SQLITE_DONE;
-            done = true;
-            break;
-        default:
-            break;
-        }
-    }
+            // employer name
+            model.Metadata.push_back(ReadTextColumn(stmt, columnIndex));
+        });
 
     if (rc != SQLITE_DONE) {
         const char* error = sqlite3_errmsg(pDb);
-        pLogger->error(
-            LogMessages::ExecStepTemplate, FilterEntityService::filterClients, rc, error);
+        pLogger->error(LogMessages::ExecStepTemplate, query, rc, error);
 
         sqlite3_finalize(stmt);
         return SqliteResult::FailDetailed(Messages::StepStatementMessage, rc, std::string(error));
@@ -170,115 +162,43 @@ SqliteResult FilterEntityService::FilterClients(const std::string& searchTerm,
 SqliteResult FilterEntityService::FilterProjects(const std::string& searchTerm,
     std::vector<FilterEntityModel>& models)
 {
-    sqlite3_stmt* stmt = nullptr;
-
-    auto formattedSearchTerm = Utils::FormatSqlSearchTerm(searchTerm);
-
-    int rc = sqlite3_prepare_v2(pDb,
-        FilterEntityService::filterProjects.c_str(),
-        static_cast<int>(FilterEntityService::filterProjects.size()),
-        &stmt,
-        nullptr);
-
-    if (rc != SQLITE_OK) {
-        const char* error = sqlite3_errmsg(pDb);
-        pLogger->error(
-            LogMessages::PrepareStatementTemplate, FilterEntityService::filterProjects, rc, error);
-
-        sqlite3_finalize(stmt);
-        return SqliteResult::FailDetailed(
-            Messages::PrepareStatementMessage, rc, std::string(error));
+    const bool useEntityIndex = UseEntityIndex(searchTerm);
+    const std::string_view query =
+        useEntityIndex ? FilterEntityService::searchProjects : FilterEntityService::filterProjects;
+
+    std::vector<std::string> terms;
+    if (useEntityIndex) {
+        terms = { Utils::FormatFtsPhraseTerm(searchTerm) };
+    } else {
+        const auto formattedSearchTerm = Utils::FormatSqlSearchTerm(searchTerm);
+        terms = { formattedSearchTerm, formattedSearchTerm };
     }
 
-    int bindIndex = 1;
-
-    // project name
-    rc = sqlite3_bind_text(stmt,
-        bindIndex,
-        formattedSearchTerm.c_str(),
-        static_cast<int>(formattedSearchTerm.size()),
-        SQLITE_TRANSIENT);
-
-    if (rc != SQLITE_OK) {
-        const char* error = sqlite3_errmsg(pDb);
-        pLogger->error(LogMessages::BindParameterTemplate, "name", bindIndex, rc, error);
-
-        sqlite3_finalize(stmt);
-        return SqliteResult::FailDetailed(Messages::BindStatementMessage, rc, std::string(error));
-    }
-
-    bindIndex++;
-
-    // project description
-    rc = sqlite3_bind_text(stmt,
-        bindIndex,
-        formattedSearchTerm.c_str(),
-        static_cast<int>(formattedSearchTerm.size()),
-        SQLITE_TRANSIENT);
-
-    if (rc != SQLITE_OK) {
-        const char* error = sqlite3_errmsg(pDb);
-        pLogger->error(LogMessages::BindParameterTemplate, "description", bindIndex, rc, error);
+    sqlite3_stmt* stmt = nullptr;
 
-        sqlite3_finalize(stmt);
-        return SqliteResult::FailDetailed(Messages::BindStatementMessage, rc, std::string(error));
+    auto sqliteResult = PrepareFilterStatement(query, terms, &stmt);
+    if (!sqliteResult.Success) {
+        return sqliteResult;
     }
 
-    bool done = false;
-    while (!done) {
-        switch (sqlite3_step(stmt)) {
-        case SQLITE_ROW: {
-            rc = SQLITE_ROW;
-
-            FilterEntityModel projectModel(EditListEntityType::Projects);
-            std::vector<std::string> metadata;
-            int columnIndex = 0;
-
-            projectModel.EntityId = sqlite3_column_int64(stmt, columnIndex++);
-
-            const unsigned char* res = sqlite3_column_text(stmt, columnIndex);
-            projectModel.EntityName = std::string(
-                reinterpret_cast<const char*>(res), sqlite3_column_bytes(stmt, columnIndex++));
+    int rc = Persistence::ReadRows(
+        stmt, FilterEntityModelColumns, models, [&](FilterEntityModel& model, int columnIndex) {
+            model.Type = EditListEntityType::Projects;
 
             // is default
-            bool bvalue = !!sqlite3_column_int(stmt, columnIndex++);
-            std::string value = bvalue ? "Yes" : "No";
-            metadata.push_back(value);
-
-            projectModel.EntityDateModified = sqlite3_column_int(stmt, columnIndex++);
+            model.Metadata.push_back(ReadFlagColumn(stmt, columnIndex++));
 
             // employer name
-            res = sqlite3_column_text(stmt, columnIndex);
-            value = std::string(
-                reinterpret_cast<const char*>(res), sqlite3_column_bytes(stmt, columnIndex++));
-            metadata.push_back(value);
+            model.Metadata.push_back(ReadTextColumn(stmt, columnIndex++));
 
             // client name
-            res = sqlite3_column_text(stmt, columnIndex);
-            value = std::string(
-                reinterpret_cast<const char*>(res), sqlite3_column_bytes(stmt, columnIndex++));
-            if (value.empty()) {
-                value = "(n/a)";
-            }
-            metadata.push_back(value);
-            projectModel.Metadata = metadata;
-
-            models.push_back(projectModel);
-            break;
-        }
-        case SQLITE_DONE:
-            rc = SQLITE_DONE;
-            done = true;
-            break;
-        default:
-            break;
-        }
-    }
+            std::string clientName = ReadTextColumn(stmt, columnIndex);
+            model.Metadata.push_back(clientName.empty() ? "(n/a)" : clientName);
+        });
 
     if (rc != SQLITE_DONE) {
         const char* error = sqlite3_errmsg(pDb);
-        pLogger->error(
-            LogMessages::ExecStepTemplate, FilterEntityService::filterProjects, rc, error);
+        pLogger->error(LogMessages::ExecStepTemplate, query, rc, error);
 
         sqlite3_finalize(stmt);
         return SqliteResult::FailDetailed(Messages::StepStatementMessage, rc, std::string(error));
@@ -293,102 +213,38 @@ SqliteResult FilterEntityService::FilterProjects(const std::string& searchTerm,
 SqliteResult FilterEntityService::FilterCategories(const std::string& searchTerm,
     std::vector<FilterEntityModel>& models)
 {
-    sqlite3_stmt* stmt = nullptr;
-
-    auto formattedSearchTerm = Utils::FormatSqlSearchTerm(searchTerm);
-
-    int rc = sqlite3_prepare_v2(pDb,
-        FilterEntityService::filterCategories.c_str(),
-        static_cast<int>(FilterEntityService::filterCategories.size()),
-        &stmt,
-        nullptr);
-
-    if (rc != SQLITE_OK) {
-        const char* error = sqlite3_errmsg(pDb);
-        pLogger->error(LogMessages::PrepareStatementTemplate,
-            FilterEntityService::filterCategories,
-            rc,
-            error);
-
-        sqlite3_finalize(stmt);
-        return SqliteResult::FailDetailed(
-            Messages::PrepareStatementMessage, rc, std::string(error));
-    }
-
-    int bindIndex = 1;
-
-    // category name
-    rc = sqlite3_bind_text(stmt,
-        bindIndex,
-        formattedSearchTerm.c_str(),
-        static_cast<int>(formattedSearchTerm.size()),
-        SQLITE_TRANSIENT);
-
-    if (rc != SQLITE_OK) {
-        const char* error = sqlite3_errmsg(pDb);
-        pLogger->error(LogMessages::BindParameterTemplate, "name", bindIndex, rc, error);
-
-        sqlite3_finalize(stmt);
-        return SqliteResult::FailDetailed(Messages::BindStatementMessage, rc, std::string(error));
+    const bool useEntityIndex = UseEntityIndex(searchTerm);
+    const std::string_view query = useEntityIndex ? FilterEntityService::searchCategories
+                                                   : FilterEntityService::filterCategories;
+
+    std::vector<std::string> terms;
+    if (useEntityIndex) {
+        // the category itself or the name of its project
+        const auto phraseTerm = Utils::FormatFtsPhraseTerm(searchTerm);
+        terms = { phraseTerm, "name : " + phraseTerm };
+    } else {
+        const auto formattedSearchTerm = Utils::FormatSqlSearchTerm(searchTerm);
+        terms = { formattedSearchTerm, formattedSearchTerm };
     }
 
-    bindIndex++;
-
-    // project_name
-    rc = sqlite3_bind_text(stmt,
-        bindIndex,
-        formattedSearchTerm.c_str(),
-        static_cast<int>(formattedSearchTerm.size()),
-        SQLITE_TRANSIENT);
-
-    if (rc != SQLITE_OK) {
-        const char* error = sqlite3_errmsg(pDb);
-        pLogger->error(LogMessages::BindParameterTemplate, "project_name", bindIndex, rc, error);
+    sqlite3_stmt* stmt = nullptr;
 
-        sqlite3_finalize(stmt);
-        return SqliteResult::FailDetailed(Messages::BindStatementMessage, rc, std::string(error));
+    auto sqliteResult = PrepareFilterStatement(query, terms, &stmt);
+    if (!sqliteResult.Success) {
+        return sqliteResult;
     }
 
-    bool done = false;
-    while (!done) {
-        switch (sqlite3_step(stmt)) {
-        case SQLITE_ROW: {
-            rc = SQLITE_ROW;
-
-            FilterEntityModel categoryModel(EditListEntityType::Categories);
-            std::vector<std::string> metadata;
-            int columnIndex = 0;
-
-            categoryModel.EntityId = sqlite3_column_int64(stmt, columnIndex++);
+    int rc = Persistence::ReadRows(
+        stmt, FilterEntityModelColumns, models, [&](FilterEntityModel& model, int columnIndex) {
+            model.Type = EditListEntityType::Categories;
 
-            const unsigned char* res = sqlite3_column_text(stmt, columnIndex);
-            categoryModel.EntityName = std::string(
-                reinterpret_cast<const char*>(res), sqlite3_column_bytes(stmt, columnIndex++));
-
-            categoryModel.EntityDateModified = sqlite3_column_int(stmt, columnIndex++);
-
-            res = sqlite3_column_text(stmt, columnIndex);
-            std::string value = std::string(
-                reinterpret_cast<const char*>(res), sqlite3_column_bytes(stmt, columnIndex++));
-            metadata.push_back(value);
-            categoryModel.Metadata = metadata;
-
-            models.push_back(categoryModel);
-            break;
-        }
-        case SQLITE_DONE:
-            rc = SQLITE_DONE;
-            done = true;
-            break;
-        default:
-            break;
-        }
-    }
+            // project name
+            model.Metadata.push_back(ReadTextColumn(stmt, columnIndex));
+        });
 
     if (rc != SQLITE_DONE) {
         const char* error = sqlite3_errmsg(pDb);
-        pLogger->error(
-            LogMessages::ExecStepTemplate, FilterEntityService::filterCategories, rc, error);
+        pLogger->error(LogMessages::ExecStepTemplate, query, rc, error);
 
         sqlite3_finalize(stmt);
         return SqliteResult::FailDetailed(Messages::StepStatementMessage, rc, std::string(error));
@@ -404,130 +260,110 @@ SqliteResult FilterEntityService::FilterCategories(const std::string& searchTerm
 SqliteResult FilterEntityService::FilterAttributeGroups(const std::string& searchTerm,
     std::vector<FilterEntityModel>& models)
 {
-    auto formatedSearchTerm = Utils::FormatSqlSearchTerm(searchTerm);
+    const bool useEntityIndex = UseEntityIndex(searchTerm);
+    const std::string_view query = useEntityIndex ? FilterEntityService::searchAttributeGroups
+                                                   : FilterEntityService::filterAttributeGroups;
+
+    std::vector<std::string> terms;
+    if (useEntityIndex) {
+        terms = { Utils::FormatFtsPhraseTerm(searchTerm) };
+    } else {
+        const auto formattedSearchTerm = Utils::FormatSqlSearchTerm(searchTerm);
+        terms = { formattedSearchTerm, formattedSearchTerm };
+    }
 
     sqlite3_stmt* stmt = nullptr;
 
-    int rc = sqlite3_prepare_v2(pDb,
-        FilterEntityService::filterAttributeGroups.c_str(),
-        static_cast<int>(FilterEntityService::filterAttributeGroups.size()),
-        &stmt,
-        nullptr);
-
-    if (rc != SQLITE_OK) {
-        const char* error = sqlite3_errmsg(pDb);
-        pLogger->error(LogMessages::PrepareStatementTemplate,
-            FilterEntityService::filterAttributeGroups,
-            rc,
-            error);
-
-        sqlite3_finalize(stmt);
-        return SqliteResult::FailDetailed(
-            Messages::PrepareStatementMessage, rc, std::string(error));
+    auto sqliteResult = PrepareFilterStatement(query, terms, &stmt);
+    if (!sqliteResult.Success) {
+        return sqliteResult;
     }
 
-    int bindIndex = 1;
+    int rc = Persistence::ReadRows(
+        stmt, FilterEntityModelColumns, models, [&](FilterEntityModel& model, int columnIndex) {
+            model.Type = EditListEntityType::AttributeGroups;
 
-    // name
-    rc = sqlite3_bind_text(stmt,
-        bindIndex,
-        formatedSearchTerm.c_str(),
-        static_cast<int>(formatedSearchTerm.size()),
-        SQLITE_TRANSIENT);
+            // is static, is default
+            model.Metadata.push_back(ReadFlagColumn(stmt, columnIndex++));
+            model.Metadata.push_back(ReadFlagColumn(stmt, columnIndex));
+        });
 
-    if (rc != SQLITE_OK) {
+    if (rc != SQLITE_DONE) {
         const char* error = sqlite3_errmsg(pDb);
-        pLogger->error(LogMessages::BindParameterTemplate, "name", bindIndex, rc, error);
+        pLogger->error(LogMessages::ExecStepTemplate, query, rc, error);
 
         sqlite3_finalize(stmt);
-        return SqliteResult::FailDetailed(Messages::BindStatementMessage, rc, std::string(error));
+        return SqliteResult::FailDetailed(Messages::StepStatementMessage, rc, std::string(error));
     }
 
-    bindIndex++;
+    sqlite3_finalize(stmt);
 
-    // description
-    rc = sqlite3_bind_text(stmt,
-        bindIndex,
-        formatedSearchTerm.c_str(),
-        static_cast<int>(formatedSearchTerm.size()),
-        SQLITE_TRANSIENT);
+    SPDLOG_LOGGER_TRACE(pLogger, LogMessages::FilterEntities, models.size(), searchTerm);
 
-    if (rc != SQLITE_OK) {
-        const char* error = sqlite3_errmsg(pDb);
-        pLogger->error(LogMessages::BindParameterTemplate, "description", bindIndex, rc, error);
+    return SqliteResult::OK();
+}
 
-        sqlite3_finalize(stmt);
-        return SqliteResult::FailDetailed(Messages::BindStatementMessage, rc, std::string(error));
+SqliteResult FilterEntityService::FilterAttributes(const std::string& searchTerm,
+    std::vector<FilterEntityModel>& models)
+{
+    const bool useEntityIndex = UseEntityIndex(searchTerm);
+    const std::string_view query = useEntityIndex ? FilterEntityService::searchAttributes
+                                                   : FilterEntityService::filterAttributes;
+
+    std::vector<std::string> terms;
+    if (useEntityIndex) {
+        terms = { Utils::FormatFtsPhraseTerm(searchTerm) };
+    } else {
+        const auto formattedSearchTerm = Utils::FormatSqlSearchTerm(searchTerm);
+        terms = { formattedSearchTerm, formattedSearchTerm };
     }
 
-    bool done = false;
-    while (!done) {
-        switch (sqlite3_step(stmt)) {
-        case SQLITE_ROW: {
-            rc = SQLITE_ROW;
-
-            FilterEntityModel attributeGroupModel(EditListEntityType::AttributeGroups);
-            std::vector<std::string> metadata;
-
-            int columnIndex = 0;
-            attributeGroupModel.EntityId = sqlite3_column_int64(stmt, columnIndex++);
+    sqlite3_stmt* stmt = nullptr;
 
-            const unsigned char* res = sqlite3_column_text(stmt, columnIndex);
-            attributeGroupModel.EntityName = std::string(
-                reinterpret_cast<const char*>(res), sqlite3_column_bytes(stmt, columnIndex++));
+    auto sqliteResult = PrepareFilterStatement(query, terms, &stmt);
+    if (!sqliteResult.Success) {
+        return sqliteResult;
+    }
 
-            bool value = !!sqlite3_column_int(stmt, columnIndex++);
-            metadata.push_back(value ? "Yes" : "No");
-            value = !!sqlite3_column_int(stmt, columnIndex++);
-            metadata.push_back(value ? "Yes" : "No");
+    int rc = Persistence::ReadRows(
+        stmt, FilterEntityModelColumns, models, [&](FilterEntityModel& model, int columnIndex) {
+            model.Type = EditListEntityType::Attributes;
 
-            attributeGroupModel.EntityDateModified = sqlite3_column_int(stmt, columnIndex++);
-            attributeGroupModel.Metadata = metadata;
-
-            models.push_back(attributeGroupModel);
-            break;
-        }
-        case SQLITE_DONE:
-            rc = SQLITE_DONE;
-            done = true;
-            break;
-        default:
-            break;
-        }
-    }
+            // is required, attribute group name, attribute type name
+            model.Metadata.push_back(ReadFlagColumn(stmt, columnIndex++));
+            model.Metadata.push_back(ReadTextColumn(stmt, columnIndex++));
+            model.Metadata.push_back(ReadTextColumn(stmt, columnIndex));
+        });
 
     if (rc != SQLITE_DONE) {
         const char* error = sqlite3_errmsg(pDb);
-        pLogger->error(
-            LogMessages::ExecStepTemplate, FilterEntityService::filterAttributeGroups, rc, error);
+        pLogger->error(LogMessages::ExecStepTemplate, query, rc, error);
 
         sqlite3_finalize(stmt);
         return SqliteResult::FailDetailed(Messages::StepStatementMessage, rc, std::string(error));
     }
 
     sqlite3_finalize(stmt);
-
     SPDLOG_LOGGER_TRACE(pLogger, LogMessages::FilterEntities, models.size(), searchTerm);
 
     return SqliteResult::OK();
 }
 
-SqliteResult FilterEntityService::FilterAttributes(const std::string& searchTerm,
+SqliteResult FilterEntityService::FilterStaticAttributes(const std::string& searchTerm,
     std::vector<FilterEntityModel>& models)
 {
-    auto formatedSearchTerm = Utils::FormatSqlSearchTerm(searchTerm);
-
     sqlite3_stmt* stmt = nullptr;
+
     int rc = sqlite3_prepare_v2(pDb,
-        FilterEntityService::filterAttributes.c_str(),
-        static_cast<int>(FilterEntityService::filterAttributes.size()),
+        FilterEntityService::filterStaticAttributes.data(),
+        static_cast<int>(FilterEntityService::filterStaticAttributes.size()),
         &stmt,
         nullptr);
 
     if (rc != SQLITE_OK) {
         const char* error = sqlite3_errmsg(pDb);
         pLogger->error(LogMessages::PrepareStatementTemplate,
-            FilterEntityService::filterAttributes,
+            FilterEntityService::filterStaticAttributes,
             rc,
             error);
 
@@ -536,194 +372,122 @@ SqliteResult FilterEntityService::FilterAttributes(const std::string& searchTerm
             Messages::PrepareStatementMessage, rc, std::string(error));
     }
 
-    int bindIndex = 1;
+    rc = Persistence::ReadRows(
+        stmt, FilterEntityModelColumns, models, [&](FilterEntityModel& model, int columnIndex) {
+            model.Type = EditListEntityType::StaticAttributeGroups;
 
-    // name
-    rc = sqlite3_bind_text(stmt,
-        bindIndex,
-        formatedSearchTerm.c_str(),
-        static_cast<int>(formatedSearchTerm.size()),
-        SQLITE_TRANSIENT);
+            // static attribute value count
+            model.Metadata.push_back(std::to_string(sqlite3_column_int(stmt, columnIndex)));
+        });
 
-    if (rc != SQLITE_OK) {
+    if (rc != SQLITE_DONE) {
         const char* error = sqlite3_errmsg(pDb);
-        pLogger->error(LogMessages::BindParameterTemplate, "name", bindIndex, rc, error);
+        pLogger->error(LogMessages::ExecStepTemplate, FilterEntityService::filterStaticAttributes,
+            rc,
+            error);
 
         sqlite3_finalize(stmt);
-        return SqliteResult::FailDetailed(Messages::BindStatementMessage, rc, std::string(error));
+        return SqliteResult::FailDetailed(Messages::StepStatementMessage, rc, std::string(error));
     }
 
-    bindIndex++;
-
-    // description
-    rc = sqlite3_bind_text(stmt,
-        bindIndex,
-        formatedSearchTerm.c_str(),
-        static_cast<int>(formatedSearchTerm.size()),
-        SQLITE_TRANSIENT);
+    sqlite3_finalize(stmt);
+    SPDLOG_LOGGER_TRACE(
+        pLogger, LogMessages::FilterEntities, models.size(), "");
 
-    if (rc != SQLITE_OK) {
-        const char* error = sqlite3_errmsg(pDb);
-        pLogger->error(LogMessages::BindParameterTemplate, "description", bindIndex, rc, error);
+    return SqliteResult::OK();
+}
 
-        sqlite3_finalize(stmt);
-        return SqliteResult::FailDetailed(Messages::BindStatementMessage, rc, std::string(error));
+bool FilterEntityService::MatchesSearchTerm(const FilterEntityModel& model,
+    const std::string& searchTerm)
+{
+    // LIKE and the trigram index only fold the case of ASCII characters the same way
+    bool isAscii = std::all_of(searchTerm.begin(), searchTerm.end(), [](char c) {
+        return static_cast<unsigned char>(c) < 0x80;
+    });
+    if (!isAscii || !UseEntityIndex(searchTerm)) {
+        return false;
     }
 
-    bool done = false;
-    while (!done) {
-        switch (sqlite3_step(stmt)) {
-        case SQLITE_ROW: {
-            rc = SQLITE_ROW;
-
-            FilterEntityModel attributeModel(EditListEntityType::Attributes);
-            std::vector<std::string> metadata;
-            int columnIndex = 0;
-
-            attributeModel.EntityId = sqlite3_column_int64(stmt, columnIndex++);
-
-            const unsigned char* res = sqlite3_column_text(stmt, columnIndex);
-            attributeModel.EntityName = std::string(
-                reinterpret_cast<const char*>(res), sqlite3_column_bytes(stmt, columnIndex++));
-
-            bool value = sqlite3_column_int(stmt, columnIndex++);
-            metadata.push_back(value ? "Yes" : "No");
-
-            res = sqlite3_column_text(stmt, columnIndex);
-            std::string svalue = std::string(
-                reinterpret_cast<const char*>(res), sqlite3_column_bytes(stmt, columnIndex++));
-            metadata.push_back(svalue);
-
-            res = sqlite3_column_text(stmt, columnIndex);
-            svalue = std::string(
-                reinterpret_cast<const char*>(res), sqlite3_column_bytes(stmt, columnIndex++));
-            metadata.push_back(svalue);
-
-            attributeModel.EntityDateModified = sqlite3_column_int(stmt, columnIndex++);
-            attributeModel.Metadata = metadata;
-
-            models.push_back(attributeModel);
-            break;
-        }
-        case SQLITE_DONE:
-            rc = SQLITE_DONE;
-            done = true;
-            break;
-        default:
-            break;
-        }
+    if (ContainsIgnoreCase(model.EntityName, searchTerm) ||
+        ContainsIgnoreCase(model.EntityDescription, searchTerm)) {
+        return true;
     }
 
-    if (rc != SQLITE_DONE) {
-        const char* error = sqlite3_errmsg(pDb);
-        pLogger->error(
-            LogMessages::ExecStepTemplate, FilterEntityService::filterAttributes, rc, error);
-
-        sqlite3_finalize(stmt);
-        return SqliteResult::FailDetailed(Messages::StepStatementMessage, rc, std::string(error));
+    switch (model.Type) {
+    case EditListEntityType::Clients:
+    case EditListEntityType::Categories:
+        // the name of the linked employer or project
+        return !model.Metadata.empty() && ContainsIgnoreCase(model.Metadata[0], searchTerm);
+    case EditListEntityType::StaticAttributeGroups:
+        // static attribute groups are not filtered by a search term
+        return true;
+    default:
+        return false;
     }
-
-    sqlite3_finalize(stmt);
-    SPDLOG_LOGGER_TRACE(pLogger, LogMessages::FilterEntities, models.size(), searchTerm);
-
-    return SqliteResult::OK();
 }
 
-SqliteResult FilterEntityService::FilterStaticAttributes(const std::string& searchTerm,
-    std::vector<FilterEntityModel>& models)
+SqliteResult FilterEntityService::PrepareFilterStatement(std::string_view query,
+    const std::vector<std::string>& terms,
+    sqlite3_stmt** stmt) const
 {
-    sqlite3_stmt* stmt = nullptr;
-
-    int rc = sqlite3_prepare_v2(pDb,
-        FilterEntityService::filterStaticAttributes.c_str(),
-        static_cast<int>(FilterEntityService::filterStaticAttributes.size()),
-        &stmt,
-        nullptr);
+    int rc = sqlite3_prepare_v2(pDb, query.data(), static_cast<int>(query.size()), stmt, nullptr);
 
     if (rc != SQLITE_OK) {
         const char* error = sqlite3_errmsg(pDb);
-        pLogger->error(LogMessages::PrepareStatementTemplate,
-            FilterEntityService::filterStaticAttributes,
-            rc,
-            error);
+        pLogger->error(LogMessages::PrepareStatementTemplate, query, rc, error);
 
-        sqlite3_finalize(stmt);
+        sqlite3_finalize(*stmt);
         return SqliteResult::FailDetailed(
             Messages::PrepareStatementMessage, rc, std::string(error));
     }
 
-    bool done = false;
-    while (!done) {
-        switch (sqlite3_step(stmt)) {
-        case SQLITE_ROW: {
-            rc = SQLITE_ROW;
-
-            FilterEntityModel staticAttributeModel(EditListEntityType::StaticAttributeGroups);
-            std::vector<std::string> metadata;
-            int columnIndex = 0;
-
-            staticAttributeModel.EntityId = sqlite3_column_int64(stmt, columnIndex++);
-
-            const unsigned char* res = sqlite3_column_text(stmt, columnIndex);
-            staticAttributeModel.EntityName = std::string(
-                reinterpret_cast<const char*>(res), sqlite3_column_bytes(stmt, columnIndex++));
+    int bindIndex = 1;
 
-            int staticAttributeValueCount =
-                sqlite3_column_int(stmt, columnIndex++);
-            metadata.push_back(std::to_string(staticAttributeValueCount));
+    for (const auto& term : terms) {
+        rc = sqlite3_bind_text(
+            *stmt, bindIndex, term.c_str(), static_cast<int>(term.size()), SQLITE_TRANSIENT);
 
-            staticAttributeModel.EntityDateModified = sqlite3_column_int(stmt, columnIndex++);
-            staticAttributeModel.Metadata = metadata;
+        if (rc != SQLITE_OK) {
+            const char* error = sqlite3_errmsg(pDb);
+            pLogger->error(LogMessages::BindParameterTemplate, "search_term", bindIndex, rc, error);
 
-            models.push_back(staticAttributeModel);
-            break;
-        }
-        case SQLITE_DONE:
-            rc = SQLITE_DONE;
-            done = true;
-            break;
-        default:
-            break;
+            sqlite3_finalize(*stmt);
+            return SqliteResult::FailDetailed(
+                Messages::BindStatementMessage, rc, std::string(error));
         }
-    }
-
-    if (rc != SQLITE_DONE) {
-        const char* error = sqlite3_errmsg(pDb);
-        pLogger->error(LogMessages::ExecStepTemplate, FilterEntityService::filterStaticAttributes,
-            rc,
-            error);
 
-        sqlite3_finalize(stmt);
-        return SqliteResult::FailDetailed(Messages::StepStatementMessage, rc, std::string(error));
+        bindIndex++;
     }
 
-    sqlite3_finalize(stmt);
-    SPDLOG_LOGGER_TRACE(
-        pLogger, LogMessages::FilterEntities, models.size(), "");
-
     return SqliteResult::OK();
 }
 
-std::string FilterEntityService::filterClients = "SELECT "
-                                                 "clients.client_id, "
-                                                 "clients.name AS client_name, "
-                                                 "clients.date_modified, "
-                                                 "employers.name AS employer_name "
-                                                 "FROM clients "
-                                                 "INNER JOIN employers "
-                                                 "ON clients.employer_id = employers.employer_id "
-                                                 "WHERE clients.is_active = 1 "
-                                                 "AND (client_name LIKE ? "
-                                                 "OR employer_name LIKE ? "
-                                                 "OR clients.description LIKE ?);"
-                                                 "ORDER BY clients.date_modified ASC;";
-
-std::string FilterEntityService::filterProjects =
+// the metadata columns of each entity follow the ones in FilterEntityModelColumns
+constexpr std::string_view FilterEntityService::filterClients =
+    "SELECT "
+    "clients.client_id, "
+    "clients.name AS client_name, "
+    "clients.date_modified, "
+    "clients.description, "
+    "employers.name AS employer_name "
+    "FROM clients "
+    "INNER JOIN employers "
+    "ON clients.employer_id = employers.employer_id "
+    "WHERE clients.is_active = 1 "
+    "AND (client_name LIKE ? "
+    "OR employer_name LIKE ? "
+    "OR clients.description LIKE ?);"
+    "ORDER BY clients.date_modified ASC;";
+static_assert(Persistence::CountSelectColumns(FilterEntityService::filterClients) ==
+              Persistence::ColumnCount(FilterEntityModelColumns) + 1);
+
+constexpr std::string_view FilterEntityService::filterProjects =
     "SELECT "
     "projects.project_id, "
     "projects.name AS project_name, "
-    "projects.is_default, "
     "projects.date_modified, "
+    "projects.description, "
+    "projects.is_default, "
     "employers.name AS employer_name, "
     "clients.name AS client_name "
     "FROM projects "
@@ -733,12 +497,15 @@ std::string FilterEntityService::filterProjects =
     "AND (project_name LIKE ? "
     "OR projects.description LIKE ?);"
     "ORDER BY projects.date_modified ASC;";
+static_assert(Persistence::CountSelectColumns(FilterEntityService::filterProjects) ==
+              Persistence::ColumnCount(FilterEntityModelColumns) + 3);
 
-std::string FilterEntityService::filterCategories =
+constexpr std::string_view FilterEntityService::filterCategories =
     "SELECT "
     "categories.category_id, "
     "categories.name AS category_name, "
     "categories.date_modified, "
+    "categories.description, "
     "projects.name AS project_name "
     "FROM categories "
     "INNER JOIN projects "
@@ -748,27 +515,34 @@ std::string FilterEntityService::filterCategories =
     "OR project_name LIKE ? "
     "OR categories.description LIKE ?) "
     "ORDER BY categories.date_modified ASC;";
+static_assert(Persistence::CountSelectColumns(FilterEntityService::filterCategories) ==
+              Persistence::ColumnCount(FilterEntityModelColumns) + 1);
 
-std::string FilterEntityService::filterAttributeGroups = "SELECT "
-                                                         "attribute_group_id, "
-                                                         "name, "
-                                                         "is_static, "
-                                                         "is_default, "
-                                                         "date_modified "
-                                                         "FROM attribute_groups "
-                                                         "WHERE is_active = 1 "
-                                                         "AND (name LIKE ? "
-                                                         "OR description LIKE ?)"
-                                                         "ORDER BY date_modified ASC;";
-
-std::string FilterEntityService::filterAttributes =
+constexpr std::string_view FilterEntityService::filterAttributeGroups =
+    "SELECT "
+    "attribute_group_id, "
+    "name, "
+    "date_modified, "
+    "description, "
+    "is_static, "
+    "is_default "
+    "FROM attribute_groups "
+    "WHERE is_active = 1 "
+    "AND (name LIKE ? "
+    "OR description LIKE ?)"
+    "ORDER BY date_modified ASC;";
+static_assert(Persistence::CountSelectColumns(FilterEntityService::filterAttributeGroups) ==
+              Persistence::ColumnCount(FilterEntityModelColumns) + 2);
+
+constexpr std::string_view FilterEntityService::filterAttributes =
     "SELECT "
     "attributes.attribute_id, "
     "attributes.name, "
+    "attributes.date_modified, "
+    "attributes.description, "
     "attributes.is_required, "
     "attribute_groups.name AS attribute_group_name, "
-    "attribute_types.name AS attribute_type_name, "
-    "attributes.date_modified "
+    "attribute_types.name AS attribute_type_name "
     "FROM attributes "
     "INNER JOIN attribute_groups "
     "ON attributes.attribute_group_id = attribute_groups.attribute_group_id "
@@ -777,12 +551,16 @@ std::string FilterEntityService::filterAttributes =
     "WHERE attributes.is_active = 1 "
     "AND (attributes.name LIKE ? "
     "OR attributes.description LIKE ?)";
+static_assert(Persistence::CountSelectColumns(FilterEntityService::filterAttributes) ==
+              Persistence::ColumnCount(FilterEntityModelColumns) + 3);
 
-std::string FilterEntityService::filterStaticAttributes = "SELECT "
+constexpr std::string_view FilterEntityService::filterStaticAttributes =
+    "SELECT "
     "attribute_groups.attribute_group_id, "
     "attribute_groups.name, "
-    "COUNT(static_attribute_values.static_attribute_value_id) AS static_attribute_value_count, "
-    "attribute_groups.date_modified "
+    "attribute_groups.date_modified, "
+    "attribute_groups.description, "
+    "COUNT(static_attribute_values.static_attribute_value_id) AS static_attribute_value_count "
     "FROM attribute_groups "
     "INNER JOIN static_attribute_values "
     "ON attribute_groups.attribute_group_id = static_attribute_values.attribute_group_id "
@@ -790,4 +568,100 @@ std::string FilterEntityService::filterStaticAttributes = "SELECT "
     "AND attribute_groups.is_static = 1 "
     "AND static_attribute_values.is_active = 1 "
     "GROUP BY attribute_groups.attribute_group_id, attribute_groups.name";
+static_assert(Persistence::CountSelectColumns(FilterEntityService::filterStaticAttributes) ==
+              Persistence::ColumnCount(FilterEntityModelColumns) + 1);
+
+// entities_fts rowids are the entity id * 8 + the entity type, see its migration
+constexpr std::string_view FilterEntityService::searchClients =
+    "SELECT "
+    "clients.client_id, "
+    "clients.name AS client_name, "
+    "clients.date_modified, "
+    "clients.description, "
+    "employers.name AS employer_name "
+    "FROM clients "
+    "INNER JOIN employers "
+    "ON clients.employer_id = employers.employer_id "
+    "WHERE clients.is_active = 1 "
+    "AND (clients.client_id IN ("
+    "SELECT rowid / 8 FROM entities_fts WHERE entities_fts MATCH ? AND rowid % 8 = 2) "
+    "OR clients.employer_id IN ("
+    "SELECT rowid / 8 FROM entities_fts WHERE entities_fts MATCH ? AND rowid % 8 = 1)) "
+    "ORDER BY clients.date_modified ASC;";
+static_assert(Persistence::CountSelectColumns(FilterEntityService::searchClients) ==
+              Persistence::ColumnCount(FilterEntityModelColumns) + 1);
+
+constexpr std::string_view FilterEntityService::searchProjects =
+    "SELECT "
+    "projects.project_id, "
+    "projects.name AS project_name, "
+    "projects.date_modified, "
+    "projects.description, "
+    "projects.is_default, "
+    "employers.name AS employer_name, "
+    "clients.name AS client_name "
+    "FROM projects "
+    "INNER JOIN employers ON projects.employer_id = employers.employer_id "
+    "LEFT JOIN clients ON projects.client_id = clients.client_id "
+    "WHERE projects.is_active = 1 "
+    "AND projects.project_id IN ("
+    "SELECT rowid / 8 FROM entities_fts WHERE entities_fts MATCH ? AND rowid % 8 = 3) "
+    "ORDER BY projects.date_modified ASC;";
+static_assert(Persistence::CountSelectColumns(FilterEntityService::searchProjects) ==
+              Persistence::ColumnCount(FilterEntityModelColumns) + 3);
+
+constexpr std::string_view FilterEntityService::searchCategories =
+    "SELECT "
+    "categories.category_id, "
+    "categories.name AS category_name, "
+    "categories.date_modified, "
+    "categories.description, "
+    "projects.name AS project_name "
+    "FROM categories "
+    "INNER JOIN projects "
+    "ON categories.project_id = projects.project_id "
+    "WHERE categories.is_active = 1 "
+    "AND (categories.category_id IN ("
+    "SELECT rowid / 8 FROM entities_fts WHERE entities_fts MATCH ? AND rowid % 8 = 4) "
+    "OR categories.project_id IN ("
+    "SELECT rowid / 8 FROM entities_fts WHERE entities_fts MATCH ? AND rowid % 8 = 3)) "
+    "ORDER BY categories.date_modified ASC;";
+static_assert(Persistence::CountSelectColumns(FilterEntityService::searchCategories) ==
+              Persistence::ColumnCount(FilterEntityModelColumns) + 1);
+
+constexpr std::string_view FilterEntityService::searchAttributeGroups =
+    "SELECT "
+    "attribute_group_id, "
+    "name, "
+    "date_modified, "
+    "description, "
+    "is_static, "
+    "is_default "
+    "FROM attribute_groups "
+    "WHERE is_active = 1 "
+    "AND attribute_group_id IN ("
+    "SELECT rowid / 8 FROM entities_fts WHERE entities_fts MATCH ? AND rowid % 8 = 5) "
+    "ORDER BY date_modified ASC;";
+static_assert(Persistence::CountSelectColumns(FilterEntityService::searchAttributeGroups) ==
+              Persistence::ColumnCount(FilterEntityModelColumns) + 2);
+
+constexpr std::string_view FilterEntityService::searchAttributes =
+    "SELECT "
+    "attributes.attribute_id, "
+    "attributes.name, "
+    "attributes.date_modified, "
+    "attributes.description, "
+    "attributes.is_required, "
+    "attribute_groups.name AS attribute_group_name, "
+    "attribute_types.name AS attribute_type_name "
+    "FROM attributes "
+    "INNER JOIN attribute_groups "
+    "ON attributes.attribute_group_id = attribute_groups.attribute_group_id "
+    "INNER JOIN attribute_types "
+    "ON attributes.attribute_type_id = attribute_types.attribute_type_id "
+    "WHERE attributes.is_active = 1 "
+    "AND attributes.attribute_id IN ("
+    "SELECT rowid / 8 FROM entities_fts WHERE entities_fts MATCH ? AND rowid % 8 = 6);";
+static_assert(Persistence::CountSelectColumns(FilterEntityService::searchAttributes) ==
+              Persistence::ColumnCount(FilterEntityModelColumns) + 3);
 } // namespace tks::Services
@@ -22,6 +22,8 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <string_view>
+#include <tuple>
 #include <vector>
 
 #include "../../common/enums.h"
@@ -38,7 +40,9 @@ struct FilterEntityModel final {
     std::string EntityName;
     std::int32_t EntityDateModified;
     std::vector<std::string> Metadata;
+    std::string EntityDescription;
 
+    FilterEntityModel();
     FilterEntityModel(EditListEntityType type);
     FilterEntityModel(EditListEntityType type,
         std::int64_t entityId,
@@ -48,6 +52,12 @@ struct FilterEntityModel final {
     ~FilterEntityModel() = default;
 };
 
+// leading columns of every filter query, see Persistence::ReadRow
+inline constexpr auto FilterEntityModelColumns = std::make_tuple(&FilterEntityModel::EntityId,
+    &FilterEntityModel::EntityName,
+    &FilterEntityModel::EntityDateModified,
+    &FilterEntityModel::EntityDescription);
+
 struct FilterEntityService final : public Persistence::PersistenceBase {
     FilterEntityService() = delete;
     FilterEntityService(const FilterEntityService&) = delete;
@@ -75,11 +85,28 @@ struct FilterEntityService final : public Persistence::PersistenceBase {
     SqliteResult FilterStaticAttributes(const std::string& searchTerm,
         std::vector<FilterEntityModel>& models);
 
-    static std::string filterClients;
-    static std::string filterProjects;
-    static std::string filterCategories;
-    static std::string filterAttributeGroups;
-    static std::string filterAttributes;
-    static std::string filterStaticAttributes;
+    /// <summary>
+    /// Whether the filter of model's entity type matches model for searchTerm, without a query.
+    /// Only decides for terms of three or more ASCII characters, which all filters match as a
+    /// case insensitive substring, and returns false for anything else
+    /// </summary>
+    static bool MatchesSearchTerm(const FilterEntityModel& model, const std::string& searchTerm);
+
+    SqliteResult PrepareFilterStatement(std::string_view query,
+        const std::vector<std::string>& terms,
+        /*out*/ sqlite3_stmt** stmt) const;
+
+    static const std::string_view filterClients;
+    static const std::string_view filterProjects;
+    static const std::string_view filterCategories;
+    static const std::string_view filterAttributeGroups;
+    static const std::string_view filterAttributes;
+    static const std::string_view filterStaticAttributes;
+
+    static const std::string_view searchClients;
+    static const std::string_view searchProjects;
+    static const std::string_view searchCategories;
+    static const std::string_view searchAttributeGroups;
+    static const std::string_view searchAttributes;
 };
 } // namespace tks::Services
@@ -0,0 +1,187 @@
+// Productivity tool to help you track the time you spend on tasks
+// Copyright (C) 2026 Szymon Welgus
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+// Contact:
+//     szymonwelgus at gmail dot com
+
+
+#include "incrementalentitysearch.h"
+
+#include <algorithm>
+#include <cctype>
+#include <iterator>
+
+namespace tks::Services
+{
+namespace
+{
+// FilterEntityService::MatchesSearchTerm decides for the same terms
+bool IsNarrowableTerm(const std::string& searchTerm)
+{
+    return searchTerm.size() >= 3 &&
+           std::all_of(searchTerm.begin(), searchTerm.end(), [](char c) {
+               return static_cast<unsigned char>(c) < 0x80;
+           });
+}
+
+std::string ToLower(std::string value)
+{
+    std::transform(value.begin(), value.end(), value.begin(), [](unsigned char c) {
+        return static_cast<char>(std::tolower(c));
+    });
+    return value;
+}
+} // namespace
+
+IncrementalEntitySearch::IncrementalEntitySearch(
+    std::shared_ptr<DatabaseExecutor> databaseExecutor,
+    EditListEntityType type)
+    : pDatabaseExecutor(databaseExecutor)
+    , mType(type)
+    , mQueryToken()
+    , bHasResults(false)
+    , mSearchTerm()
+    , mModels()
+{
+}
+
+IncrementalEntitySearch::~IncrementalEntitySearch()
+{
+    // the completion of a query in flight refers to this instance
+    Cancel();
+}
+
+void IncrementalEntitySearch::Search(const std::string& searchTerm, Completion completion)
+{
+    // whatever is in flight was searched for a term the user has since changed
+    mQueryToken.Cancel();
+
+    std::vector<FilterEntityModel> models;
+    if (TryNarrow(searchTerm, models)) {
+        mSearchTerm = searchTerm;
+        mModels = std::move(models);
+
+        completion(SqliteResult::OK(), mModels);
+        return;
+    }
+
+    mQueryToken = CancellationToken();
+    bHasResults = false;
+
+    pDatabaseExecutor->Post<FilterResult>(
+        mQueryToken,
+        [type = mType, searchTerm](DatabaseExecutorContext& context) {
+            return Filter(context, type, searchTerm);
+        },
+        [this, searchTerm, completion = std::move(completion)](FilterResult& result) {
+            if (result.first.Success) {
+                bHasResults = true;
+                mSearchTerm = searchTerm;
+                mModels = result.second;
+            }
+
+            completion(result.first, result.second);
+        });
+}
+
+void IncrementalEntitySearch::Invalidate()
+{
+    bHasResults = false;
+    mSearchTerm.clear();
+    mModels.clear();
+}
+
+void IncrementalEntitySearch::Cancel()
+{
+    mQueryToken.Cancel();
+}
+
+bool IncrementalEntitySearch::TryNarrow(const std::string& searchTerm,
+    std::vector<FilterEntityModel>& models) const
+{
+    // an empty term returned every active entity, otherwise the last results are only a
+    // superset when both terms are matched as plain substrings and the new one contains the old
+    if (!bHasResults || !IsNarrowableTerm(searchTerm)) {
+        return false;
+    }
+
+    if (!mSearchTerm.empty()) {
+        if (!IsNarrowableTerm(mSearchTerm) ||
+            ToLower(searchTerm).find(ToLower(mSearchTerm)) == std::string::npos) {
+            return false;
+        }
+    }
+
+    std::copy_if(mModels.begin(),
+        mModels.end(),
+        std::back_inserter(models),
+        [&searchTerm](const FilterEntityModel& model) {
+            return FilterEntityService::MatchesSearchTerm(model, searchTerm);
+        });
+
+    return true;
+}
+
+IncrementalEntitySearch::FilterResult IncrementalEntitySearch::Filter(
+    DatabaseExecutorContext& context,
+    EditListEntityType type,
+    const std::string& searchTerm)
+{
+    FilterResult result{ SqliteResult::OK(), {} };
+    auto& models = result.second;
+
+    switch (type) {
+    case EditListEntityType::Employers: {
+        std::vector<Model::EmployerModel> employers;
+        result.first = context.Employers.Filter(searchTerm, employers);
+
+        for (const auto& employer : employers) {
+            FilterEntityModel model(EditListEntityType::Employers,
+                employer.EmployerId,
+                employer.Name,
+                static_cast<std::int32_t>(employer.DateModified),
+                { employer.IsDefault ? "Yes" : "No" });
+            model.EntityDescription = employer.Description.value_or("");
+
+            models.push_back(model);
+        }
+        break;
+    }
+    case EditListEntityType::Clients:
+        result.first = context.FilterEntities.FilterClients(searchTerm, models);
+        break;
+    case EditListEntityType::Projects:
+        result.first = context.FilterEntities.FilterProjects(searchTerm, models);
+        break;
+    case EditListEntityType::Categories:
+        result.first = context.FilterEntities.FilterCategories(searchTerm, models);
+        break;
+    case EditListEntityType::AttributeGroups:
+        result.first = context.FilterEntities.FilterAttributeGroups(searchTerm, models);
+        break;
+    case EditListEntityType::Attributes:
+        result.first = context.FilterEntities.FilterAttributes(searchTerm, models);
+        break;
+    case EditListEntityType::StaticAttributeGroups:
+        result.first = context.FilterEntities.FilterStaticAttributes(searchTerm, models);
+        break;
+    default:
+        break;
+    }
+
+    return result;
+}
+} // namespace tks::Services
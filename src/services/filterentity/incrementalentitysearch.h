@@ -0,0 +1,90 @@
+// Productivity tool to help you track the time you spend on tasks
+// Copyright (C) 2026 Szymon Welgus
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+// Contact:
+//     szymonwelgus at gmail dot com
+
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../../common/enums.h"
+
+#include "../../common/results/sqliteresult.h"
+
+#include "../executor/databaseexecutor.h"
+
+#include "filterentityservice.h"
+
+namespace tks::Services
+{
+/// <summary>
+/// Search-as-you-type over one entity type. Terms that extend the last searched term are
+/// narrowed from the last results in memory, everything else is queried on the executor and
+/// supersedes any query still in flight
+/// </summary>
+class IncrementalEntitySearch final
+{
+public:
+    using Completion =
+        std::function<void(const SqliteResult&, const std::vector<FilterEntityModel>&)>;
+
+    IncrementalEntitySearch() = delete;
+    IncrementalEntitySearch(const IncrementalEntitySearch&) = delete;
+    IncrementalEntitySearch(std::shared_ptr<DatabaseExecutor> databaseExecutor,
+        EditListEntityType type);
+    ~IncrementalEntitySearch();
+
+    IncrementalEntitySearch& operator=(const IncrementalEntitySearch&) = delete;
+
+    /// <summary>
+    /// Complete with the entities matching searchTerm, synchronously when the last results can
+    /// be narrowed, otherwise on the UI thread once the query finishes
+    /// </summary>
+    void Search(const std::string& searchTerm, Completion completion);
+
+    /// <summary>
+    /// Drop the last results so the next search queries the database, e.g. after an edit
+    /// </summary>
+    void Invalidate();
+
+    void Cancel();
+
+private:
+    using FilterResult = std::pair<SqliteResult, std::vector<FilterEntityModel>>;
+
+    bool TryNarrow(const std::string& searchTerm,
+        /*out*/ std::vector<FilterEntityModel>& models) const;
+
+    static FilterResult Filter(DatabaseExecutorContext& context,
+        EditListEntityType type,
+        const std::string& searchTerm);
+
+    std::shared_ptr<DatabaseExecutor> pDatabaseExecutor;
+    EditListEntityType mType;
+
+    CancellationToken mQueryToken;
+
+    bool bHasResults;
+    std::string mSearchTerm;
+    std::vector<FilterEntityModel> mModels;
+};
+} // namespace tks::Services
@@ -0,0 +1,165 @@
+// Productivity tool to help you track the time you spend on tasks
+// Copyright (C) 2026 Szymon Welgus
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+// Contact:
+//     szymonwelgus at gmail dot com
+
+
+#include "csvrecordreader.h"
+
+namespace tks::Services::Import
+{
+CsvRecordReader::CsvRecordReader(std::istream& stream, char delimiter, char textQualifier)
+    : mStream(stream)
+    , mDelimiter(delimiter)
+    , mTextQualifier(textQualifier)
+    , mBuffer(BufferSize)
+    , pPosition(nullptr)
+    , pEnd(nullptr)
+    , mFields()
+    , mFieldCount(0)
+    , mLineNumber(1)
+    , mRecordLineNumber(1)
+    , bUnterminatedQualifier(false)
+{
+}
+
+bool CsvRecordReader::ReadRecord()
+{
+    mFieldCount = 0;
+    mRecordLineNumber = mLineNumber;
+
+    if (pPosition == pEnd && !FillBuffer()) {
+        return false;
+    }
+
+    std::string* field = &NextField();
+    bool quoted = false;
+
+    while (true) {
+        if (pPosition == pEnd && !FillBuffer()) {
+            bUnterminatedQualifier = quoted;
+            return true;
+        }
+
+        if (quoted) {
+            // copy everything up to the next qualifier in one go
+            const char* start = pPosition;
+            while (pPosition != pEnd && *pPosition != mTextQualifier) {
+                if (*pPosition == '\n') {
+                    mLineNumber++;
+                }
+                pPosition++;
+            }
+            field->append(start, pPosition);
+
+            if (pPosition == pEnd) {
+                continue;
+            }
+
+            pPosition++;
+            if (pPosition == pEnd && !FillBuffer()) {
+                return true;
+            }
+
+            // a doubled qualifier is an escaped qualifier
+            if (*pPosition == mTextQualifier) {
+                field->push_back(mTextQualifier);
+                pPosition++;
+            } else {
+                quoted = false;
+            }
+            continue;
+        }
+
+        const char* start = pPosition;
+        while (pPosition != pEnd && *pPosition != mDelimiter && *pPosition != '\n' &&
+               *pPosition != '\r' && (*pPosition != mTextQualifier || mTextQualifier == '\0')) {
+            pPosition++;
+        }
+        field->append(start, pPosition);
+
+        if (pPosition == pEnd) {
+            continue;
+        }
+
+        const char c = *pPosition++;
+        if (c == mDelimiter) {
+            field = &NextField();
+        } else if (c == '\n') {
+            mLineNumber++;
+            return true;
+        } else if (c == '\r') {
+            if ((pPosition != pEnd || FillBuffer()) && *pPosition == '\n') {
+                pPosition++;
+            }
+            mLineNumber++;
+            return true;
+        } else if (field->empty()) {
+            quoted = true;
+        } else {
+            // a qualifier in the middle of an unqualified value is kept as-is
+            field->push_back(c);
+        }
+    }
+}
+
+std::size_t CsvRecordReader::GetFieldCount() const
+{
+    return mFieldCount;
+}
+
+const std::string& CsvRecordReader::GetField(std::size_t index) const
+{
+    return mFields[index];
+}
+
+std::size_t CsvRecordReader::GetLineNumber() const
+{
+    return mRecordLineNumber;
+}
+
+bool CsvRecordReader::HasUnterminatedQualifier() const
+{
+    return bUnterminatedQualifier;
+}
+
+bool CsvRecordReader::FillBuffer()
+{
+    if (!mStream) {
+        return false;
+    }
+
+    mStream.read(mBuffer.data(), static_cast<std::streamsize>(mBuffer.size()));
+    const auto read = static_cast<std::size_t>(mStream.gcount());
+
+    pPosition = mBuffer.data();
+    pEnd = pPosition + read;
+
+    return read > 0;
+}
+
+std::string& CsvRecordReader::NextField()
+{
+    if (mFieldCount == mFields.size()) {
+        mFields.emplace_back();
+    }
+
+    auto& field = mFields[mFieldCount++];
+    field.clear();
+    return field;
+}
+} // namespace tks::Services::Import
@@ -0,0 +1,72 @@
+// Productivity tool to help you track the time you spend on tasks
+// Copyright (C) 2026 Szymon Welgus
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+// Contact:
+//     szymonwelgus at gmail dot com
+
+
+#pragma once
+
+#include <cstddef>
+#include <istream>
+#include <string>
+#include <vector>
+
+namespace tks::Services::Import
+{
+// Reads delimited records from a stream through a fixed size buffer. Field storage is kept
+// between records so steady state reading does not allocate.
+class CsvRecordReader final
+{
+public:
+    static constexpr std::size_t BufferSize = 1 << 20;
+
+    CsvRecordReader() = delete;
+    CsvRecordReader(const CsvRecordReader&) = delete;
+    CsvRecordReader(std::istream& stream, char delimiter, char textQualifier);
+    ~CsvRecordReader() = default;
+
+    CsvRecordReader& operator=(const CsvRecordReader&) = delete;
+
+    bool ReadRecord();
+
+    std::size_t GetFieldCount() const;
+    const std::string& GetField(std::size_t index) const;
+
+    // line the last record started on (1 based)
+    std::size_t GetLineNumber() const;
+    bool HasUnterminatedQualifier() const;
+
+private:
+    bool FillBuffer();
+    std::string& NextField();
+
+    std::istream& mStream;
+    char mDelimiter;
+    char mTextQualifier;
+
+    std::vector<char> mBuffer;
+    const char* pPosition;
+    const char* pEnd;
+
+    std::vector<std::string> mFields;
+    std::size_t mFieldCount;
+
+    std::size_t mLineNumber;
+    std::size_t mRecordLineNumber;
+    bool bUnterminatedQualifier;
+};
+} // namespace tks::Services::Import
@@ -0,0 +1,75 @@
+// Productivity tool to help you track the time you spend on tasks
+// Copyright (C) 2026 Szymon Welgus
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+// Contact:
+//     szymonwelgus at gmail dot com
+
+
+#include "taskimportoptions.h"
+
+#include <algorithm>
+
+namespace tks::Services::Import
+{
+namespace
+{
+char MapDelimiterEnumToChar(DelimiterType delimiter)
+{
+    switch (delimiter) {
+    case DelimiterType::Semicolon:
+        return ';';
+    case DelimiterType::Pipe:
+        return '|';
+    case DelimiterType::Tab:
+        return '\t';
+    case DelimiterType::Space:
+        return ' ';
+    case DelimiterType::None:
+    case DelimiterType::Comma:
+    default:
+        return ',';
+    }
+}
+} // namespace
+
+TaskImportOptions::TaskImportOptions()
+    : Delimiter(',')
+    , TextQualifier('\"')
+    , EmptyValuesHandler(EmptyValues::Blank)
+    , ExcludeHeaders(false)
+    , IncludeAttributes(true)
+    , Columns()
+{
+}
+
+TaskImportOptions::TaskImportOptions(const Core::Configuration::PresetSetting& presetSetting)
+    : Delimiter(MapDelimiterEnumToChar(presetSetting.Delimiter))
+    , TextQualifier('\0')
+    , EmptyValuesHandler(presetSetting.EmptyValuesHandler)
+    , ExcludeHeaders(presetSetting.ExcludeHeaders)
+    , IncludeAttributes(presetSetting.IncludeAttributes)
+    , Columns(presetSetting.Columns)
+{
+    const auto textQualifier = MapTextQualifierEnumToValue(presetSetting.TextQualifier);
+    if (!textQualifier.empty()) {
+        TextQualifier = textQualifier[0];
+    }
+
+    std::sort(Columns.begin(), Columns.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.Order < rhs.Order;
+    });
+}
+} // namespace tks::Services::Import
@@ -0,0 +1,45 @@
+// Productivity tool to help you track the time you spend on tasks
+// Copyright (C) 2026 Szymon Welgus
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+// Contact:
+//     szymonwelgus at gmail dot com
+
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "../../common/enums.h"
+
+#include "../../core/configuration.h"
+
+namespace tks::Services::Import
+{
+struct TaskImportOptions {
+    char Delimiter;
+    char TextQualifier;
+    EmptyValues EmptyValuesHandler;
+    bool ExcludeHeaders;
+    bool IncludeAttributes;
+    // maps a file header (or, without headers, a position) to an export column name
+    std::vector<Core::Configuration::PresetColumnSetting> Columns;
+
+    TaskImportOptions();
+    TaskImportOptions(const Core::Configuration::PresetSetting& presetSetting);
+    ~TaskImportOptions() = default;
+};
+} // namespace tks::Services::Import
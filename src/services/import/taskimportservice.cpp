@@ -0,0 +1,1309 @@
+// Productivity tool to help you track the time you spend on tasks
+// Copyright (C) 2026 Szymon Welgus
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+// Contact:
+//     szymonwelgus at gmail dot com
+
+
+#include "taskimportservice.h"
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <chrono>
+#include <fstream>
+#include <utility>
+
+#include <spdlog/fmt/fmt.h>
+
+#include "../../common/logmessages.h"
+
+#include "../../common/messages/sqlitemessages.h"
+
+#include "../../persistence/base/changefeed.h"
+
+namespace tks::Services::Import
+{
+namespace
+{
+// key for the composite lookups, an ID (employer or project) followed by a name
+void MakeKey(std::string& key, std::int64_t id, const std::string& name)
+{
+    std::array<char, 24> buffer{};
+    auto [end, ec] = std::to_chars(buffer.data(), buffer.data() + buffer.size(), id);
+
+    key.clear();
+    key.append(buffer.data(), end);
+    key.push_back('\x1f');
+    key.append(name);
+}
+
+std::string ReadColumnText(sqlite3_stmt* stmt, int columnIndex)
+{
+    const unsigned char* res = sqlite3_column_text(stmt, columnIndex);
+    if (res == nullptr) {
+        return std::string();
+    }
+
+    return std::string(
+        reinterpret_cast<const char*>(res), sqlite3_column_bytes(stmt, columnIndex));
+}
+
+bool IsEmptyValue(const std::string& value, EmptyValues emptyValuesHandler)
+{
+    return value.empty() || (emptyValuesHandler == EmptyValues::Null && value == "NULL");
+}
+
+bool TryParseInteger(const std::string& value, std::int64_t& result)
+{
+    const char* end = value.data() + value.size();
+    auto [ptr, ec] = std::from_chars(value.data(), end, result);
+    return ec == std::errc() && ptr == end;
+}
+
+bool EqualsIgnoreCase(const std::string& value, std::string_view other)
+{
+    return value.size() == other.size() &&
+           std::equal(value.begin(), value.end(), other.begin(), [](char lhs, char rhs) {
+               return (lhs | 0x20) == rhs;
+           });
+}
+
+// accepts every format the BooleanHandler export option produces
+bool TryParseBoolean(const std::string& value, bool& result)
+{
+    if (value == "1" || EqualsIgnoreCase(value, "true") || EqualsIgnoreCase(value, "yes")) {
+        result = true;
+        return true;
+    }
+    if (value == "0" || EqualsIgnoreCase(value, "false") || EqualsIgnoreCase(value, "no")) {
+        result = false;
+        return true;
+    }
+    return false;
+}
+
+// parses the "HH:MM" format of the Duration export column
+bool TryParseDuration(const std::string& value, int& hours, int& minutes)
+{
+    const char* begin = value.data();
+    const char* end = begin + value.size();
+
+    auto [hoursEnd, hoursEc] = std::from_chars(begin, end, hours);
+    if (hoursEc != std::errc() || hoursEnd == end || *hoursEnd != ':') {
+        return false;
+    }
+
+    auto [minutesEnd, minutesEc] = std::from_chars(hoursEnd + 1, end, minutes);
+    return minutesEc == std::errc() && minutesEnd == end;
+}
+
+// the OriginalColumn names of Services::Export::MakeAvailableColumns
+ImportColumn MapOriginalColumn(const std::string& originalColumn)
+{
+    static const std::unordered_map<std::string, ImportColumn> originalColumns = {
+        { "Employer", ImportColumn::Employer },
+        { "Client", ImportColumn::Client },
+        { "Project", ImportColumn::Project },
+        { "Display Name", ImportColumn::DisplayName },
+        { "Category", ImportColumn::Category },
+        { "Date", ImportColumn::Date },
+        { "Description", ImportColumn::Description },
+        { "Billable", ImportColumn::Billable },
+        { "Unique ID", ImportColumn::UniqueId },
+        { "Hours", ImportColumn::Hours },
+        { "Minutes", ImportColumn::Minutes },
+        { "Duration", ImportColumn::Duration },
+    };
+
+    auto iterator = originalColumns.find(originalColumn);
+    return iterator != originalColumns.end() ? iterator->second : ImportColumn::Ignored;
+}
+} // namespace
+
+TaskImportSummary::TaskImportSummary()
+    : RecordsRead(0)
+    , TasksImported(0)
+    , AttributeValuesImported(0)
+    , RecordsSkipped(0)
+    , Errors()
+{
+}
+
+TaskImportService::Statements::~Statements()
+{
+    sqlite3_finalize(UpsertWorkday);
+    sqlite3_finalize(CreateTask);
+    sqlite3_finalize(CreateTaskAttributeValue);
+    sqlite3_finalize(BackfillTasksFts);
+}
+
+TaskImportService::TaskImportService(const std::string& databaseFilePath,
+    const std::shared_ptr<spdlog::logger> logger)
+    : PersistenceBase(logger, databaseFilePath)
+    , mEmployers()
+    , mProjectsByName()
+    , mProjectsByDisplayName()
+    , mCategories()
+    , mAttributes()
+    , mWorkdays()
+    , mColumnBindings()
+    , mPendingAttributeValues()
+    , mKey()
+    , mTimestamp(0)
+{
+}
+
+TaskImportService::~TaskImportService() {}
+
+ImportResult TaskImportService::ImportFromFile(const std::string& filePath,
+    const TaskImportOptions& options,
+    TaskImportSummary& summary)
+{
+    std::ifstream stream(filePath, std::ios::in | std::ios::binary);
+    if (!stream.is_open()) {
+        pLogger->error("Failed to open import file at \"{0}\"", filePath);
+        return ImportResult::Fail("Failed to open import file");
+    }
+
+    return Import(stream, options, summary);
+}
+
+ImportResult TaskImportService::Import(std::istream& stream,
+    const TaskImportOptions& options,
+    TaskImportSummary& summary)
+{
+    const auto start = std::chrono::steady_clock::now();
+    summary = TaskImportSummary();
+
+    auto sqliteResult = LoadLookups();
+    if (!sqliteResult.Success) {
+        return ImportResult::FailWithSqliteResult(
+            "Failed to load employers, projects, categories and attributes", sqliteResult);
+    }
+
+    CsvRecordReader reader(stream, options.Delimiter, options.TextQualifier);
+
+    if (!options.ExcludeHeaders && !reader.ReadRecord()) {
+        return ImportResult::Fail("The import file is empty");
+    }
+
+    auto importResult = MapColumns(reader, options);
+    if (!importResult.Success) {
+        return importResult;
+    }
+
+    Statements statements;
+    const std::pair<std::string_view, sqlite3_stmt**> statementsToPrepare[] = {
+        { TaskImportService::upsertWorkday, &statements.UpsertWorkday },
+        { TaskImportService::createTask, &statements.CreateTask },
+        { TaskImportService::createTaskAttributeValue, &statements.CreateTaskAttributeValue },
+        { TaskImportService::backfillTasksFts, &statements.BackfillTasksFts },
+    };
+
+    for (const auto& [query, stmt] : statementsToPrepare) {
+        sqliteResult = Prepare(query, stmt);
+        if (!sqliteResult.Success) {
+            return ImportResult::FailWithSqliteResult("Failed to prepare import", sqliteResult);
+        }
+    }
+
+    // the column defaults would evaluate the local time twice for every task
+    sqliteResult = ReadTimestamp(mTimestamp);
+    if (!sqliteResult.Success) {
+        return ImportResult::FailWithSqliteResult("Failed to prepare import", sqliteResult);
+    }
+
+    // the task insert trigger only maintains tasks_fts, which CommitBatch backfills per batch
+    // in a single statement instead of one trigger program per task
+    int rc = sqlite3_db_config(pDb, SQLITE_DBCONFIG_ENABLE_TRIGGER, 0, nullptr);
+    if (rc != SQLITE_OK) {
+        const char* error = sqlite3_errmsg(pDb);
+        pLogger->error("Failed to disable triggers for import. Error {0}: \"{1}\"", rc, error);
+
+        return ImportResult::FailWithSqliteResult("Failed to prepare import",
+            SqliteResult::FailDetailed(Messages::ExecMessage, rc, std::string(error)));
+    }
+
+    // the import is published as one range change once it is done instead of a row change for
+    // every task written
+    auto& changeFeed = Persistence::ChangeFeed::GetInstance();
+    changeFeed.Suspend(pDb);
+
+    std::size_t batchTasks = 0;
+    std::size_t batchAttributeValues = 0;
+    std::int64_t firstTaskId = -1;
+
+    // every reference is resolved through the lookups and none of the referenced rows are ever
+    // hard deleted, so the foreign key checks would only repeat those lookups for every task
+    sqliteResult = Exec(TaskImportService::disableForeignKeys);
+
+    // a batch of tasks, their workday index entries and tasks_fts segments outgrow the default
+    // page cache long before it is committed
+    if (sqliteResult.Success) {
+        sqliteResult = Exec(TaskImportService::importCacheSize);
+    }
+
+    // automatic merges would rewrite the segments of earlier batches on every commit, they
+    // resume with the first write after the import
+    FtsConfig ftsConfig;
+    bool ftsConfigChanged = false;
+    if (sqliteResult.Success) {
+        sqliteResult = ReadFtsConfig(ftsConfig);
+    }
+    if (sqliteResult.Success) {
+        sqliteResult = WriteFtsConfig(FtsConfig{ 0, ImportFtsHashSize });
+        ftsConfigChanged = sqliteResult.Success;
+    }
+
+    if (sqliteResult.Success) {
+        sqliteResult = Exec(TaskImportService::beginTransaction);
+    }
+
+    while (sqliteResult.Success && reader.ReadRecord()) {
+        // blank line
+        if (reader.GetFieldCount() == 1 && reader.GetField(0).empty()) {
+            continue;
+        }
+
+        summary.RecordsRead++;
+
+        std::int64_t taskId = -1;
+        sqliteResult =
+            ImportRecord(reader, options, statements, summary, taskId, batchAttributeValues);
+
+        if (!sqliteResult.Success || taskId == -1) {
+            continue;
+        }
+
+        if (firstTaskId == -1) {
+            firstTaskId = taskId;
+        }
+
+        if (++batchTasks < BatchSize) {
+            continue;
+        }
+
+        sqliteResult = CommitBatch(statements, firstTaskId);
+        if (sqliteResult.Success) {
+            summary.TasksImported += batchTasks;
+            summary.AttributeValuesImported += batchAttributeValues;
+
+            batchTasks = 0;
+            batchAttributeValues = 0;
+            firstTaskId = -1;
+
+            sqliteResult = Exec(TaskImportService::beginTransaction);
+        }
+    }
+
+    if (sqliteResult.Success) {
+        sqliteResult = CommitBatch(statements, firstTaskId);
+        if (sqliteResult.Success) {
+            summary.TasksImported += batchTasks;
+            summary.AttributeValuesImported += batchAttributeValues;
+        }
+    }
+
+    if (!sqliteResult.Success && !sqlite3_get_autocommit(pDb)) {
+        Exec(TaskImportService::rollbackTransaction);
+    }
+
+    if (ftsConfigChanged) {
+        WriteFtsConfig(ftsConfig);
+    }
+
+    Exec(TaskImportService::enableForeignKeys);
+    sqlite3_db_config(pDb, SQLITE_DBCONFIG_ENABLE_TRIGGER, 1, nullptr);
+
+    changeFeed.Resume(pDb);
+
+    // batches committed before a failure stay imported and are published all the same
+    if (summary.TasksImported > 0) {
+        PublishImportedDates();
+    }
+
+    if (reader.HasUnterminatedQualifier()) {
+        pLogger->warn("Import file ended inside a qualified value on line \"{0}\"",
+            reader.GetLineNumber());
+        Skip(reader, "The file ended inside a qualified value", summary);
+    }
+
+    const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start);
+    pLogger->info("Imported \"{0}\" tasks and \"{1}\" attribute values from \"{2}\" records "
+                  "(\"{3}\" skipped) in {4:.3f}s, {5:.0f} tasks/s",
+        summary.TasksImported,
+        summary.AttributeValuesImported,
+        summary.RecordsRead,
+        summary.RecordsSkipped,
+        elapsed.count(),
+        elapsed.count() > 0 ? summary.TasksImported / elapsed.count() : 0.0);
+
+    if (!sqliteResult.Success) {
+        return ImportResult::FailWithSqliteResult("Failed to import tasks", sqliteResult);
+    }
+
+    return ImportResult::OK();
+}
+
+SqliteResult TaskImportService::LoadLookups()
+{
+    mEmployers.clear();
+    mProjectsByName.clear();
+    mProjectsByDisplayName.clear();
+    mCategories.clear();
+    mAttributes.clear();
+    mWorkdays.clear();
+
+    sqlite3_stmt* stmt = nullptr;
+    int rc = SQLITE_OK;
+
+    // employers
+    auto sqliteResult = Prepare(TaskImportService::filterEmployers, &stmt);
+    if (!sqliteResult.Success) {
+        return sqliteResult;
+    }
+
+    while ((rc = sqlite3_step(stmt)) == SQLITE_ROW) {
+        mEmployers.emplace(ReadColumnText(stmt, 1), sqlite3_column_int64(stmt, 0));
+    }
+
+    sqliteResult = ResetStatement(stmt, TaskImportService::filterEmployers, rc);
+    sqlite3_finalize(stmt);
+    if (!sqliteResult.Success) {
+        return sqliteResult;
+    }
+
+    // projects, by name and by display name (per employer and, when unambiguous, on its own)
+    sqliteResult = Prepare(TaskImportService::filterProjects, &stmt);
+    if (!sqliteResult.Success) {
+        return sqliteResult;
+    }
+
+    while ((rc = sqlite3_step(stmt)) == SQLITE_ROW) {
+        const std::int64_t projectId = sqlite3_column_int64(stmt, 0);
+        const std::string displayName = ReadColumnText(stmt, 2);
+        const std::int64_t employerId = sqlite3_column_int64(stmt, 3);
+
+        mProjectsByName.emplace(ReadColumnText(stmt, 1), ProjectLookup{ projectId, employerId });
+
+        MakeKey(mKey, employerId, displayName);
+        mProjectsByDisplayName.emplace(mKey, projectId);
+
+        MakeKey(mKey, 0, displayName);
+        auto [iterator, inserted] = mProjectsByDisplayName.emplace(mKey, projectId);
+        if (!inserted) {
+            iterator->second = -1;
+        }
+    }
+
+    sqliteResult = ResetStatement(stmt, TaskImportService::filterProjects, rc);
+    sqlite3_finalize(stmt);
+    if (!sqliteResult.Success) {
+        return sqliteResult;
+    }
+
+    // categories
+    sqliteResult = Prepare(TaskImportService::filterCategories, &stmt);
+    if (!sqliteResult.Success) {
+        return sqliteResult;
+    }
+
+    while ((rc = sqlite3_step(stmt)) == SQLITE_ROW) {
+        const std::int64_t projectId =
+            sqlite3_column_type(stmt, 3) == SQLITE_NULL ? 0 : sqlite3_column_int64(stmt, 3);
+
+        MakeKey(mKey, projectId, ReadColumnText(stmt, 1));
+        mCategories.emplace(
+            mKey, CategoryLookup{ sqlite3_column_int64(stmt, 0), !!sqlite3_column_int(stmt, 2) });
+    }
+
+    sqliteResult = ResetStatement(stmt, TaskImportService::filterCategories, rc);
+    sqlite3_finalize(stmt);
+    if (!sqliteResult.Success) {
+        return sqliteResult;
+    }
+
+    // attributes
+    sqliteResult = Prepare(TaskImportService::filterAttributes, &stmt);
+    if (!sqliteResult.Success) {
+        return sqliteResult;
+    }
+
+    while ((rc = sqlite3_step(stmt)) == SQLITE_ROW) {
+        mAttributes.push_back(AttributeLookup{ sqlite3_column_int64(stmt, 0),
+            sqlite3_column_int64(stmt, 2),
+            static_cast<AttributeTypes>(sqlite3_column_int(stmt, 3)),
+            ReadColumnText(stmt, 1) });
+    }
+
+    sqliteResult = ResetStatement(stmt, TaskImportService::filterAttributes, rc);
+    sqlite3_finalize(stmt);
+    if (!sqliteResult.Success) {
+        return sqliteResult;
+    }
+
+    SPDLOG_LOGGER_TRACE(pLogger,
+        "Loaded import lookups: \"{0}\" employers, \"{1}\" projects, \"{2}\" categories, "
+        "\"{3}\" attributes",
+        mEmployers.size(),
+        mProjectsByName.size(),
+        mCategories.size(),
+        mAttributes.size());
+
+    return SqliteResult::OK();
+}
+
+ImportResult TaskImportService::MapColumns(const CsvRecordReader& reader,
+    const TaskImportOptions& options)
+{
+    mColumnBindings.clear();
+
+    if (options.ExcludeHeaders) {
+        // without headers the preset column order is the file column order
+        for (const auto& presetColumn : options.Columns) {
+            mColumnBindings.push_back(
+                ColumnBinding{ MapOriginalColumn(presetColumn.OriginalColumn), 0 });
+        }
+    } else {
+        for (std::size_t i = 0; i < reader.GetFieldCount(); i++) {
+            std::string header = reader.GetField(i);
+            if (i == 0 && header.rfind("\xEF\xBB\xBF", 0) == 0) {
+                header.erase(0, 3);
+            }
+
+            auto presetColumnIterator = std::find_if(options.Columns.begin(),
+                options.Columns.end(),
+                [&](const auto& presetColumn) { return presetColumn.Column == header; });
+
+            ColumnBinding binding{ MapOriginalColumn(presetColumnIterator != options.Columns.end()
+                                                         ? presetColumnIterator->OriginalColumn
+                                                         : header),
+                0 };
+
+            if (binding.Column == ImportColumn::Ignored && options.IncludeAttributes) {
+                auto attributeIterator = std::find_if(mAttributes.begin(),
+                    mAttributes.end(),
+                    [&](const AttributeLookup& attribute) { return attribute.Name == header; });
+
+                if (attributeIterator != mAttributes.end()) {
+                    binding.Column = ImportColumn::Attribute;
+                    binding.AttributeIndex =
+                        static_cast<std::size_t>(attributeIterator - mAttributes.begin());
+                }
+            }
+
+            if (binding.Column == ImportColumn::Ignored) {
+                pLogger->warn("Import column \"{0}\" is not mapped and will be ignored", header);
+            }
+
+            mColumnBindings.push_back(binding);
+        }
+    }
+
+    auto hasColumn = [&](ImportColumn column) {
+        return std::any_of(mColumnBindings.begin(),
+            mColumnBindings.end(),
+            [&](const ColumnBinding& binding) { return binding.Column == column; });
+    };
+
+    if (!hasColumn(ImportColumn::Date)) {
+        return ImportResult::Fail("The import file has no \"Date\" column");
+    }
+    if (!hasColumn(ImportColumn::Description)) {
+        return ImportResult::Fail("The import file has no \"Description\" column");
+    }
+    if (!hasColumn(ImportColumn::Project) && !hasColumn(ImportColumn::DisplayName)) {
+        return ImportResult::Fail("The import file has no \"Project\" or \"Display Name\" column");
+    }
+    if (!hasColumn(ImportColumn::Category)) {
+        return ImportResult::Fail("The import file has no \"Category\" column");
+    }
+    if (!hasColumn(ImportColumn::Duration) && !hasColumn(ImportColumn::Hours) &&
+        !hasColumn(ImportColumn::Minutes)) {
+        return ImportResult::Fail(
+            "The import file has no \"Duration\" or \"Hours\" and \"Minutes\" columns");
+    }
+
+    return ImportResult::OK();
+}
+
+SqliteResult TaskImportService::ReadTimestamp(std::int64_t& timestamp) const
+{
+    sqlite3_stmt* stmt = nullptr;
+
+    auto sqliteResult = Prepare(TaskImportService::selectTimestamp, &stmt);
+    if (!sqliteResult.Success) {
+        return sqliteResult;
+    }
+
+    int rc = sqlite3_step(stmt);
+    if (rc == SQLITE_ROW) {
+        timestamp = sqlite3_column_int64(stmt, 0);
+        rc = sqlite3_step(stmt);
+    }
+
+    sqliteResult = ResetStatement(stmt, TaskImportService::selectTimestamp, rc);
+    sqlite3_finalize(stmt);
+
+    return sqliteResult;
+}
+
+SqliteResult TaskImportService::ReadFtsConfig(FtsConfig& ftsConfig) const
+{
+    sqlite3_stmt* stmt = nullptr;
+
+    auto sqliteResult = Prepare(TaskImportService::selectFtsConfig, &stmt);
+    if (!sqliteResult.Success) {
+        return sqliteResult;
+    }
+
+    int rc = SQLITE_OK;
+    while ((rc = sqlite3_step(stmt)) == SQLITE_ROW) {
+        const std::string key = ReadColumnText(stmt, 0);
+        if (key == "automerge") {
+            ftsConfig.AutoMerge = sqlite3_column_int64(stmt, 1);
+        } else if (key == "hashsize") {
+            ftsConfig.HashSize = sqlite3_column_int64(stmt, 1);
+        }
+    }
+
+    sqliteResult = ResetStatement(stmt, TaskImportService::selectFtsConfig, rc);
+    sqlite3_finalize(stmt);
+
+    return sqliteResult;
+}
+
+SqliteResult TaskImportService::WriteFtsConfig(const FtsConfig& ftsConfig) const
+{
+    sqlite3_stmt* stmt = nullptr;
+
+    auto sqliteResult = Prepare(TaskImportService::updateFtsConfig, &stmt);
+    if (!sqliteResult.Success) {
+        return sqliteResult;
+    }
+
+    const std::pair<const char*, std::int64_t> settings[] = {
+        { "automerge", ftsConfig.AutoMerge },
+        { "hashsize", ftsConfig.HashSize },
+    };
+
+    for (const auto& [key, value] : settings) {
+        int bindIndex = 1;
+
+        // key
+        int rc = sqlite3_bind_text(stmt, bindIndex, key, -1, SQLITE_STATIC);
+        if (rc != SQLITE_OK) {
+            sqliteResult = BindFailed(stmt, "key", bindIndex, rc);
+            break;
+        }
+
+        bindIndex++;
+
+        // value
+        rc = sqlite3_bind_int64(stmt, bindIndex, value);
+        if (rc != SQLITE_OK) {
+            sqliteResult = BindFailed(stmt, "value", bindIndex, rc);
+            break;
+        }
+
+        rc = sqlite3_step(stmt);
+        sqliteResult = ResetStatement(stmt, TaskImportService::updateFtsConfig, rc);
+        if (!sqliteResult.Success) {
+            break;
+        }
+    }
+
+    sqlite3_finalize(stmt);
+    if (!sqliteResult.Success) {
+        return sqliteResult;
+    }
+
+    SPDLOG_LOGGER_TRACE(pLogger,
+        "Set tasks_fts automerge to \"{0}\" and hashsize to \"{1}\"",
+        ftsConfig.AutoMerge,
+        ftsConfig.HashSize);
+
+    return SqliteResult::OK();
+}
+
+SqliteResult TaskImportService::ImportRecord(const CsvRecordReader& reader,
+    const TaskImportOptions& options,
+    Statements& statements,
+    TaskImportSummary& summary,
+    std::int64_t& taskId,
+    std::size_t& attributeValues)
+{
+    const std::string* employer = nullptr;
+    const std::string* project = nullptr;
+    const std::string* displayName = nullptr;
+    const std::string* category = nullptr;
+    const std::string* date = nullptr;
+    const std::string* description = nullptr;
+    const std::string* billable = nullptr;
+    const std::string* uniqueId = nullptr;
+    const std::string* hours = nullptr;
+    const std::string* minutes = nullptr;
+    const std::string* duration = nullptr;
+
+    mPendingAttributeValues.clear();
+
+    const std::size_t fieldCount = std::min(reader.GetFieldCount(), mColumnBindings.size());
+    for (std::size_t i = 0; i < fieldCount; i++) {
+        const std::string& field = reader.GetField(i);
+        if (IsEmptyValue(field, options.EmptyValuesHandler)) {
+            continue;
+        }
+
+        switch (mColumnBindings[i].Column) {
+        case ImportColumn::Employer:
+            employer = &field;
+            break;
+        case ImportColumn::Project:
+            project = &field;
+            break;
+        case ImportColumn::DisplayName:
+            displayName = &field;
+            break;
+        case ImportColumn::Category:
+            category = &field;
+            break;
+        case ImportColumn::Date:
+            date = &field;
+            break;
+        case ImportColumn::Description:
+            description = &field;
+            break;
+        case ImportColumn::Billable:
+            billable = &field;
+            break;
+        case ImportColumn::UniqueId:
+            uniqueId = &field;
+            break;
+        case ImportColumn::Hours:
+            hours = &field;
+            break;
+        case ImportColumn::Minutes:
+            minutes = &field;
+            break;
+        case ImportColumn::Duration:
+            duration = &field;
+            break;
+        case ImportColumn::Attribute:
+            mPendingAttributeValues.push_back(
+                PendingAttributeValue{ mColumnBindings[i].AttributeIndex, i, 0 });
+            break;
+        case ImportColumn::Client:
+        case ImportColumn::Ignored:
+        default:
+            break;
+        }
+    }
+
+    if (date == nullptr) {
+        Skip(reader, "Missing date", summary);
+        return SqliteResult::OK();
+    }
+
+    // employer, only used to validate or disambiguate the project
+    std::int64_t employerId = 0;
+    if (employer != nullptr) {
+        auto employerIterator = mEmployers.find(*employer);
+        if (employerIterator == mEmployers.end()) {
+            Skip(reader, fmt::format("Unknown employer \"{0}\"", *employer), summary);
+            return SqliteResult::OK();
+        }
+        employerId = employerIterator->second;
+    }
+
+    // project
+    std::int64_t projectId = -1;
+    if (project != nullptr) {
+        auto projectIterator = mProjectsByName.find(*project);
+        if (projectIterator == mProjectsByName.end() ||
+            (employerId != 0 && projectIterator->second.EmployerId != employerId)) {
+            Skip(reader, fmt::format("Unknown project \"{0}\"", *project), summary);
+            return SqliteResult::OK();
+        }
+        projectId = projectIterator->second.ProjectId;
+    } else if (displayName != nullptr) {
+        MakeKey(mKey, employerId, *displayName);
+        auto projectIterator = mProjectsByDisplayName.find(mKey);
+        if (projectIterator == mProjectsByDisplayName.end() || projectIterator->second == -1) {
+            Skip(reader,
+                fmt::format("Unknown or ambiguous project \"{0}\"", *displayName),
+                summary);
+            return SqliteResult::OK();
+        }
+        projectId = projectIterator->second;
+    } else {
+        Skip(reader, "Missing project", summary);
+        return SqliteResult::OK();
+    }
+
+    // category, scoped to the project first and then one without a project
+    if (category == nullptr) {
+        Skip(reader, "Missing category", summary);
+        return SqliteResult::OK();
+    }
+
+    MakeKey(mKey, projectId, *category);
+    auto categoryIterator = mCategories.find(mKey);
+    if (categoryIterator == mCategories.end()) {
+        MakeKey(mKey, 0, *category);
+        categoryIterator = mCategories.find(mKey);
+    }
+    if (categoryIterator == mCategories.end()) {
+        Skip(reader, fmt::format("Unknown category \"{0}\"", *category), summary);
+        return SqliteResult::OK();
+    }
+    const CategoryLookup& categoryLookup = categoryIterator->second;
+
+    // duration
+    int taskHours = 0;
+    int taskMinutes = 0;
+    std::int64_t value = 0;
+    if (duration != nullptr) {
+        if (!TryParseDuration(*duration, taskHours, taskMinutes)) {
+            Skip(reader, fmt::format("Invalid duration \"{0}\"", *duration), summary);
+            return SqliteResult::OK();
+        }
+    } else {
+        if (hours != nullptr) {
+            if (!TryParseInteger(*hours, value)) {
+                Skip(reader, fmt::format("Invalid hours \"{0}\"", *hours), summary);
+                return SqliteResult::OK();
+            }
+            taskHours = static_cast<int>(value);
+        }
+        if (minutes != nullptr) {
+            if (!TryParseInteger(*minutes, value)) {
+                Skip(reader, fmt::format("Invalid minutes \"{0}\"", *minutes), summary);
+                return SqliteResult::OK();
+            }
+            taskMinutes = static_cast<int>(value);
+        }
+    }
+
+    if (taskHours < 0 || taskMinutes < 0 || taskMinutes > 59) {
+        Skip(reader, "Invalid duration", summary);
+        return SqliteResult::OK();
+    }
+
+    // billable, falling back to the category default
+    bool isBillable = categoryLookup.Billable;
+    if (billable != nullptr && !TryParseBoolean(*billable, isBillable)) {
+        Skip(reader, fmt::format("Invalid billable value \"{0}\"", *billable), summary);
+        return SqliteResult::OK();
+    }
+
+    // attribute values, all of which must belong to one attribute group
+    std::int64_t attributeGroupId = -1;
+    for (auto& pendingAttributeValue : mPendingAttributeValues) {
+        const auto& attribute = mAttributes[pendingAttributeValue.AttributeIndex];
+        const std::string& field = reader.GetField(pendingAttributeValue.FieldIndex);
+
+        if (attributeGroupId == -1) {
+            attributeGroupId = attribute.AttributeGroupId;
+        } else if (attributeGroupId != attribute.AttributeGroupId) {
+            Skip(reader, "Attribute values span more than one attribute group", summary);
+            return SqliteResult::OK();
+        }
+
+        bool booleanValue = false;
+        if (attribute.AttributeType == AttributeTypes::Numeric &&
+            !TryParseInteger(field, pendingAttributeValue.Value)) {
+            Skip(reader,
+                fmt::format("Invalid numeric value \"{0}\" for \"{1}\"", field, attribute.Name),
+                summary);
+            return SqliteResult::OK();
+        }
+        if (attribute.AttributeType == AttributeTypes::Boolean) {
+            if (!TryParseBoolean(field, booleanValue)) {
+                Skip(reader,
+                    fmt::format("Invalid boolean value \"{0}\" for \"{1}\"", field, attribute.Name),
+                    summary);
+                return SqliteResult::OK();
+            }
+            pendingAttributeValue.Value = booleanValue ? 1 : 0;
+        }
+    }
+
+    // workday
+    std::int64_t workdayId = -1;
+    auto workdayIterator = mWorkdays.find(*date);
+    if (workdayIterator != mWorkdays.end()) {
+        workdayId = workdayIterator->second;
+    } else {
+        DayNumber dayNumber;
+        if (!DayNumber::TryParse(*date, dayNumber)) {
+            Skip(reader, fmt::format("Invalid date \"{0}\"", *date), summary);
+            return SqliteResult::OK();
+        }
+
+        auto sqliteResult = UpsertWorkday(*date, dayNumber, statements, workdayId);
+        if (!sqliteResult.Success) {
+            return sqliteResult;
+        }
+
+        mWorkdays.emplace(*date, workdayId);
+    }
+
+    // task, the record fields outlive the step so they are bound without copying
+    sqlite3_stmt* stmt = statements.CreateTask;
+    int bindIndex = 1;
+
+    // billable
+    int rc = sqlite3_bind_int(stmt, bindIndex, isBillable);
+    if (rc != SQLITE_OK) {
+        return BindFailed(stmt, "billable", bindIndex, rc);
+    }
+
+    bindIndex++;
+
+    // unique_identifier
+    if (uniqueId != nullptr) {
+        rc = sqlite3_bind_text(
+            stmt, bindIndex, uniqueId->c_str(), static_cast<int>(uniqueId->size()), SQLITE_STATIC);
+    } else {
+        rc = sqlite3_bind_null(stmt, bindIndex);
+    }
+    if (rc != SQLITE_OK) {
+        return BindFailed(stmt, "unique_identifier", bindIndex, rc);
+    }
+
+    bindIndex++;
+
+    // hours
+    rc = sqlite3_bind_int(stmt, bindIndex, taskHours);
+    if (rc != SQLITE_OK) {
+        return BindFailed(stmt, "hours", bindIndex, rc);
+    }
+
+    bindIndex++;
+
+    // minutes
+    rc = sqlite3_bind_int(stmt, bindIndex, taskMinutes);
+    if (rc != SQLITE_OK) {
+        return BindFailed(stmt, "minutes", bindIndex, rc);
+    }
+
+    bindIndex++;
+
+    // description
+    if (description != nullptr) {
+        rc = sqlite3_bind_text(stmt,
+            bindIndex,
+            description->c_str(),
+            static_cast<int>(description->size()),
+            SQLITE_STATIC);
+    } else {
+        rc = sqlite3_bind_text(stmt, bindIndex, "", 0, SQLITE_STATIC);
+    }
+    if (rc != SQLITE_OK) {
+        return BindFailed(stmt, "description", bindIndex, rc);
+    }
+
+    bindIndex++;
+
+    // project_id
+    rc = sqlite3_bind_int64(stmt, bindIndex, projectId);
+    if (rc != SQLITE_OK) {
+        return BindFailed(stmt, "project_id", bindIndex, rc);
+    }
+
+    bindIndex++;
+
+    // category_id
+    rc = sqlite3_bind_int64(stmt, bindIndex, categoryLookup.CategoryId);
+    if (rc != SQLITE_OK) {
+        return BindFailed(stmt, "category_id", bindIndex, rc);
+    }
+
+    bindIndex++;
+
+    // workday_id
+    rc = sqlite3_bind_int64(stmt, bindIndex, workdayId);
+    if (rc != SQLITE_OK) {
+        return BindFailed(stmt, "workday_id", bindIndex, rc);
+    }
+
+    bindIndex++;
+
+    // attribute_group_id
+    if (attributeGroupId != -1) {
+        rc = sqlite3_bind_int64(stmt, bindIndex, attributeGroupId);
+    } else {
+        rc = sqlite3_bind_null(stmt, bindIndex);
+    }
+    if (rc != SQLITE_OK) {
+        return BindFailed(stmt, "attribute_group_id", bindIndex, rc);
+    }
+
+    bindIndex++;
+
+    // attended_meeting_id
+    rc = sqlite3_bind_null(stmt, bindIndex);
+    if (rc != SQLITE_OK) {
+        return BindFailed(stmt, "attended_meeting_id", bindIndex, rc);
+    }
+
+    bindIndex++;
+
+    // date_created and date_modified
+    rc = sqlite3_bind_int64(stmt, bindIndex, mTimestamp);
+    if (rc != SQLITE_OK) {
+        return BindFailed(stmt, "date_created", bindIndex, rc);
+    }
+
+    rc = sqlite3_step(stmt);
+    auto sqliteResult = ResetStatement(stmt, TaskImportService::createTask, rc);
+    if (!sqliteResult.Success) {
+        return sqliteResult;
+    }
+
+    taskId = sqlite3_last_insert_rowid(pDb);
+
+    // task attribute values
+    stmt = statements.CreateTaskAttributeValue;
+    for (const auto& pendingAttributeValue : mPendingAttributeValues) {
+        const auto& attribute = mAttributes[pendingAttributeValue.AttributeIndex];
+        const std::string& field = reader.GetField(pendingAttributeValue.FieldIndex);
+
+        bindIndex = 1;
+
+        // text_value
+        if (attribute.AttributeType == AttributeTypes::Text) {
+            rc = sqlite3_bind_text(
+                stmt, bindIndex, field.c_str(), static_cast<int>(field.size()), SQLITE_STATIC);
+        } else {
+            rc = sqlite3_bind_null(stmt, bindIndex);
+        }
+        if (rc != SQLITE_OK) {
+            return BindFailed(stmt, "text_value", bindIndex, rc);
+        }
+
+        bindIndex++;
+
+        // boolean_value
+        if (attribute.AttributeType == AttributeTypes::Boolean) {
+            rc = sqlite3_bind_int(stmt, bindIndex, static_cast<int>(pendingAttributeValue.Value));
+        } else {
+            rc = sqlite3_bind_null(stmt, bindIndex);
+        }
+        if (rc != SQLITE_OK) {
+            return BindFailed(stmt, "boolean_value", bindIndex, rc);
+        }
+
+        bindIndex++;
+
+        // numeric_value
+        if (attribute.AttributeType == AttributeTypes::Numeric) {
+            rc = sqlite3_bind_int64(stmt, bindIndex, pendingAttributeValue.Value);
+        } else {
+            rc = sqlite3_bind_null(stmt, bindIndex);
+        }
+        if (rc != SQLITE_OK) {
+            return BindFailed(stmt, "numeric_value", bindIndex, rc);
+        }
+
+        bindIndex++;
+
+        // task_id
+        rc = sqlite3_bind_int64(stmt, bindIndex, taskId);
+        if (rc != SQLITE_OK) {
+            return BindFailed(stmt, "task_id", bindIndex, rc);
+        }
+
+        bindIndex++;
+
+        // attribute_id
+        rc = sqlite3_bind_int64(stmt, bindIndex, attribute.AttributeId);
+        if (rc != SQLITE_OK) {
+            return BindFailed(stmt, "attribute_id", bindIndex, rc);
+        }
+
+        rc = sqlite3_step(stmt);
+        sqliteResult = ResetStatement(stmt, TaskImportService::createTaskAttributeValue, rc);
+        if (!sqliteResult.Success) {
+            return sqliteResult;
+        }
+
+        attributeValues++;
+    }
+
+    return SqliteResult::OK();
+}
+
+SqliteResult TaskImportService::UpsertWorkday(const std::string& date,
+    const DayNumber& dayNumber,
+    Statements& statements,
+    std::int64_t& workdayId) const
+{
+    sqlite3_stmt* stmt = statements.UpsertWorkday;
+    int bindIndex = 1;
+
+    // date
+    int rc = sqlite3_bind_text(
+        stmt, bindIndex, date.c_str(), static_cast<int>(date.size()), SQLITE_STATIC);
+    if (rc != SQLITE_OK) {
+        return BindFailed(stmt, "date", bindIndex, rc);
+    }
+
+    bindIndex++;
+
+    // day_number, set here as the insert trigger that derives it is disabled during an import
+    rc = sqlite3_bind_int(stmt, bindIndex, dayNumber.Value);
+    if (rc != SQLITE_OK) {
+        return BindFailed(stmt, "day_number", bindIndex, rc);
+    }
+
+    rc = sqlite3_step(stmt);
+    if (rc == SQLITE_ROW) {
+        // RETURNING workday_id
+        workdayId = sqlite3_column_int64(stmt, 0);
+        rc = sqlite3_step(stmt);
+    }
+
+    auto sqliteResult = ResetStatement(stmt, TaskImportService::upsertWorkday, rc);
+    if (!sqliteResult.Success) {
+        return sqliteResult;
+    }
+
+    SPDLOG_LOGGER_TRACE(pLogger, LogMessages::EntityGetById, "workday", date);
+
+    return SqliteResult::OK();
+}
+
+SqliteResult TaskImportService::CommitBatch(Statements& statements, std::int64_t firstTaskId) const
+{
+    if (firstTaskId != -1) {
+        sqlite3_stmt* stmt = statements.BackfillTasksFts;
+        int bindIndex = 1;
+
+        // task_id
+        int rc = sqlite3_bind_int64(stmt, bindIndex, firstTaskId);
+        if (rc != SQLITE_OK) {
+            return BindFailed(stmt, "task_id", bindIndex, rc);
+        }
+
+        rc = sqlite3_step(stmt);
+        auto sqliteResult = ResetStatement(stmt, TaskImportService::backfillTasksFts, rc);
+        if (!sqliteResult.Success) {
+            return sqliteResult;
+        }
+    }
+
+    return Exec(TaskImportService::commitTransaction);
+}
+
+void TaskImportService::PublishImportedDates() const
+{
+    DayNumber fromDayNumber;
+    DayNumber toDayNumber;
+    bool hasDates = false;
+
+    for (const auto& [date, workdayId] : mWorkdays) {
+        DayNumber dayNumber;
+        if (!DayNumber::TryParse(date, dayNumber)) {
+            continue;
+        }
+
+        if (!hasDates || dayNumber < fromDayNumber) {
+            fromDayNumber = dayNumber;
+        }
+        if (!hasDates || dayNumber > toDayNumber) {
+            toDayNumber = dayNumber;
+        }
+        hasDates = true;
+    }
+
+    if (hasDates) {
+        Persistence::ChangeFeed::GetInstance().PublishRange("tasks", fromDayNumber, toDayNumber);
+    }
+}
+
+SqliteResult TaskImportService::Prepare(const std::string_view query, sqlite3_stmt** stmt) const
+{
+    int rc =
+        sqlite3_prepare_v3(pDb, query.data(), static_cast<int>(query.size()), 0, stmt, nullptr);
+
+    if (rc != SQLITE_OK) {
+        const char* error = sqlite3_errmsg(pDb);
+        pLogger->error(LogMessages::PrepareStatementTemplate, query, rc, error);
+
+        sqlite3_finalize(*stmt);
+        *stmt = nullptr;
+        return SqliteResult::FailDetailed(
+            Messages::PrepareStatementMessage, rc, std::string(error));
+    }
+
+    return SqliteResult::OK();
+}
+
+SqliteResult TaskImportService::Exec(const std::string& query) const
+{
+    int rc = sqlite3_exec(pDb, query.c_str(), nullptr, nullptr, nullptr);
+
+    if (rc != SQLITE_OK) {
+        const char* error = sqlite3_errmsg(pDb);
+        pLogger->error(LogMessages::ExecQueryTemplate, query, rc, error);
+
+        return SqliteResult::FailDetailed(Messages::ExecMessage, rc, std::string(error));
+    }
+
+    return SqliteResult::OK();
+}
+
+SqliteResult TaskImportService::ResetStatement(sqlite3_stmt* stmt,
+    const std::string_view query,
+    int rc) const
+{
+    if (rc != SQLITE_DONE) {
+        const char* error = sqlite3_errmsg(pDb);
+        pLogger->error(LogMessages::ExecStepTemplate, query, rc, error);
+
+        sqlite3_reset(stmt);
+        return SqliteResult::FailDetailed(Messages::StepStatementMessage, rc, std::string(error));
+    }
+
+    sqlite3_reset(stmt);
+    return SqliteResult::OK();
+}
+
+SqliteResult TaskImportService::BindFailed(sqlite3_stmt* stmt,
+    const char* name,
+    int bindIndex,
+    int rc) const
+{
+    const char* error = sqlite3_errmsg(pDb);
+    pLogger->error(LogMessages::BindParameterTemplate, name, bindIndex, rc, error);
+
+    sqlite3_reset(stmt);
+    return SqliteResult::FailDetailed(Messages::BindStatementMessage, rc, std::string(error));
+}
+
+void TaskImportService::Skip(const CsvRecordReader& reader,
+    const std::string& reason,
+    TaskImportSummary& summary) const
+{
+    summary.RecordsSkipped++;
+
+    if (summary.Errors.size() < MaxReportedErrors) {
+        summary.Errors.push_back(fmt::format("Line {0}: {1}", reader.GetLineNumber(), reason));
+    }
+
+    SPDLOG_LOGGER_TRACE(
+        pLogger, "Skipped import record on line \"{0}\": {1}", reader.GetLineNumber(), reason);
+}
+
+constexpr std::string_view TaskImportService::filterEmployers = "SELECT "
+                                                                "employer_id, "
+                                                                "name "
+                                                                "FROM employers "
+                                                                "WHERE is_active = 1";
+
+constexpr std::string_view TaskImportService::filterProjects = "SELECT "
+                                                               "project_id, "
+                                                               "name, "
+                                                               "display_name, "
+                                                               "employer_id "
+                                                               "FROM projects "
+                                                               "WHERE is_active = 1";
+
+constexpr std::string_view TaskImportService::filterCategories = "SELECT "
+                                                                 "category_id, "
+                                                                 "name, "
+                                                                 "billable, "
+                                                                 "project_id "
+                                                                 "FROM categories "
+                                                                 "WHERE is_active = 1";
+
+constexpr std::string_view TaskImportService::filterAttributes =
+    "SELECT "
+    "attributes.attribute_id, "
+    "attributes.name, "
+    "attributes.attribute_group_id, "
+    "attributes.attribute_type_id "
+    "FROM attributes "
+    "INNER JOIN attribute_groups "
+    "ON attributes.attribute_group_id = attribute_groups.attribute_group_id "
+    "WHERE attributes.is_active = 1 "
+    "AND attribute_groups.is_active = 1 "
+    "ORDER BY attributes.attribute_id";
+
+// same upsert as Persistence::WorkdaysPersistence::upsert
+constexpr std::string_view TaskImportService::upsertWorkday =
+    "INSERT INTO "
+    "workdays (date, day_number) "
+    "VALUES (?, ?) "
+    "ON CONFLICT(date) DO UPDATE SET date = excluded.date "
+    "RETURNING workday_id";
+
+constexpr std::string_view TaskImportService::createTask = "INSERT INTO "
+                                                           "tasks "
+                                                           "("
+                                                           "billable, "
+                                                           "unique_identifier, "
+                                                           "hours, "
+                                                           "minutes, "
+                                                           "description, "
+                                                           "project_id, "
+                                                           "category_id, "
+                                                           "workday_id, "
+                                                           "attribute_group_id, "
+                                                           "attended_meeting_id, "
+                                                           "date_created, "
+                                                           "date_modified "
+                                                           ") "
+                                                           "VALUES (?,?,?,?,?,?,?,?,?,?,?11,?11)";
+
+constexpr std::string_view TaskImportService::createTaskAttributeValue = "INSERT INTO "
+                                                                         "task_attribute_values "
+                                                                         "("
+                                                                         "text_value, "
+                                                                         "boolean_value, "
+                                                                         "numeric_value, "
+                                                                         "task_id, "
+                                                                         "attribute_id "
+                                                                         ")"
+                                                                         " VALUES "
+                                                                         "(?, ?, ?, ?, ?)";
+
+constexpr std::string_view TaskImportService::backfillTasksFts =
+    "INSERT INTO tasks_fts(rowid, description, unique_identifier) "
+    "SELECT task_id, description, unique_identifier "
+    "FROM tasks "
+    "WHERE task_id >= ?";
+
+// the date_created and date_modified column defaults of the tasks table
+constexpr std::string_view TaskImportService::selectTimestamp =
+    "SELECT CAST(strftime('%s', 'now', 'localtime') AS INTEGER)";
+
+// tasks_fts has no command to read its settings, they live in its config shadow table
+constexpr std::string_view TaskImportService::selectFtsConfig =
+    "SELECT k, v FROM tasks_fts_config WHERE k IN ('automerge', 'hashsize')";
+
+constexpr std::string_view TaskImportService::updateFtsConfig =
+    "INSERT INTO tasks_fts(tasks_fts, rank) VALUES (?, ?)";
+
+const std::string TaskImportService::beginTransaction = "BEGIN TRANSACTION";
+const std::string TaskImportService::commitTransaction = "COMMIT";
+const std::string TaskImportService::rollbackTransaction = "ROLLBACK";
+const std::string TaskImportService::disableForeignKeys = "PRAGMA foreign_keys = OFF";
+const std::string TaskImportService::enableForeignKeys = "PRAGMA foreign_keys = ON";
+const std::string TaskImportService::importCacheSize = "PRAGMA cache_size = -65536";
+} // namespace tks::Services::Import
@@ -0,0 +1,210 @@
+// Productivity tool to help you track the time you spend on tasks
+// Copyright (C) 2026 Szymon Welgus
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+// Contact:
+//     szymonwelgus at gmail dot com
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "../../common/enums.h"
+
+#include "../../common/results/importresult.h"
+#include "../../common/results/sqliteresult.h"
+
+#include "../../persistence/base/persistencebase.h"
+
+#include "../../utils/daynumber.h"
+
+#include "csvrecordreader.h"
+#include "taskimportoptions.h"
+
+namespace tks::Services::Import
+{
+struct TaskImportSummary {
+    std::size_t RecordsRead;
+    std::size_t TasksImported;
+    std::size_t AttributeValuesImported;
+    std::size_t RecordsSkipped;
+    // the first MaxReportedErrors reasons a record was skipped
+    std::vector<std::string> Errors;
+
+    TaskImportSummary();
+    ~TaskImportSummary() = default;
+};
+
+enum class ImportColumn {
+    Ignored = 0,
+    Employer,
+    Client,
+    Project,
+    DisplayName,
+    Category,
+    Date,
+    Description,
+    Billable,
+    UniqueId,
+    Hours,
+    Minutes,
+    Duration,
+    Attribute
+};
+
+// Imports tasks from a delimited file laid out like a CSV export. Names are resolved against
+// lookups loaded up front and records are written in batched transactions through statements
+// that are prepared once per import.
+struct TaskImportService final : public Persistence::PersistenceBase {
+public:
+    static constexpr std::size_t BatchSize = 50000;
+    static constexpr std::size_t MaxReportedErrors = 100;
+    // tasks_fts flushes its pending terms once they outgrow this, so a batch is written as one
+    // segment instead of the default 1 MiB ones
+    static constexpr std::int64_t ImportFtsHashSize = 64 * 1024 * 1024;
+
+    TaskImportService() = delete;
+    TaskImportService(const TaskImportService&) = delete;
+    explicit TaskImportService(const std::string& databaseFilePath,
+        const std::shared_ptr<spdlog::logger> logger);
+    virtual ~TaskImportService();
+
+    TaskImportService& operator=(const TaskImportService&) = delete;
+
+    ImportResult ImportFromFile(const std::string& filePath,
+        const TaskImportOptions& options,
+        /*out*/ TaskImportSummary& summary);
+
+    ImportResult Import(std::istream& stream,
+        const TaskImportOptions& options,
+        /*out*/ TaskImportSummary& summary);
+
+    static const std::string_view filterEmployers;
+    static const std::string_view filterProjects;
+    static const std::string_view filterCategories;
+    static const std::string_view filterAttributes;
+    static const std::string_view upsertWorkday;
+    static const std::string_view createTask;
+    static const std::string_view createTaskAttributeValue;
+    static const std::string_view backfillTasksFts;
+    static const std::string_view selectTimestamp;
+    static const std::string_view selectFtsConfig;
+    static const std::string_view updateFtsConfig;
+
+    static const std::string beginTransaction;
+    static const std::string commitTransaction;
+    static const std::string rollbackTransaction;
+    static const std::string disableForeignKeys;
+    static const std::string enableForeignKeys;
+    static const std::string importCacheSize;
+
+private:
+    struct ColumnBinding {
+        ImportColumn Column;
+        // index into mAttributes when Column is ImportColumn::Attribute
+        std::size_t AttributeIndex;
+    };
+
+    struct ProjectLookup {
+        std::int64_t ProjectId;
+        std::int64_t EmployerId;
+    };
+
+    struct CategoryLookup {
+        std::int64_t CategoryId;
+        bool Billable;
+    };
+
+    struct AttributeLookup {
+        std::int64_t AttributeId;
+        std::int64_t AttributeGroupId;
+        AttributeTypes AttributeType;
+        std::string Name;
+    };
+
+    struct PendingAttributeValue {
+        std::size_t AttributeIndex;
+        std::size_t FieldIndex;
+        std::int64_t Value;
+    };
+
+    struct Statements {
+        sqlite3_stmt* UpsertWorkday = nullptr;
+        sqlite3_stmt* CreateTask = nullptr;
+        sqlite3_stmt* CreateTaskAttributeValue = nullptr;
+        sqlite3_stmt* BackfillTasksFts = nullptr;
+
+        ~Statements();
+    };
+
+    // the tasks_fts settings an import changes, initialized to the FTS5 defaults
+    struct FtsConfig {
+        std::int64_t AutoMerge = 4;
+        std::int64_t HashSize = 1024 * 1024;
+    };
+
+    SqliteResult LoadLookups();
+    SqliteResult ReadTimestamp(/*out*/ std::int64_t& timestamp) const;
+    SqliteResult ReadFtsConfig(/*out*/ FtsConfig& ftsConfig) const;
+    SqliteResult WriteFtsConfig(const FtsConfig& ftsConfig) const;
+    ImportResult MapColumns(const CsvRecordReader& reader, const TaskImportOptions& options);
+
+    SqliteResult Prepare(const std::string_view query, sqlite3_stmt** stmt) const;
+    SqliteResult Exec(const std::string& query) const;
+    SqliteResult ResetStatement(sqlite3_stmt* stmt, const std::string_view query, int rc) const;
+
+    SqliteResult BindFailed(sqlite3_stmt* stmt, const char* name, int bindIndex, int rc) const;
+
+    SqliteResult ImportRecord(const CsvRecordReader& reader,
+        const TaskImportOptions& options,
+        Statements& statements,
+        TaskImportSummary& summary,
+        std::int64_t& taskId,
+        std::size_t& attributeValues);
+    SqliteResult UpsertWorkday(const std::string& date,
+        const DayNumber& dayNumber,
+        Statements& statements,
+        std::int64_t& workdayId) const;
+    SqliteResult CommitBatch(Statements& statements, std::int64_t firstTaskId) const;
+    void PublishImportedDates() const;
+
+    void Skip(const CsvRecordReader& reader,
+        const std::string& reason,
+        TaskImportSummary& summary) const;
+
+    std::unordered_map<std::string, std::int64_t> mEmployers;
+    std::unordered_map<std::string, ProjectLookup> mProjectsByName;
+    // keyed by employer ID and display name, see MakeKey
+    std::unordered_map<std::string, std::int64_t> mProjectsByDisplayName;
+    // keyed by project ID (0 for categories without a project) and name, see MakeKey
+    std::unordered_map<std::string, CategoryLookup> mCategories;
+    std::vector<AttributeLookup> mAttributes;
+    std::unordered_map<std::string, std::int64_t> mWorkdays;
+
+    std::vector<ColumnBinding> mColumnBindings;
+    std::vector<PendingAttributeValue> mPendingAttributeValues;
+    std::string mKey;
+    // date_created and date_modified of every task in the import
+    std::int64_t mTimestamp;
+};
+} // namespace tks::Services::Import
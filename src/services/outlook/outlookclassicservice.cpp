@@ -23,21 +23,6 @@
 
 namespace tks::Services::Outlook
 {
-OutlookResult OutlookResult::OK()
-{
-    return OutlookResult{ true, "" };
-}
-
-OutlookResult OutlookResult::PartialOK(const std::string& message)
-{
-    return OutlookResult{ true, message };
-}
-
-OutlookResult OutlookResult::Fail(const std::string& errorMessage)
-{
-    return OutlookResult{ false, errorMessage };
-}
-
 OutlookClassicService::OutlookClassicService(std::shared_ptr<spdlog::logger> logger)
     : pLogger(logger)
     , mOutlookInstance()
@@ -30,18 +30,10 @@
 #include <spdlog/spdlog.h>
 
 #include "outlookmeetingmodel.h"
+#include "outlookresult.h"
 
 namespace tks::Services::Outlook
 {
-struct OutlookResult {
-    bool Success;
-    std::string Message;
-
-    static OutlookResult OK();
-    static OutlookResult PartialOK(const std::string& message);
-    static OutlookResult Fail(const std::string& errorMessage);
-};
-
 constexpr int olFolderCalendar = 9;
 
 class OutlookClassicService
@@ -0,0 +1,554 @@
+// Productivity tool to help you track the time you spend on tasks
+// Copyright (C) 2026 Szymon Welgus
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+// Contact:
+//     szymonwelgus at gmail dot com
+
+
+#include "referenceentitycache.h"
+
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+#include "../../persistence/base/entityversions.h"
+
+#include "../../persistence/attributegroupspersistence.h"
+#include "../../persistence/clientspersistence.h"
+#include "../../persistence/employerspersistence.h"
+#include "../../persistence/projectspersistence.h"
+
+#include "../categories/categoryservice.h"
+
+namespace tks::Services
+{
+namespace
+{
+template<typename TModel>
+struct Snapshot {
+    bool IsLoaded = false;
+    std::string DatabaseFilePath;
+    std::uint64_t Version = 0;
+
+    std::vector<TModel> Models;
+    std::unordered_map<std::int64_t, std::size_t> IndexById;
+    std::unordered_map<std::int64_t, std::vector<std::size_t>> IndexByParentId;
+};
+
+struct Store {
+    std::mutex Mutex;
+
+    Snapshot<Model::EmployerModel> Employers;
+    Snapshot<Model::ClientModel> Clients;
+    Snapshot<Model::ProjectModel> Projects;
+    Snapshot<CategoryViewModel> Categories;
+    Snapshot<Model::AttributeGroupModel> AttributeGroups;
+};
+
+Store& GetStore()
+{
+    static Store store;
+    return store;
+}
+
+std::uint64_t GetVersion(Persistence::VersionedEntity entity)
+{
+    return Persistence::EntityVersions::GetInstance().Get(entity);
+}
+
+/// <summary>
+/// Reload the snapshot unless it was loaded from the same file at the same version. The version
+/// is read by the caller before the load runs, so a write racing the load makes the next read
+/// reload again rather than keep stale rows
+/// </summary>
+template<typename TModel, typename TLoad, typename TGetId, typename TGetParentId>
+SqliteResult EnsureLoaded(std::shared_ptr<spdlog::logger> logger,
+    Snapshot<TModel>& snapshot,
+    const std::string& databaseFilePath,
+    std::uint64_t version,
+    const char* table,
+    TLoad load,
+    TGetId getId,
+    TGetParentId getParentId)
+{
+    if (snapshot.IsLoaded && snapshot.Version == version &&
+        snapshot.DatabaseFilePath == databaseFilePath) {
+        return SqliteResult::OK();
+    }
+
+    std::vector<TModel> models;
+    auto result = load(models);
+    if (!result.Success) {
+        return result;
+    }
+
+    snapshot.Models = std::move(models);
+    snapshot.IndexById.clear();
+    snapshot.IndexByParentId.clear();
+
+    for (std::size_t i = 0; i < snapshot.Models.size(); i++) {
+        const auto& model = snapshot.Models[i];
+
+        snapshot.IndexById[getId(model)] = i;
+
+        std::optional<std::int64_t> parentId = getParentId(model);
+        if (parentId.has_value()) {
+            snapshot.IndexByParentId[parentId.value()].push_back(i);
+        }
+    }
+
+    snapshot.IsLoaded = true;
+    snapshot.DatabaseFilePath = databaseFilePath;
+    snapshot.Version = version;
+
+    SPDLOG_LOGGER_TRACE(logger,
+        "Loaded \"{0}\" reference cache at version \"{1}\" with \"{2}\" rows",
+        table,
+        version,
+        snapshot.Models.size());
+
+    return SqliteResult::OK();
+}
+
+template<typename TModel>
+bool TryGetById(const Snapshot<TModel>& snapshot, std::int64_t id, TModel& model)
+{
+    auto it = snapshot.IndexById.find(id);
+    if (it == snapshot.IndexById.end()) {
+        return false;
+    }
+
+    model = snapshot.Models[it->second];
+    return true;
+}
+
+template<typename TModel, typename TPredicate>
+void CopyByParentId(const Snapshot<TModel>& snapshot,
+    std::int64_t parentId,
+    std::vector<TModel>& models,
+    TPredicate predicate)
+{
+    auto it = snapshot.IndexByParentId.find(parentId);
+    if (it == snapshot.IndexByParentId.end()) {
+        return;
+    }
+
+    for (const auto index : it->second) {
+        if (predicate(snapshot.Models[index])) {
+            models.push_back(snapshot.Models[index]);
+        }
+    }
+}
+
+SqliteResult LoadEmployers(std::shared_ptr<spdlog::logger> logger,
+    const std::string& databaseFilePath,
+    Store& store)
+{
+    auto version = GetVersion(Persistence::VersionedEntity::Employers);
+
+    return EnsureLoaded(
+        logger,
+        store.Employers,
+        databaseFilePath,
+        version,
+        "employers",
+        [&](std::vector<Model::EmployerModel>& models) {
+            Persistence::EmployersPersistence employersPersistence(logger, databaseFilePath);
+            return employersPersistence.Filter("", models);
+        },
+        [](const Model::EmployerModel& model) { return model.EmployerId; },
+        [](const Model::EmployerModel&) { return std::optional<std::int64_t>(); });
+}
+
+SqliteResult LoadClients(std::shared_ptr<spdlog::logger> logger,
+    const std::string& databaseFilePath,
+    Store& store)
+{
+    auto version = GetVersion(Persistence::VersionedEntity::Clients);
+
+    return EnsureLoaded(
+        logger,
+        store.Clients,
+        databaseFilePath,
+        version,
+        "clients",
+        [&](std::vector<Model::ClientModel>& models) {
+            Persistence::ClientsPersistence clientsPersistence(logger, databaseFilePath);
+            return clientsPersistence.Filter("", models);
+        },
+        [](const Model::ClientModel& model) { return model.ClientId; },
+        [](const Model::ClientModel& model) {
+            return std::optional<std::int64_t>(model.EmployerId);
+        });
+}
+
+SqliteResult LoadProjects(std::shared_ptr<spdlog::logger> logger,
+    const std::string& databaseFilePath,
+    Store& store)
+{
+    auto version = GetVersion(Persistence::VersionedEntity::Projects);
+
+    return EnsureLoaded(
+        logger,
+        store.Projects,
+        databaseFilePath,
+        version,
+        "projects",
+        [&](std::vector<Model::ProjectModel>& models) {
+            Persistence::ProjectsPersistence projectsPersistence(logger, databaseFilePath);
+            return projectsPersistence.Filter("", models);
+        },
+        [](const Model::ProjectModel& model) { return model.ProjectId; },
+        [](const Model::ProjectModel& model) {
+            return std::optional<std::int64_t>(model.EmployerId);
+        });
+}
+
+SqliteResult LoadCategories(std::shared_ptr<spdlog::logger> logger,
+    const std::string& databaseFilePath,
+    Store& store)
+{
+    // categories carry the display name of their project, so a project write makes them stale
+    auto version = GetVersion(Persistence::VersionedEntity::Categories) +
+                   GetVersion(Persistence::VersionedEntity::Projects);
+
+    return EnsureLoaded(
+        logger,
+        store.Categories,
+        databaseFilePath,
+        version,
+        "categories",
+        [&](std::vector<CategoryViewModel>& models) {
+            CategoryService categoryService(logger, databaseFilePath);
+            return categoryService.Filter(models);
+        },
+        [](const CategoryViewModel& model) { return model.CategoryId; },
+        [](const CategoryViewModel& model) { return model.ProjectId; });
+}
+
+SqliteResult LoadAttributeGroups(std::shared_ptr<spdlog::logger> logger,
+    const std::string& databaseFilePath,
+    Store& store)
+{
+    auto version = GetVersion(Persistence::VersionedEntity::AttributeGroups);
+
+    return EnsureLoaded(
+        logger,
+        store.AttributeGroups,
+        databaseFilePath,
+        version,
+        "attribute_groups",
+        [&](std::vector<Model::AttributeGroupModel>& models) {
+            Persistence::AttributeGroupsPersistence attributeGroupsPersistence(
+                logger, databaseFilePath);
+            return attributeGroupsPersistence.Filter("", models);
+        },
+        [](const Model::AttributeGroupModel& model) { return model.AttributeGroupId; },
+        [](const Model::AttributeGroupModel&) { return std::optional<std::int64_t>(); });
+}
+} // namespace
+
+ReferenceEntityCache::ReferenceEntityCache(std::shared_ptr<spdlog::logger> logger,
+    const std::string& databaseFilePath)
+    : pLogger(logger)
+    , mDatabaseFilePath(databaseFilePath)
+{
+}
+
+SqliteResult ReferenceEntityCache::FilterEmployers(
+    std::vector<Model::EmployerModel>& employerModels) const
+{
+    auto& store = GetStore();
+    std::scoped_lock lock(store.Mutex);
+
+    auto result = LoadEmployers(pLogger, mDatabaseFilePath, store);
+    if (!result.Success) {
+        return result;
+    }
+
+    employerModels.insert(
+        employerModels.end(), store.Employers.Models.begin(), store.Employers.Models.end());
+
+    return SqliteResult::OK();
+}
+
+SqliteResult ReferenceEntityCache::GetEmployerById(const std::int64_t employerId,
+    Model::EmployerModel& employerModel) const
+{
+    {
+        auto& store = GetStore();
+        std::scoped_lock lock(store.Mutex);
+
+        auto result = LoadEmployers(pLogger, mDatabaseFilePath, store);
+        if (!result.Success) {
+            return result;
+        }
+
+        if (TryGetById(store.Employers, employerId, employerModel)) {
+            return SqliteResult::OK();
+        }
+    }
+
+    Persistence::EmployersPersistence employersPersistence(pLogger, mDatabaseFilePath);
+    return employersPersistence.GetById(employerId, employerModel);
+}
+
+SqliteResult ReferenceEntityCache::FilterClients(
+    std::vector<Model::ClientModel>& clientModels) const
+{
+    auto& store = GetStore();
+    std::scoped_lock lock(store.Mutex);
+
+    auto result = LoadClients(pLogger, mDatabaseFilePath, store);
+    if (!result.Success) {
+        return result;
+    }
+
+    clientModels.insert(
+        clientModels.end(), store.Clients.Models.begin(), store.Clients.Models.end());
+
+    return SqliteResult::OK();
+}
+
+SqliteResult ReferenceEntityCache::FilterClientsByEmployerId(const std::int64_t employerId,
+    std::vector<Model::ClientModel>& clientModels) const
+{
+    auto& store = GetStore();
+    std::scoped_lock lock(store.Mutex);
+
+    auto result = LoadClients(pLogger, mDatabaseFilePath, store);
+    if (!result.Success) {
+        return result;
+    }
+
+    CopyByParentId(
+        store.Clients, employerId, clientModels, [](const Model::ClientModel&) { return true; });
+
+    return SqliteResult::OK();
+}
+
+SqliteResult ReferenceEntityCache::GetClientById(const std::int64_t clientId,
+    Model::ClientModel& clientModel) const
+{
+    {
+        auto& store = GetStore();
+        std::scoped_lock lock(store.Mutex);
+
+        auto result = LoadClients(pLogger, mDatabaseFilePath, store);
+        if (!result.Success) {
+            return result;
+        }
+
+        if (TryGetById(store.Clients, clientId, clientModel)) {
+            return SqliteResult::OK();
+        }
+    }
+
+    Persistence::ClientsPersistence clientsPersistence(pLogger, mDatabaseFilePath);
+    return clientsPersistence.GetById(clientId, clientModel);
+}
+
+SqliteResult ReferenceEntityCache::FilterProjectsByEmployerId(
+    std::optional<std::int64_t> employerId,
+    std::vector<Model::ProjectModel>& projectModels) const
+{
+    // the query binds a missing employer as NULL, which matches no project
+    if (!employerId.has_value()) {
+        return SqliteResult::OK();
+    }
+
+    auto& store = GetStore();
+    std::scoped_lock lock(store.Mutex);
+
+    auto result = LoadProjects(pLogger, mDatabaseFilePath, store);
+    if (!result.Success) {
+        return result;
+    }
+
+    CopyByParentId(store.Projects,
+        employerId.value(),
+        projectModels,
+        [](const Model::ProjectModel&) { return true; });
+
+    return SqliteResult::OK();
+}
+
+SqliteResult ReferenceEntityCache::FilterProjectsByEmployerIdOrClientId(
+    std::optional<std::int64_t> employerId,
+    std::optional<std::int64_t> clientId,
+    std::vector<Model::ProjectModel>& projectModels) const
+{
+    if (!employerId.has_value()) {
+        return SqliteResult::OK();
+    }
+
+    auto& store = GetStore();
+    std::scoped_lock lock(store.Mutex);
+
+    auto result = LoadProjects(pLogger, mDatabaseFilePath, store);
+    if (!result.Success) {
+        return result;
+    }
+
+    // projects without a client, or of the client when one is given
+    CopyByParentId(store.Projects,
+        employerId.value(),
+        projectModels,
+        [&clientId](const Model::ProjectModel& model) {
+            return !model.ClientId.has_value() ||
+                   (clientId.has_value() && model.ClientId.value() == clientId.value());
+        });
+
+    return SqliteResult::OK();
+}
+
+SqliteResult ReferenceEntityCache::GetProjectById(const std::int64_t projectId,
+    Model::ProjectModel& projectModel) const
+{
+    {
+        auto& store = GetStore();
+        std::scoped_lock lock(store.Mutex);
+
+        auto result = LoadProjects(pLogger, mDatabaseFilePath, store);
+        if (!result.Success) {
+            return result;
+        }
+
+        if (TryGetById(store.Projects, projectId, projectModel)) {
+            return SqliteResult::OK();
+        }
+    }
+
+    Persistence::ProjectsPersistence projectsPersistence(pLogger, mDatabaseFilePath);
+    return projectsPersistence.GetById(projectId, projectModel);
+}
+
+SqliteResult ReferenceEntityCache::FilterCategories(
+    std::vector<CategoryViewModel>& categories) const
+{
+    auto& store = GetStore();
+    std::scoped_lock lock(store.Mutex);
+
+    auto result = LoadCategories(pLogger, mDatabaseFilePath, store);
+    if (!result.Success) {
+        return result;
+    }
+
+    categories.insert(
+        categories.end(), store.Categories.Models.begin(), store.Categories.Models.end());
+
+    return SqliteResult::OK();
+}
+
+SqliteResult ReferenceEntityCache::FilterCategoriesByProjectId(const std::int64_t projectId,
+    std::vector<CategoryViewModel>& categories) const
+{
+    auto& store = GetStore();
+    std::scoped_lock lock(store.Mutex);
+
+    auto result = LoadCategories(pLogger, mDatabaseFilePath, store);
+    if (!result.Success) {
+        return result;
+    }
+
+    CopyByParentId(
+        store.Categories, projectId, categories, [](const CategoryViewModel&) { return true; });
+
+    return SqliteResult::OK();
+}
+
+SqliteResult ReferenceEntityCache::FilterCategoriesByProjectIds(
+    const std::vector<std::int64_t>& projectIds,
+    std::vector<CategoryViewModel>& categories) const
+{
+    auto& store = GetStore();
+    std::scoped_lock lock(store.Mutex);
+
+    auto result = LoadCategories(pLogger, mDatabaseFilePath, store);
+    if (!result.Success) {
+        return result;
+    }
+
+    for (const auto projectId : projectIds) {
+        CopyByParentId(store.Categories, projectId, categories, [](const CategoryViewModel&) {
+            return true;
+        });
+    }
+
+    return SqliteResult::OK();
+}
+
+SqliteResult ReferenceEntityCache::GetCategoryById(const std::int64_t categoryId,
+    CategoryViewModel& category) const
+{
+    {
+        auto& store = GetStore();
+        std::scoped_lock lock(store.Mutex);
+
+        auto result = LoadCategories(pLogger, mDatabaseFilePath, store);
+        if (!result.Success) {
+            return result;
+        }
+
+        if (TryGetById(store.Categories, categoryId, category)) {
+            return SqliteResult::OK();
+        }
+    }
+
+    CategoryService categoryService(pLogger, mDatabaseFilePath);
+    return categoryService.GetById(categoryId, category);
+}
+
+SqliteResult ReferenceEntityCache::FilterAttributeGroups(
+    std::vector<Model::AttributeGroupModel>& attributeGroupModels) const
+{
+    auto& store = GetStore();
+    std::scoped_lock lock(store.Mutex);
+
+    auto result = LoadAttributeGroups(pLogger, mDatabaseFilePath, store);
+    if (!result.Success) {
+        return result;
+    }
+
+    attributeGroupModels.insert(attributeGroupModels.end(),
+        store.AttributeGroups.Models.begin(),
+        store.AttributeGroups.Models.end());
+
+    return SqliteResult::OK();
+}
+
+SqliteResult ReferenceEntityCache::GetAttributeGroupById(const std::int64_t attributeGroupId,
+    Model::AttributeGroupModel& attributeGroupModel) const
+{
+    {
+        auto& store = GetStore();
+        std::scoped_lock lock(store.Mutex);
+
+        auto result = LoadAttributeGroups(pLogger, mDatabaseFilePath, store);
+        if (!result.Success) {
+            return result;
+        }
+
+        if (TryGetById(store.AttributeGroups, attributeGroupId, attributeGroupModel)) {
+            return SqliteResult::OK();
+        }
+    }
+
+    Persistence::AttributeGroupsPersistence attributeGroupsPersistence(
+        pLogger, mDatabaseFilePath);
+    return attributeGroupsPersistence.GetById(attributeGroupId, attributeGroupModel);
+}
+} // namespace tks::Services
@@ -0,0 +1,95 @@
+// Productivity tool to help you track the time you spend on tasks
+// Copyright (C) 2026 Szymon Welgus
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+// Contact:
+//     szymonwelgus at gmail dot com
+
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <spdlog/spdlog.h>
+#include <spdlog/logger.h>
+
+#include "../../common/results/sqliteresult.h"
+
+#include "../../models/attributegroupmodel.h"
+#include "../../models/clientmodel.h"
+#include "../../models/employermodel.h"
+#include "../../models/projectmodel.h"
+
+#include "../categories/categoryviewmodel.h"
+
+namespace tks::Services
+{
+/// <summary>
+/// Process-wide read-through copy of the active employers, clients, projects, categories and
+/// attribute groups, indexed by id and by their employer or project. A table is reloaded on the
+/// first read after Persistence::EntityVersions reports a write to it. Results match the queries
+/// the methods stand in for, lookups of inactive rows fall through to a query
+/// </summary>
+class ReferenceEntityCache final
+{
+public:
+    ReferenceEntityCache() = delete;
+    ReferenceEntityCache(const ReferenceEntityCache&) = delete;
+    ReferenceEntityCache(std::shared_ptr<spdlog::logger> logger,
+        const std::string& databaseFilePath);
+    ~ReferenceEntityCache() = default;
+
+    ReferenceEntityCache& operator=(const ReferenceEntityCache&) = delete;
+
+    SqliteResult FilterEmployers(/*out*/ std::vector<Model::EmployerModel>& employerModels) const;
+    SqliteResult GetEmployerById(const std::int64_t employerId,
+        /*out*/ Model::EmployerModel& employerModel) const;
+
+    SqliteResult FilterClients(/*out*/ std::vector<Model::ClientModel>& clientModels) const;
+    SqliteResult FilterClientsByEmployerId(const std::int64_t employerId,
+        /*out*/ std::vector<Model::ClientModel>& clientModels) const;
+    SqliteResult GetClientById(const std::int64_t clientId,
+        /*out*/ Model::ClientModel& clientModel) const;
+
+    SqliteResult FilterProjectsByEmployerId(std::optional<std::int64_t> employerId,
+        /*out*/ std::vector<Model::ProjectModel>& projectModels) const;
+    SqliteResult FilterProjectsByEmployerIdOrClientId(std::optional<std::int64_t> employerId,
+        std::optional<std::int64_t> clientId,
+        /*out*/ std::vector<Model::ProjectModel>& projectModels) const;
+    SqliteResult GetProjectById(const std::int64_t projectId,
+        /*out*/ Model::ProjectModel& projectModel) const;
+
+    SqliteResult FilterCategories(/*out*/ std::vector<CategoryViewModel>& categories) const;
+    SqliteResult FilterCategoriesByProjectId(const std::int64_t projectId,
+        /*out*/ std::vector<CategoryViewModel>& categories) const;
+    SqliteResult FilterCategoriesByProjectIds(const std::vector<std::int64_t>& projectIds,
+        /*out*/ std::vector<CategoryViewModel>& categories) const;
+    SqliteResult GetCategoryById(const std::int64_t categoryId,
+        /*out*/ CategoryViewModel& category) const;
+
+    SqliteResult FilterAttributeGroups(
+        /*out*/ std::vector<Model::AttributeGroupModel>& attributeGroupModels) const;
+    SqliteResult GetAttributeGroupById(const std::int64_t attributeGroupId,
+        /*out*/ Model::AttributeGroupModel& attributeGroupModel) const;
+
+private:
+    std::shared_ptr<spdlog::logger> pLogger;
+    std::string mDatabaseFilePath;
+};
+} // namespace tks::Services
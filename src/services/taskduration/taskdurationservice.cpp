@@ -24,6 +24,7 @@
 
 #include "../../common/messages/sqlitemessages.h"
 
+#include "../../utils/daynumber.h"
 #include "../../utils/utils.h"
 
 namespace tks::Services
@@ -51,6 +52,15 @@ SqliteResult TaskDurationService::GetTaskDurationsForDateRange(const std::string
         : TaskDurationService::getBillableHoursForDateRange.size();
     // clang-format on
 
+    DayNumber startDayNumber;
+    DayNumber endDayNumber;
+    if (!DayNumber::TryParse(startDate, startDayNumber) ||
+        !DayNumber::TryParse(endDate, endDayNumber)) {
+        pLogger->error("Invalid date range \"{0}\" - \"{1}\"", startDate, endDate);
+        return SqliteResult::FailDetailed(
+            Messages::BindStatementMessage, SQLITE_MISMATCH, "Invalid date range");
+    }
+
     sqlite3_stmt* stmt = nullptr;
 
     int rc = sqlite3_prepare_v2(pDb, sql.c_str(), static_cast<int>(sqlSize), &stmt, nullptr);
@@ -66,12 +76,11 @@ SqliteResult TaskDurationService::GetTaskDurationsForDateRange(const std::string
 
     int bindIndex = 1;
 
-    rc = sqlite3_bind_text(
-        stmt, bindIndex, startDate.c_str(), static_cast<int>(startDate.size()), SQLITE_TRANSIENT);
+    rc = sqlite3_bind_int(stmt, bindIndex, startDayNumber.Value);
 
     if (rc != SQLITE_OK) {
         const char* error = sqlite3_errmsg(pDb);
-        pLogger->error(LogMessages::BindParameterTemplate, "date", bindIndex, rc, error);
+        pLogger->error(LogMessages::BindParameterTemplate, "day_number", bindIndex, rc, error);
 
         sqlite3_finalize(stmt);
         return SqliteResult::FailDetailed(Messages::BindStatementMessage, rc, std::string(error));
@@ -79,12 +88,11 @@ SqliteResult TaskDurationService::GetTaskDurationsForDateRange(const std::string
 
     bindIndex++;
 
-    rc = sqlite3_bind_text(
-        stmt, bindIndex, endDate.c_str(), static_cast<int>(endDate.size()), SQLITE_TRANSIENT);
+    rc = sqlite3_bind_int(stmt, bindIndex, endDayNumber.Value);
 
     if (rc != SQLITE_OK) {
         const char* error = sqlite3_errmsg(pDb);
-        pLogger->error(LogMessages::BindParameterTemplate, "date", bindIndex, rc, error);
+        pLogger->error(LogMessages::BindParameterTemplate, "day_number", bindIndex, rc, error);
 
         sqlite3_finalize(stmt);
         return SqliteResult::FailDetailed(Messages::BindStatementMessage, rc, std::string(error));
@@ -369,8 +377,8 @@ std::string TaskDurationService::getAllHoursForDateRange =
     "FROM tasks "
     "INNER JOIN workdays "
     "ON tasks.workday_id = workdays.workday_id "
-    "WHERE workdays.date >= ? "
-    "AND workdays.date <= ? "
+    "WHERE workdays.day_number >= ? "
+    "AND workdays.day_number <= ? "
     "AND tasks.is_active = 1";
 
 std::string TaskDurationService::getBillableHoursForDateRange =
@@ -380,8 +388,8 @@ std::string TaskDurationService::getBillableHoursForDateRange =
     "FROM tasks "
     "INNER JOIN workdays "
     "ON tasks.workday_id = workdays.workday_id "
-    "WHERE workdays.date >= ? "
-    "AND workdays.date <= ? "
+    "WHERE workdays.day_number >= ? "
+    "AND workdays.day_number <= ? "
     "AND tasks.billable = 1 "
     "AND tasks.is_active = 1";
 
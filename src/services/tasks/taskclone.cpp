@@ -0,0 +1,57 @@
+// Productivity tool to help you track the time you spend on tasks
+// Copyright (C) 2026 Szymon Welgus
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+// Contact:
+//     szymonwelgus at gmail dot com
+
+
+#include "taskclone.h"
+
+namespace tks::Services
+{
+TaskCloneRequest::TaskCloneRequest()
+    : SourceFromDayNumber()
+    , SourceToDayNumber()
+    , TargetFromDayNumber()
+    , Mode(TaskCloneMode::Copy)
+    , DryRun(false)
+{
+}
+
+std::int32_t TaskCloneRequest::GetOffset() const
+{
+    return TargetFromDayNumber - SourceFromDayNumber;
+}
+
+TaskClonePreview::TaskClonePreview()
+    : SourceTaskId(-1)
+    , SourceDate()
+    , SourceDayNumber(0)
+    , Description()
+    , Hours(0)
+    , Minutes(0)
+    , AttributeValueCount(0)
+    , TargetDate()
+{
+}
+
+TaskCloneResult::TaskCloneResult()
+    : Tasks()
+    , TargetTaskIds()
+    , AttributeValueCount(0)
+{
+}
+} // namespace tks::Services
@@ -0,0 +1,83 @@
+// Productivity tool to help you track the time you spend on tasks
+// Copyright (C) 2026 Szymon Welgus
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+// Contact:
+//     szymonwelgus at gmail dot com
+
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "../../utils/daynumber.h"
+
+namespace tks::Services
+{
+enum class TaskCloneMode { Copy = 1, Move };
+
+/// <summary>
+/// Clone the active tasks of the source day range to the same days shifted to start at
+/// TargetFromDayNumber. A dry run only reports what would be cloned
+/// </summary>
+struct TaskCloneRequest {
+    TaskCloneRequest();
+
+    DayNumber SourceFromDayNumber;
+    DayNumber SourceToDayNumber;
+    DayNumber TargetFromDayNumber;
+    TaskCloneMode Mode;
+    bool DryRun;
+
+    std::int32_t GetOffset() const;
+};
+
+struct TaskClonePreview {
+    TaskClonePreview();
+
+    std::int64_t SourceTaskId;
+    std::string SourceDate;
+    int SourceDayNumber;
+    std::string Description;
+    int Hours;
+    int Minutes;
+    std::int64_t AttributeValueCount;
+    std::string TargetDate;
+};
+
+// columns in the order TaskCloneService::filterSourceTasks selects them, see
+// Persistence::ReadRow, TargetDate is derived from SourceDayNumber
+inline constexpr auto TaskClonePreviewColumns = std::make_tuple(&TaskClonePreview::SourceTaskId,
+    &TaskClonePreview::SourceDate,
+    &TaskClonePreview::SourceDayNumber,
+    &TaskClonePreview::Description,
+    &TaskClonePreview::Hours,
+    &TaskClonePreview::Minutes,
+    &TaskClonePreview::AttributeValueCount);
+
+struct TaskCloneResult {
+    TaskCloneResult();
+
+    // the source tasks, in task_id order
+    std::vector<TaskClonePreview> Tasks;
+    // ids of the cloned tasks, in the order of Tasks, empty on a dry run. A move keeps the
+    // source ids
+    std::vector<std::int64_t> TargetTaskIds;
+    std::int64_t AttributeValueCount;
+};
+} // namespace tks::Services
@@ -0,0 +1,503 @@
+// Productivity tool to help you track the time you spend on tasks
+// Copyright (C) 2026 Szymon Welgus
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+// Contact:
+//     szymonwelgus at gmail dot com
+
+
+#include "taskcloneservice.h"
+
+#include "../../common/logmessages.h"
+
+#include "../../common/messages/sqlitemessages.h"
+
+#include "../../persistence/base/changefeed.h"
+#include "../../persistence/base/rowmapper.h"
+
+namespace tks::Services
+{
+TaskCloneService::TaskCloneService(const std::shared_ptr<spdlog::logger> logger,
+    const std::string& databaseFilePath)
+    : PersistenceBase(logger, databaseFilePath)
+{
+}
+
+TaskCloneService::~TaskCloneService() {}
+
+SqliteResult TaskCloneService::CloneDateRange(const TaskCloneRequest& request,
+    TaskCloneResult& result) const
+{
+    result = TaskCloneResult();
+
+    if (request.SourceToDayNumber < request.SourceFromDayNumber) {
+        pLogger->error("Invalid clone source range \"{0}\" to \"{1}\"",
+            request.SourceFromDayNumber.ToString(),
+            request.SourceToDayNumber.ToString());
+        return SqliteResult::SoftFailed("The source range ends before it starts");
+    }
+
+    if (request.GetOffset() == 0) {
+        pLogger->error("Clone target \"{0}\" is the same as the source",
+            request.TargetFromDayNumber.ToString());
+        return SqliteResult::SoftFailed("The target range is the same as the source range");
+    }
+
+    if (request.DryRun) {
+        auto sqliteResult = FilterSourceTasks(request, result.Tasks);
+        for (const auto& task : result.Tasks) {
+            result.AttributeValueCount += task.AttributeValueCount;
+        }
+        return sqliteResult;
+    }
+
+    auto sqliteResult = Exec(TaskCloneService::createTaskCloneMap);
+    if (!sqliteResult.Success) {
+        return sqliteResult;
+    }
+
+    // the clone is published as one range change per affected range instead of a row change
+    // for every task written
+    auto& changeFeed = Persistence::ChangeFeed::GetInstance();
+
+    changeFeed.Suspend(pDb);
+    sqliteResult = CloneInTransaction(request, result);
+    changeFeed.Resume(pDb);
+
+    if (!sqliteResult.Success) {
+        return sqliteResult;
+    }
+
+    auto targetToDayNumber =
+        request.TargetFromDayNumber + (request.SourceToDayNumber - request.SourceFromDayNumber);
+    changeFeed.PublishRange("tasks", request.TargetFromDayNumber, targetToDayNumber);
+
+    if (request.Mode == TaskCloneMode::Move) {
+        changeFeed.PublishRange("tasks", request.SourceFromDayNumber, request.SourceToDayNumber);
+    }
+
+    SPDLOG_LOGGER_TRACE(pLogger,
+        "{0} \"{1}\" tasks and \"{2}\" attribute values from \"{3}\" - \"{4}\" to \"{5}\"",
+        request.Mode == TaskCloneMode::Copy ? "Copied" : "Moved",
+        result.TargetTaskIds.size(),
+        result.AttributeValueCount,
+        request.SourceFromDayNumber.ToString(),
+        request.SourceToDayNumber.ToString(),
+        request.TargetFromDayNumber.ToString());
+
+    return SqliteResult::OK();
+}
+
+SqliteResult TaskCloneService::CloneInTransaction(const TaskCloneRequest& request,
+    TaskCloneResult& result) const
+{
+    auto sqliteResult = Exec(TaskCloneService::beginTransaction);
+    if (!sqliteResult.Success) {
+        return sqliteResult;
+    }
+
+    sqliteResult = Clone(request, result);
+
+    if (!sqliteResult.Success) {
+        Exec(TaskCloneService::rollbackTransaction);
+
+        result.TargetTaskIds.clear();
+        result.AttributeValueCount = 0;
+        return sqliteResult;
+    }
+
+    sqliteResult = Exec(TaskCloneService::commitTransaction);
+    if (!sqliteResult.Success) {
+        Exec(TaskCloneService::rollbackTransaction);
+
+        result.TargetTaskIds.clear();
+        result.AttributeValueCount = 0;
+        return sqliteResult;
+    }
+
+    return SqliteResult::OK();
+}
+
+SqliteResult TaskCloneService::FilterSourceTasks(const TaskCloneRequest& request,
+    std::vector<TaskClonePreview>& tasks) const
+{
+    sqlite3_stmt* stmt = nullptr;
+
+    int rc = sqlite3_prepare_v2(pDb,
+        TaskCloneService::filterSourceTasks.data(),
+        static_cast<int>(TaskCloneService::filterSourceTasks.size()),
+        &stmt,
+        nullptr);
+
+    if (rc != SQLITE_OK) {
+        const char* error = sqlite3_errmsg(pDb);
+        pLogger->error(
+            LogMessages::PrepareStatementTemplate, TaskCloneService::filterSourceTasks, rc, error);
+
+        sqlite3_finalize(stmt);
+        return SqliteResult::FailDetailed(
+            Messages::PrepareStatementMessage, rc, std::string(error));
+    }
+
+    int bindIndex = 1;
+
+    // source from day_number
+    rc = sqlite3_bind_int(stmt, bindIndex, request.SourceFromDayNumber.Value);
+
+    if (rc != SQLITE_OK) {
+        const char* error = sqlite3_errmsg(pDb);
+        pLogger->error(LogMessages::BindParameterTemplate, "day_number", bindIndex, rc, error);
+
+        sqlite3_finalize(stmt);
+        return SqliteResult::FailDetailed(Messages::BindStatementMessage, rc, std::string(error));
+    }
+
+    bindIndex++;
+
+    // source to day_number
+    rc = sqlite3_bind_int(stmt, bindIndex, request.SourceToDayNumber.Value);
+
+    if (rc != SQLITE_OK) {
+        const char* error = sqlite3_errmsg(pDb);
+        pLogger->error(LogMessages::BindParameterTemplate, "day_number", bindIndex, rc, error);
+
+        sqlite3_finalize(stmt);
+        return SqliteResult::FailDetailed(Messages::BindStatementMessage, rc, std::string(error));
+    }
+
+    const std::int32_t offset = request.GetOffset();
+    rc = Persistence::ReadRows(
+        stmt, TaskClonePreviewColumns, tasks, [offset](TaskClonePreview& task, int) {
+            task.TargetDate = (DayNumber(task.SourceDayNumber) + offset).ToString();
+        });
+
+    if (rc != SQLITE_DONE) {
+        const char* error = sqlite3_errmsg(pDb);
+        pLogger->error(
+            LogMessages::ExecStepTemplate, TaskCloneService::filterSourceTasks, rc, error);
+
+        sqlite3_finalize(stmt);
+        return SqliteResult::FailDetailed(Messages::StepStatementMessage, rc, std::string(error));
+    }
+
+    sqlite3_finalize(stmt);
+
+    SPDLOG_LOGGER_TRACE(pLogger,
+        LogMessages::FilterEntities,
+        tasks.size(),
+        request.SourceFromDayNumber.ToString() + " - " + request.SourceToDayNumber.ToString());
+
+    return SqliteResult::OK();
+}
+
+SqliteResult TaskCloneService::Clone(const TaskCloneRequest& request,
+    TaskCloneResult& result) const
+{
+    // read inside the transaction so the preview matches what is cloned
+    auto sqliteResult = FilterSourceTasks(request, result.Tasks);
+    if (!sqliteResult.Success || result.Tasks.empty()) {
+        return sqliteResult;
+    }
+
+    int changes = 0;
+
+    sqliteResult = Exec(TaskCloneService::clearTaskCloneMap);
+    if (!sqliteResult.Success) {
+        return sqliteResult;
+    }
+
+    sqliteResult = Execute(TaskCloneService::createTargetWorkdays, request, changes);
+    if (!sqliteResult.Success) {
+        return sqliteResult;
+    }
+
+    if (request.Mode == TaskCloneMode::Copy) {
+        sqliteResult = Execute(TaskCloneService::mapCopiedTasks, request, changes);
+        if (sqliteResult.Success) {
+            sqliteResult = Execute(TaskCloneService::copyTasks, request, changes);
+        }
+        if (sqliteResult.Success) {
+            sqliteResult = Execute(TaskCloneService::copyTaskAttributeValues, request, changes);
+            result.AttributeValueCount = changes;
+        }
+    } else {
+        sqliteResult = Execute(TaskCloneService::mapMovedTasks, request, changes);
+        if (sqliteResult.Success) {
+            sqliteResult = Execute(TaskCloneService::moveTasks, request, changes);
+        }
+        // moved tasks keep their attribute values
+        for (const auto& task : result.Tasks) {
+            result.AttributeValueCount += task.AttributeValueCount;
+        }
+    }
+
+    if (!sqliteResult.Success) {
+        return sqliteResult;
+    }
+
+    sqlite3_stmt* stmt = nullptr;
+
+    int rc = sqlite3_prepare_v2(pDb,
+        TaskCloneService::filterTargetTaskIds.data(),
+        static_cast<int>(TaskCloneService::filterTargetTaskIds.size()),
+        &stmt,
+        nullptr);
+
+    if (rc != SQLITE_OK) {
+        const char* error = sqlite3_errmsg(pDb);
+        pLogger->error(LogMessages::PrepareStatementTemplate,
+            TaskCloneService::filterTargetTaskIds,
+            rc,
+            error);
+
+        sqlite3_finalize(stmt);
+        return SqliteResult::FailDetailed(
+            Messages::PrepareStatementMessage, rc, std::string(error));
+    }
+
+    result.TargetTaskIds.reserve(result.Tasks.size());
+    while ((rc = sqlite3_step(stmt)) == SQLITE_ROW) {
+        result.TargetTaskIds.push_back(sqlite3_column_int64(stmt, 0));
+    }
+
+    if (rc != SQLITE_DONE) {
+        const char* error = sqlite3_errmsg(pDb);
+        pLogger->error(
+            LogMessages::ExecStepTemplate, TaskCloneService::filterTargetTaskIds, rc, error);
+
+        sqlite3_finalize(stmt);
+        return SqliteResult::FailDetailed(Messages::StepStatementMessage, rc, std::string(error));
+    }
+
+    sqlite3_finalize(stmt);
+
+    return Exec(TaskCloneService::clearTaskCloneMap);
+}
+
+SqliteResult TaskCloneService::Execute(const std::string_view query,
+    const TaskCloneRequest& request,
+    int& changes) const
+{
+    sqlite3_stmt* stmt = nullptr;
+
+    int rc =
+        sqlite3_prepare_v2(pDb, query.data(), static_cast<int>(query.size()), &stmt, nullptr);
+
+    if (rc != SQLITE_OK) {
+        const char* error = sqlite3_errmsg(pDb);
+        pLogger->error(LogMessages::PrepareStatementTemplate, query, rc, error);
+
+        sqlite3_finalize(stmt);
+        return SqliteResult::FailDetailed(
+            Messages::PrepareStatementMessage, rc, std::string(error));
+    }
+
+    const int values[] = { request.GetOffset(),
+        request.SourceFromDayNumber.Value,
+        request.SourceToDayNumber.Value };
+    const int parameterCount = sqlite3_bind_parameter_count(stmt);
+
+    for (int bindIndex = 1; bindIndex <= parameterCount; bindIndex++) {
+        rc = sqlite3_bind_int(stmt, bindIndex, values[bindIndex - 1]);
+
+        if (rc != SQLITE_OK) {
+            const char* error = sqlite3_errmsg(pDb);
+            pLogger->error(LogMessages::BindParameterTemplate, "day_number", bindIndex, rc, error);
+
+            sqlite3_finalize(stmt);
+            return SqliteResult::FailDetailed(
+                Messages::BindStatementMessage, rc, std::string(error));
+        }
+    }
+
+    rc = sqlite3_step(stmt);
+
+    if (rc != SQLITE_DONE) {
+        const char* error = sqlite3_errmsg(pDb);
+        pLogger->error(LogMessages::ExecStepTemplate, query, rc, error);
+
+        sqlite3_finalize(stmt);
+        return SqliteResult::FailDetailed(Messages::StepStatementMessage, rc, std::string(error));
+    }
+
+    sqlite3_finalize(stmt);
+
+    changes = sqlite3_changes(pDb);
+
+    return SqliteResult::OK();
+}
+
+SqliteResult TaskCloneService::Exec(const std::string& query) const
+{
+    int rc = sqlite3_exec(pDb, query.c_str(), nullptr, nullptr, nullptr);
+
+    if (rc != SQLITE_OK) {
+        const char* error = sqlite3_errmsg(pDb);
+        pLogger->error(LogMessages::ExecQueryTemplate, query, rc, error);
+
+        return SqliteResult::FailDetailed(Messages::ExecMessage, rc, std::string(error));
+    }
+
+    return SqliteResult::OK();
+}
+
+constexpr std::string_view TaskCloneService::filterSourceTasks =
+    "SELECT "
+    "tasks.task_id, "
+    "workdays.date, "
+    "workdays.day_number, "
+    "tasks.description, "
+    "tasks.hours, "
+    "tasks.minutes, "
+    "(SELECT COUNT(*) FROM task_attribute_values "
+    "WHERE task_attribute_values.task_id = tasks.task_id "
+    "AND task_attribute_values.is_active = 1) "
+    "FROM tasks "
+    "INNER JOIN workdays "
+    "ON tasks.workday_id = workdays.workday_id "
+    "WHERE workdays.day_number BETWEEN ? AND ? "
+    "AND tasks.is_active = 1 "
+    "ORDER BY tasks.task_id";
+static_assert(Persistence::CountSelectColumns(TaskCloneService::filterSourceTasks) ==
+              Persistence::ColumnCount(TaskClonePreviewColumns));
+
+// ?1 is the offset in days and ?2 and ?3 the source day_number range, see Execute
+
+// date is derived from day_number the way the workdays day_number trigger derives the reverse
+constexpr std::string_view TaskCloneService::createTargetWorkdays =
+    "INSERT INTO workdays (date, day_number) "
+    "SELECT "
+    "date((workdays.day_number + ?1) * 86400, 'unixepoch'), "
+    "workdays.day_number + ?1 "
+    "FROM workdays "
+    "WHERE workdays.day_number BETWEEN ?2 AND ?3 "
+    "AND EXISTS (SELECT 1 FROM tasks "
+    "WHERE tasks.workday_id = workdays.workday_id "
+    "AND tasks.is_active = 1) "
+    "ON CONFLICT DO NOTHING";
+
+// copies get explicit ids past the current maximum so they can be paired with their source
+constexpr std::string_view TaskCloneService::mapCopiedTasks =
+    "INSERT INTO temp.task_clone_map (source_task_id, target_task_id) "
+    "SELECT "
+    "tasks.task_id, "
+    "(SELECT COALESCE(MAX(task_id), 0) FROM tasks) + ROW_NUMBER() OVER (ORDER BY tasks.task_id) "
+    "FROM tasks "
+    "INNER JOIN workdays "
+    "ON tasks.workday_id = workdays.workday_id "
+    "WHERE workdays.day_number BETWEEN ?2 AND ?3 "
+    "AND tasks.is_active = 1";
+
+constexpr std::string_view TaskCloneService::mapMovedTasks =
+    "INSERT INTO temp.task_clone_map (source_task_id, target_task_id) "
+    "SELECT "
+    "tasks.task_id, "
+    "tasks.task_id "
+    "FROM tasks "
+    "INNER JOIN workdays "
+    "ON tasks.workday_id = workdays.workday_id "
+    "WHERE workdays.day_number BETWEEN ?2 AND ?3 "
+    "AND tasks.is_active = 1";
+
+// a copy is not the meeting its source was logged against, so attended_meeting_id is dropped
+constexpr std::string_view TaskCloneService::copyTasks =
+    "INSERT INTO tasks "
+    "("
+    "task_id, "
+    "billable, "
+    "unique_identifier, "
+    "hours, "
+    "minutes, "
+    "description, "
+    "project_id, "
+    "category_id, "
+    "workday_id, "
+    "attribute_group_id, "
+    "attended_meeting_id"
+    ") "
+    "SELECT "
+    "task_clone_map.target_task_id, "
+    "tasks.billable, "
+    "tasks.unique_identifier, "
+    "tasks.hours, "
+    "tasks.minutes, "
+    "tasks.description, "
+    "tasks.project_id, "
+    "tasks.category_id, "
+    "target_workdays.workday_id, "
+    "tasks.attribute_group_id, "
+    "NULL "
+    "FROM temp.task_clone_map "
+    "INNER JOIN tasks "
+    "ON tasks.task_id = task_clone_map.source_task_id "
+    "INNER JOIN workdays AS source_workdays "
+    "ON source_workdays.workday_id = tasks.workday_id "
+    "INNER JOIN workdays AS target_workdays "
+    "ON target_workdays.day_number = source_workdays.day_number + ?1 "
+    "ORDER BY task_clone_map.target_task_id";
+
+constexpr std::string_view TaskCloneService::copyTaskAttributeValues =
+    "INSERT INTO task_attribute_values "
+    "("
+    "text_value, "
+    "boolean_value, "
+    "numeric_value, "
+    "task_id, "
+    "attribute_id"
+    ") "
+    "SELECT "
+    "task_attribute_values.text_value, "
+    "task_attribute_values.boolean_value, "
+    "task_attribute_values.numeric_value, "
+    "task_clone_map.target_task_id, "
+    "task_attribute_values.attribute_id "
+    "FROM task_attribute_values "
+    "INNER JOIN temp.task_clone_map "
+    "ON task_clone_map.source_task_id = task_attribute_values.task_id "
+    "WHERE task_attribute_values.is_active = 1 "
+    "ORDER BY task_attribute_values.task_attribute_value_id";
+
+constexpr std::string_view TaskCloneService::moveTasks =
+    "UPDATE tasks "
+    "SET "
+    "workday_id = ("
+    "SELECT target_workdays.workday_id "
+    "FROM workdays AS source_workdays "
+    "INNER JOIN workdays AS target_workdays "
+    "ON target_workdays.day_number = source_workdays.day_number + ?1 "
+    "WHERE source_workdays.workday_id = tasks.workday_id"
+    "), "
+    "date_modified = strftime('%s', 'now', 'localtime') "
+    "WHERE task_id IN (SELECT source_task_id FROM temp.task_clone_map)";
+
+constexpr std::string_view TaskCloneService::filterTargetTaskIds = "SELECT target_task_id "
+                                                                   "FROM temp.task_clone_map "
+                                                                   "ORDER BY source_task_id";
+
+const std::string TaskCloneService::createTaskCloneMap =
+    "CREATE TEMP TABLE IF NOT EXISTS task_clone_map "
+    "("
+    "source_task_id INTEGER PRIMARY KEY NOT NULL, "
+    "target_task_id INTEGER NOT NULL"
+    ")";
+
+const std::string TaskCloneService::clearTaskCloneMap = "DELETE FROM temp.task_clone_map";
+
+// IMMEDIATE takes the write lock up front, so the maximum task_id read by mapCopiedTasks cannot
+// be taken by another connection before copyTasks runs
+const std::string TaskCloneService::beginTransaction = "BEGIN IMMEDIATE TRANSACTION";
+const std::string TaskCloneService::commitTransaction = "COMMIT";
+const std::string TaskCloneService::rollbackTransaction = "ROLLBACK";
+} // namespace tks::Services
@@ -0,0 +1,81 @@
+// Productivity tool to help you track the time you spend on tasks
+// Copyright (C) 2026 Szymon Welgus
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+// Contact:
+//     szymonwelgus at gmail dot com
+
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include "../../common/results/sqliteresult.h"
+
+#include "../../persistence/base/persistencebase.h"
+
+#include "taskclone.h"
+
+namespace tks::Services
+{
+/// <summary>
+/// Copies or moves a day range of tasks and their attribute values with set based statements in
+/// one transaction, creating any missing target workdays on the way
+/// </summary>
+struct TaskCloneService final : public Persistence::PersistenceBase {
+    TaskCloneService() = delete;
+    TaskCloneService(const TaskCloneService&) = delete;
+    TaskCloneService(const std::shared_ptr<spdlog::logger> logger,
+        const std::string& databaseFilePath);
+    virtual ~TaskCloneService();
+
+    TaskCloneService& operator=(const TaskCloneService&) = delete;
+
+    SqliteResult CloneDateRange(const TaskCloneRequest& request,
+        /*out*/ TaskCloneResult& result) const;
+
+    SqliteResult FilterSourceTasks(const TaskCloneRequest& request,
+        /*out*/ std::vector<TaskClonePreview>& tasks) const;
+
+    static const std::string_view filterSourceTasks;
+    static const std::string_view createTargetWorkdays;
+    static const std::string_view mapCopiedTasks;
+    static const std::string_view mapMovedTasks;
+    static const std::string_view copyTasks;
+    static const std::string_view copyTaskAttributeValues;
+    static const std::string_view moveTasks;
+    static const std::string_view filterTargetTaskIds;
+
+    static const std::string createTaskCloneMap;
+    static const std::string clearTaskCloneMap;
+    static const std::string beginTransaction;
+    static const std::string commitTransaction;
+    static const std::string rollbackTransaction;
+
+private:
+    SqliteResult CloneInTransaction(const TaskCloneRequest& request,
+        /*out*/ TaskCloneResult& result) const;
+    SqliteResult Clone(const TaskCloneRequest& request, /*out*/ TaskCloneResult& result) const;
+
+    // prepares query and binds ?1 offset, ?2 source from and ?3 source to day numbers where the
+    // query uses them
+    SqliteResult Execute(const std::string_view query,
+        const TaskCloneRequest& request,
+        /*out*/ int& changes) const;
+    SqliteResult Exec(const std::string& query) const;
+};
+} // namespace tks::Services
@@ -0,0 +1,76 @@
+// Productivity tool to help you track the time you spend on tasks
+// Copyright (C) 2026 Szymon Welgus
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+// Contact:
+//     szymonwelgus at gmail dot com
+
+#include "taskcursor.h"
+
+#include <sstream>
+
+#include <fmt/format.h>
+
+namespace tks::Services
+{
+TaskCursor::TaskCursor()
+    : FromDayNumber()
+    , ToDayNumber()
+    , LastDayNumber()
+    , LastTaskId(-1)
+    , Exhausted(false)
+{
+}
+
+std::string TaskCursor::ToContinuationToken() const
+{
+    return fmt::format("{0}.{1}.{2}.{3}.{4}",
+        FromDayNumber.Value,
+        ToDayNumber.Value,
+        LastDayNumber.Value,
+        LastTaskId,
+        Exhausted ? 1 : 0);
+}
+
+bool TaskCursor::TryParseContinuationToken(const std::string& token, TaskCursor& cursor)
+{
+    std::istringstream ssToken{ token };
+
+    TaskCursor parsedCursor;
+    int exhausted = 0;
+    char separators[4] = {};
+    ssToken >> parsedCursor.FromDayNumber.Value >> separators[0] >>
+        parsedCursor.ToDayNumber.Value >> separators[1] >> parsedCursor.LastDayNumber.Value >>
+        separators[2] >> parsedCursor.LastTaskId >> separators[3] >> exhausted;
+
+    if (ssToken.fail() || !ssToken.eof()) {
+        return false;
+    }
+
+    for (const auto separator : separators) {
+        if (separator != '.') {
+            return false;
+        }
+    }
+
+    if (parsedCursor.ToDayNumber < parsedCursor.FromDayNumber) {
+        return false;
+    }
+
+    parsedCursor.Exhausted = exhausted != 0;
+    cursor = parsedCursor;
+    return true;
+}
+} // namespace tks::Services
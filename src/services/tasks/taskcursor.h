@@ -0,0 +1,48 @@
+// Productivity tool to help you track the time you spend on tasks
+// Copyright (C) 2026 Szymon Welgus
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+// Contact:
+//     szymonwelgus at gmail dot com
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "../../utils/daynumber.h"
+
+namespace tks::Services
+{
+/// <summary>
+/// Position of a keyset paginated read over the tasks of a date range, ordered by
+/// (workdays.day_number, tasks.task_id). The position is the key of the last row returned
+/// </summary>
+struct TaskCursor {
+    TaskCursor();
+
+    static constexpr std::size_t DefaultPageSize = 500;
+
+    DayNumber FromDayNumber;
+    DayNumber ToDayNumber;
+    DayNumber LastDayNumber;
+    std::int64_t LastTaskId;
+    bool Exhausted;
+
+    std::string ToContinuationToken() const;
+    static bool TryParseContinuationToken(const std::string& token, /*out*/ TaskCursor& cursor);
+};
+} // namespace tks::Services
@@ -0,0 +1,84 @@
+// Productivity tool to help you track the time you spend on tasks
+// Copyright (C) 2026 Szymon Welgus
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+// Contact:
+//     szymonwelgus at gmail dot com
+
+#include "taskdimensions.h"
+
+namespace tks::Services
+{
+const std::string TaskDimensions::Empty = "";
+
+ProjectDimension::ProjectDimension()
+    : Name()
+    , DisplayName()
+    , EmployerId(-1)
+    , ClientId(-1)
+{
+}
+
+TaskDimensions::TaskDimensions()
+    : Employers()
+    , Clients()
+    , Projects()
+    , Categories()
+    , Workdays()
+{
+}
+
+const std::string& TaskDimensions::GetEmployerName(const std::int64_t projectId) const
+{
+    auto it = Projects.find(projectId);
+    return it == Projects.end() ? Empty : Find(Employers, it->second.EmployerId);
+}
+
+const std::string& TaskDimensions::GetClientName(const std::int64_t projectId) const
+{
+    auto it = Projects.find(projectId);
+    return it == Projects.end() ? Empty : Find(Clients, it->second.ClientId);
+}
+
+const std::string& TaskDimensions::GetProjectName(const std::int64_t projectId) const
+{
+    auto it = Projects.find(projectId);
+    return it == Projects.end() ? Empty : it->second.Name;
+}
+
+const std::string& TaskDimensions::GetProjectDisplayName(const std::int64_t projectId) const
+{
+    auto it = Projects.find(projectId);
+    return it == Projects.end() ? Empty : it->second.DisplayName;
+}
+
+const std::string& TaskDimensions::GetCategoryName(const std::int64_t categoryId) const
+{
+    return Find(Categories, categoryId);
+}
+
+const std::string& TaskDimensions::GetWorkdayDate(const std::int64_t workdayId) const
+{
+    return Find(Workdays, workdayId);
+}
+
+const std::string& TaskDimensions::Find(
+    const std::unordered_map<std::int64_t, std::string>& names,
+    const std::int64_t id)
+{
+    auto it = names.find(id);
+    return it == names.end() ? Empty : it->second;
+}
+} // namespace tks::Services
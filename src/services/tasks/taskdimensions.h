@@ -0,0 +1,63 @@
+// Productivity tool to help you track the time you spend on tasks
+// Copyright (C) 2026 Szymon Welgus
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+// Contact:
+//     szymonwelgus at gmail dot com
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+namespace tks::Services
+{
+struct ProjectDimension {
+    ProjectDimension();
+
+    std::string Name;
+    std::string DisplayName;
+    std::int64_t EmployerId;
+    std::int64_t ClientId;
+};
+
+/// <summary>
+/// Names of the employers, clients, projects, categories and dates referenced by a set of tasks
+/// filled once per query and shared by all of its TaskViewModel rows
+/// </summary>
+struct TaskDimensions {
+    TaskDimensions();
+
+    std::unordered_map<std::int64_t, std::string> Employers;
+    std::unordered_map<std::int64_t, std::string> Clients;
+    std::unordered_map<std::int64_t, ProjectDimension> Projects;
+    std::unordered_map<std::int64_t, std::string> Categories;
+    std::unordered_map<std::int64_t, std::string> Workdays;
+
+    const std::string& GetEmployerName(const std::int64_t projectId) const;
+    const std::string& GetClientName(const std::int64_t projectId) const;
+    const std::string& GetProjectName(const std::int64_t projectId) const;
+    const std::string& GetProjectDisplayName(const std::int64_t projectId) const;
+    const std::string& GetCategoryName(const std::int64_t categoryId) const;
+    const std::string& GetWorkdayDate(const std::int64_t workdayId) const;
+
+private:
+    static const std::string& Find(const std::unordered_map<std::int64_t, std::string>& names,
+        const std::int64_t id);
+
+    static const std::string Empty;
+};
+} // namespace tks::Services
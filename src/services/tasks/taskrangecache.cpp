@@ -0,0 +1,230 @@
+// Productivity tool to help you track the time you spend on tasks
+// Copyright (C) 2026 Szymon Welgus
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+// Contact:
+//     szymonwelgus at gmail dot com
+
+#include "taskrangecache.h"
+
+#include <iterator>
+
+#include "../../persistence/base/entityversions.h"
+
+namespace tks::Services
+{
+TaskRangeCache::TaskRangeCache()
+    : mTasksByDayNumber()
+    , mDayNumbersByTaskId()
+    , mGeneration(0)
+    , mReferenceVersion(ReadReferenceVersion())
+{
+}
+
+std::uint64_t TaskRangeCache::GetGeneration()
+{
+    ClearIfReferencesChanged();
+    return mGeneration;
+}
+
+bool TaskRangeCache::TryGet(const std::vector<std::string>& dates,
+    std::map<std::string, std::vector<TaskViewModel>>& taskViewModels) const
+{
+    if (!IsCurrent() || !Contains(dates)) {
+        return false;
+    }
+
+    for (const auto& date : dates) {
+        DayNumber dayNumber;
+        DayNumber::TryParse(date, dayNumber);
+        taskViewModels[date] = mTasksByDayNumber.at(dayNumber);
+    }
+
+    return true;
+}
+
+bool TaskRangeCache::Contains(const std::vector<std::string>& dates) const
+{
+    if (!IsCurrent()) {
+        return false;
+    }
+
+    for (const auto& date : dates) {
+        DayNumber dayNumber;
+        if (!DayNumber::TryParse(date, dayNumber) ||
+            mTasksByDayNumber.find(dayNumber) == mTasksByDayNumber.end()) {
+            return false;
+        }
+    }
+
+    return !dates.empty();
+}
+
+bool TaskRangeCache::TryCalculateDuration(const std::string& fromDate,
+    const std::string& toDate,
+    TaskDurationType type,
+    int& totalMinutes) const
+{
+    if (!IsCurrent()) {
+        return false;
+    }
+
+    DayNumber fromDayNumber;
+    DayNumber toDayNumber;
+    if (!DayNumber::TryParse(fromDate, fromDayNumber) ||
+        !DayNumber::TryParse(toDate, toDayNumber) || toDayNumber < fromDayNumber) {
+        return false;
+    }
+
+    // every date of the range must be cached, a missing bucket is not the same as an empty day
+    auto first = mTasksByDayNumber.lower_bound(fromDayNumber);
+    auto last = mTasksByDayNumber.upper_bound(toDayNumber);
+    if (std::distance(first, last) != (toDayNumber - fromDayNumber) + 1) {
+        return false;
+    }
+
+    totalMinutes = 0;
+    for (auto it = first; it != last; ++it) {
+        for (const auto& taskViewModel : it->second) {
+            if (type == TaskDurationType::Billable && !taskViewModel.Billable) {
+                continue;
+            }
+
+            totalMinutes += taskViewModel.Hours * 60 + taskViewModel.Minutes;
+        }
+    }
+
+    return true;
+}
+
+bool TaskRangeCache::Store(const std::map<std::string, std::vector<TaskViewModel>>& taskViewModels,
+    std::uint64_t generation)
+{
+    ClearIfReferencesChanged();
+    if (generation != mGeneration) {
+        return false;
+    }
+
+    for (const auto& [date, tasks] : taskViewModels) {
+        DayNumber dayNumber;
+        if (!DayNumber::TryParse(date, dayNumber)) {
+            continue;
+        }
+
+        auto iterator = mTasksByDayNumber.find(dayNumber);
+        if (iterator != mTasksByDayNumber.end()) {
+            Erase(iterator, std::next(iterator));
+        }
+
+        mTasksByDayNumber[dayNumber] = tasks;
+        for (const auto& taskViewModel : tasks) {
+            mDayNumbersByTaskId[taskViewModel.TaskId] = dayNumber;
+        }
+    }
+
+    return true;
+}
+
+void TaskRangeCache::Retain(DayNumber fromDayNumber, DayNumber toDayNumber)
+{
+    Erase(mTasksByDayNumber.begin(), mTasksByDayNumber.lower_bound(fromDayNumber));
+    Erase(mTasksByDayNumber.upper_bound(toDayNumber), mTasksByDayNumber.end());
+}
+
+void TaskRangeCache::Invalidate(const std::string& date)
+{
+    mGeneration++;
+
+    DayNumber dayNumber;
+    if (DayNumber::TryParse(date, dayNumber)) {
+        auto iterator = mTasksByDayNumber.find(dayNumber);
+        if (iterator != mTasksByDayNumber.end()) {
+            Erase(iterator, std::next(iterator));
+        }
+    }
+}
+
+void TaskRangeCache::Invalidate(DayNumber fromDayNumber, DayNumber toDayNumber)
+{
+    mGeneration++;
+
+    if (toDayNumber < fromDayNumber) {
+        return;
+    }
+
+    Erase(mTasksByDayNumber.lower_bound(fromDayNumber), mTasksByDayNumber.upper_bound(toDayNumber));
+}
+
+void TaskRangeCache::InvalidateTask(const std::int64_t taskId)
+{
+    mGeneration++;
+
+    auto taskIterator = mDayNumbersByTaskId.find(taskId);
+    if (taskIterator == mDayNumbersByTaskId.end()) {
+        return;
+    }
+
+    auto iterator = mTasksByDayNumber.find(taskIterator->second);
+    if (iterator != mTasksByDayNumber.end()) {
+        Erase(iterator, std::next(iterator));
+    }
+}
+
+void TaskRangeCache::Clear()
+{
+    mGeneration++;
+    mReferenceVersion = ReadReferenceVersion();
+    mTasksByDayNumber.clear();
+    mDayNumbersByTaskId.clear();
+}
+
+std::uint64_t TaskRangeCache::ReadReferenceVersion()
+{
+    // the counters only ever grow, so their sum moves whenever any one of them does
+    auto& entityVersions = Persistence::EntityVersions::GetInstance();
+    return entityVersions.Get(Persistence::VersionedEntity::Employers) +
+           entityVersions.Get(Persistence::VersionedEntity::Clients) +
+           entityVersions.Get(Persistence::VersionedEntity::Projects) +
+           entityVersions.Get(Persistence::VersionedEntity::Categories);
+}
+
+bool TaskRangeCache::IsCurrent() const
+{
+    return mReferenceVersion == ReadReferenceVersion();
+}
+
+void TaskRangeCache::ClearIfReferencesChanged()
+{
+    if (!IsCurrent()) {
+        Clear();
+    }
+}
+
+void TaskRangeCache::Erase(std::map<DayNumber, std::vector<TaskViewModel>>::iterator first,
+    std::map<DayNumber, std::vector<TaskViewModel>>::iterator last)
+{
+    for (auto it = first; it != last; ++it) {
+        for (const auto& taskViewModel : it->second) {
+            // a task moved between cached days is indexed under the day it moved to
+            auto taskIterator = mDayNumbersByTaskId.find(taskViewModel.TaskId);
+            if (taskIterator != mDayNumbersByTaskId.end() && taskIterator->second == it->first) {
+                mDayNumbersByTaskId.erase(taskIterator);
+            }
+        }
+    }
+
+    mTasksByDayNumber.erase(first, last);
+}
+} // namespace tks::Services
@@ -0,0 +1,82 @@
+// Productivity tool to help you track the time you spend on tasks
+// Copyright (C) 2026 Szymon Welgus
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+// Contact:
+//     szymonwelgus at gmail dot com
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "../../common/enums.h"
+
+#include "../../utils/daynumber.h"
+
+#include "taskviewmodel.h"
+
+namespace tks::Services
+{
+/// <summary>
+/// Per date task buckets for the shown range and its neighbours, owned by the UI thread.
+/// The buckets carry employer, client, project and category names, so a write to any of those
+/// tables drops them all
+/// </summary>
+class TaskRangeCache final
+{
+public:
+    TaskRangeCache();
+    ~TaskRangeCache() = default;
+
+    std::uint64_t GetGeneration();
+
+    bool TryGet(const std::vector<std::string>& dates,
+        /*out*/ std::map<std::string, std::vector<TaskViewModel>>& taskViewModels) const;
+    bool Contains(const std::vector<std::string>& dates) const;
+    bool TryCalculateDuration(const std::string& fromDate,
+        const std::string& toDate,
+        TaskDurationType type,
+        /*out*/ int& totalMinutes) const;
+
+    /// <summary>
+    /// Store fetched buckets unless an invalidation happened since the fetch was issued
+    /// </summary>
+    bool Store(const std::map<std::string, std::vector<TaskViewModel>>& taskViewModels,
+        std::uint64_t generation);
+
+    void Retain(DayNumber fromDayNumber, DayNumber toDayNumber);
+    void Invalidate(const std::string& date);
+    void Invalidate(DayNumber fromDayNumber, DayNumber toDayNumber);
+    void InvalidateTask(const std::int64_t taskId);
+    void Clear();
+
+private:
+    static std::uint64_t ReadReferenceVersion();
+
+    bool IsCurrent() const;
+    void ClearIfReferencesChanged();
+    void Erase(std::map<DayNumber, std::vector<TaskViewModel>>::iterator first,
+        std::map<DayNumber, std::vector<TaskViewModel>>::iterator last);
+
+    std::map<DayNumber, std::vector<TaskViewModel>> mTasksByDayNumber;
+    std::unordered_map<std::int64_t, DayNumber> mDayNumbersByTaskId;
+    std::uint64_t mGeneration;
+    std::uint64_t mReferenceVersion;
+};
+} // namespace tks::Services
@@ -0,0 +1,72 @@
+// Productivity tool to help you track the time you spend on tasks
+// Copyright (C) 2026 Szymon Welgus
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+// Contact:
+//     szymonwelgus at gmail dot com
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+
+#include "../../utils/daynumber.h"
+
+#include "taskviewmodel.h"
+
+namespace tks::Services
+{
+/// <summary>
+/// Full text search of task descriptions and unique identifiers, optionally narrowed to a
+/// date range and project
+/// </summary>
+struct TaskSearchQuery {
+    TaskSearchQuery();
+
+    std::string Term;
+    std::optional<DayNumber> FromDayNumber;
+    std::optional<DayNumber> ToDayNumber;
+    std::optional<std::int64_t> ProjectId;
+};
+
+struct TaskSearchResult {
+    TaskSearchResult();
+
+    TaskViewModel Task;
+    // matched text with the hits wrapped in SnippetMatchStart/SnippetMatchEnd
+    std::string Snippet;
+    // bm25 score, lower is more relevant
+    double Rank;
+
+    static constexpr const char* SnippetMatchStart = "[";
+    static constexpr const char* SnippetMatchEnd = "]";
+};
+
+/// <summary>
+/// Position of a keyset paginated read over search results, ordered by (rank, tasks.task_id).
+/// The position is the key of the last result returned
+/// </summary>
+struct TaskSearchCursor {
+    TaskSearchCursor();
+
+    static constexpr std::size_t DefaultPageSize = 50;
+
+    double LastRank;
+    std::int64_t LastTaskId;
+    bool Exhausted;
+};
+} // namespace tks::Services
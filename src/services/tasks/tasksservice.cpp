@@ -19,8 +19,14 @@
 
 #include "tasksservice.h"
 
+#include <algorithm>
+#include <limits>
+
 #include "../../common/logmessages.h"
 
+#include "../../persistence/base/idset.h"
+#include "../../persistence/base/rowmapper.h"
+
 #include "../../common/messages/sqlitemessages.h"
 
 #include "../../utils/utils.h"
@@ -38,14 +44,42 @@ TasksService::~TasksService() {}
 SqliteResult TasksService::FilterByDateRange(std::vector<std::string> dates,
     std::map<std::string, std::vector<TaskViewModel>>& taskViewModels)
 {
+    if (dates.empty()) {
+        return SqliteResult::OK();
+    }
+
+    std::vector<DayNumber> dayNumbers;
     for (const auto& date : dates) {
-        std::vector<TaskViewModel> tasks;
-        auto sqliteResult = FilterByDate(date, tasks);
-        if (!sqliteResult.Success) {
-            return sqliteResult;
+        DayNumber dayNumber;
+        if (!DayNumber::TryParse(date, dayNumber)) {
+            return InvalidDate(date);
         }
+        dayNumbers.push_back(dayNumber);
+    }
+
+    // one dictionary and one range scan cover every date, rows are bucketed by their workday
+    auto dimensions = std::make_shared<TaskDimensions>();
+    auto [fromDayNumber, toDayNumber] = std::minmax_element(dayNumbers.begin(), dayNumbers.end());
+    auto sqliteResult = FilterDimensions(*fromDayNumber, *toDayNumber, *dimensions);
+    if (!sqliteResult.Success) {
+        return sqliteResult;
+    }
+
+    std::vector<TaskViewModel> tasks;
+    sqliteResult = FilterByDayNumberRange(*fromDayNumber, *toDayNumber, dimensions, tasks);
+    if (!sqliteResult.Success) {
+        return sqliteResult;
+    }
+
+    for (const auto& date : dates) {
+        taskViewModels[date];
+    }
 
-        taskViewModels[date] = tasks;
+    for (auto& task : tasks) {
+        auto iterator = taskViewModels.find(task.GetWorkdayDate());
+        if (iterator != taskViewModels.end()) {
+            iterator->second.push_back(std::move(task));
+        }
     }
 
     auto datesAsCsvFmt = Utils::ConvertListStringToCommaDelimitedString(dates);
@@ -56,133 +90,261 @@ SqliteResult TasksService::FilterByDateRange(std::vector<std::string> dates,
 
 SqliteResult TasksService::FilterByDate(const std::string& date,
     std::vector<TaskViewModel>& taskViewModels) const
+{
+    DayNumber dayNumber;
+    if (!DayNumber::TryParse(date, dayNumber)) {
+        return InvalidDate(date);
+    }
+
+    auto dimensions = std::make_shared<TaskDimensions>();
+    auto sqliteResult = FilterDimensions(dayNumber, dayNumber, *dimensions);
+    if (!sqliteResult.Success) {
+        return sqliteResult;
+    }
+
+    return FilterByDayNumberRange(dayNumber, dayNumber, dimensions, taskViewModels);
+}
+
+SqliteResult TasksService::FilterByDayNumberRange(DayNumber fromDayNumber,
+    DayNumber toDayNumber,
+    std::shared_ptr<const TaskDimensions> dimensions,
+    std::vector<TaskViewModel>& taskViewModels) const
 {
     sqlite3_stmt* stmt = nullptr;
 
-    int rc = sqlite3_prepare_v2(pDb,
-        TasksService::filterByDate.c_str(),
-        static_cast<int>(TasksService::filterByDate.size()),
-        &stmt,
-        nullptr);
+    auto sqliteResult = PrepareDayNumberRangeStatement(
+        TasksService::filterByDayNumberRange, fromDayNumber, toDayNumber, &stmt);
+    if (!sqliteResult.Success) {
+        return sqliteResult;
+    }
 
-    if (rc != SQLITE_OK) {
+    int rc = Persistence::ReadRows(stmt,
+        TaskViewModelColumns,
+        taskViewModels,
+        [&](TaskViewModel& model, int) { model.Dimensions = dimensions; });
+
+    if (rc != SQLITE_DONE) {
         const char* error = sqlite3_errmsg(pDb);
         pLogger->error(
-            LogMessages::PrepareStatementTemplate, TasksService::filterByDate, rc, error);
+            LogMessages::ExecStepTemplate, TasksService::filterByDayNumberRange, rc, error);
 
         sqlite3_finalize(stmt);
-        return SqliteResult::FailDetailed(
-            Messages::PrepareStatementMessage, rc, std::string(error));
+        return SqliteResult::FailDetailed(Messages::StepStatementMessage, rc, std::string(error));
     }
 
-    rc = sqlite3_bind_text(stmt, 1, date.c_str(), static_cast<int>(date.size()), SQLITE_TRANSIENT);
+    sqlite3_finalize(stmt);
+    SPDLOG_LOGGER_TRACE(pLogger,
+        LogMessages::FilterEntities,
+        taskViewModels.size(),
+        fmt::format("{0} - {1}", fromDayNumber.ToString(), toDayNumber.ToString()));
 
-    if (rc != SQLITE_OK) {
-        const char* error = sqlite3_errmsg(pDb);
-        pLogger->error(LogMessages::BindParameterTemplate, "date", 1, rc, error);
+    return SqliteResult::OK();
+}
 
-        sqlite3_finalize(stmt);
-        return SqliteResult::FailDetailed(Messages::BindStatementMessage, rc, std::string(error));
+SqliteResult TasksService::FilterDimensions(DayNumber fromDayNumber,
+    DayNumber toDayNumber,
+    TaskDimensions& dimensions) const
+{
+    sqlite3_stmt* stmt = nullptr;
+
+    // projects along with the employers and clients they belong to
+    auto sqliteResult = PrepareDayNumberRangeStatement(
+        TasksService::filterProjectDimensions, fromDayNumber, toDayNumber, &stmt);
+    if (!sqliteResult.Success) {
+        return sqliteResult;
     }
 
+    int rc = SQLITE_OK;
     bool done = false;
     while (!done) {
-        switch (sqlite3_step(stmt)) {
+        switch (rc = sqlite3_step(stmt)) {
         case SQLITE_ROW: {
-            rc = SQLITE_ROW;
-
-            TaskViewModel model;
-
             int columnIndex = 0;
 
-            model.TaskId = sqlite3_column_int64(stmt, columnIndex++);
-
-            model.Billable = !!sqlite3_column_int(stmt, columnIndex++);
-
-            if (sqlite3_column_type(stmt, columnIndex) == SQLITE_NULL) {
-                model.UniqueIdentifier = std::nullopt;
-            } else {
-                const unsigned char* res = sqlite3_column_text(stmt, columnIndex);
-                model.UniqueIdentifier = std::make_optional(std::string(
-                    reinterpret_cast<const char*>(res), sqlite3_column_bytes(stmt, columnIndex)));
-            }
-            columnIndex++;
-
-            model.Hours = sqlite3_column_int(stmt, columnIndex++);
-            model.Minutes = sqlite3_column_int(stmt, columnIndex++);
+            ProjectDimension project;
+            auto projectId = sqlite3_column_int64(stmt, columnIndex++);
 
             const unsigned char* res = sqlite3_column_text(stmt, columnIndex);
-            model.Description = std::string(
+            project.Name = std::string(
                 reinterpret_cast<const char*>(res), sqlite3_column_bytes(stmt, columnIndex++));
 
-            model.DateCreated = sqlite3_column_int(stmt, columnIndex++);
-            model.DateModified = sqlite3_column_int(stmt, columnIndex++);
-            model.IsActive = !!sqlite3_column_int(stmt, columnIndex++);
-
-            model.ProjectId = sqlite3_column_int64(stmt, columnIndex++);
-            model.CategoryId = sqlite3_column_int64(stmt, columnIndex++);
-            model.WorkdayId = sqlite3_column_int64(stmt, columnIndex++);
-
             res = sqlite3_column_text(stmt, columnIndex);
-            model.WorkdayDate = std::string(
+            project.DisplayName = std::string(
                 reinterpret_cast<const char*>(res), sqlite3_column_bytes(stmt, columnIndex++));
 
-            res = sqlite3_column_text(stmt, columnIndex);
-            model.ProjectName = std::string(
-                reinterpret_cast<const char*>(res), sqlite3_column_bytes(stmt, columnIndex++));
+            project.EmployerId = sqlite3_column_int64(stmt, columnIndex++);
 
             res = sqlite3_column_text(stmt, columnIndex);
-            model.ProjectDisplayName = std::string(
+            dimensions.Employers[project.EmployerId] = std::string(
                 reinterpret_cast<const char*>(res), sqlite3_column_bytes(stmt, columnIndex++));
 
-            res = sqlite3_column_text(stmt, columnIndex);
-            model.CategoryName = std::string(
-                reinterpret_cast<const char*>(res), sqlite3_column_bytes(stmt, columnIndex++));
+            if (sqlite3_column_type(stmt, columnIndex) != SQLITE_NULL) {
+                project.ClientId = sqlite3_column_int64(stmt, columnIndex++);
 
-            if (sqlite3_column_type(stmt, columnIndex) == SQLITE_NULL) {
-                model.ClientName = "";
-            } else {
                 res = sqlite3_column_text(stmt, columnIndex);
-                model.ClientName = std::string(
+                dimensions.Clients[project.ClientId] = std::string(
                     reinterpret_cast<const char*>(res), sqlite3_column_bytes(stmt, columnIndex++));
             }
 
-            res = sqlite3_column_text(stmt, columnIndex);
-            model.EmployerName = std::string(
-                reinterpret_cast<const char*>(res), sqlite3_column_bytes(stmt, columnIndex++));
-
-            taskViewModels.push_back(model);
+            dimensions.Projects[projectId] = std::move(project);
             break;
         }
         case SQLITE_DONE:
-            rc = SQLITE_DONE;
-            done = true;
-            break;
         default:
+            done = true;
             break;
         }
     }
 
     if (rc != SQLITE_DONE) {
         const char* error = sqlite3_errmsg(pDb);
-        pLogger->error(LogMessages::ExecStepTemplate, TasksService::filterByDate, rc, error);
+        pLogger->error(
+            LogMessages::ExecStepTemplate, TasksService::filterProjectDimensions, rc, error);
 
         sqlite3_finalize(stmt);
-        return SqliteResult::FailDetailed(Messages::BindStatementMessage, rc, std::string(error));
+        return SqliteResult::FailDetailed(Messages::StepStatementMessage, rc, std::string(error));
     }
 
     sqlite3_finalize(stmt);
-    SPDLOG_LOGGER_TRACE(pLogger, LogMessages::FilterEntities, taskViewModels.size(), date);
+
+    // categories and workdays are plain id to name lookups
+    for (const auto& [query, names] :
+        { std::make_pair(&TasksService::filterCategoryDimensions, &dimensions.Categories),
+            std::make_pair(&TasksService::filterWorkdayDimensions, &dimensions.Workdays) }) {
+        sqliteResult = PrepareDayNumberRangeStatement(*query, fromDayNumber, toDayNumber, &stmt);
+        if (!sqliteResult.Success) {
+            return sqliteResult;
+        }
+
+        done = false;
+        while (!done) {
+            switch (rc = sqlite3_step(stmt)) {
+            case SQLITE_ROW: {
+                int columnIndex = 0;
+
+                auto id = sqlite3_column_int64(stmt, columnIndex++);
+
+                const unsigned char* res = sqlite3_column_text(stmt, columnIndex);
+                (*names)[id] = std::string(
+                    reinterpret_cast<const char*>(res), sqlite3_column_bytes(stmt, columnIndex++));
+                break;
+            }
+            case SQLITE_DONE:
+            default:
+                done = true;
+                break;
+            }
+        }
+
+        if (rc != SQLITE_DONE) {
+            const char* error = sqlite3_errmsg(pDb);
+            pLogger->error(LogMessages::ExecStepTemplate, *query, rc, error);
+
+            sqlite3_finalize(stmt);
+            return SqliteResult::FailDetailed(
+                Messages::StepStatementMessage, rc, std::string(error));
+        }
+
+        sqlite3_finalize(stmt);
+    }
+
+    SPDLOG_LOGGER_TRACE(pLogger,
+        LogMessages::FilterEntities,
+        dimensions.Projects.size() + dimensions.Categories.size() + dimensions.Workdays.size(),
+        fmt::format("{0} - {1}", fromDayNumber.ToString(), toDayNumber.ToString()));
+
+    return SqliteResult::OK();
+}
+
+SqliteResult TasksService::PrepareDayNumberRangeStatement(std::string_view query,
+    DayNumber fromDayNumber,
+    DayNumber toDayNumber,
+    sqlite3_stmt** stmt) const
+{
+    int rc = sqlite3_prepare_v2(pDb, query.data(), static_cast<int>(query.size()), stmt, nullptr);
+
+    if (rc != SQLITE_OK) {
+        const char* error = sqlite3_errmsg(pDb);
+        pLogger->error(LogMessages::PrepareStatementTemplate, query, rc, error);
+
+        sqlite3_finalize(*stmt);
+        return SqliteResult::FailDetailed(
+            Messages::PrepareStatementMessage, rc, std::string(error));
+    }
+
+    int bindIndex = 1;
+
+    for (const auto& dayNumber : { fromDayNumber, toDayNumber }) {
+        rc = sqlite3_bind_int(*stmt, bindIndex, dayNumber.Value);
+
+        if (rc != SQLITE_OK) {
+            const char* error = sqlite3_errmsg(pDb);
+            pLogger->error(LogMessages::BindParameterTemplate, "day_number", bindIndex, rc, error);
+
+            sqlite3_finalize(*stmt);
+            return SqliteResult::FailDetailed(
+                Messages::BindStatementMessage, rc, std::string(error));
+        }
+
+        bindIndex++;
+    }
 
     return SqliteResult::OK();
 }
 
+SqliteResult TasksService::InvalidDate(const std::string& date) const
+{
+    pLogger->error("Invalid date \"{0}\", expected format \"%F\"", date);
+
+    return SqliteResult::FailDetailed(Messages::BindStatementMessage, SQLITE_MISMATCH, date);
+}
+
+void TasksService::ReadDimensions(sqlite3_stmt* stmt,
+    int columnIndex,
+    const TaskViewModel& taskViewModel,
+    TaskDimensions& dimensions) const
+{
+    const unsigned char* res = sqlite3_column_text(stmt, columnIndex);
+    dimensions.Workdays[taskViewModel.WorkdayId] =
+        std::string(reinterpret_cast<const char*>(res), sqlite3_column_bytes(stmt, columnIndex++));
+
+    ProjectDimension project;
+
+    res = sqlite3_column_text(stmt, columnIndex);
+    project.Name =
+        std::string(reinterpret_cast<const char*>(res), sqlite3_column_bytes(stmt, columnIndex++));
+
+    res = sqlite3_column_text(stmt, columnIndex);
+    project.DisplayName =
+        std::string(reinterpret_cast<const char*>(res), sqlite3_column_bytes(stmt, columnIndex++));
+
+    res = sqlite3_column_text(stmt, columnIndex);
+    dimensions.Categories[taskViewModel.CategoryId] =
+        std::string(reinterpret_cast<const char*>(res), sqlite3_column_bytes(stmt, columnIndex++));
+
+    project.EmployerId = sqlite3_column_int64(stmt, columnIndex++);
+
+    res = sqlite3_column_text(stmt, columnIndex);
+    dimensions.Employers[project.EmployerId] =
+        std::string(reinterpret_cast<const char*>(res), sqlite3_column_bytes(stmt, columnIndex++));
+
+    if (sqlite3_column_type(stmt, columnIndex) != SQLITE_NULL) {
+        project.ClientId = sqlite3_column_int64(stmt, columnIndex++);
+
+        res = sqlite3_column_text(stmt, columnIndex);
+        dimensions.Clients[project.ClientId] = std::string(
+            reinterpret_cast<const char*>(res), sqlite3_column_bytes(stmt, columnIndex++));
+    }
+
+    dimensions.Projects[taskViewModel.ProjectId] = std::move(project);
+}
+
 SqliteResult TasksService::GetById(const std::int64_t taskId, TaskViewModel& taskModel) const
 {
     sqlite3_stmt* stmt = nullptr;
 
     int rc = sqlite3_prepare_v2(pDb,
-        TasksService::getById.c_str(),
+        TasksService::getById.data(),
         static_cast<int>(TasksService::getById.size()),
         &stmt,
         nullptr);
@@ -216,143 +378,740 @@ SqliteResult TasksService::GetById(const std::int64_t taskId, TaskViewModel& tas
         return SqliteResult::FailDetailed(Messages::StepStatementMessage, rc, std::string(error));
     }
 
-    int columnIndex = 0;
+    int columnIndex = Persistence::ReadRow(stmt, TaskViewModelColumns, taskModel);
+
+    // a single row gets a dictionary of its own
+    auto dimensions = std::make_shared<TaskDimensions>();
+    ReadDimensions(stmt, columnIndex, taskModel, *dimensions);
+    taskModel.Dimensions = dimensions;
 
-    taskModel.TaskId = sqlite3_column_int64(stmt, columnIndex++);
+    rc = sqlite3_step(stmt);
 
-    taskModel.Billable = !!sqlite3_column_int(stmt, columnIndex++);
-    if (sqlite3_column_type(stmt, columnIndex) == SQLITE_NULL) {
-        taskModel.UniqueIdentifier = std::nullopt;
-    } else {
-        const unsigned char* res = sqlite3_column_text(stmt, columnIndex);
-        taskModel.UniqueIdentifier = std::make_optional(std::string(
-            reinterpret_cast<const char*>(res), sqlite3_column_bytes(stmt, columnIndex)));
+    if (rc != SQLITE_DONE) {
+        const char* error = sqlite3_errmsg(pDb);
+        pLogger->warn(LogMessages::ExecQueryDidNotReturnOneResultTemplate, rc, error);
+
+        sqlite3_finalize(stmt);
+        return SqliteResult::FailDetailed(
+            Messages::StepStatementReturnedMultipleRowsMessage, rc, std::string(error));
     }
-    columnIndex++;
 
-    taskModel.Hours = sqlite3_column_int(stmt, columnIndex++);
-    taskModel.Minutes = sqlite3_column_int(stmt, columnIndex++);
+    sqlite3_finalize(stmt);
+    SPDLOG_LOGGER_TRACE(pLogger, LogMessages::EntityGetById, "tasks", taskId);
 
-    const unsigned char* res = sqlite3_column_text(stmt, columnIndex);
-    taskModel.Description =
-        std::string(reinterpret_cast<const char*>(res), sqlite3_column_bytes(stmt, columnIndex++));
+    return SqliteResult::OK();
+}
 
-    taskModel.DateCreated = sqlite3_column_int(stmt, columnIndex++);
-    taskModel.DateModified = sqlite3_column_int(stmt, columnIndex++);
-    taskModel.IsActive = !!sqlite3_column_int(stmt, columnIndex++);
+SqliteResult TasksService::FilterByIds(const std::vector<std::int64_t>& taskIds,
+    DayNumber fromDayNumber,
+    DayNumber toDayNumber,
+    std::vector<TaskViewModel>& taskViewModels) const
+{
+    std::string idSetError;
 
-    taskModel.ProjectId = sqlite3_column_int64(stmt, columnIndex++);
-    taskModel.CategoryId = sqlite3_column_int64(stmt, columnIndex++);
-    taskModel.WorkdayId = sqlite3_column_int64(stmt, columnIndex++);
+    int rc = Persistence::BindIdSet(pDb, taskIds, idSetError);
 
-    res = sqlite3_column_text(stmt, columnIndex);
-    taskModel.WorkdayDate =
-        std::string(reinterpret_cast<const char*>(res), sqlite3_column_bytes(stmt, columnIndex++));
+    if (rc != SQLITE_OK) {
+        pLogger->error(LogMessages::ExecQueryTemplate, "temp.id_set", rc, idSetError);
 
-    res = sqlite3_column_text(stmt, columnIndex);
-    taskModel.ProjectName =
-        std::string(reinterpret_cast<const char*>(res), sqlite3_column_bytes(stmt, columnIndex++));
+        return SqliteResult::FailDetailed(Messages::BindStatementMessage, rc, idSetError);
+    }
 
-    res = sqlite3_column_text(stmt, columnIndex);
-    taskModel.ProjectDisplayName =
-        std::string(reinterpret_cast<const char*>(res), sqlite3_column_bytes(stmt, columnIndex++));
+    sqlite3_stmt* stmt = nullptr;
 
-    res = sqlite3_column_text(stmt, columnIndex);
-    taskModel.CategoryName =
-        std::string(reinterpret_cast<const char*>(res), sqlite3_column_bytes(stmt, columnIndex++));
+    auto sqliteResult = PrepareDayNumberRangeStatement(
+        TasksService::filterByIds, fromDayNumber, toDayNumber, &stmt);
+    if (!sqliteResult.Success) {
+        return sqliteResult;
+    }
 
-    if (sqlite3_column_type(stmt, columnIndex) == SQLITE_NULL) {
-        taskModel.ClientName = "";
-    } else {
-        res = sqlite3_column_text(stmt, columnIndex);
-        taskModel.ClientName = std::string(
-            reinterpret_cast<const char*>(res), sqlite3_column_bytes(stmt, columnIndex++));
+    // the rows share one dictionary, each fills in the names it references
+    auto dimensions = std::make_shared<TaskDimensions>();
+
+    rc = Persistence::ReadRows(stmt,
+        TaskViewModelColumns,
+        taskViewModels,
+        [&](TaskViewModel& model, int columnIndex) {
+            ReadDimensions(stmt, columnIndex, model, *dimensions);
+            model.Dimensions = dimensions;
+        });
+
+    if (rc != SQLITE_DONE) {
+        const char* error = sqlite3_errmsg(pDb);
+        pLogger->error(LogMessages::ExecStepTemplate, TasksService::filterByIds, rc, error);
+
+        sqlite3_finalize(stmt);
+        return SqliteResult::FailDetailed(Messages::StepStatementMessage, rc, std::string(error));
     }
 
-    res = sqlite3_column_text(stmt, columnIndex);
-    taskModel.EmployerName =
-        std::string(reinterpret_cast<const char*>(res), sqlite3_column_bytes(stmt, columnIndex++));
+    sqlite3_finalize(stmt);
+    SPDLOG_LOGGER_TRACE(pLogger,
+        LogMessages::FilterEntities,
+        taskViewModels.size(),
+        Utils::ConvertListIdsToCommaDelimitedString(taskIds));
 
-    rc = sqlite3_step(stmt);
+    return SqliteResult::OK();
+}
+
+SqliteResult TasksService::FilterDatesByIds(const std::vector<std::int64_t>& taskIds,
+    std::vector<std::string>& dates) const
+{
+    std::string idSetError;
+
+    int rc = Persistence::BindIdSet(pDb, taskIds, idSetError);
+
+    if (rc != SQLITE_OK) {
+        pLogger->error(LogMessages::ExecQueryTemplate, "temp.id_set", rc, idSetError);
+
+        return SqliteResult::FailDetailed(Messages::BindStatementMessage, rc, idSetError);
+    }
+
+    sqlite3_stmt* stmt = nullptr;
+
+    rc = sqlite3_prepare_v2(pDb,
+        TasksService::filterDatesByIds.data(),
+        static_cast<int>(TasksService::filterDatesByIds.size()),
+        &stmt,
+        nullptr);
+
+    if (rc != SQLITE_OK) {
+        const char* error = sqlite3_errmsg(pDb);
+        pLogger->error(
+            LogMessages::PrepareStatementTemplate, TasksService::filterDatesByIds, rc, error);
+
+        sqlite3_finalize(stmt);
+        return SqliteResult::FailDetailed(
+            Messages::PrepareStatementMessage, rc, std::string(error));
+    }
+
+    bool done = false;
+    while (!done) {
+        switch (rc = sqlite3_step(stmt)) {
+        case SQLITE_ROW: {
+            const unsigned char* res = sqlite3_column_text(stmt, 0);
+            dates.emplace_back(reinterpret_cast<const char*>(res), sqlite3_column_bytes(stmt, 0));
+            break;
+        }
+        case SQLITE_DONE:
+        default:
+            done = true;
+            break;
+        }
+    }
 
     if (rc != SQLITE_DONE) {
         const char* error = sqlite3_errmsg(pDb);
-        pLogger->warn(LogMessages::ExecQueryDidNotReturnOneResultTemplate, rc, error);
+        pLogger->error(LogMessages::ExecStepTemplate, TasksService::filterDatesByIds, rc, error);
+
+        sqlite3_finalize(stmt);
+        return SqliteResult::FailDetailed(Messages::StepStatementMessage, rc, std::string(error));
+    }
+
+    sqlite3_finalize(stmt);
+    SPDLOG_LOGGER_TRACE(pLogger,
+        LogMessages::FilterEntities,
+        dates.size(),
+        Utils::ConvertListIdsToCommaDelimitedString(taskIds));
+
+    return SqliteResult::OK();
+}
+
+SqliteResult TasksService::CountByDateRange(const std::string& fromDate,
+    const std::string& toDate,
+    std::map<std::string, std::int64_t>& taskCounts) const
+{
+    DayNumber fromDayNumber;
+    if (!DayNumber::TryParse(fromDate, fromDayNumber)) {
+        return InvalidDate(fromDate);
+    }
+
+    DayNumber toDayNumber;
+    if (!DayNumber::TryParse(toDate, toDayNumber)) {
+        return InvalidDate(toDate);
+    }
+
+    sqlite3_stmt* stmt = nullptr;
+
+    auto sqliteResult = PrepareDayNumberRangeStatement(
+        TasksService::countByDateRange, fromDayNumber, toDayNumber, &stmt);
+    if (!sqliteResult.Success) {
+        return sqliteResult;
+    }
+
+    int rc = SQLITE_OK;
+    bool done = false;
+    while (!done) {
+        switch (rc = sqlite3_step(stmt)) {
+        case SQLITE_ROW: {
+            int columnIndex = 0;
+
+            const unsigned char* res = sqlite3_column_text(stmt, columnIndex);
+            std::string date = std::string(
+                reinterpret_cast<const char*>(res), sqlite3_column_bytes(stmt, columnIndex++));
+
+            taskCounts[date] = sqlite3_column_int64(stmt, columnIndex++);
+            break;
+        }
+        case SQLITE_DONE:
+        default:
+            done = true;
+            break;
+        }
+    }
+
+    if (rc != SQLITE_DONE) {
+        const char* error = sqlite3_errmsg(pDb);
+        pLogger->error(LogMessages::ExecStepTemplate, TasksService::countByDateRange, rc, error);
+
+        sqlite3_finalize(stmt);
+        return SqliteResult::FailDetailed(Messages::StepStatementMessage, rc, std::string(error));
+    }
+
+    sqlite3_finalize(stmt);
+    SPDLOG_LOGGER_TRACE(pLogger,
+        LogMessages::FilterEntities,
+        taskCounts.size(),
+        fmt::format("{0} - {1}", fromDate, toDate));
+
+    return SqliteResult::OK();
+}
+
+SqliteResult TasksService::OpenCursor(const std::string& fromDate,
+    const std::string& toDate,
+    TaskCursor& cursor) const
+{
+    DayNumber fromDayNumber;
+    if (!DayNumber::TryParse(fromDate, fromDayNumber)) {
+        return InvalidDate(fromDate);
+    }
+
+    DayNumber toDayNumber;
+    if (!DayNumber::TryParse(toDate, toDayNumber) || toDayNumber < fromDayNumber) {
+        return InvalidDate(toDate);
+    }
+
+    // task ids are positive, so (from, -1) sorts before every task of the first date
+    cursor = TaskCursor();
+    cursor.FromDayNumber = fromDayNumber;
+    cursor.ToDayNumber = toDayNumber;
+    cursor.LastDayNumber = fromDayNumber;
+    cursor.LastTaskId = -1;
+
+    return SqliteResult::OK();
+}
+
+SqliteResult TasksService::FetchPage(TaskCursor& cursor,
+    std::size_t pageSize,
+    std::vector<TaskViewModel>& taskViewModels) const
+{
+    if (cursor.Exhausted || pageSize == 0) {
+        return SqliteResult::OK();
+    }
+
+    sqlite3_stmt* stmt = nullptr;
+
+    int rc = sqlite3_prepare_v2(pDb,
+        TasksService::fetchPageByCursor.data(),
+        static_cast<int>(TasksService::fetchPageByCursor.size()),
+        &stmt,
+        nullptr);
+
+    if (rc != SQLITE_OK) {
+        const char* error = sqlite3_errmsg(pDb);
+        pLogger->error(
+            LogMessages::PrepareStatementTemplate, TasksService::fetchPageByCursor, rc, error);
 
         sqlite3_finalize(stmt);
         return SqliteResult::FailDetailed(
-            Messages::StepStatementReturnedMultipleRowsMessage, rc, std::string(error));
+            Messages::PrepareStatementMessage, rc, std::string(error));
+    }
+
+    int bindIndex = 1;
+
+    for (const std::int64_t value : { static_cast<std::int64_t>(cursor.LastDayNumber.Value),
+             static_cast<std::int64_t>(cursor.ToDayNumber.Value),
+             static_cast<std::int64_t>(cursor.LastDayNumber.Value),
+             cursor.LastTaskId,
+             static_cast<std::int64_t>(pageSize) }) {
+        rc = sqlite3_bind_int64(stmt, bindIndex, value);
+
+        if (rc != SQLITE_OK) {
+            const char* error = sqlite3_errmsg(pDb);
+            pLogger->error(LogMessages::BindParameterTemplate, "cursor", bindIndex, rc, error);
+
+            sqlite3_finalize(stmt);
+            return SqliteResult::FailDetailed(
+                Messages::BindStatementMessage, rc, std::string(error));
+        }
+
+        bindIndex++;
+    }
+
+    std::vector<TaskViewModel> page;
+    page.reserve(pageSize);
+
+    DayNumber firstDayNumber = cursor.LastDayNumber;
+    DayNumber lastDayNumber = cursor.LastDayNumber;
+    std::int64_t lastTaskId = cursor.LastTaskId;
+
+    rc = Persistence::ReadRows(
+        stmt, TaskViewModelColumns, page, [&](TaskViewModel& model, int columnIndex) {
+            lastDayNumber = DayNumber(sqlite3_column_int(stmt, columnIndex));
+            lastTaskId = model.TaskId;
+            if (page.size() == 1) {
+                firstDayNumber = lastDayNumber;
+            }
+        });
+
+    if (rc != SQLITE_DONE) {
+        const char* error = sqlite3_errmsg(pDb);
+        pLogger->error(LogMessages::ExecStepTemplate, TasksService::fetchPageByCursor, rc, error);
+
+        sqlite3_finalize(stmt);
+        return SqliteResult::FailDetailed(Messages::StepStatementMessage, rc, std::string(error));
     }
 
     sqlite3_finalize(stmt);
-    SPDLOG_LOGGER_TRACE(pLogger, LogMessages::EntityGetById, "tasks", taskId);
+
+    // names are only resolved for the dates the page spans
+    if (!page.empty()) {
+        auto dimensions = std::make_shared<TaskDimensions>();
+        auto sqliteResult = FilterDimensions(firstDayNumber, lastDayNumber, *dimensions);
+        if (!sqliteResult.Success) {
+            return sqliteResult;
+        }
+
+        for (auto& model : page) {
+            model.Dimensions = dimensions;
+        }
+    }
+
+    // the cursor only moves once the whole page has been read
+    cursor.LastDayNumber = lastDayNumber;
+    cursor.LastTaskId = lastTaskId;
+    cursor.Exhausted = page.size() < pageSize;
+
+    SPDLOG_LOGGER_TRACE(pLogger,
+        LogMessages::FilterEntities,
+        page.size(),
+        cursor.ToContinuationToken());
+
+    taskViewModels.insert(taskViewModels.end(),
+        std::make_move_iterator(page.begin()),
+        std::make_move_iterator(page.end()));
+
+    return SqliteResult::OK();
+}
+
+SqliteResult TasksService::Search(const TaskSearchQuery& query,
+    TaskSearchCursor& cursor,
+    std::size_t pageSize,
+    std::vector<TaskSearchResult>& results) const
+{
+    const std::string matchTerm = Utils::FormatFtsSearchTerm(query.Term);
+    if (matchTerm.empty()) {
+        cursor.Exhausted = true;
+    }
+
+    if (cursor.Exhausted || pageSize == 0) {
+        return SqliteResult::OK();
+    }
+
+    sqlite3_stmt* stmt = nullptr;
+
+    int rc = sqlite3_prepare_v2(pDb,
+        TasksService::search.data(),
+        static_cast<int>(TasksService::search.size()),
+        &stmt,
+        nullptr);
+
+    if (rc != SQLITE_OK) {
+        const char* error = sqlite3_errmsg(pDb);
+        pLogger->error(LogMessages::PrepareStatementTemplate, TasksService::search, rc, error);
+
+        sqlite3_finalize(stmt);
+        return SqliteResult::FailDetailed(
+            Messages::PrepareStatementMessage, rc, std::string(error));
+    }
+
+    int bindIndex = 1;
+
+    rc = sqlite3_bind_text(
+        stmt, bindIndex, matchTerm.c_str(), static_cast<int>(matchTerm.size()), SQLITE_TRANSIENT);
+
+    if (rc != SQLITE_OK) {
+        const char* error = sqlite3_errmsg(pDb);
+        pLogger->error(LogMessages::BindParameterTemplate, "term", bindIndex, rc, error);
+
+        sqlite3_finalize(stmt);
+        return SqliteResult::FailDetailed(Messages::BindStatementMessage, rc, std::string(error));
+    }
+
+    bindIndex++;
+
+    // an open ended range is bound as the widest one
+    const DayNumber fromDayNumber =
+        query.FromDayNumber.value_or(DayNumber(std::numeric_limits<std::int32_t>::min()));
+    const DayNumber toDayNumber =
+        query.ToDayNumber.value_or(DayNumber(std::numeric_limits<std::int32_t>::max()));
+
+    for (const DayNumber dayNumber : { fromDayNumber, toDayNumber }) {
+        rc = sqlite3_bind_int(stmt, bindIndex, dayNumber.Value);
+
+        if (rc != SQLITE_OK) {
+            const char* error = sqlite3_errmsg(pDb);
+            pLogger->error(LogMessages::BindParameterTemplate, "day_number", bindIndex, rc, error);
+
+            sqlite3_finalize(stmt);
+            return SqliteResult::FailDetailed(
+                Messages::BindStatementMessage, rc, std::string(error));
+        }
+
+        bindIndex++;
+    }
+
+    // the project id is bound twice, for the IS NULL check and for the comparison
+    for (int i = 0; i < 2; i++) {
+        if (query.ProjectId.has_value()) {
+            rc = sqlite3_bind_int64(stmt, bindIndex, query.ProjectId.value());
+        } else {
+            rc = sqlite3_bind_null(stmt, bindIndex);
+        }
+
+        if (rc != SQLITE_OK) {
+            const char* error = sqlite3_errmsg(pDb);
+            pLogger->error(LogMessages::BindParameterTemplate, "project_id", bindIndex, rc, error);
+
+            sqlite3_finalize(stmt);
+            return SqliteResult::FailDetailed(
+                Messages::BindStatementMessage, rc, std::string(error));
+        }
+
+        bindIndex++;
+    }
+
+    rc = sqlite3_bind_double(stmt, bindIndex, cursor.LastRank);
+
+    if (rc != SQLITE_OK) {
+        const char* error = sqlite3_errmsg(pDb);
+        pLogger->error(LogMessages::BindParameterTemplate, "rank", bindIndex, rc, error);
+
+        sqlite3_finalize(stmt);
+        return SqliteResult::FailDetailed(Messages::BindStatementMessage, rc, std::string(error));
+    }
+
+    bindIndex++;
+
+    for (const std::int64_t value : { cursor.LastTaskId, static_cast<std::int64_t>(pageSize) }) {
+        rc = sqlite3_bind_int64(stmt, bindIndex, value);
+
+        if (rc != SQLITE_OK) {
+            const char* error = sqlite3_errmsg(pDb);
+            pLogger->error(LogMessages::BindParameterTemplate, "cursor", bindIndex, rc, error);
+
+            sqlite3_finalize(stmt);
+            return SqliteResult::FailDetailed(
+                Messages::BindStatementMessage, rc, std::string(error));
+        }
+
+        bindIndex++;
+    }
+
+    std::vector<TaskSearchResult> page;
+    page.reserve(pageSize);
+
+    // the names of a page are shared by its rows like those of a range filter
+    auto dimensions = std::make_shared<TaskDimensions>();
+
+    bool done = false;
+    while (!done) {
+        switch (rc = sqlite3_step(stmt)) {
+        case SQLITE_ROW: {
+            auto& result = page.emplace_back();
+
+            int columnIndex = Persistence::ReadRow(stmt, TaskViewModelColumns, result.Task);
+            ReadDimensions(stmt, columnIndex, result.Task, *dimensions);
+            columnIndex += DimensionColumnCount;
+
+            const unsigned char* res = sqlite3_column_text(stmt, columnIndex);
+            result.Snippet = std::string(
+                reinterpret_cast<const char*>(res), sqlite3_column_bytes(stmt, columnIndex++));
+
+            result.Rank = sqlite3_column_double(stmt, columnIndex++);
+            result.Task.Dimensions = dimensions;
+            break;
+        }
+        case SQLITE_DONE:
+        default:
+            done = true;
+            break;
+        }
+    }
+
+    if (rc != SQLITE_DONE) {
+        const char* error = sqlite3_errmsg(pDb);
+        pLogger->error(LogMessages::ExecStepTemplate, TasksService::search, rc, error);
+
+        sqlite3_finalize(stmt);
+        return SqliteResult::FailDetailed(Messages::StepStatementMessage, rc, std::string(error));
+    }
+
+    sqlite3_finalize(stmt);
+
+    if (!page.empty()) {
+        cursor.LastRank = page.back().Rank;
+        cursor.LastTaskId = page.back().Task.TaskId;
+    }
+    cursor.Exhausted = page.size() < pageSize;
+
+    SPDLOG_LOGGER_TRACE(pLogger, LogMessages::FilterEntities, page.size(), query.Term);
+
+    results.insert(results.end(),
+        std::make_move_iterator(page.begin()),
+        std::make_move_iterator(page.end()));
 
     return SqliteResult::OK();
 }
 
-std::string TasksService::filterByDate = "SELECT "
-                                         "tasks.task_id, "
-                                         "tasks.billable, "
-                                         "tasks.unique_identifier, "
-                                         "tasks.hours, "
-                                         "tasks.minutes, "
-                                         "tasks.description, "
-                                         "tasks.date_created, "
-                                         "tasks.date_modified, "
-                                         "tasks.is_active, "
-                                         "tasks.project_id, "
-                                         "tasks.category_id, "
-                                         "tasks.workday_id, "
-                                         "workdays.date, "
-                                         "projects.name,"
-                                         "projects.display_name,"
-                                         "categories.name, "
-                                         "clients.name, "
-                                         "employers.name "
-                                         "FROM tasks "
-                                         "INNER JOIN workdays "
-                                         "ON tasks.workday_id = workdays.workday_id "
-                                         "INNER JOIN projects "
-                                         "ON tasks.project_id = projects.project_id "
-                                         "INNER JOIN categories "
-                                         "ON tasks.category_id = categories.category_id "
-                                         "LEFT JOIN clients "
-                                         "ON projects.client_id = clients.client_id "
-                                         "INNER JOIN employers "
-                                         "ON projects.employer_id = employers.employer_id "
-                                         "WHERE workdays.date = ? "
-                                         "AND tasks.is_active = 1;";
-
-std::string TasksService::getById = "SELECT "
-                                    "tasks.task_id, "
-                                    "tasks.billable, "
-                                    "tasks.unique_identifier, "
-                                    "tasks.hours, "
-                                    "tasks.minutes, "
-                                    "tasks.description, "
-                                    "tasks.date_created, "
-                                    "tasks.date_modified, "
-                                    "tasks.is_active, "
-                                    "tasks.project_id, "
-                                    "tasks.category_id, "
-                                    "tasks.workday_id, "
-                                    "workdays.date, "
-                                    "projects.name,"
-                                    "projects.display_name,"
-                                    "categories.name, "
-                                    "clients.name, "
-                                    "employers.name "
-                                    "FROM tasks "
-                                    "INNER JOIN workdays "
-                                    "ON tasks.workday_id = workdays.workday_id "
-                                    "INNER JOIN projects "
-                                    "ON tasks.project_id = projects.project_id "
-                                    "INNER JOIN categories "
-                                    "ON tasks.category_id = categories.category_id "
-                                    "LEFT JOIN clients "
-                                    "ON projects.client_id = clients.client_id "
-                                    "INNER JOIN employers "
-                                    "ON projects.employer_id = employers.employer_id "
-                                    "WHERE tasks.task_id = ? "
-                                    "AND tasks.is_active = 1;";
+constexpr std::string_view TasksService::filterByDayNumberRange =
+    "SELECT "
+    "tasks.task_id, "
+    "tasks.billable, "
+    "tasks.unique_identifier, "
+    "tasks.hours, "
+    "tasks.minutes, "
+    "tasks.description, "
+    "tasks.date_created, "
+    "tasks.date_modified, "
+    "tasks.is_active, "
+    "tasks.project_id, "
+    "tasks.category_id, "
+    "tasks.workday_id "
+    "FROM tasks "
+    "INNER JOIN workdays "
+    "ON tasks.workday_id = workdays.workday_id "
+    "WHERE workdays.day_number >= ? "
+    "AND workdays.day_number <= ? "
+    "AND tasks.is_active = 1 "
+    "ORDER BY workdays.day_number, tasks.task_id;";
+static_assert(Persistence::CountSelectColumns(TasksService::filterByDayNumberRange) ==
+              Persistence::ColumnCount(TaskViewModelColumns));
+
+std::string TasksService::filterProjectDimensions =
+    "SELECT "
+    "projects.project_id, "
+    "projects.name, "
+    "projects.display_name, "
+    "employers.employer_id, "
+    "employers.name, "
+    "clients.client_id, "
+    "clients.name "
+    "FROM projects "
+    "INNER JOIN employers "
+    "ON projects.employer_id = employers.employer_id "
+    "LEFT JOIN clients "
+    "ON projects.client_id = clients.client_id "
+    "WHERE projects.project_id IN ("
+    "SELECT tasks.project_id "
+    "FROM tasks "
+    "INNER JOIN workdays "
+    "ON tasks.workday_id = workdays.workday_id "
+    "WHERE workdays.day_number >= ? "
+    "AND workdays.day_number <= ? "
+    "AND tasks.is_active = 1);";
+
+std::string TasksService::filterCategoryDimensions =
+    "SELECT "
+    "categories.category_id, "
+    "categories.name "
+    "FROM categories "
+    "WHERE categories.category_id IN ("
+    "SELECT tasks.category_id "
+    "FROM tasks "
+    "INNER JOIN workdays "
+    "ON tasks.workday_id = workdays.workday_id "
+    "WHERE workdays.day_number >= ? "
+    "AND workdays.day_number <= ? "
+    "AND tasks.is_active = 1);";
+
+std::string TasksService::filterWorkdayDimensions = "SELECT "
+                                                    "workdays.workday_id, "
+                                                    "workdays.date "
+                                                    "FROM workdays "
+                                                    "WHERE workdays.day_number >= ? "
+                                                    "AND workdays.day_number <= ?;";
+
+constexpr std::string_view TasksService::getById =
+    "SELECT "
+    "tasks.task_id, "
+    "tasks.billable, "
+    "tasks.unique_identifier, "
+    "tasks.hours, "
+    "tasks.minutes, "
+    "tasks.description, "
+    "tasks.date_created, "
+    "tasks.date_modified, "
+    "tasks.is_active, "
+    "tasks.project_id, "
+    "tasks.category_id, "
+    "tasks.workday_id, "
+    "workdays.date, "
+    "projects.name, "
+    "projects.display_name, "
+    "categories.name, "
+    "employers.employer_id, "
+    "employers.name, "
+    "clients.client_id, "
+    "clients.name "
+    "FROM tasks "
+    "INNER JOIN workdays "
+    "ON tasks.workday_id = workdays.workday_id "
+    "INNER JOIN projects "
+    "ON tasks.project_id = projects.project_id "
+    "INNER JOIN categories "
+    "ON tasks.category_id = categories.category_id "
+    "LEFT JOIN clients "
+    "ON projects.client_id = clients.client_id "
+    "INNER JOIN employers "
+    "ON projects.employer_id = employers.employer_id "
+    "WHERE tasks.task_id = ? "
+    "AND tasks.is_active = 1;";
+static_assert(Persistence::CountSelectColumns(TasksService::getById) ==
+              Persistence::ColumnCount(TaskViewModelColumns) + TasksService::DimensionColumnCount);
+
+constexpr std::string_view TasksService::filterByIds =
+    "SELECT "
+    "tasks.task_id, "
+    "tasks.billable, "
+    "tasks.unique_identifier, "
+    "tasks.hours, "
+    "tasks.minutes, "
+    "tasks.description, "
+    "tasks.date_created, "
+    "tasks.date_modified, "
+    "tasks.is_active, "
+    "tasks.project_id, "
+    "tasks.category_id, "
+    "tasks.workday_id, "
+    "workdays.date, "
+    "projects.name, "
+    "projects.display_name, "
+    "categories.name, "
+    "employers.employer_id, "
+    "employers.name, "
+    "clients.client_id, "
+    "clients.name "
+    "FROM tasks "
+    "INNER JOIN workdays "
+    "ON tasks.workday_id = workdays.workday_id "
+    "INNER JOIN projects "
+    "ON tasks.project_id = projects.project_id "
+    "INNER JOIN categories "
+    "ON tasks.category_id = categories.category_id "
+    "LEFT JOIN clients "
+    "ON projects.client_id = clients.client_id "
+    "INNER JOIN employers "
+    "ON projects.employer_id = employers.employer_id "
+    "WHERE tasks.task_id IN (SELECT id FROM temp.id_set) "
+    "AND workdays.day_number >= ? "
+    "AND workdays.day_number <= ? "
+    "AND tasks.is_active = 1 "
+    "ORDER BY workdays.day_number, tasks.task_id;";
+static_assert(Persistence::CountSelectColumns(TasksService::filterByIds) ==
+              Persistence::ColumnCount(TaskViewModelColumns) + TasksService::DimensionColumnCount);
+
+constexpr std::string_view TasksService::filterDatesByIds =
+    "SELECT DISTINCT "
+    "workdays.date "
+    "FROM tasks "
+    "INNER JOIN workdays "
+    "ON tasks.workday_id = workdays.workday_id "
+    "WHERE tasks.task_id IN (SELECT id FROM temp.id_set);";
+
+std::string TasksService::countByDateRange = "SELECT "
+                                             "workdays.date, "
+                                             "COUNT(tasks.task_id) "
+                                             "FROM workdays "
+                                             "INNER JOIN tasks "
+                                             "ON workdays.workday_id = tasks.workday_id "
+                                             "WHERE workdays.day_number >= ? "
+                                             "AND workdays.day_number <= ? "
+                                             "AND tasks.is_active = 1 "
+                                             "GROUP BY workdays.day_number;";
+
+constexpr std::string_view TasksService::fetchPageByCursor =
+    "SELECT "
+    "tasks.task_id, "
+    "tasks.billable, "
+    "tasks.unique_identifier, "
+    "tasks.hours, "
+    "tasks.minutes, "
+    "tasks.description, "
+    "tasks.date_created, "
+    "tasks.date_modified, "
+    "tasks.is_active, "
+    "tasks.project_id, "
+    "tasks.category_id, "
+    "tasks.workday_id, "
+    "workdays.day_number "
+    "FROM tasks "
+    "INNER JOIN workdays "
+    "ON tasks.workday_id = workdays.workday_id "
+    "WHERE workdays.day_number >= ? "
+    "AND workdays.day_number <= ? "
+    "AND (workdays.day_number, tasks.task_id) > (?, ?) "
+    "AND tasks.is_active = 1 "
+    "ORDER BY workdays.day_number, tasks.task_id "
+    "LIMIT ?;";
+static_assert(Persistence::CountSelectColumns(TasksService::fetchPageByCursor) ==
+              Persistence::ColumnCount(TaskViewModelColumns) + 1);
+
+constexpr std::string_view TasksService::search =
+    "SELECT "
+    "tasks.task_id, "
+    "tasks.billable, "
+    "tasks.unique_identifier, "
+    "tasks.hours, "
+    "tasks.minutes, "
+    "tasks.description, "
+    "tasks.date_created, "
+    "tasks.date_modified, "
+    "tasks.is_active, "
+    "tasks.project_id, "
+    "tasks.category_id, "
+    "tasks.workday_id, "
+    "workdays.date, "
+    "projects.name, "
+    "projects.display_name, "
+    "categories.name, "
+    "employers.employer_id, "
+    "employers.name, "
+    "clients.client_id, "
+    "clients.name, "
+    "snippet(tasks_fts, -1, '[', ']', '...', 12), "
+    "bm25(tasks_fts) "
+    "FROM tasks_fts "
+    "INNER JOIN tasks "
+    "ON tasks_fts.rowid = tasks.task_id "
+    "INNER JOIN workdays "
+    "ON tasks.workday_id = workdays.workday_id "
+    "INNER JOIN projects "
+    "ON tasks.project_id = projects.project_id "
+    "INNER JOIN categories "
+    "ON tasks.category_id = categories.category_id "
+    "LEFT JOIN clients "
+    "ON projects.client_id = clients.client_id "
+    "INNER JOIN employers "
+    "ON projects.employer_id = employers.employer_id "
+    "WHERE tasks_fts MATCH ? "
+    "AND workdays.day_number >= ? "
+    "AND workdays.day_number <= ? "
+    "AND (? IS NULL OR tasks.project_id = ?) "
+    "AND tasks.is_active = 1 "
+    "AND (bm25(tasks_fts), tasks.task_id) > (?, ?) "
+    "ORDER BY bm25(tasks_fts), tasks.task_id "
+    "LIMIT ?;";
+static_assert(Persistence::CountSelectColumns(TasksService::search) ==
+              Persistence::ColumnCount(TaskViewModelColumns) +
+                  TasksService::DimensionColumnCount + 2); // snippet and rank
 } // namespace tks::Services
@@ -19,9 +19,11 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <map>
 #include <vector>
 
@@ -29,6 +31,11 @@
 
 #include "../../persistence/base/persistencebase.h"
 
+#include "../../utils/daynumber.h"
+
+#include "taskcursor.h"
+#include "taskdimensions.h"
+#include "tasksearch.h"
 #include "taskviewmodel.h"
 
 namespace tks::Services
@@ -45,9 +52,58 @@ struct TasksService final : public Persistence::PersistenceBase {
         /*out*/ std::map<std::string, std::vector<TaskViewModel>>& taskViewModels);
     SqliteResult FilterByDate(const std::string& date,
         /*out*/ std::vector<TaskViewModel>& taskViewModels) const;
+    SqliteResult FilterByDayNumberRange(DayNumber fromDayNumber,
+        DayNumber toDayNumber,
+        std::shared_ptr<const TaskDimensions> dimensions,
+        /*out*/ std::vector<TaskViewModel>& taskViewModels) const;
+    SqliteResult FilterDimensions(DayNumber fromDayNumber,
+        DayNumber toDayNumber,
+        /*out*/ TaskDimensions& dimensions) const;
+    SqliteResult PrepareDayNumberRangeStatement(std::string_view query,
+        DayNumber fromDayNumber,
+        DayNumber toDayNumber,
+        /*out*/ sqlite3_stmt** stmt) const;
+    SqliteResult InvalidDate(const std::string& date) const;
+    void ReadDimensions(sqlite3_stmt* stmt,
+        int columnIndex,
+        const TaskViewModel& taskViewModel,
+        /*out*/ TaskDimensions& dimensions) const;
     SqliteResult GetById(const std::int64_t taskId, /*out*/ TaskViewModel& taskViewModel) const;
+    SqliteResult FilterByIds(const std::vector<std::int64_t>& taskIds,
+        DayNumber fromDayNumber,
+        DayNumber toDayNumber,
+        /*out*/ std::vector<TaskViewModel>& taskViewModels) const;
+    SqliteResult FilterDatesByIds(const std::vector<std::int64_t>& taskIds,
+        /*out*/ std::vector<std::string>& dates) const;
+    SqliteResult CountByDateRange(const std::string& fromDate,
+        const std::string& toDate,
+        /*out*/ std::map<std::string, std::int64_t>& taskCounts) const;
+
+    SqliteResult OpenCursor(const std::string& fromDate,
+        const std::string& toDate,
+        /*out*/ TaskCursor& cursor) const;
+    SqliteResult FetchPage(TaskCursor& cursor,
+        std::size_t pageSize,
+        /*out*/ std::vector<TaskViewModel>& taskViewModels) const;
+
+    SqliteResult Search(const TaskSearchQuery& query,
+        TaskSearchCursor& cursor,
+        std::size_t pageSize,
+        /*out*/ std::vector<TaskSearchResult>& results) const;
+
+    // workdays.date, projects.name, projects.display_name, categories.name, employers.employer_id,
+    // employers.name, clients.client_id, clients.name
+    static constexpr std::size_t DimensionColumnCount = 8;
 
-    static std::string filterByDate;
-    static std::string getById;
+    static const std::string_view filterByDayNumberRange;
+    static std::string filterProjectDimensions;
+    static std::string filterCategoryDimensions;
+    static std::string filterWorkdayDimensions;
+    static const std::string_view getById;
+    static const std::string_view filterByIds;
+    static const std::string_view filterDatesByIds;
+    static std::string countByDateRange;
+    static const std::string_view fetchPageByCursor;
+    static const std::string_view search;
 };
 } // namespace tks::Services
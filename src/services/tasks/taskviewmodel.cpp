@@ -26,6 +26,16 @@
 
 namespace tks::Services
 {
+namespace
+{
+// rows that were not read from a query share one empty dictionary
+std::shared_ptr<const TaskDimensions> GetEmptyDimensions()
+{
+    static const auto emptyDimensions = std::make_shared<const TaskDimensions>();
+    return emptyDimensions;
+}
+} // namespace
+
 TaskViewModel::TaskViewModel()
     : TaskId(-1)
     , Billable(false)
@@ -39,13 +49,38 @@ TaskViewModel::TaskViewModel()
     , ProjectId(-1)
     , CategoryId(-1)
     , WorkdayId(-1)
-    , WorkdayDate()
-    , EmployerName()
-    , ClientName()
-    , ProjectName()
-    , ProjectDisplayName()
-    , CategoryName()
+    , Dimensions(GetEmptyDimensions())
+{
+}
+
+const std::string& TaskViewModel::GetWorkdayDate() const
+{
+    return Dimensions->GetWorkdayDate(WorkdayId);
+}
+
+const std::string& TaskViewModel::GetEmployerName() const
+{
+    return Dimensions->GetEmployerName(ProjectId);
+}
+
+const std::string& TaskViewModel::GetClientName() const
+{
+    return Dimensions->GetClientName(ProjectId);
+}
+
+const std::string& TaskViewModel::GetProjectName() const
+{
+    return Dimensions->GetProjectName(ProjectId);
+}
+
+const std::string& TaskViewModel::GetProjectDisplayName() const
+{
+    return Dimensions->GetProjectDisplayName(ProjectId);
+}
+
+const std::string& TaskViewModel::GetCategoryName() const
 {
+    return Dimensions->GetCategoryName(CategoryId);
 }
 
 const std::string TaskViewModel::GetDuration() const
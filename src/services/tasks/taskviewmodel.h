@@ -20,8 +20,12 @@
 #pragma once
 
 #include <cstdint>
+#include <memory>
 #include <optional>
 #include <string>
+#include <tuple>
+
+#include "taskdimensions.h"
 
 namespace tks::Services
 {
@@ -40,12 +44,14 @@ struct TaskViewModel {
     std::int64_t ProjectId;
     std::int64_t CategoryId;
     std::int64_t WorkdayId;
-    std::string WorkdayDate;
-    std::string EmployerName;
-    std::string ClientName;
-    std::string ProjectName;
-    std::string ProjectDisplayName;
-    std::string CategoryName;
+    std::shared_ptr<const TaskDimensions> Dimensions;
+
+    const std::string& GetWorkdayDate() const;
+    const std::string& GetEmployerName() const;
+    const std::string& GetClientName() const;
+    const std::string& GetProjectName() const;
+    const std::string& GetProjectDisplayName() const;
+    const std::string& GetCategoryName() const;
 
     const std::string GetDuration() const;
     const std::string TryGetUniqueIdentifier() const;
@@ -54,4 +60,18 @@ struct TaskViewModel {
     const std::string GetDateCreatedString() const;
     const std::string GetDateModifiedString() const;
 };
+
+// columns in the order task view queries select them, see Persistence::ReadRow
+inline constexpr auto TaskViewModelColumns = std::make_tuple(&TaskViewModel::TaskId,
+    &TaskViewModel::Billable,
+    &TaskViewModel::UniqueIdentifier,
+    &TaskViewModel::Hours,
+    &TaskViewModel::Minutes,
+    &TaskViewModel::Description,
+    &TaskViewModel::DateCreated,
+    &TaskViewModel::DateModified,
+    &TaskViewModel::IsActive,
+    &TaskViewModel::ProjectId,
+    &TaskViewModel::CategoryId,
+    &TaskViewModel::WorkdayId);
 } // namespace MyNamespace
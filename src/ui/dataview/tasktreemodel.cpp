@@ -34,14 +34,21 @@ TaskTreeModel::TaskTreeModel(const std::vector<std::string>& weekDates,
     : pCfg(cfg)
     , pLogger(logger)
     , pRoots()
+    , mRootNodesByDate()
+    , mChildNodesByTaskId()
+    , mLoadedDateNodes()
 {
     for (const auto& date : weekDates) {
         pRoots.push_back(std::make_unique<TaskTreeModelNode>(nullptr, date));
+        mRootNodesByDate[date] = pRoots.back().get();
     }
 }
 
 TaskTreeModel::~TaskTreeModel()
 {
+    mLoadedDateNodes.clear();
+    mChildNodesByTaskId.clear();
+    mRootNodesByDate.clear();
     pRoots.clear();
 }
 
@@ -65,10 +72,11 @@ void TaskTreeModel::GetValue(wxVariant& variant, const wxDataViewItem& item, uns
 {
     wxASSERT(item.IsOk());
 
-    TaskTreeModelNode* node = (TaskTreeModelNode*) item.GetID();
+    // nodes hold their text columns as prepared wxStrings so repaints do not convert per cell
+    const TaskTreeModelNode* node = (const TaskTreeModelNode*) item.GetID();
     switch (col) {
     case Col_Date:
-        variant = node->GetDate();
+        variant = node->GetDisplayDate();
         break;
     case Col_Employer:
         variant = node->GetEmployerName();
@@ -161,17 +169,8 @@ wxDataViewItem TaskTreeModel::GetParent(const wxDataViewItem& item) const
         return wxDataViewItem(0);
     }
 
+    // root nodes have no parent, so this resolves to the invisible root item for them
     TaskTreeModelNode* node = (TaskTreeModelNode*) item.GetID();
-
-    for (const auto& parentNode : pRoots) {
-        if (node == parentNode.get()) {
-            SPDLOG_LOGGER_TRACE(
-                pLogger, "Node matched with one of the root nodes \"{0}\"", node->GetProjectName());
-            return wxDataViewItem(0);
-        }
-    }
-
-    SPDLOG_LOGGER_TRACE(pLogger, "Node is child, call up the node structure");
     return wxDataViewItem((void*) node->GetParent());
 }
 
@@ -216,88 +215,70 @@ void TaskTreeModel::Delete(const wxDataViewItem& item)
         return;
     }
 
-    wxDataViewItem parent(node->GetParent());
-    if (!parent.IsOk()) { // this means that the root node was clicked and has no parent
+    auto parentNode = node->GetParent();
+    if (!parentNode) { // this means that the root node was clicked and has no parent
         SPDLOG_LOGGER_TRACE(pLogger, "Root node selected and skipping deletion of root node");
         return;
     }
 
     SPDLOG_LOGGER_TRACE(pLogger, "Delete node from parent");
 
-    auto& children = node->GetChildren();
-    for (auto it = children.begin(); it != children.end(); ++it) {
-        if (it->get() == node) {
-            children.erase(it);
-            break;
-        }
-    }
+    mChildNodesByTaskId.erase(node->GetTaskId());
+    parentNode->Remove(node);
 
+    wxDataViewItem parent((void*) parentNode);
     ItemDeleted(parent, item);
 }
 
 void TaskTreeModel::DeleteChild(const std::string& date, const std::int64_t taskId)
 {
-    auto iterator = std::find_if(pRoots.begin(),
-        pRoots.end(),
-        [&](const std::unique_ptr<TaskTreeModelNode>& ptr) { return ptr->GetDate() == date; });
+    auto child = FindChildNode(date, taskId);
+    if (!child) {
+        return;
+    }
 
-    if (iterator != pRoots.end()) {
-        auto parentNode = iterator->get();
-        wxDataViewItem parent((void*) parentNode);
+    auto parentNode = child->GetParent();
+    wxDataViewItem parent((void*) parentNode);
+    wxDataViewItem childItem((void*) child);
 
-        auto& children = parentNode->GetChildren();
-        for (auto it = children.begin(); it != children.end(); ++it) {
-            if (it->get()->GetTaskId() == taskId) {
-                auto child = it->get();
-                wxDataViewItem childItem((void*) child);
-                children.erase(it);
-
-                ItemDeleted(parent, childItem);
-                break;
-            }
-        }
-    }
+    mChildNodesByTaskId.erase(taskId);
+    parentNode->Remove(child);
+
+    ItemDeleted(parent, childItem);
 }
 
 void TaskTreeModel::ChangeChild(const std::string& date, Services::TaskViewModel& taskModel)
 {
-    auto iterator = std::find_if(pRoots.begin(),
-        pRoots.end(),
-        [&](const std::unique_ptr<TaskTreeModelNode>& ptr) { return ptr->GetDate() == date; });
-
-    if (iterator != pRoots.end()) {
-        auto parentNode = iterator->get();
-
-        auto& children = parentNode->GetChildren();
-        for (auto it = children.begin(); it != children.end(); ++it) {
-            if (it->get()->GetTaskId() == taskModel.TaskId) {
-                std::string projectName = pCfg->UseProjectDisplayName()
-                                              ? taskModel.ProjectDisplayName
-                                              : taskModel.ProjectName;
-
-                auto child = it->get();
-                child->SetDate(taskModel.WorkdayDate);
-                child->SetEmployerName(taskModel.EmployerName);
-                child->SetClientName(taskModel.ClientName);
-                child->SetProjectName(projectName);
-                child->SetCategoryName(taskModel.CategoryName);
-                child->SetDuration(taskModel.GetDuration());
-                child->Billable(taskModel.Billable);
-                child->SetUniqueId(taskModel.TryGetUniqueIdentifier());
-                child->SetDescription(taskModel.GetTrimmedDescription());
-
-                wxDataViewItem item((void*) child);
-                ItemChanged(item);
-
-                break;
-            }
-        }
+    auto child = FindChildNode(date, taskModel.TaskId);
+    if (!child) {
+        return;
     }
+
+    const std::string& projectName = pCfg->UseProjectDisplayName()
+                                         ? taskModel.GetProjectDisplayName()
+                                         : taskModel.GetProjectName();
+
+    child->SetDate(taskModel.GetWorkdayDate());
+    child->SetEmployerName(taskModel.GetEmployerName());
+    child->SetClientName(taskModel.GetClientName());
+    child->SetProjectName(projectName);
+    child->SetCategoryName(taskModel.GetCategoryName());
+    child->SetDuration(taskModel.GetDuration());
+    child->Billable(taskModel.Billable);
+    child->SetUniqueId(taskModel.TryGetUniqueIdentifier());
+    child->SetDescription(taskModel.GetTrimmedDescription());
+
+    wxDataViewItem item((void*) child);
+    ItemChanged(item);
 }
 
 void TaskTreeModel::Clear()
 {
     SPDLOG_LOGGER_TRACE(pLogger, "Clear all children across root nodes and root nodes themselves");
+    mLoadedDateNodes.clear();
+    mChildNodesByTaskId.clear();
+    mRootNodesByDate.clear();
+
     for (auto& node : pRoots) {
         node->GetChildren().clear();
     }
@@ -308,6 +289,10 @@ void TaskTreeModel::Clear()
 
 void TaskTreeModel::ClearAll()
 {
+    mLoadedDateNodes.clear();
+    mChildNodesByTaskId.clear();
+    mRootNodesByDate.clear();
+
     for (auto& parentNode : pRoots) {
         wxDataViewItemArray itemsRemoved;
 
@@ -336,101 +321,79 @@ void TaskTreeModel::ClearAll()
 
 void TaskTreeModel::ClearNodeEntriesByDateKey(const std::string& date)
 {
-    auto iterator = std::find_if(pRoots.begin(),
-        pRoots.end(),
-        [&](const std::unique_ptr<TaskTreeModelNode>& ptr) { return ptr->GetDate() == date; });
+    auto parentNode = FindRootNode(date);
+    if (!parentNode) {
+        return;
+    }
 
-    if (iterator != pRoots.end()) {
-        auto parentNode = iterator->get();
-        SPDLOG_LOGGER_TRACE(
-            pLogger, "Located root node associated with date key \"{0}\"", parentNode->GetDate());
+    SPDLOG_LOGGER_TRACE(
+        pLogger, "Located root node associated with date key \"{0}\"", parentNode->GetDate());
 
-        wxDataViewItemArray itemsRemoved;
-        auto& children = parentNode->GetChildren();
-        auto count = children.size();
-        for (auto it = children.begin(); it != children.end(); ++it) {
-            auto child = it->get();
-            itemsRemoved.Add(wxDataViewItem((void*) child));
-        }
+    UnindexChildNodes(parentNode);
 
-        SPDLOG_LOGGER_TRACE(pLogger, "Removed children {0}", count);
-        parentNode->GetChildren().clear();
+    // a lazily loaded node gives up its slot in the loaded window and loads again on expand
+    if (RemoveLoadedDateNode(parentNode)) {
+        parentNode->ChildrenLoaded(false);
+    }
 
-        wxDataViewItem parent((void*) parentNode);
-        ItemsDeleted(parent, itemsRemoved);
+    wxDataViewItemArray itemsRemoved;
+    auto& children = parentNode->GetChildren();
+    auto count = children.size();
+    for (auto it = children.begin(); it != children.end(); ++it) {
+        auto child = it->get();
+        itemsRemoved.Add(wxDataViewItem((void*) child));
     }
+
+    SPDLOG_LOGGER_TRACE(pLogger, "Removed children {0}", count);
+    parentNode->GetChildren().clear();
+
+    wxDataViewItem parent((void*) parentNode);
+    ItemsDeleted(parent, itemsRemoved);
 }
 
 void TaskTreeModel::InsertChildNode(const std::string& date, Services::TaskViewModel& taskModel)
 {
-    auto iterator = std::find_if(pRoots.begin(),
-        pRoots.end(),
-        [&](const std::unique_ptr<TaskTreeModelNode>& ptr) { return ptr->GetDate() == date; });
-
-    if (iterator != pRoots.end()) {
-        auto parentNode = iterator->get();
-        std::string projectName =
-            pCfg->UseProjectDisplayName() ? taskModel.ProjectDisplayName : taskModel.ProjectName;
-
-        auto childNode = new TaskTreeModelNode(parentNode,
-            taskModel.WorkdayDate,
-            taskModel.EmployerName,
-            taskModel.ClientName,
-            projectName,
-            taskModel.CategoryName,
-            taskModel.GetDuration(),
-            taskModel.Billable,
-            taskModel.TryGetUniqueIdentifier(),
-            taskModel.GetTrimmedDescription(),
-            taskModel.TaskId);
-        parentNode->Append(childNode);
+    auto parentNode = FindRootNode(date);
+    if (!parentNode) {
+        return;
+    }
 
-        wxDataViewItem child((void*) childNode);
-        wxDataViewItem parent((void*) parentNode);
-        ItemAdded(parent, child);
+    if (!parentNode->ChildrenLoaded()) {
+        SPDLOG_LOGGER_TRACE(pLogger, "Root node \"{0}\" children load on expand", date);
+        return;
     }
+
+    auto childNode = AppendChildNode(parentNode, taskModel);
+
+    wxDataViewItem child((void*) childNode);
+    wxDataViewItem parent((void*) parentNode);
+    ItemAdded(parent, child);
 }
 
 void TaskTreeModel::InsertChildNodes(const std::string& date,
     std::vector<Services::TaskViewModel> models)
 {
     SPDLOG_LOGGER_TRACE(pLogger, "Insertion of tasks for \"{0}\"", date);
-    auto iterator = std::find_if(pRoots.begin(),
-        pRoots.end(),
-        [&](const std::unique_ptr<TaskTreeModelNode>& ptr) { return ptr->GetDate() == date; });
+    auto parentNode = FindRootNode(date);
+    if (!parentNode || !parentNode->ChildrenLoaded()) {
+        return;
+    }
 
-    if (iterator != pRoots.end()) {
-        auto parentNode = iterator->get();
-        SPDLOG_LOGGER_TRACE(
-            pLogger, "Located root node associated with date key \"{0}\"", parentNode->GetDate());
-
-        wxDataViewItemArray itemsAdded;
-        for (auto& model : models) {
-            std::string projectName = pCfg->UseProjectDisplayName() ? model.ProjectDisplayName
-                                                                    : model.ProjectName;
-
-            auto childNode = new TaskTreeModelNode(parentNode,
-                model.WorkdayDate,
-                model.EmployerName,
-                model.ClientName,
-                projectName,
-                model.CategoryName,
-                model.GetDuration(),
-                model.Billable,
-                model.TryGetUniqueIdentifier(),
-                model.GetTrimmedDescription(),
-                model.TaskId);
-            parentNode->Append(childNode);
-
-            wxDataViewItem child((void*) childNode);
-            itemsAdded.Add(child);
-        }
+    SPDLOG_LOGGER_TRACE(
+        pLogger, "Located root node associated with date key \"{0}\"", parentNode->GetDate());
 
-        wxDataViewItem parent((void*) parentNode);
-        ItemsAdded(parent, itemsAdded);
+    wxDataViewItemArray itemsAdded;
+    for (auto& model : models) {
+        auto childNode = AppendChildNode(parentNode, model);
 
-        SPDLOG_LOGGER_TRACE(pLogger, "Number of inserted children \"{0}\"", models.size());
+        wxDataViewItem child((void*) childNode);
+        itemsAdded.Add(child);
     }
+
+    wxDataViewItem parent((void*) parentNode);
+    ItemsAdded(parent, itemsAdded);
+
+    SPDLOG_LOGGER_TRACE(pLogger, "Number of inserted children \"{0}\"", models.size());
 }
 
 void TaskTreeModel::InsertRootAndChildNodes(const std::string& date,
@@ -438,32 +401,15 @@ void TaskTreeModel::InsertRootAndChildNodes(const std::string& date,
 {
     SPDLOG_LOGGER_TRACE(pLogger, "Insertion of tasks for \"{0}\"", date);
 
-    auto rootDateNode = std::make_unique<TaskTreeModelNode>(nullptr, date);
+    pRoots.push_back(std::make_unique<TaskTreeModelNode>(nullptr, date));
+    auto rootDateNode = pRoots.back().get();
+    mRootNodesByDate[date] = rootDateNode;
 
     for (auto& model : models) {
-        std::string projectName =
-            pCfg->UseProjectDisplayName() ? model.ProjectDisplayName : model.ProjectName;
-
-        auto node = new TaskTreeModelNode(rootDateNode.get(),
-            model.WorkdayDate,
-            model.EmployerName,
-            model.ClientName,
-            projectName,
-            model.CategoryName,
-            model.GetDuration(),
-            model.Billable,
-            model.TryGetUniqueIdentifier(),
-            model.GetTrimmedDescription(),
-            model.TaskId);
-        rootDateNode->Append(node);
-    }
-
-    pRoots.push_back(std::move(rootDateNode));
-
-    auto iterator = std::find_if(pRoots.begin(),
-        pRoots.end(),
-        [&](const std::unique_ptr<TaskTreeModelNode>& ptr) { return ptr->GetDate() == date; });
-    wxDataViewItem child((void*) iterator->get());
+        AppendChildNode(rootDateNode, model);
+    }
+
+    wxDataViewItem child((void*) rootDateNode);
     wxDataViewItem parent((void*) nullptr);
     ItemAdded(parent, child);
 
@@ -471,20 +417,150 @@ void TaskTreeModel::InsertRootAndChildNodes(const std::string& date,
         pLogger, "Inserted \"{0}\" children for root node {1}", models.size(), date);
 }
 
-wxDataViewItem TaskTreeModel::TryExpandTodayDateNode(const std::string& todayDate)
+void TaskTreeModel::ApplyTaskChanged(Services::TaskViewModel& taskModel)
 {
-    auto iterator = std::find_if(
-        pRoots.begin(), pRoots.end(), [&](const std::unique_ptr<TaskTreeModelNode>& ptr) {
-            return ptr->GetDate() == todayDate;
-        });
+    std::string currentDate = "";
+    if (TryGetTaskDate(taskModel.TaskId, currentDate)) {
+        if (currentDate == taskModel.GetWorkdayDate()) {
+            ChangeChild(currentDate, taskModel);
+            return;
+        }
 
-    if (iterator != pRoots.end()) {
+        SPDLOG_LOGGER_TRACE(pLogger,
+            "Task \"{0}\" moved from \"{1}\" to \"{2}\"",
+            taskModel.TaskId,
+            currentDate,
+            taskModel.GetWorkdayDate());
+        DeleteChild(currentDate, taskModel.TaskId);
+    }
+
+    InsertChildNode(taskModel.GetWorkdayDate(), taskModel);
+}
+
+void TaskTreeModel::ApplyTaskRemoved(const std::int64_t taskId)
+{
+    std::string currentDate = "";
+    if (TryGetTaskDate(taskId, currentDate)) {
+        DeleteChild(currentDate, taskId);
+    }
+}
+
+bool TaskTreeModel::TryGetTaskDate(const std::int64_t taskId, std::string& date) const
+{
+    auto iterator = mChildNodesByTaskId.find(taskId);
+    if (iterator == mChildNodesByTaskId.end()) {
+        return false;
+    }
+
+    date = iterator->second->GetParent()->GetDate();
+    return true;
+}
+
+bool TaskTreeModel::TryGetTaskDuration(const std::int64_t taskId,
+    int& minutes,
+    bool& billable) const
+{
+    auto iterator = mChildNodesByTaskId.find(taskId);
+    if (iterator == mChildNodesByTaskId.end()) {
+        return false;
+    }
+
+    // the node holds the duration as displayed, "hh:mm"
+    const auto& duration = iterator->second->GetDuration();
+
+    long hours = 0;
+    long durationMinutes = 0;
+    if (!duration.BeforeFirst(':').ToLong(&hours) ||
+        !duration.AfterFirst(':').ToLong(&durationMinutes)) {
+        return false;
+    }
+
+    minutes = static_cast<int>(hours * 60 + durationMinutes);
+    billable = iterator->second->Billable();
+    return true;
+}
+
+void TaskTreeModel::InsertLazyRootNodes(const std::vector<std::string>& dates,
+    const std::map<std::string, std::int64_t>& taskCounts)
+{
+    wxDataViewItemArray itemsAdded;
+    for (const auto& date : dates) {
+        pRoots.push_back(std::make_unique<TaskTreeModelNode>(nullptr, date));
+        auto rootDateNode = pRoots.back().get();
+        mRootNodesByDate[date] = rootDateNode;
+
+        // a day without tasks has nothing to fetch, so it can accept inserts straight away
+        auto iterator = taskCounts.find(date);
+        rootDateNode->ChildrenLoaded(iterator == taskCounts.end() || iterator->second == 0);
+
+        itemsAdded.Add(wxDataViewItem((void*) rootDateNode));
+    }
+
+    wxDataViewItem parent((void*) nullptr);
+    ItemsAdded(parent, itemsAdded);
+
+    SPDLOG_LOGGER_TRACE(pLogger, "Inserted \"{0}\" lazy root nodes", dates.size());
+}
+
+bool TaskTreeModel::RequiresChildNodes(const wxDataViewItem& item) const
+{
+    if (!item.IsOk()) {
+        return false;
+    }
+
+    const TaskTreeModelNode* node = (const TaskTreeModelNode*) item.GetID();
+    return node->IsContainer() && !node->ChildrenLoaded();
+}
+
+wxDataViewItemArray TaskTreeModel::LoadChildNodes(const wxDataViewItem& item,
+    std::vector<Services::TaskViewModel> models)
+{
+    TaskTreeModelNode* parentNode = (TaskTreeModelNode*) item.GetID();
+    if (!parentNode || parentNode->ChildrenLoaded()) {
+        return wxDataViewItemArray();
+    }
+
+    SPDLOG_LOGGER_TRACE(
+        pLogger, "Load \"{0}\" children for root node {1}", models.size(), parentNode->GetDate());
+
+    parentNode->ChildrenLoaded(true);
+    mLoadedDateNodes.push_front(parentNode);
+
+    wxDataViewItemArray itemsAdded;
+    for (auto& model : models) {
+        auto childNode = AppendChildNode(parentNode, model);
+        itemsAdded.Add(wxDataViewItem((void*) childNode));
+    }
+
+    ItemsAdded(item, itemsAdded);
+
+    return EvictLeastRecentlyUsedDateNodes();
+}
+
+void TaskTreeModel::TouchDateNode(const wxDataViewItem& item)
+{
+    TaskTreeModelNode* node = (TaskTreeModelNode*) item.GetID();
+    for (auto it = mLoadedDateNodes.begin(); it != mLoadedDateNodes.end(); ++it) {
+        if (*it == node) {
+            mLoadedDateNodes.splice(mLoadedDateNodes.begin(), mLoadedDateNodes, it);
+            break;
+        }
+    }
+}
+
+wxDataViewItem TaskTreeModel::FindDateNode(const std::string& date) const
+{
+    return wxDataViewItem((void*) FindRootNode(date));
+}
+
+wxDataViewItem TaskTreeModel::TryExpandTodayDateNode(const std::string& todayDate)
+{
+    auto item = FindDateNode(todayDate);
+    if (item.IsOk()) {
         SPDLOG_LOGGER_TRACE(pLogger, "Found root node to expand: \"{0}\"", todayDate);
-        auto node = iterator->get();
-        return wxDataViewItem((void*) node);
     }
 
-    return wxDataViewItem();
+    return item;
 }
 
 wxDataViewItemArray TaskTreeModel::TryCollapseDateNodes()
@@ -501,17 +577,111 @@ wxDataViewItemArray TaskTreeModel::TryExpandAllDateNodes(const std::vector<std::
 {
     wxDataViewItemArray array;
     for (auto& date : dates) {
-        auto iterator = std::find_if(pRoots.begin(),
-            pRoots.end(),
-            [&](const std::unique_ptr<TaskTreeModelNode>& ptr) { return ptr->GetDate() == date; });
-
-        if (iterator != pRoots.end()) {
+        auto node = FindRootNode(date);
+        if (node) {
             SPDLOG_LOGGER_TRACE(pLogger, "Found root node to expand: \"{0}\"", date);
-            auto node = iterator->get();
             array.Add(wxDataViewItem((void*) node));
         }
     }
 
     return array;
 }
+
+TaskTreeModelNode* TaskTreeModel::FindRootNode(const std::string& date) const
+{
+    auto iterator = mRootNodesByDate.find(date);
+    if (iterator == mRootNodesByDate.end()) {
+        return nullptr;
+    }
+
+    return iterator->second;
+}
+
+TaskTreeModelNode* TaskTreeModel::FindChildNode(const std::string& date,
+    const std::int64_t taskId) const
+{
+    auto iterator = mChildNodesByTaskId.find(taskId);
+    if (iterator == mChildNodesByTaskId.end()) {
+        return nullptr;
+    }
+
+    // callers address a task by the date it is filed under, so a node under another root is a miss
+    auto child = iterator->second;
+    if (child->GetParent() != FindRootNode(date)) {
+        SPDLOG_LOGGER_TRACE(
+            pLogger, "Task \"{0}\" is not filed under root node \"{1}\"", taskId, date);
+        return nullptr;
+    }
+
+    return child;
+}
+
+TaskTreeModelNode* TaskTreeModel::AppendChildNode(TaskTreeModelNode* parentNode,
+    Services::TaskViewModel& taskModel)
+{
+    const std::string& projectName = pCfg->UseProjectDisplayName()
+                                         ? taskModel.GetProjectDisplayName()
+                                         : taskModel.GetProjectName();
+
+    auto childNode = new TaskTreeModelNode(parentNode,
+        taskModel.GetWorkdayDate(),
+        taskModel.GetEmployerName(),
+        taskModel.GetClientName(),
+        projectName,
+        taskModel.GetCategoryName(),
+        taskModel.GetDuration(),
+        taskModel.Billable,
+        taskModel.TryGetUniqueIdentifier(),
+        taskModel.GetTrimmedDescription(),
+        taskModel.TaskId);
+    parentNode->Append(childNode);
+    mChildNodesByTaskId[taskModel.TaskId] = childNode;
+
+    return childNode;
+}
+
+void TaskTreeModel::UnindexChildNodes(TaskTreeModelNode* parentNode)
+{
+    for (const auto& child : parentNode->GetChildren()) {
+        mChildNodesByTaskId.erase(child->GetTaskId());
+    }
+}
+
+bool TaskTreeModel::RemoveLoadedDateNode(TaskTreeModelNode* parentNode)
+{
+    auto iterator = std::find(mLoadedDateNodes.begin(), mLoadedDateNodes.end(), parentNode);
+    if (iterator == mLoadedDateNodes.end()) {
+        return false;
+    }
+
+    mLoadedDateNodes.erase(iterator);
+    return true;
+}
+
+wxDataViewItemArray TaskTreeModel::EvictLeastRecentlyUsedDateNodes()
+{
+    wxDataViewItemArray evicted;
+    while (mLoadedDateNodes.size() > MaxLoadedDateNodes) {
+        auto parentNode = mLoadedDateNodes.back();
+        mLoadedDateNodes.pop_back();
+
+        SPDLOG_LOGGER_TRACE(pLogger, "Evict children of root node \"{0}\"", parentNode->GetDate());
+
+        UnindexChildNodes(parentNode);
+
+        wxDataViewItemArray itemsRemoved;
+        for (const auto& child : parentNode->GetChildren()) {
+            itemsRemoved.Add(wxDataViewItem((void*) child.get()));
+        }
+        parentNode->GetChildren().clear();
+        parentNode->ChildrenLoaded(false);
+
+        wxDataViewItem parent((void*) parentNode);
+        ItemsDeleted(parent, itemsRemoved);
+
+        evicted.Add(parent);
+    }
+
+    return evicted;
+}
 } // namespace tks::UI
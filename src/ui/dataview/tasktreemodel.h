@@ -19,8 +19,12 @@
 
 #pragma once
 
+#include <cstdint>
+#include <list>
+#include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include <wx/wxprec.h>
@@ -63,6 +67,9 @@ class TaskTreeModel : public wxDataViewModel
         Col_Max
     };
 
+    /* Upper bound of lazily loaded date nodes that keep their children in memory */
+    static constexpr std::size_t MaxLoadedDateNodes = 31;
+
     TaskTreeModel(const std::vector<std::string>& weekDates,
         std::shared_ptr<Core::Configuration> cfg,
         std::shared_ptr<spdlog::logger> logger);
@@ -92,15 +99,47 @@ class TaskTreeModel : public wxDataViewModel
     void InsertRootAndChildNodes(const std::string& date,
         std::vector<Services::TaskViewModel> models);
 
+    void ApplyTaskChanged(Services::TaskViewModel& taskModel);
+    void ApplyTaskRemoved(const std::int64_t taskId);
+    bool TryGetTaskDate(const std::int64_t taskId, /*out*/ std::string& date) const;
+    bool TryGetTaskDuration(const std::int64_t taskId,
+        /*out*/ int& minutes,
+        /*out*/ bool& billable) const;
+
+    void InsertLazyRootNodes(const std::vector<std::string>& dates,
+        const std::map<std::string, std::int64_t>& taskCounts);
+    bool RequiresChildNodes(const wxDataViewItem& item) const;
+    wxDataViewItemArray LoadChildNodes(const wxDataViewItem& item,
+        std::vector<Services::TaskViewModel> models);
+    void TouchDateNode(const wxDataViewItem& item);
+
+    wxDataViewItem FindDateNode(const std::string& date) const;
+
     wxDataViewItem TryExpandTodayDateNode(const std::string& todaysDate);
     wxDataViewItemArray TryCollapseDateNodes();
 
     wxDataViewItemArray TryExpandAllDateNodes(const std::vector<std::string>& dates);
 
 private:
+    TaskTreeModelNode* FindRootNode(const std::string& date) const;
+    TaskTreeModelNode* FindChildNode(const std::string& date, const std::int64_t taskId) const;
+
+    TaskTreeModelNode* AppendChildNode(TaskTreeModelNode* parentNode,
+        Services::TaskViewModel& taskModel);
+    void UnindexChildNodes(TaskTreeModelNode* parentNode);
+    bool RemoveLoadedDateNode(TaskTreeModelNode* parentNode);
+    wxDataViewItemArray EvictLeastRecentlyUsedDateNodes();
+
     std::shared_ptr<Core::Configuration> pCfg;
     std::shared_ptr<spdlog::logger> pLogger;
     std::vector<std::unique_ptr<TaskTreeModelNode>> pRoots;
+
+    /* Lookup indexes over the nodes owned by pRoots, kept in step with every mutation */
+    std::unordered_map<std::string, TaskTreeModelNode*> mRootNodesByDate;
+    std::unordered_map<std::int64_t, TaskTreeModelNode*> mChildNodesByTaskId;
+
+    /* Lazily loaded date nodes holding children, most recently expanded first */
+    std::list<TaskTreeModelNode*> mLoadedDateNodes;
 };
 } // namespace UI
 } // namespace tks::UI
@@ -34,6 +34,7 @@ TaskTreeModelNode::TaskTreeModelNode(TaskTreeModelNode* parent,
     std::int64_t taskId)
     : pParent(parent)
     , mDate(dateName)
+    , mDisplayDate(dateName)
     , mEmployerName(employerName)
     , mClientName(clientName)
     , mProjectName(projectName)
@@ -44,12 +45,16 @@ TaskTreeModelNode::TaskTreeModelNode(TaskTreeModelNode* parent,
     , mDescription(description)
     , mTaskId(taskId)
     , bContainer(false)
+    , bChildrenLoaded(true)
 {
 }
 
 TaskTreeModelNode::TaskTreeModelNode(TaskTreeModelNode* parent, const std::string& branch)
     : pParent(parent)
     , mDate(branch)
+    , mDisplayDate(branch)
+    , mEmployerName("")
+    , mClientName("")
     , mProjectName("")
     , mCategoryName("")
     , mDuration("")
@@ -58,6 +63,7 @@ TaskTreeModelNode::TaskTreeModelNode(TaskTreeModelNode* parent, const std::strin
     , mDescription("")
     , mTaskId(0)
     , bContainer(true)
+    , bChildrenLoaded(true)
 {
 }
 
@@ -66,6 +72,16 @@ bool TaskTreeModelNode::IsContainer() const
     return bContainer;
 }
 
+bool TaskTreeModelNode::ChildrenLoaded() const
+{
+    return bChildrenLoaded;
+}
+
+void TaskTreeModelNode::ChildrenLoaded(const bool value)
+{
+    bChildrenLoaded = value;
+}
+
 TaskTreeModelNode* TaskTreeModelNode::GetParent()
 {
     return pParent;
@@ -91,37 +107,54 @@ void TaskTreeModelNode::Append(TaskTreeModelNode* child)
     mChildren.push_back(std::unique_ptr<TaskTreeModelNode>(child));
 }
 
+bool TaskTreeModelNode::Remove(TaskTreeModelNode* child)
+{
+    for (auto it = mChildren.begin(); it != mChildren.end(); ++it) {
+        if (it->get() == child) {
+            mChildren.erase(it);
+            return true;
+        }
+    }
+
+    return false;
+}
+
 const unsigned int TaskTreeModelNode::GetChildCount() const
 {
     return mChildren.size();
 }
 
-std::string TaskTreeModelNode::GetDate() const
+const std::string& TaskTreeModelNode::GetDate() const
 {
     return mDate;
 }
 
-std::string TaskTreeModelNode::GetEmployerName() const
+const wxString& TaskTreeModelNode::GetDisplayDate() const
+{
+    return mDisplayDate;
+}
+
+const wxString& TaskTreeModelNode::GetEmployerName() const
 {
     return mEmployerName;
 }
 
-std::string TaskTreeModelNode::GetClientName() const
+const wxString& TaskTreeModelNode::GetClientName() const
 {
     return mClientName;
 }
 
-std::string TaskTreeModelNode::GetProjectName() const
+const wxString& TaskTreeModelNode::GetProjectName() const
 {
     return mProjectName;
 }
 
-std::string TaskTreeModelNode::GetCategoryName() const
+const wxString& TaskTreeModelNode::GetCategoryName() const
 {
     return mCategoryName;
 }
 
-std::string TaskTreeModelNode::GetDuration() const
+const wxString& TaskTreeModelNode::GetDuration() const
 {
     return mDuration;
 }
@@ -131,12 +164,12 @@ bool TaskTreeModelNode::Billable() const
     return bBillable;
 }
 
-std::string TaskTreeModelNode::GetUniqueId() const
+const wxString& TaskTreeModelNode::GetUniqueId() const
 {
     return mUniqueId;
 }
 
-std::string TaskTreeModelNode::GetDescription() const
+const wxString& TaskTreeModelNode::GetDescription() const
 {
     return mDescription;
 }
@@ -149,6 +182,7 @@ std::int64_t TaskTreeModelNode::GetTaskId() const
 void TaskTreeModelNode::SetDate(const std::string& value)
 {
     mDate = value;
+    mDisplayDate = value;
 }
 
 void TaskTreeModelNode::SetEmployerName(const std::string& value)
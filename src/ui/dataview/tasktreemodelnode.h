@@ -51,23 +51,27 @@ class TaskTreeModelNode final
     ~TaskTreeModelNode() = default;
 
     bool IsContainer() const;
+    bool ChildrenLoaded() const;
+    void ChildrenLoaded(const bool value);
     TaskTreeModelNode* GetParent();
     std::vector<std::unique_ptr<TaskTreeModelNode>>& GetChildren();
     TaskTreeModelNode* GetNthChild(unsigned int n);
 
     void Insert(TaskTreeModelNode* child, unsigned int n);
     void Append(TaskTreeModelNode* child);
+    bool Remove(TaskTreeModelNode* child);
     const unsigned int GetChildCount() const;
 
-    std::string GetDate() const;
-    std::string GetEmployerName() const;
-    std::string GetClientName() const;
-    std::string GetProjectName() const;
-    std::string GetCategoryName() const;
-    std::string GetDuration() const;
+    const std::string& GetDate() const;
+    const wxString& GetDisplayDate() const;
+    const wxString& GetEmployerName() const;
+    const wxString& GetClientName() const;
+    const wxString& GetProjectName() const;
+    const wxString& GetCategoryName() const;
+    const wxString& GetDuration() const;
     bool Billable() const;
-    std::string GetUniqueId() const;
-    std::string GetDescription() const;
+    const wxString& GetUniqueId() const;
+    const wxString& GetDescription() const;
     std::int64_t GetTaskId() const;
 
     void SetDate(const std::string& value);
@@ -85,17 +89,20 @@ class TaskTreeModelNode final
     TaskTreeModelNode* pParent;
     std::vector<std::unique_ptr<TaskTreeModelNode>> mChildren;
 
+    /* mDate doubles as the root node lookup key, the rest are held ready for rendering */
     std::string mDate;
-    std::string mEmployerName;
-    std::string mClientName;
-    std::string mProjectName;
-    std::string mCategoryName;
-    std::string mDuration;
+    wxString mDisplayDate;
+    wxString mEmployerName;
+    wxString mClientName;
+    wxString mProjectName;
+    wxString mCategoryName;
+    wxString mDuration;
     bool bBillable;
-    std::string mUniqueId;
-    std::string mDescription;
+    wxString mUniqueId;
+    wxString mDescription;
     std::int64_t mTaskId;
 
     bool bContainer;
+    bool bChildrenLoaded;
 };
 }
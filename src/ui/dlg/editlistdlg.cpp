@@ -41,24 +41,16 @@
 #include "../../common/results/sqliteresult.h"
 #include "../../common/messages/persistencemessages.h"
 
-#include "../../persistence/employerspersistence.h"
-#include "../../persistence/categoriespersistence.h"
-#include "../../persistence/attributegroupspersistence.h"
-#include "../../persistence/attributespersistence.h"
-
-#include "../../models/employermodel.h"
-#include "../../models/categorymodel.h"
-#include "../../models/attributegroupmodel.h"
-#include "../../models/attributemodel.h"
-
-#include "../../services/filterentity/filterentityservice.h"
-#include "../../services/attributes/staticattributegroupviewmodel.h"
-#include "../../services/attributes/staticattributegroupsservice.h"
-
 #include "../../utils/utils.h"
 
 namespace tks::UI::dlg
 {
+namespace
+{
+// long enough to skip the keystrokes of a word typed in one go
+constexpr int SearchDebounceMilliseconds = 250;
+} // namespace
+
 ListCtrlData::ListCtrlData(std::int64_t entityId, const std::string& entityName)
     : EntityId(entityId)
     , EntityName(entityName)
@@ -79,6 +71,7 @@ ListCtrlData::ListCtrlData(std::int64_t entityId,
 EditListDialog::EditListDialog(wxWindow* parent,
     std::shared_ptr<spdlog::logger> logger,
     const std::string& databaseFilePath,
+    std::shared_ptr<Services::DatabaseExecutor> databaseExecutor,
     EditListEntityType editListEntityType,
     const wxString& name)
     : wxDialog(parent,
@@ -99,6 +92,9 @@ EditListDialog::EditListDialog(wxWindow* parent,
     , pCancelButton(nullptr)
     , mDatabaseFilePath(databaseFilePath)
     , mType(editListEntityType)
+    , pEntitySearch(
+          std::make_unique<Services::IncrementalEntitySearch>(databaseExecutor, editListEntityType))
+    , pSearchDebounceTimer(std::make_unique<wxTimer>(this, tksIDC_SEARCHDEBOUNCETIMER))
     , mSearchTerm()
     , mEntityId(-1)
 {
@@ -213,6 +209,13 @@ void EditListDialog::ConfigureEventBindings()
         this
     );
 
+    Bind(
+        wxEVT_TIMER,
+        &EditListDialog::OnSearchDebounce,
+        this,
+        tksIDC_SEARCHDEBOUNCETIMER
+    );
+
     pSearchButton->Bind(
         wxEVT_BUTTON,
         &EditListDialog::OnSearch,
@@ -254,244 +257,19 @@ void EditListDialog::DataToControls()
 {
     AppendColumnsToListControl();
 
-    switch (mType) {
-    case EditListEntityType::Employers:
-        EmployerDataToControls();
-        break;
-    case EditListEntityType::Clients:
-        ClientDataToControls();
-        break;
-    case EditListEntityType::Projects:
-        ProjectDataToControls();
-        break;
-    case EditListEntityType::Categories:
-        CategoryDataToControls();
-        break;
-    case EditListEntityType::AttributeGroups:
-        AttributeGroupDataToControls();
-        break;
-    case EditListEntityType::Attributes:
-        AttributeDataToControls();
-        break;
-    case EditListEntityType::StaticAttributeGroups: {
-        StaticAttributeGroupsDataToControls();
-        break;
-    }
-    default:
-        break;
-    }
-
     SetSizerAndFit(pMainSizer);
 
-    pOkButton->Enable();
-}
-
-void EditListDialog::EmployerDataToControls()
-{
-    std::vector<Model::EmployerModel> employers;
-    std::vector<ListCtrlData> entries;
-    Persistence::EmployersPersistence employerPersistence(pLogger, mDatabaseFilePath);
-
-    auto sqliteResult = employerPersistence.Filter(mSearchTerm, employers);
-    if (!sqliteResult.Success) {
-        wxRichMessageDialog dialog(this,
-            Messages::FilterEmployersMessage,
-            Common::GetProgramName(),
-            wxCENTER | wxCANCEL_DEFAULT | wxOK | wxCANCEL | wxICON_ERROR);
-        dialog.SetExtendedMessage(sqliteResult.FriendlyErrorMessage);
-        dialog.ShowDetailedText(sqliteResult.GetReturnCodeAndMessage());
-
-        dialog.ShowModal();
-    } else {
-        for (auto& employer : employers) {
-            std::string isDefaultString = employer.IsDefault ? "Yes" : "No";
-            ListCtrlData data(employer.EmployerId,
-                employer.Name,
-                std::vector<std::string>{ isDefaultString },
-                employer.DateModified);
-            entries.push_back(data);
-        }
-
-        SetDataToControls(entries);
-    }
-}
-
-void EditListDialog::ClientDataToControls()
-{
-    std::vector<Services::FilterEntityModel> clientModels;
-    std::vector<ListCtrlData> entries;
-    Services::FilterEntityService editClientsService(pLogger, mDatabaseFilePath);
-
-    auto result = editClientsService.FilterClients(mSearchTerm, clientModels);
-    if (!result.Success) {
-        wxRichMessageDialog dialog(this,
-            Messages::FilterClientsMessage,
-            Common::GetProgramName(),
-            wxCENTER | wxCANCEL_DEFAULT | wxOK | wxCANCEL | wxICON_ERROR);
-        dialog.SetExtendedMessage(result.FriendlyErrorMessage);
-        dialog.ShowDetailedText(result.GetReturnCodeAndMessage());
-
-        dialog.ShowModal();
-    } else {
-        for (auto& clientModel : clientModels) {
-            ListCtrlData data(clientModel.EntityId,
-                clientModel.EntityName,
-                clientModel.Metadata,
-                clientModel.EntityDateModified);
-            entries.push_back(data);
-        }
-
-        SetDataToControls(entries);
-    }
-}
-
-void EditListDialog::ProjectDataToControls()
-{
-    std::vector<Services::FilterEntityModel> projectModels;
-    std::vector<ListCtrlData> entries;
-    Services::FilterEntityService editProjectsService(pLogger, mDatabaseFilePath);
-
-    auto sqliteResult = editProjectsService.FilterProjects(mSearchTerm, projectModels);
-    if (!sqliteResult.Success) {
-        wxRichMessageDialog dialog(this,
-            Messages::FilterProjectsMessage,
-            Common::GetProgramName(),
-            wxCENTER | wxCANCEL_DEFAULT | wxOK | wxCANCEL | wxICON_ERROR);
-        dialog.SetExtendedMessage(sqliteResult.FriendlyErrorMessage);
-        dialog.ShowDetailedText(sqliteResult.GetReturnCodeAndMessage());
-
-        dialog.ShowModal();
-    } else {
-        for (const auto& project : projectModels) {
-            ListCtrlData data(
-                project.EntityId, project.EntityName, project.Metadata, project.EntityDateModified);
-            entries.push_back(data);
-        }
-
-        SetDataToControls(entries);
-    }
-}
-
-void EditListDialog::CategoryDataToControls()
-{
-    std::vector<Services::FilterEntityModel> cateogryModels;
-    std::vector<ListCtrlData> entries;
-    Services::FilterEntityService editCategoriesService(pLogger, mDatabaseFilePath);
-
-    auto sqliteResult = editCategoriesService.FilterCategories(mSearchTerm, cateogryModels);
-    if (!sqliteResult.Success) {
-        wxRichMessageDialog dialog(this,
-            Messages::FilterCategoriesMessage,
-            Common::GetProgramName(),
-            wxCENTER | wxCANCEL_DEFAULT | wxOK | wxCANCEL | wxICON_ERROR);
-        dialog.SetExtendedMessage(sqliteResult.FriendlyErrorMessage);
-        dialog.ShowDetailedText(sqliteResult.GetReturnCodeAndMessage());
-
-        dialog.ShowModal();
-    } else {
-        for (const auto& category : cateogryModels) {
-            ListCtrlData data(category.EntityId,
-                category.EntityName,
-                category.Metadata,
-                category.EntityDateModified);
-            entries.push_back(data);
-        }
-
-        SetDataToControls(entries);
-    }
-}
-
-void EditListDialog::AttributeGroupDataToControls()
-{
-    std::vector<Services::FilterEntityModel> attributeGroupModels;
-    std::vector<ListCtrlData> entries;
-    Services::FilterEntityService editAttributeGroupsService(pLogger, mDatabaseFilePath);
-
-    auto sqliteResult =
-        editAttributeGroupsService.FilterAttributeGroups(mSearchTerm, attributeGroupModels);
-    if (!sqliteResult.Success) {
-        wxRichMessageDialog dialog(this,
-            Messages::FilterAttributeGroupsMessage,
-            Common::GetProgramName(),
-            wxCENTER | wxCANCEL_DEFAULT | wxOK | wxCANCEL | wxICON_ERROR);
-        dialog.SetExtendedMessage(sqliteResult.FriendlyErrorMessage);
-        dialog.ShowDetailedText(sqliteResult.GetReturnCodeAndMessage());
-
-        dialog.ShowModal();
-    } else {
-        for (auto& attributeGroup : attributeGroupModels) {
-            ListCtrlData data(attributeGroup.EntityId,
-                attributeGroup.EntityName,
-                attributeGroup.Metadata,
-                attributeGroup.EntityDateModified);
-            entries.push_back(data);
-        }
-
-        SetDataToControls(entries);
-    }
-}
-
-void EditListDialog::AttributeDataToControls()
-{
-    std::vector<Services::FilterEntityModel> attributeModels;
-    std::vector<ListCtrlData> entries;
-    Services::FilterEntityService editAttributesService(pLogger, mDatabaseFilePath);
-
-    auto sqliteResult = editAttributesService.FilterAttributes(mSearchTerm, attributeModels);
-    if (!sqliteResult.Success) {
-        wxRichMessageDialog dialog(this,
-            Messages::FilterAttributeGroupsMessage,
-            Common::GetProgramName(),
-            wxCENTER | wxCANCEL_DEFAULT | wxOK | wxCANCEL | wxICON_ERROR);
-        dialog.SetExtendedMessage(sqliteResult.FriendlyErrorMessage);
-        dialog.ShowDetailedText(sqliteResult.GetReturnCodeAndMessage());
-
-        dialog.ShowModal();
-    } else {
-        for (auto& attributeGroup : attributeModels) {
-            ListCtrlData data(attributeGroup.EntityId,
-                attributeGroup.EntityName,
-                attributeGroup.Metadata,
-                attributeGroup.EntityDateModified);
-            entries.push_back(data);
-        }
-
-        SetDataToControls(entries);
-    }
-}
-
-void EditListDialog::StaticAttributeGroupsDataToControls()
-{
-    std::vector<Services::FilterEntityModel> staticAttributeModels;
-    std::vector<ListCtrlData> entries;
-    Services::FilterEntityService staticAttributesService(pLogger, mDatabaseFilePath);
-
-    auto sqliteResult =
-        staticAttributesService.FilterStaticAttributes(mSearchTerm, staticAttributeModels);
-    if (!sqliteResult.Success) {
-        wxRichMessageDialog dialog(this,
-            Messages::FilterAttributeGroupsMessage,
-            Common::GetProgramName(),
-            wxCENTER | wxCANCEL_DEFAULT | wxOK | wxCANCEL | wxICON_ERROR);
-        dialog.SetExtendedMessage(sqliteResult.FriendlyErrorMessage);
-        dialog.ShowDetailedText(sqliteResult.GetReturnCodeAndMessage());
-
-        dialog.ShowModal();
-    } else {
-        for (auto& attributeGroup : staticAttributeModels) {
-            ListCtrlData data(attributeGroup.EntityId,
-                attributeGroup.EntityName,
-                attributeGroup.Metadata,
-                attributeGroup.EntityDateModified);
-            entries.push_back(data);
-        }
+    Search();
 
-        SetDataToControls(entries);
-    }
+    pOkButton->Enable();
 }
 
 void EditListDialog::SetDataToControls(const std::vector<ListCtrlData>& entries)
 {
+    // one repaint for the whole result set rather than one per row
+    pListCtrl->Freeze();
+    pListCtrl->DeleteAllItems();
+
     int listIndex = 0;
     int columnIndex = 0;
     for (auto& entry : entries) {
@@ -503,16 +281,31 @@ void EditListDialog::SetDataToControls(const std::vector<ListCtrlData>& entries)
         pListCtrl->SetItemPtrData(listIndex, static_cast<wxUIntPtr>(entry.EntityId));
         columnIndex = 0;
     }
+
+    pListCtrl->Thaw();
 }
 
 void EditListDialog::OnSearchTextChange(wxCommandEvent& event)
 {
     std::string value = pSearchTextCtrl->GetValue().ToStdString();
     mSearchTerm = Utils::TrimWhitespace(value);
+
+    pSearchDebounceTimer->StartOnce(SearchDebounceMilliseconds);
+}
+
+void EditListDialog::OnSearchDebounce(wxTimerEvent& WXUNUSED(event))
+{
+    // one or two characters match too much to query per keystroke, the search button explains
+    // the minimum length
+    if (mSearchTerm.empty() || mSearchTerm.length() >= 3) {
+        Search();
+    }
 }
 
 void EditListDialog::OnSearch(wxCommandEvent& event)
 {
+    pSearchDebounceTimer->Stop();
+
     if (mSearchTerm.length() < 3) {
         wxRichToolTip toolTip("", "Please enter 3 or more characters to search");
         toolTip.ShowFor(pSearchTextCtrl);
@@ -523,6 +316,8 @@ void EditListDialog::OnSearch(wxCommandEvent& event)
 
 void EditListDialog::OnReset(wxCommandEvent& event)
 {
+    pSearchDebounceTimer->Stop();
+
     mSearchTerm = "";
     pSearchTextCtrl->ChangeValue(wxEmptyString);
     Search();
@@ -576,7 +371,9 @@ void EditListDialog::OnItemDoubleClick(wxListEvent& event)
     mEntityId = -1;
     mSearchTerm = "";
     pSearchTextCtrl->ChangeValue(wxEmptyString);
-    pListCtrl->DeleteAllItems();
+
+    // the entity may have been renamed or deactivated, so the last results are stale
+    pEntitySearch->Invalidate();
     Search();
 }
 
@@ -592,249 +389,36 @@ void EditListDialog::OnCancel(wxCommandEvent& event)
 
 void EditListDialog::Search()
 {
-    switch (mType) {
-    case EditListEntityType::Employers:
-        SearchEmployers();
-        break;
-    case EditListEntityType::Clients:
-        SearchClients();
-        break;
-    case EditListEntityType::Projects:
-        SearchProjects();
-        break;
-    case EditListEntityType::Categories:
-        SearchCategories();
-        break;
-    case EditListEntityType::AttributeGroups:
-        SearchAttributeGroups();
-        break;
-    case EditListEntityType::Attributes:
-        SearchAttributes();
-        break;
-    case EditListEntityType::StaticAttributeGroups:
-        SearchStaticAttributeGroups();
-        break;
-    default:
-        break;
-    }
+    pEntitySearch->Search(mSearchTerm,
+        [this](const SqliteResult& result,
+            const std::vector<Services::FilterEntityModel>& models) {
+            OnSearchCompleted(result, models);
+        });
 }
 
-void EditListDialog::SearchEmployers()
+void EditListDialog::OnSearchCompleted(const SqliteResult& result,
+    const std::vector<Services::FilterEntityModel>& models)
 {
-    pListCtrl->DeleteAllItems();
-
-    std::vector<Model::EmployerModel> employers;
-    std::vector<ListCtrlData> entries;
-    Persistence::EmployersPersistence employerPersistence(pLogger, mDatabaseFilePath);
-
-    auto sqliteResult = employerPersistence.Filter(mSearchTerm, employers);
-    if (!sqliteResult.Success) {
-        wxRichMessageDialog dialog(this,
-            Messages::FilterEmployersMessage,
-            Common::GetProgramName(),
-            wxCENTER | wxCANCEL_DEFAULT | wxOK | wxCANCEL | wxICON_ERROR);
-        dialog.SetExtendedMessage(sqliteResult.FriendlyErrorMessage);
-        dialog.ShowDetailedText(sqliteResult.GetReturnCodeAndMessage());
-
-        dialog.ShowModal();
-    } else {
-        for (auto& employer : employers) {
-            std::string isDefaultString = employer.IsDefault ? "Yes" : "No";
-            ListCtrlData data(employer.EmployerId,
-                employer.Name,
-                std::vector<std::string>{ isDefaultString },
-                employer.DateModified);
-            entries.push_back(data);
-        }
-
-        SetDataToControls(entries);
-    }
-}
-
-void EditListDialog::SearchClients()
-{
-    pListCtrl->DeleteAllItems();
-
-    std::vector<Services::FilterEntityModel> clientModels;
-    std::vector<ListCtrlData> entries;
-    Services::FilterEntityService editClientsService(pLogger, mDatabaseFilePath);
-
-    auto result = editClientsService.FilterClients(mSearchTerm, clientModels);
     if (!result.Success) {
         wxRichMessageDialog dialog(this,
-            Messages::FilterClientsMessage,
+            GetFilterErrorMessage(),
             Common::GetProgramName(),
             wxCENTER | wxCANCEL_DEFAULT | wxOK | wxCANCEL | wxICON_ERROR);
         dialog.SetExtendedMessage(result.FriendlyErrorMessage);
         dialog.ShowDetailedText(result.GetReturnCodeAndMessage());
 
         dialog.ShowModal();
-    } else {
-        for (auto& clientModel : clientModels) {
-            ListCtrlData data(clientModel.EntityId,
-                clientModel.EntityName,
-                clientModel.Metadata,
-                clientModel.EntityDateModified);
-            entries.push_back(data);
-        }
-
-        SetDataToControls(entries);
+        return;
     }
-}
-
-void EditListDialog::SearchProjects()
-{
-    pListCtrl->DeleteAllItems();
 
-    std::vector<Services::FilterEntityModel> projectModels;
     std::vector<ListCtrlData> entries;
-    Services::FilterEntityService editProjectsService(pLogger, mDatabaseFilePath);
-
-    auto sqliteResult = editProjectsService.FilterProjects(mSearchTerm, projectModels);
-    if (!sqliteResult.Success) {
-        wxRichMessageDialog dialog(this,
-            Messages::FilterProjectsMessage,
-            Common::GetProgramName(),
-            wxCENTER | wxCANCEL_DEFAULT | wxOK | wxCANCEL | wxICON_ERROR);
-        dialog.SetExtendedMessage(sqliteResult.FriendlyErrorMessage);
-        dialog.ShowDetailedText(sqliteResult.GetReturnCodeAndMessage());
-
-        dialog.ShowModal();
-    } else {
-        for (const auto& project : projectModels) {
-            ListCtrlData data(
-                project.EntityId, project.EntityName, project.Metadata, project.EntityDateModified);
-            entries.push_back(data);
-        }
-
-        SetDataToControls(entries);
+    entries.reserve(models.size());
+    for (const auto& model : models) {
+        entries.emplace_back(
+            model.EntityId, model.EntityName, model.Metadata, model.EntityDateModified);
     }
-}
-
-void EditListDialog::SearchCategories()
-{
-    pListCtrl->DeleteAllItems();
 
-    std::vector<Services::FilterEntityModel> cateogryModels;
-    std::vector<ListCtrlData> entries;
-    Services::FilterEntityService editCategoriesService(pLogger, mDatabaseFilePath);
-
-    auto sqliteResult = editCategoriesService.FilterCategories(mSearchTerm, cateogryModels);
-    if (!sqliteResult.Success) {
-        wxRichMessageDialog dialog(this,
-            Messages::FilterCategoriesMessage,
-            Common::GetProgramName(),
-            wxCENTER | wxCANCEL_DEFAULT | wxOK | wxCANCEL | wxICON_ERROR);
-        dialog.SetExtendedMessage(sqliteResult.FriendlyErrorMessage);
-        dialog.ShowDetailedText(sqliteResult.GetReturnCodeAndMessage());
-
-        dialog.ShowModal();
-    } else {
-        for (const auto& category : cateogryModels) {
-            ListCtrlData data(category.EntityId,
-                category.EntityName,
-                category.Metadata,
-                category.EntityDateModified);
-            entries.push_back(data);
-        }
-
-        SetDataToControls(entries);
-    }
-}
-
-void EditListDialog::SearchAttributeGroups()
-{
-    pListCtrl->DeleteAllItems();
-
-    std::vector<Services::FilterEntityModel> attributeGroupModels;
-    std::vector<ListCtrlData> entries;
-    Services::FilterEntityService editAttributeGroupsService(pLogger, mDatabaseFilePath);
-
-    auto sqliteResult =
-        editAttributeGroupsService.FilterAttributeGroups(mSearchTerm, attributeGroupModels);
-    if (!sqliteResult.Success) {
-        wxRichMessageDialog dialog(this,
-            Messages::FilterAttributeGroupsMessage,
-            Common::GetProgramName(),
-            wxCENTER | wxCANCEL_DEFAULT | wxOK | wxCANCEL | wxICON_ERROR);
-        dialog.SetExtendedMessage(sqliteResult.FriendlyErrorMessage);
-        dialog.ShowDetailedText(sqliteResult.GetReturnCodeAndMessage());
-
-        dialog.ShowModal();
-    } else {
-        for (auto& attributeGroup : attributeGroupModels) {
-            ListCtrlData data(attributeGroup.EntityId,
-                attributeGroup.EntityName,
-                attributeGroup.Metadata,
-                attributeGroup.EntityDateModified);
-            entries.push_back(data);
-        }
-
-        SetDataToControls(entries);
-    }
-}
-
-void EditListDialog::SearchAttributes()
-{
-    pListCtrl->DeleteAllItems();
-
-    std::vector<Services::FilterEntityModel> attributeModels;
-    std::vector<ListCtrlData> entries;
-    Services::FilterEntityService editAttributesService(pLogger, mDatabaseFilePath);
-
-    auto sqliteResult = editAttributesService.FilterAttributeGroups(mSearchTerm, attributeModels);
-    if (!sqliteResult.Success) {
-        wxRichMessageDialog dialog(this,
-            Messages::FilterAttributeGroupsMessage,
-            Common::GetProgramName(),
-            wxCENTER | wxCANCEL_DEFAULT | wxOK | wxCANCEL | wxICON_ERROR);
-        dialog.SetExtendedMessage(sqliteResult.FriendlyErrorMessage);
-        dialog.ShowDetailedText(sqliteResult.GetReturnCodeAndMessage());
-
-        dialog.ShowModal();
-    } else {
-        for (auto& attributeGroup : attributeModels) {
-            ListCtrlData data(attributeGroup.EntityId,
-                attributeGroup.EntityName,
-                attributeGroup.Metadata,
-                attributeGroup.EntityDateModified);
-            entries.push_back(data);
-        }
-
-        SetDataToControls(entries);
-    }
-}
-
-void EditListDialog::SearchStaticAttributeGroups()
-{
-    pListCtrl->DeleteAllItems();
-
-    std::vector<Services::FilterEntityModel> staticAttributeModels;
-    std::vector<ListCtrlData> entries;
-    Services::FilterEntityService staticAttributesService(pLogger, mDatabaseFilePath);
-
-    auto sqliteResult =
-        staticAttributesService.FilterStaticAttributes(mSearchTerm, staticAttributeModels);
-    if (!sqliteResult.Success) {
-        wxRichMessageDialog dialog(this,
-            Messages::FilterAttributeGroupsMessage,
-            Common::GetProgramName(),
-            wxCENTER | wxCANCEL_DEFAULT | wxOK | wxCANCEL | wxICON_ERROR);
-        dialog.SetExtendedMessage(sqliteResult.FriendlyErrorMessage);
-        dialog.ShowDetailedText(sqliteResult.GetReturnCodeAndMessage());
-
-        dialog.ShowModal();
-    } else {
-        for (auto& attributeGroup : staticAttributeModels) {
-            ListCtrlData data(attributeGroup.EntityId,
-                attributeGroup.EntityName,
-                attributeGroup.Metadata,
-                attributeGroup.EntityDateModified);
-            entries.push_back(data);
-        }
-
-        SetDataToControls(entries);
-    }
+    SetDataToControls(entries);
 }
 
 std::string EditListDialog::GetSearchHintText()
@@ -859,6 +443,26 @@ std::string EditListDialog::GetSearchHintText()
     }
 }
 
+std::string EditListDialog::GetFilterErrorMessage()
+{
+    switch (mType) {
+    case EditListEntityType::Employers:
+        return Messages::FilterEmployersMessage;
+    case EditListEntityType::Clients:
+        return Messages::FilterClientsMessage;
+    case EditListEntityType::Projects:
+        return Messages::FilterProjectsMessage;
+    case EditListEntityType::Categories:
+        return Messages::FilterCategoriesMessage;
+    case EditListEntityType::Attributes:
+        return Messages::FilterAttributesMessage;
+    case EditListEntityType::AttributeGroups:
+    case EditListEntityType::StaticAttributeGroups:
+    default:
+        return Messages::FilterAttributeGroupsMessage;
+    }
+}
+
 void EditListDialog::AppendColumnsToListControl()
 {
     int columnIndex = 0;
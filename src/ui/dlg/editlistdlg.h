@@ -22,6 +22,7 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <wx/wxprec.h>
 #ifndef WX_PRECOMP
@@ -33,6 +34,12 @@
 
 #include "../../common/enums.h"
 
+#include "../../common/results/sqliteresult.h"
+
+#include "../../services/executor/databaseexecutor.h"
+#include "../../services/filterentity/filterentityservice.h"
+#include "../../services/filterentity/incrementalentitysearch.h"
+
 namespace tks::UI::dlg
 {
 struct ListCtrlData {
@@ -56,6 +63,7 @@ class EditListDialog final : public wxDialog
     EditListDialog(wxWindow* parent,
         std::shared_ptr<spdlog::logger> logger,
         const std::string& databaseFilePath,
+        std::shared_ptr<Services::DatabaseExecutor> databaseExecutor,
         EditListEntityType editListEntityType,
         const wxString& name = "editlistdlg");
     virtual ~EditListDialog() = default;
@@ -71,17 +79,10 @@ class EditListDialog final : public wxDialog
     void ConfigureEventBindings();
     void DataToControls();
 
-    void EmployerDataToControls();
-    void ClientDataToControls();
-    void ProjectDataToControls();
-    void CategoryDataToControls();
-    void AttributeGroupDataToControls();
-    void AttributeDataToControls();
-    void StaticAttributeGroupsDataToControls();
-
     void SetDataToControls(const std::vector<ListCtrlData>& entries);
 
     void OnSearchTextChange(wxCommandEvent& event);
+    void OnSearchDebounce(wxTimerEvent& event);
     void OnSearch(wxCommandEvent& event);
     void OnReset(wxCommandEvent& event);
     void OnItemDoubleClick(wxListEvent& event);
@@ -89,15 +90,11 @@ class EditListDialog final : public wxDialog
     void OnCancel(wxCommandEvent& event);
 
     void Search();
-    void SearchEmployers();
-    void SearchClients();
-    void SearchProjects();
-    void SearchCategories();
-    void SearchAttributeGroups();
-    void SearchAttributes();
-    void SearchStaticAttributeGroups();
+    void OnSearchCompleted(const SqliteResult& result,
+        const std::vector<Services::FilterEntityModel>& models);
 
     std::string GetSearchHintText();
+    std::string GetFilterErrorMessage();
 
     void AppendColumnsToListControl();
 
@@ -118,6 +115,9 @@ class EditListDialog final : public wxDialog
     std::string mDatabaseFilePath;
     EditListEntityType mType;
 
+    std::unique_ptr<Services::IncrementalEntitySearch> pEntitySearch;
+    std::unique_ptr<wxTimer> pSearchDebounceTimer;
+
     std::string mSearchTerm;
     std::int64_t mEntityId;
 
@@ -125,7 +125,8 @@ class EditListDialog final : public wxDialog
         tksIDC_LISTRESULTS = wxID_HIGHEST + 1001,
         tksIDC_SEARCHTEXTCTRL,
         tksIDC_SEARCHBUTTON,
-        tksIDC_RESETBUTTON
+        tksIDC_RESETBUTTON,
+        tksIDC_SEARCHDEBOUNCETIMER
     };
 };
 } // namespace tks::UI::dlg
@@ -52,19 +52,17 @@
 #include "../../models/staticattributevaluemodel.h"
 #include "../../models/attendedmeetingmodel.h"
 
-#include "../../persistence/employerspersistence.h"
-#include "../../persistence/clientspersistence.h"
-#include "../../persistence/projectspersistence.h"
+#include "../../persistence/base/workdayidcache.h"
+
 #include "../../persistence/categoriespersistence.h"
 #include "../../persistence/workdayspersistence.h"
 #include "../../persistence/taskspersistence.h"
-#include "../../persistence/attributegroupspersistence.h"
 #include "../../persistence/taskattributevaluespersistence.h"
 #include "../../persistence/staticattributevaluespersistence.h"
 #include "../../persistence/attendedmeetingspersistence.h"
 
 #include "../../services/categories/categoryviewmodel.h"
-#include "../../services/categories/categoryservice.h"
+#include "../../services/referencedata/referenceentitycache.h"
 
 #include "../../utils/utils.h"
 
@@ -201,9 +199,9 @@ void TaskDialog::UpdateChoicesFromAttendedMeeting(const std::int64_t employerId,
 
         // select an employer from attended meetings frame
         Model::EmployerModel employerModel;
-        Persistence::EmployersPersistence employerPersistence(pLogger, mDatabaseFilePath);
+        Services::ReferenceEntityCache employersCache(pLogger, mDatabaseFilePath);
 
-        auto sqliteResult = employerPersistence.GetById(mEmployerId, employerModel);
+        auto sqliteResult = employersCache.GetEmployerById(mEmployerId, employerModel);
         if (!sqliteResult.Success) {
             wxRichMessageDialog dialog(this,
                 Messages::FilterEmployersMessage,
@@ -219,9 +217,9 @@ void TaskDialog::UpdateChoicesFromAttendedMeeting(const std::int64_t employerId,
 
         // set a client (if applicable)
         std::vector<Model::ClientModel> clients;
-        Persistence::ClientsPersistence clientsPersistence(pLogger, mDatabaseFilePath);
+        Services::ReferenceEntityCache clientsCache(pLogger, mDatabaseFilePath);
 
-        auto result = clientsPersistence.FilterByEmployerId(mEmployerId, clients);
+        auto result = clientsCache.FilterClientsByEmployerId(mEmployerId, clients);
         if (!result.Success) {
             wxRichMessageDialog dialog(this,
                 Messages::FilterClientsByEmployerMessage,
@@ -248,9 +246,9 @@ void TaskDialog::UpdateChoicesFromAttendedMeeting(const std::int64_t employerId,
 
         // populate project choice control and set selected project
         std::vector<Model::ProjectModel> projects;
-        Persistence::ProjectsPersistence projectPersistence(pLogger, mDatabaseFilePath);
+        Services::ReferenceEntityCache projectsCache(pLogger, mDatabaseFilePath);
 
-        sqliteResult = projectPersistence.FilterByEmployerId(mEmployerId, projects);
+        sqliteResult = projectsCache.FilterProjectsByEmployerId(mEmployerId, projects);
         if (!sqliteResult.Success) {
             wxRichMessageDialog dialog(this,
                 Messages::FilterProjectsMessage,
@@ -274,17 +272,17 @@ void TaskDialog::UpdateChoicesFromAttendedMeeting(const std::int64_t employerId,
 
             // populate category choice control and select category
             std::vector<Services::CategoryViewModel> categories;
-            Services::CategoryService categoryService(pLogger, mDatabaseFilePath);
+            Services::ReferenceEntityCache categoriesCache(pLogger, mDatabaseFilePath);
 
             tks::SqliteResult sqliteResult;
             std::string operationMessage;
 
             if (pCfg->ShowProjectAssociatedCategories()) {
-                sqliteResult =
-                    categoryService.FilterByProjectId(mProjectIdFromAttendedMeeting, categories);
+                sqliteResult = categoriesCache.FilterCategoriesByProjectId(
+                    mProjectIdFromAttendedMeeting, categories);
                 operationMessage = Messages::FilterCategoriesByProjectMessage;
             } else {
-                sqliteResult = categoryService.Filter(categories);
+                sqliteResult = categoriesCache.FilterCategories(categories);
                 operationMessage = Messages::FilterCategoriesMessage;
             }
 
@@ -642,8 +640,6 @@ void TaskDialog::FillControls()
     pTaskDescriptionCharCountStaticText->SetLabel(
         std::to_string(pCfg->GetMaximumDescriptionLength()));
 
-    std::string defaultSearchTerm = "";
-
     pAttributeGroupChoiceCtrl->Append("Select attribute group", new ClientData<std::int64_t>(-1));
     pAttributeGroupChoiceCtrl->SetSelection(0);
 
@@ -662,9 +658,9 @@ void TaskDialog::FillControls()
 
     // Fill Attribute Group choice control with data
     std::vector<Model::AttributeGroupModel> attributeGroupModels;
-    Persistence::AttributeGroupsPersistence attributeGroupsPersistence(pLogger, mDatabaseFilePath);
+    Services::ReferenceEntityCache attributeGroupsCache(pLogger, mDatabaseFilePath);
 
-    auto sqliteResult = attributeGroupsPersistence.Filter(defaultSearchTerm, attributeGroupModels);
+    auto sqliteResult = attributeGroupsCache.FilterAttributeGroups(attributeGroupModels);
     if (!sqliteResult.Success) {
         wxRichMessageDialog dialog(this,
             Messages::FilterAttributeGroupsMessage,
@@ -734,9 +730,9 @@ void TaskDialog::FillControls()
     }
 
     std::vector<Model::EmployerModel> employers;
-    Persistence::EmployersPersistence employerPersistence(pLogger, mDatabaseFilePath);
+    Services::ReferenceEntityCache employersCache(pLogger, mDatabaseFilePath);
 
-    sqliteResult = employerPersistence.Filter(defaultSearchTerm, employers);
+    sqliteResult = employersCache.FilterEmployers(employers);
     if (!sqliteResult.Success) {
         wxRichMessageDialog dialog(this,
             Messages::FilterEmployersMessage,
@@ -759,9 +755,9 @@ void TaskDialog::FillControls()
     }
 
     std::vector<Model::ClientModel> clients;
-    Persistence::ClientsPersistence clientsPersistence(pLogger, mDatabaseFilePath);
+    Services::ReferenceEntityCache clientsCache(pLogger, mDatabaseFilePath);
 
-    auto result = clientsPersistence.FilterByEmployerId(mEmployerId, clients);
+    auto result = clientsCache.FilterClientsByEmployerId(mEmployerId, clients);
     if (!result.Success) {
         wxRichMessageDialog dialog(this,
             Messages::FilterClientsByEmployerMessage,
@@ -788,9 +784,9 @@ void TaskDialog::FillControls()
 
     if (!bIsEdit) {
         std::vector<Model::ProjectModel> projects;
-        Persistence::ProjectsPersistence projectPersistence(pLogger, mDatabaseFilePath);
+        Services::ReferenceEntityCache projectsCache(pLogger, mDatabaseFilePath);
 
-        sqliteResult = projectPersistence.FilterByEmployerId(mEmployerId, projects);
+        sqliteResult = projectsCache.FilterProjectsByEmployerId(mEmployerId, projects);
         if (!sqliteResult.Success) {
             wxRichMessageDialog dialog(this,
                 Messages::FilterProjectsMessage,
@@ -968,9 +964,9 @@ void TaskDialog::DataToControls()
     if (!employerSelected) {
         // load employer
         Model::EmployerModel employerModel;
-        Persistence::EmployersPersistence employerPersistence(pLogger, mDatabaseFilePath);
+        Services::ReferenceEntityCache employersCache(pLogger, mDatabaseFilePath);
 
-        auto sqliteResult = employerPersistence.GetById(mEmployerId, employerModel);
+        auto sqliteResult = employersCache.GetEmployerById(mEmployerId, employerModel);
         if (!sqliteResult.Success) {
             wxRichMessageDialog dialog(this,
                 Messages::CreateEmployerMessage,
@@ -989,9 +985,9 @@ void TaskDialog::DataToControls()
 
     // load project
     Model::ProjectModel projectModel;
-    Persistence::ProjectsPersistence projectPersistence(pLogger, mDatabaseFilePath);
+    Services::ReferenceEntityCache projectsCache(pLogger, mDatabaseFilePath);
 
-    sqliteResult = projectPersistence.GetById(taskModel.ProjectId, projectModel);
+    sqliteResult = projectsCache.GetProjectById(taskModel.ProjectId, projectModel);
     if (!sqliteResult.Success) {
         wxRichMessageDialog dialog(this,
             Messages::FilterProjectsMessage,
@@ -1008,7 +1004,7 @@ void TaskDialog::DataToControls()
         // load projects
         std::vector<Model::ProjectModel> projects;
 
-        auto sqliteResult = projectPersistence.FilterByEmployerIdOrClientId(
+        auto sqliteResult = projectsCache.FilterProjectsByEmployerIdOrClientId(
             std::make_optional(projectModel.EmployerId),
             projectModel.ClientId.has_value() ? projectModel.ClientId : std::nullopt,
             projects);
@@ -1040,13 +1036,12 @@ void TaskDialog::DataToControls()
     pProjectChoiceCtrl->SetStringSelection(projectModel.DisplayName);
 
     // load clients
-    Persistence::ClientsPersistence clientsPersistence(pLogger, mDatabaseFilePath);
+    Services::ReferenceEntityCache clientsCache(pLogger, mDatabaseFilePath);
 
     if (!employerSelected) {
         std::vector<Model::ClientModel> clients;
-        std::string defaultSearchTerm = "";
 
-        auto result = clientsPersistence.Filter(defaultSearchTerm, clients);
+        auto result = clientsCache.FilterClients(clients);
         if (!result.Success) {
             wxRichMessageDialog dialog(this,
                 Messages::FilterClientsByEmployerMessage,
@@ -1068,7 +1063,7 @@ void TaskDialog::DataToControls()
                     Model::ClientModel client;
 
                     auto sqliteResult =
-                        clientsPersistence.GetById(projectModel.ClientId.value(), client);
+                        clientsCache.GetClientById(projectModel.ClientId.value(), client);
                     if (!sqliteResult.Success) {
                         wxRichMessageDialog dialog(this,
                             Messages::GetByIdClientMessage,
@@ -1090,7 +1085,7 @@ void TaskDialog::DataToControls()
         if (projectModel.ClientId.has_value()) {
             Model::ClientModel client;
 
-            auto sqliteResult = clientsPersistence.GetById(projectModel.ClientId.value(), client);
+            auto sqliteResult = clientsCache.GetClientById(projectModel.ClientId.value(), client);
             if (!sqliteResult.Success) {
                 wxRichMessageDialog dialog(this,
                     Messages::GetByIdClientMessage,
@@ -1109,15 +1104,15 @@ void TaskDialog::DataToControls()
     // load categories
     ResetCategoryChoiceControl();
 
-    Services::CategoryService categoryService(pLogger, mDatabaseFilePath);
+    Services::ReferenceEntityCache categoriesCache(pLogger, mDatabaseFilePath);
     std::vector<Services::CategoryViewModel> categories;
     std::string operationMessage;
 
     if (pCfg->ShowProjectAssociatedCategories()) {
-        sqliteResult = categoryService.FilterByProjectId(taskModel.ProjectId, categories);
+        sqliteResult = categoriesCache.FilterCategoriesByProjectId(taskModel.ProjectId, categories);
         operationMessage = Messages::FilterCategoriesByProjectMessage;
     } else {
-        sqliteResult = categoryService.Filter(categories);
+        sqliteResult = categoriesCache.FilterCategories(categories);
         operationMessage = Messages::FilterCategoriesMessage;
     }
 
@@ -1143,7 +1138,7 @@ void TaskDialog::DataToControls()
         }
 
         Services::CategoryViewModel category;
-        sqliteResult = categoryService.GetById(taskModel.CategoryId, category);
+        sqliteResult = categoriesCache.GetCategoryById(taskModel.CategoryId, category);
         if (!sqliteResult.Success) {
             wxRichMessageDialog dialog(this,
                 Messages::GetByIdCategoryMessage,
@@ -1300,9 +1295,10 @@ void TaskDialog::OnAttributeGroupChoiceSelection(wxCommandEvent& event)
     mAttributeGroupId = attributeGroupId;
 
     Model::AttributeGroupModel attributeGroupModel;
-    Persistence::AttributeGroupsPersistence attributeGroupsPersistence(pLogger, mDatabaseFilePath);
+    Services::ReferenceEntityCache attributeGroupsCache(pLogger, mDatabaseFilePath);
 
-    auto sqliteResult = attributeGroupsPersistence.GetById(mAttributeGroupId, attributeGroupModel);
+    auto sqliteResult =
+        attributeGroupsCache.GetAttributeGroupById(mAttributeGroupId, attributeGroupModel);
     if (!sqliteResult.Success) {
         wxRichMessageDialog dialog(this,
             Messages::GetByIdAttributeGroupMessage,
@@ -1546,20 +1542,25 @@ void TaskDialog::OnOK(wxCommandEvent& event)
 
     TransferDataFromControls();
 
-    Persistence::WorkdaysPersistence workdayPersistence(pLogger, mDatabaseFilePath);
     std::int64_t workdayId = -1;
-    auto sqliteResult = workdayPersistence.GetWorkdayIdByDate(workdayId, mDate);
+    tks::SqliteResult sqliteResult;
 
-    if (!sqliteResult.Success) {
-        wxRichMessageDialog dialog(this,
-            Messages::GetWorkdayIdByDateMessage,
-            tks::Common::GetProgramName(),
-            wxCENTER | wxCANCEL_DEFAULT | wxOK | wxCANCEL | wxICON_ERROR);
-        dialog.SetExtendedMessage(sqliteResult.FriendlyErrorMessage);
-        dialog.ShowDetailedText(sqliteResult.GetReturnCodeAndMessage());
+    // a cached date does not need a connection at all
+    if (!Persistence::WorkdayIdCache::GetInstance().TryGet(mDatabaseFilePath, mDate, workdayId)) {
+        Persistence::WorkdaysPersistence workdayPersistence(pLogger, mDatabaseFilePath);
+        sqliteResult = workdayPersistence.GetWorkdayIdByDate(workdayId, mDate);
 
-        dialog.ShowModal();
-        return;
+        if (!sqliteResult.Success) {
+            wxRichMessageDialog dialog(this,
+                Messages::GetWorkdayIdByDateMessage,
+                tks::Common::GetProgramName(),
+                wxCENTER | wxCANCEL_DEFAULT | wxOK | wxCANCEL | wxICON_ERROR);
+            dialog.SetExtendedMessage(sqliteResult.FriendlyErrorMessage);
+            dialog.ShowDetailedText(sqliteResult.GetReturnCodeAndMessage());
+
+            dialog.ShowModal();
+            return;
+        }
     }
 
     mTaskModel.WorkdayId = workdayId;
@@ -1937,9 +1938,9 @@ void TaskDialog::ResetCategoryChoiceControl(bool disable)
 void TaskDialog::FetchClientEntitiesByEmployer(const std::int64_t employerId)
 {
     std::vector<Model::ClientModel> clients;
-    Persistence::ClientsPersistence clientsPersistence(pLogger, mDatabaseFilePath);
+    Services::ReferenceEntityCache clientsCache(pLogger, mDatabaseFilePath);
 
-    auto result = clientsPersistence.FilterByEmployerId(employerId, clients);
+    auto result = clientsCache.FilterClientsByEmployerId(employerId, clients);
     if (!result.Success) {
         wxRichMessageDialog dialog(this,
             Messages::FilterClientsByEmployerMessage,
@@ -1970,10 +1971,10 @@ void TaskDialog::FetchProjectEntitiesByEmployerOrClient(
     const std::optional<std::int64_t> clientId)
 {
     std::vector<Model::ProjectModel> projects;
-    Persistence::ProjectsPersistence projectPersistence(pLogger, mDatabaseFilePath);
+    Services::ReferenceEntityCache projectsCache(pLogger, mDatabaseFilePath);
 
     auto sqliteResult =
-        projectPersistence.FilterByEmployerIdOrClientId(employerId, clientId, projects);
+        projectsCache.FilterProjectsByEmployerIdOrClientId(employerId, clientId, projects);
     if (!sqliteResult.Success) {
         wxRichMessageDialog dialog(this,
             Messages::FilterProjectsMessage,
@@ -2019,16 +2020,16 @@ void TaskDialog::FetchProjectEntitiesByEmployerOrClient(
 void TaskDialog::FetchCategoryEntities(const std::optional<std::int64_t> projectId)
 {
     std::vector<Services::CategoryViewModel> categories;
-    Services::CategoryService categoryService(pLogger, mDatabaseFilePath);
+    Services::ReferenceEntityCache categoriesCache(pLogger, mDatabaseFilePath);
 
     tks::SqliteResult sqliteResult;
     std::string operationMessage;
 
     if (projectId.has_value()) {
-        sqliteResult = categoryService.FilterByProjectId(projectId.value(), categories);
+        sqliteResult = categoriesCache.FilterCategoriesByProjectId(projectId.value(), categories);
         operationMessage = Messages::FilterCategoriesByProjectMessage;
     } else {
-        sqliteResult = categoryService.Filter(categories);
+        sqliteResult = categoriesCache.FilterCategories(categories);
         operationMessage = Messages::FilterCategoriesMessage;
     }
 
@@ -44,15 +44,11 @@
 #include "../../models/employermodel.h"
 
 #include "../../persistence/attendedmeetingspersistence.h"
-#include "../../persistence/employerspersistence.h"
-#include "../../persistence/projectspersistence.h"
 
 #include "../../services/categories/categoryviewmodel.h"
-#include "../../services/categories/categoryservice.h"
+#include "../../services/referencedata/referenceentitycache.h"
 
-#include "../../services/outlook/outlookclassicservice.h"
-
-#include "../../utils/utils.h"
+#include "../../services/calendar/calendarmeetingservice.h"
 
 namespace tks::UI::frames
 {
@@ -218,9 +214,9 @@ void OutlookMeetingsViewFrame::FillControls()
     pEmployerChoiceCtrl->SetSelection(0);
 
     std::vector<Model::EmployerModel> employers;
-    Persistence::EmployersPersistence employerPersistence(pLogger, mDatabaseFilePath);
+    Services::ReferenceEntityCache employersCache(pLogger, mDatabaseFilePath);
 
-    auto sqliteResult = employerPersistence.Filter("", employers);
+    auto sqliteResult = employersCache.FilterEmployers(employers);
     if (!sqliteResult.Success) {
         wxRichMessageDialog dialog(this,
             Messages::FilterEmployersMessage,
@@ -291,7 +287,9 @@ void OutlookMeetingsViewFrame::DataToControls()
 
     std::vector<std::string> accountNames;
 
-    Services::Outlook::OutlookClassicService service(pLogger);
+    Services::Calendar::CalendarMeetingService service(pLogger,
+        mDatabaseFilePath,
+        Services::Calendar::CreateCalendarProvider(pLogger, pCfg->GetCalendarIcsFilePath()));
     Services::Outlook::OutlookResult result;
     {
         wxBusyCursor cursor;
@@ -390,9 +388,10 @@ void OutlookMeetingsViewFrame::OnDateSelection(wxDateEvent& event)
 
     FetchOutlookMeetingsAndUpdateFeedbackLabel();
 
-    std::vector<Model::AttendedMeetingModel> attendedMeetingModels = FetchAttendedMeetings();
+    FetchProjectsAndCategories();
+    FetchAttendedMeetings();
 
-    AddMeetingsToPanel(attendedMeetingModels);
+    AddMeetingsToPanel();
 
     SetDialogSizeFromParent();
 }
@@ -413,11 +412,12 @@ void OutlookMeetingsViewFrame::OnRefresh(wxCommandEvent& event)
         RemoveActiveMeetingsPanel();
     }
 
-    FetchOutlookMeetingsAndUpdateFeedbackLabel();
+    FetchOutlookMeetingsAndUpdateFeedbackLabel(true);
 
-    std::vector<Model::AttendedMeetingModel> attendedMeetingModels = FetchAttendedMeetings();
+    FetchProjectsAndCategories();
+    FetchAttendedMeetings();
 
-    AddMeetingsToPanel(attendedMeetingModels);
+    AddMeetingsToPanel();
 
     SetDialogSizeFromParent();
 }
@@ -454,6 +454,8 @@ void OutlookMeetingsViewFrame::OnEmployerChoice(wxCommandEvent& event)
         }
 
         mEmployerId = -1;
+        mProjectModels.clear();
+        mCategoriesByProjectId.clear();
 
         return;
     }
@@ -486,22 +488,10 @@ void OutlookMeetingsViewFrame::OnEmployerChoice(wxCommandEvent& event)
         return;
     }
 
-    std::vector<Model::ProjectModel> projectModels;
-    Persistence::ProjectsPersistence projectPersistence(pLogger, mDatabaseFilePath);
-
-    auto sqliteResult = projectPersistence.FilterByEmployerId(mEmployerId, projectModels);
-    if (!sqliteResult.Success) {
-        wxRichMessageDialog dialog(this,
-            Messages::FilterProjectsMessage,
-            tks::Common::GetProgramName(),
-            wxCENTER | wxCANCEL_DEFAULT | wxOK | wxCANCEL | wxICON_ERROR);
-        dialog.SetExtendedMessage(sqliteResult.FriendlyErrorMessage);
-        dialog.ShowDetailedText(sqliteResult.GetReturnCodeAndMessage());
-
-        dialog.ShowModal();
-
+    if (!FetchProjectsAndCategories()) {
         return;
     }
+
     for (size_t i = 0; i < mControlChoicesData.size(); i++) {
         wxWindow* projectWnd = FindWindowById(mControlChoicesData[i].ProjectChoiceControlId);
         if (projectWnd) {
@@ -510,11 +500,11 @@ void OutlookMeetingsViewFrame::OnEmployerChoice(wxCommandEvent& event)
                 projectChoiceCtrl->Enable();
             }
             if (projectChoiceCtrl) {
-                if (!projectModels.empty()) {
+                if (!mProjectModels.empty()) {
                     bool hasDefaultProject = false;
                     std::int64_t defaultProjectId = -1;
 
-                    for (auto& project : projectModels) {
+                    for (auto& project : mProjectModels) {
                         projectChoiceCtrl->Append(
                             project.DisplayName, new ClientData<std::int64_t>(project.ProjectId));
 
@@ -526,24 +516,6 @@ void OutlookMeetingsViewFrame::OnEmployerChoice(wxCommandEvent& event)
                     }
 
                     if (hasDefaultProject) {
-                        std::vector<Services::CategoryViewModel> categories;
-                        Services::CategoryService categoryService(pLogger, mDatabaseFilePath);
-
-                        auto sqliteResult =
-                            categoryService.FilterByProjectId(defaultProjectId, categories);
-
-                        if (!sqliteResult.Success) {
-                            wxRichMessageDialog dialog(this,
-                                Messages::FilterCategoriesByProjectMessage,
-                                tks::Common::GetProgramName(),
-                                wxCENTER | wxCANCEL_DEFAULT | wxOK | wxCANCEL | wxICON_ERROR);
-                            dialog.SetExtendedMessage(sqliteResult.FriendlyErrorMessage);
-                            dialog.ShowDetailedText(sqliteResult.GetReturnCodeAndMessage());
-
-                            dialog.ShowModal();
-
-                            return;
-                        }
                         wxWindow* categoryWnd =
                             FindWindowById(mControlChoicesData[i].CategoryChoiceControlId);
                         if (categoryWnd) {
@@ -552,14 +524,7 @@ void OutlookMeetingsViewFrame::OnEmployerChoice(wxCommandEvent& event)
                                 if (!categoryChoiceCtrl->IsEnabled()) {
                                     categoryChoiceCtrl->Enable();
                                 }
-                                if (!categories.empty()) {
-                                    for (auto& category : categories) {
-                                        categoryChoiceCtrl->Append(category.GetFormattedName(),
-                                            new ClientData<std::int64_t>(category.CategoryId));
-                                    }
-                                } else {
-                                    categoryChoiceCtrl->Disable();
-                                }
+                                AppendCategoryChoices(categoryChoiceCtrl, defaultProjectId);
                             }
                         }
                     }
@@ -599,9 +564,10 @@ void OutlookMeetingsViewFrame::OnAccountChoice(wxCommandEvent& event)
 
     FetchOutlookMeetingsAndUpdateFeedbackLabel();
 
-    std::vector<Model::AttendedMeetingModel> attendedMeetingModels = FetchAttendedMeetings();
+    FetchProjectsAndCategories();
+    FetchAttendedMeetings();
 
-    AddMeetingsToPanel(attendedMeetingModels);
+    AddMeetingsToPanel();
 
     SetDialogSizeFromParent();
 }
@@ -649,32 +615,7 @@ void OutlookMeetingsViewFrame::OnProjectChoice(wxCommandEvent& event)
                     categoryChoiceCtrl->Append("Please select", new ClientData<std::int64_t>(-1));
                     categoryChoiceCtrl->SetSelection(0);
 
-                    std::vector<Services::CategoryViewModel> categories;
-                    Services::CategoryService categoryService(pLogger, mDatabaseFilePath);
-
-                    auto sqliteResult = categoryService.FilterByProjectId(projectId, categories);
-
-                    if (!sqliteResult.Success) {
-                        wxRichMessageDialog dialog(this,
-                            Messages::FilterCategoriesByProjectMessage,
-                            tks::Common::GetProgramName(),
-                            wxCENTER | wxCANCEL_DEFAULT | wxOK | wxCANCEL | wxICON_ERROR);
-                        dialog.SetExtendedMessage(sqliteResult.FriendlyErrorMessage);
-                        dialog.ShowDetailedText(sqliteResult.GetReturnCodeAndMessage());
-
-                        dialog.ShowModal();
-
-                        return;
-                    }
-
-                    if (!categories.empty()) {
-                        for (auto& category : categories) {
-                            categoryChoiceCtrl->Append(category.GetFormattedName(),
-                                new ClientData<std::int64_t>(category.CategoryId));
-                        }
-                    } else {
-                        categoryChoiceCtrl->Disable();
-                    }
+                    AppendCategoryChoices(categoryChoiceCtrl, projectId);
                 }
             }
         }
@@ -784,6 +725,7 @@ void OutlookMeetingsViewFrame::OnAttendedCheckBoxCheck(wxCommandEvent& event)
             wxCheckBox* attendedCheckBoxCtrl = wxDynamicCast(windowPtr, wxCheckBox);
             if (attendedCheckBoxCtrl) {
                 if (isOK) {
+                    mAttendedEntryIds.insert(meetingModel.EntryId);
                     attendedCheckBoxCtrl->Disable();
                 } else {
                     attendedCheckBoxCtrl->SetValue(false);
@@ -795,15 +737,18 @@ void OutlookMeetingsViewFrame::OnAttendedCheckBoxCheck(wxCommandEvent& event)
     }
 }
 
-void OutlookMeetingsViewFrame::FetchOutlookMeetingsAndUpdateFeedbackLabel()
+void OutlookMeetingsViewFrame::FetchOutlookMeetingsAndUpdateFeedbackLabel(bool forceRefresh)
 {
     SPDLOG_LOGGER_TRACE(pLogger,
         "Outlook account name selected \"{0}\"",
         mSelectedAccount.empty() ? "(none)" : mSelectedAccount);
 
-    Services::Outlook::OutlookClassicService service(pLogger);
-    Services::Outlook::OutlookResult result =
-        service.FetchCalendarMeetings(mSelectedAccount, mSelectedDate, mMeetingModels);
+    // served from the local meeting cache unless the source changed or a refresh is requested
+    Services::Calendar::CalendarMeetingService service(pLogger,
+        mDatabaseFilePath,
+        Services::Calendar::CreateCalendarProvider(pLogger, pCfg->GetCalendarIcsFilePath()));
+    Services::Outlook::OutlookResult result = service.FetchCalendarMeetings(
+        mSelectedAccount, mSelectedDate, mMeetingModels, forceRefresh);
 
     if (!result.Success) {
         wxMessageDialog dialog(this,
@@ -836,51 +781,113 @@ void OutlookMeetingsViewFrame::FetchOutlookMeetingsAndUpdateFeedbackLabel()
     }
 }
 
-std::vector<Model::AttendedMeetingModel> OutlookMeetingsViewFrame::FetchAttendedMeetings()
+bool OutlookMeetingsViewFrame::FetchProjectsAndCategories()
+{
+    mProjectModels.clear();
+    mCategoriesByProjectId.clear();
+
+    if (mEmployerId < 1) {
+        return true;
+    }
+
+    Services::ReferenceEntityCache referenceEntityCache(pLogger, mDatabaseFilePath);
+
+    auto sqliteResult =
+        referenceEntityCache.FilterProjectsByEmployerId(mEmployerId, mProjectModels);
+    if (!sqliteResult.Success) {
+        wxRichMessageDialog dialog(this,
+            Messages::FilterProjectsMessage,
+            tks::Common::GetProgramName(),
+            wxCENTER | wxCANCEL_DEFAULT | wxOK | wxCANCEL | wxICON_ERROR);
+        dialog.SetExtendedMessage(sqliteResult.FriendlyErrorMessage);
+        dialog.ShowDetailedText(sqliteResult.GetReturnCodeAndMessage());
+
+        dialog.ShowModal();
+
+        return false;
+    }
+
+    std::vector<std::int64_t> projectIds;
+    projectIds.reserve(mProjectModels.size());
+    for (const auto& project : mProjectModels) {
+        projectIds.push_back(project.ProjectId);
+    }
+
+    std::vector<Services::CategoryViewModel> categories;
+    sqliteResult = referenceEntityCache.FilterCategoriesByProjectIds(projectIds, categories);
+    if (!sqliteResult.Success) {
+        wxRichMessageDialog dialog(this,
+            Messages::FilterCategoriesByProjectMessage,
+            tks::Common::GetProgramName(),
+            wxCENTER | wxCANCEL_DEFAULT | wxOK | wxCANCEL | wxICON_ERROR);
+        dialog.SetExtendedMessage(sqliteResult.FriendlyErrorMessage);
+        dialog.ShowDetailedText(sqliteResult.GetReturnCodeAndMessage());
+
+        dialog.ShowModal();
+
+        mProjectModels.clear();
+
+        return false;
+    }
+
+    for (auto& category : categories) {
+        if (category.ProjectId.has_value()) {
+            mCategoriesByProjectId[category.ProjectId.value()].push_back(std::move(category));
+        }
+    }
+
+    SPDLOG_LOGGER_TRACE(pLogger,
+        "Loaded \"{0}\" projects and \"{1}\" categories for employer ID \"{2}\"",
+        mProjectModels.size(),
+        categories.size(),
+        mEmployerId);
+
+    return true;
+}
+
+bool OutlookMeetingsViewFrame::FetchAttendedMeetings()
 {
+    mAttendedEntryIds.clear();
+
+    if (mMeetingModels.empty()) {
+        return true;
+    }
+
+    std::vector<std::string> entryIds;
+    entryIds.reserve(mMeetingModels.size());
+    for (const auto& meetingModel : mMeetingModels) {
+        entryIds.push_back(meetingModel.EntryId);
+    }
+
     Persistence::AttendedMeetingsPersistence attendedMeetingsPersistence(
         pLogger, mDatabaseFilePath);
 
     std::vector<Model::AttendedMeetingModel> attendedMeetingModels;
     auto sqliteResult =
-        attendedMeetingsPersistence.GetByTodaysDate(Utils::UnixTimestampTodayMidnight(),
-            Utils::UnixTimestampTomorrowMidnight(),
-            attendedMeetingModels);
+        attendedMeetingsPersistence.FilterByEntryIds(entryIds, attendedMeetingModels);
 
     if (!sqliteResult.Success) {
         wxRichMessageDialog dialog(this,
-            Messages::FilterAttendedMeetingsByTodayDateMessage,
+            Messages::FilterAttendedMeetingsByEntryIdsMessage,
             Common::GetProgramName(),
             wxCENTER | wxCANCEL_DEFAULT | wxOK | wxCANCEL | wxICON_ERROR);
         dialog.SetExtendedMessage(sqliteResult.FriendlyErrorMessage);
         dialog.ShowDetailedText(sqliteResult.GetReturnCodeAndMessage());
 
         dialog.ShowModal();
+
+        return false;
     }
 
-    return attendedMeetingModels;
+    for (const auto& attendedMeetingModel : attendedMeetingModels) {
+        mAttendedEntryIds.insert(attendedMeetingModel.EntryId);
+    }
+
+    return true;
 }
 
-void OutlookMeetingsViewFrame::AddMeetingsToPanel(
-    const std::vector<Model::AttendedMeetingModel>& attendedMeetingModels)
+void OutlookMeetingsViewFrame::AddMeetingsToPanel()
 {
-    std::vector<Model::ProjectModel> projectModels;
-    Persistence::ProjectsPersistence projectPersistence(pLogger, mDatabaseFilePath);
-
-    if (mMeetingModels.size() != 0) {
-        auto sqliteResult = projectPersistence.FilterByEmployerId(mEmployerId, projectModels);
-        if (!sqliteResult.Success) {
-            wxRichMessageDialog dialog(this,
-                Messages::FilterProjectsMessage,
-                tks::Common::GetProgramName(),
-                wxCENTER | wxCANCEL_DEFAULT | wxOK | wxCANCEL | wxICON_ERROR);
-            dialog.SetExtendedMessage(sqliteResult.FriendlyErrorMessage);
-            dialog.ShowDetailedText(sqliteResult.GetReturnCodeAndMessage());
-
-            dialog.ShowModal();
-        }
-    }
-
     /* Panel Sizer */
     auto panelSizer = new wxBoxSizer(wxVERTICAL);
 
@@ -893,25 +900,14 @@ void OutlookMeetingsViewFrame::AddMeetingsToPanel(
     int categoryChoiceControlId = tksIDC_CATEGORIESCHOICECTRL_BASE;
 
     for (const auto& meetingModel : mMeetingModels) {
-        bool meetingAttended = false;
-
-        auto attendedMeetingFoundIterator = std::find_if(attendedMeetingModels.begin(),
-            attendedMeetingModels.end(),
-            [&](const Model::AttendedMeetingModel& model) {
-                return model.EntryId == meetingModel.EntryId;
-            });
-
-        if (attendedMeetingFoundIterator != attendedMeetingModels.end()) {
-            meetingAttended = true;
-        }
+        bool meetingAttended = mAttendedEntryIds.contains(meetingModel.EntryId);
 
         AddMeetingControlsToPanel(panelSizer,
             &attendedCheckBoxControlId,
             &projectChoiceControlId,
             &categoryChoiceControlId,
             meetingModel,
-            meetingAttended,
-            projectModels);
+            meetingAttended);
 
         ++attendedCheckBoxControlId;
         ++projectChoiceControlId;
@@ -986,8 +982,7 @@ void OutlookMeetingsViewFrame::AddMeetingControlsToPanel(wxBoxSizer* panelSizer,
     int* projectChoiceControlId,
     int* categoryChoiceControlId,
     const Services::Outlook::OutlookMeetingModel& meetingModel,
-    bool meetingAttended,
-    const std::vector<Model::ProjectModel>& projectModels)
+    bool meetingAttended)
 {
     ControlChoiceData choiceData;
     choiceData.CheckBoxControlId = *attendedCheckBoxControlId;
@@ -1066,11 +1061,11 @@ void OutlookMeetingsViewFrame::AddMeetingControlsToPanel(wxBoxSizer* panelSizer,
     categoryChoiceCtrl->Bind(
         wxEVT_CHOICE, &OutlookMeetingsViewFrame::OnCategoryChoice, this, *categoryChoiceControlId);
 
-    if (!projectModels.empty()) {
+    if (!mProjectModels.empty()) {
         bool hasDefaultProject = false;
         std::int64_t defaultProjectId = -1;
 
-        for (auto& project : projectModels) {
+        for (auto& project : mProjectModels) {
             projectChoiceCtrl->Append(
                 project.DisplayName, new ClientData<std::int64_t>(project.ProjectId));
 
@@ -1083,33 +1078,7 @@ void OutlookMeetingsViewFrame::AddMeetingControlsToPanel(wxBoxSizer* panelSizer,
         }
 
         if (hasDefaultProject) {
-            std::vector<Services::CategoryViewModel> categories;
-            Services::CategoryService categoryService(pLogger, mDatabaseFilePath);
-
-            auto sqliteResult = categoryService.FilterByProjectId(defaultProjectId, categories);
-            std::string operationMessage = Messages::FilterCategoriesByProjectMessage;
-
-            if (!sqliteResult.Success) {
-                wxRichMessageDialog dialog(this,
-                    operationMessage,
-                    tks::Common::GetProgramName(),
-                    wxCENTER | wxCANCEL_DEFAULT | wxOK | wxCANCEL | wxICON_ERROR);
-                dialog.SetExtendedMessage(sqliteResult.FriendlyErrorMessage);
-                dialog.ShowDetailedText(sqliteResult.GetReturnCodeAndMessage());
-
-                dialog.ShowModal();
-
-                return;
-            }
-
-            if (!categories.empty()) {
-                for (auto& category : categories) {
-                    categoryChoiceCtrl->Append(category.GetFormattedName(),
-                        new ClientData<std::int64_t>(category.CategoryId));
-                }
-            } else {
-                categoryChoiceCtrl->Disable();
-            }
+            AppendCategoryChoices(categoryChoiceCtrl, defaultProjectId);
         }
     } else {
         projectChoiceCtrl->Disable();
@@ -1144,4 +1113,19 @@ void OutlookMeetingsViewFrame::AddMeetingControlsToPanel(wxBoxSizer* panelSizer,
 
     mControlChoicesData.push_back(choiceData);
 }
+
+void OutlookMeetingsViewFrame::AppendCategoryChoices(wxChoice* categoryChoiceCtrl,
+    std::int64_t projectId)
+{
+    auto categoriesIterator = mCategoriesByProjectId.find(projectId);
+    if (categoriesIterator == mCategoriesByProjectId.end() || categoriesIterator->second.empty()) {
+        categoryChoiceCtrl->Disable();
+        return;
+    }
+
+    for (auto& category : categoriesIterator->second) {
+        categoryChoiceCtrl->Append(
+            category.GetFormattedName(), new ClientData<std::int64_t>(category.CategoryId));
+    }
+}
 } // namespace tks::UI::frames
@@ -22,6 +22,8 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include <wx/wxprec.h>
@@ -37,6 +39,8 @@
 #include "../../models/attendedmeetingmodel.h"
 #include "../../models/projectmodel.h"
 
+#include "../../services/categories/categoryviewmodel.h"
+
 namespace tks::Core
 {
 class Configuration;
@@ -104,9 +108,10 @@ class OutlookMeetingsViewFrame final : public wxFrame
     void OnCategoryChoice(wxCommandEvent& event);
     void OnAttendedCheckBoxCheck(wxCommandEvent& event);
 
-    void FetchOutlookMeetingsAndUpdateFeedbackLabel();
-    std::vector<Model::AttendedMeetingModel> FetchAttendedMeetings();
-    void AddMeetingsToPanel(const std::vector<Model::AttendedMeetingModel>& attendedMeetingModels);
+    void FetchOutlookMeetingsAndUpdateFeedbackLabel(bool forceRefresh = false);
+    bool FetchProjectsAndCategories();
+    bool FetchAttendedMeetings();
+    void AddMeetingsToPanel();
     void SetDialogSizeFromParent();
 
     void RemoveActiveMeetingsPanel();
@@ -117,8 +122,8 @@ class OutlookMeetingsViewFrame final : public wxFrame
         int* projectChoiceControlId,
         int* categoryChoiceControlId,
         const Services::Outlook::OutlookMeetingModel& meetingModel,
-        bool meetingAttended,
-        const std::vector<Model::ProjectModel>& projectModels);
+        bool meetingAttended);
+    void AppendCategoryChoices(wxChoice* categoryChoiceCtrl, std::int64_t projectId);
 
     std::shared_ptr<Core::Configuration> pCfg;
     std::shared_ptr<Core::Environment> pEnv;
@@ -150,6 +155,12 @@ class OutlookMeetingsViewFrame final : public wxFrame
 
     std::vector<ControlChoiceData> mControlChoicesData;
 
+    // loaded once per refresh so building the meeting rows does not query per row
+    std::vector<Model::ProjectModel> mProjectModels;
+    std::unordered_map<std::int64_t, std::vector<Services::CategoryViewModel>>
+        mCategoriesByProjectId;
+    std::unordered_set<std::string> mAttendedEntryIds;
+
     enum {
         tksIDC_DATEPICKERCTRL = wxID_HIGHEST + 1001,
         tksIDC_EMPLOYERCHOICECTRL,
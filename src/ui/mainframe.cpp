@@ -20,8 +20,11 @@
 #include "mainframe.h"
 
 #include <algorithm>
+#include <functional>
 #include <map>
+#include <set>
 #include <sstream>
+#include <utility>
 #include <vector>
 
 #include <date/date.h>
@@ -65,6 +68,7 @@
 #include "../services/tasks/taskviewmodel.h"
 #include "../services/tasks/tasksservice.h"
 
+#include "../utils/daynumber.h"
 #include "../utils/mswutils.h"
 #include "../utils/utils.h"
 
@@ -136,10 +140,6 @@ EVT_MENU(wxID_DELETE, MainFrame::OnDeleteTask)
 EVT_MENU(ID_POP_CLONE_TASK, MainFrame::OnCloneTask)
 EVT_MENU(wxID_ADD, MainFrame::OnAddMinutes)
 /* Custom Event Handlers */
-EVT_COMMAND(wxID_ANY, tksEVT_TASKDATEADDED, MainFrame::OnTaskAddedOnDate)
-EVT_COMMAND(wxID_ANY, tksEVT_TASKDATEDELETED, MainFrame::OnTaskDeletedOnDate)
-EVT_COMMAND(wxID_ANY, tksEVT_TASKDATEDCHANGEDFROM, MainFrame::OnTaskDateChangedFrom)
-EVT_COMMAND(wxID_ANY, tksEVT_TASKDATEDCHANGEDTO, MainFrame::OnTaskDateChangedTo)
 EVT_COMMAND(wxID_ANY, tksEVT_OUTLOOKMEETINGSFRMCLOSED, MainFrame::OnOutlookMeetingViewClose)
 /* Control Event Handlers */
 EVT_DATE_CHANGED(tksIDC_FROMDATE, MainFrame::OnFromDateSelection)
@@ -148,6 +148,7 @@ EVT_DATE_CHANGED(tksIDC_TODATE, MainFrame::OnToDateSelection)
 EVT_DATAVIEW_ITEM_CONTEXT_MENU(tksIDC_TASKDATAVIEWCTRL, MainFrame::OnContextMenu)
 EVT_DATAVIEW_SELECTION_CHANGED(tksIDC_TASKDATAVIEWCTRL, MainFrame::OnDataViewSelectionChanged)
 EVT_DATAVIEW_ITEM_ACTIVATED(tksIDC_TASKDATAVIEWCTRL, MainFrame::OnDataViewSelectionActivate)
+EVT_DATAVIEW_ITEM_EXPANDING(tksIDC_TASKDATAVIEWCTRL, MainFrame::OnDataViewItemExpanding)
 /* Power Event Handlers */
 EVT_POWER_RESUME(MainFrame::OnPowerResume)
 wxEND_EVENT_TABLE()
@@ -167,6 +168,8 @@ MainFrame::MainFrame(std::shared_ptr<Core::Environment> env,
     , pEnv(env)
     , pCfg(cfg)
     , mDatabaseFilePath()
+    , pDatabaseExecutor(nullptr)
+    , pTaskRangeCache(std::make_shared<Services::TaskRangeCache>())
     , pInfoBar(nullptr)
     , pTaskBarIcon(nullptr)
     , pStatusBar(nullptr)
@@ -184,6 +187,9 @@ MainFrame::MainFrame(std::shared_ptr<Core::Environment> env,
     , mTaskDate()
     , mExpandCounter(0)
     , bDateRangeChanged(false)
+    , mDateRangeQueryToken()
+    , mPrefetchQueryToken()
+    , mTaskChangesSubscriptionId(0)
     , pTaskReminderTimer(std::make_unique<wxTimer>(this, tksIDC_TASKREMINDERTIMER))
     , pTaskReminderNotification()
     , pThumbBarNewTaskButton(nullptr)
@@ -219,8 +225,22 @@ MainFrame::MainFrame(std::shared_ptr<Core::Environment> env,
         pTaskBarIcon->SetTaskBarIcon();
     }
 
+    // Setup background database executor, results are marshalled back onto the UI thread
+    pDatabaseExecutor = std::make_shared<Services::DatabaseExecutor>(
+        pLogger, mDatabaseFilePath, [this](std::function<void()> completion) {
+            CallAfter(completion);
+        });
+
+    // Setup change feed, committed task rows are applied to the task view and status bar
+    auto& changeFeed = Persistence::ChangeFeed::GetInstance();
+    changeFeed.SetDispatcher([this](std::function<void()> publish) { CallAfter(publish); });
+    mTaskChangesSubscriptionId = changeFeed.Subscribe(
+        "tasks",
+        [this](const std::vector<Persistence::RowChange>& changes) { OnTaskRowsChanged(changes); },
+        [this](const Persistence::RangeChange& change) { OnTaskRangeChanged(change); });
+
     // Setup StatusBar
-    pStatusBar = new StatusBar(this, pLogger, mDatabaseFilePath);
+    pStatusBar = new StatusBar(this, pLogger, pDatabaseExecutor, pTaskRangeCache);
 
     // Setup DateStore
     pDateStore = std::make_unique<DateStore>(pLogger);
@@ -255,6 +275,13 @@ MainFrame::MainFrame(std::shared_ptr<Core::Environment> env,
 
 MainFrame::~MainFrame()
 {
+    // join the worker before anything its pending completions reference is torn down
+    pDatabaseExecutor->Stop();
+
+    auto& changeFeed = Persistence::ChangeFeed::GetInstance();
+    changeFeed.Unsubscribe(mTaskChangesSubscriptionId);
+    changeFeed.SetDispatcher(nullptr);
+
     if (pTaskBarIcon) {
         pTaskBarIcon->RemoveIcon();
         delete pTaskBarIcon;
@@ -562,30 +589,47 @@ void MainFrame::DataToControls()
         pInfoBar->ShowMessage(infoBarMessage, wxICON_INFORMATION);
     }
 
-    // Fetch tasks between mFromDate and mToDate
-    std::map<std::string, std::vector<Services::TaskViewModel>> tasksGroupedByWorkday;
-    Services::TasksService tasksService(pLogger, mDatabaseFilePath);
+    // Fetch tasks between mFromDate and mToDate, the week's date nodes show empty until they arrive
+    using TasksGroupedByWorkday = std::map<std::string, std::vector<Services::TaskViewModel>>;
+    using FilterResult = std::pair<SqliteResult, TasksGroupedByWorkday>;
 
-    auto sqliteResult = tasksService.FilterByDateRange(
-        pDateStore->MondayToSundayDateRangeList, tasksGroupedByWorkday);
-    if (!sqliteResult.Success) {
-        wxRichMessageDialog dialog(this,
-            Messages::FilterByDateRangeTaskMessage,
-            Common::GetProgramName(),
-            wxCENTER | wxCANCEL_DEFAULT | wxOK | wxCANCEL | wxICON_ERROR);
-        dialog.SetExtendedMessage(sqliteResult.FriendlyErrorMessage);
-        dialog.ShowDetailedText(sqliteResult.GetReturnCodeAndMessage());
+    auto token = RenewDateRangeQueryToken();
+    auto dates = pDateStore->MondayToSundayDateRangeList;
 
-        dialog.ShowModal();
-    } else {
-        for (auto& [workdayDate, tasks] : tasksGroupedByWorkday) {
-            pTaskTreeModel->InsertChildNodes(workdayDate, tasks);
-        }
-        pDataViewCtrl->Expand(pTaskTreeModel->TryExpandTodayDateNode(pDateStore->PrintTodayDate));
+    auto generation = pTaskRangeCache->GetGeneration();
+    pDatabaseExecutor->Post<FilterResult>(
+        token,
+        [dates](Services::DatabaseExecutorContext& context) {
+            FilterResult result;
+            result.first = context.Tasks.FilterByDateRange(dates, result.second);
+            return result;
+        },
+        [this, dates, generation](FilterResult& result) {
+            auto& [sqliteResult, tasksGroupedByWorkday] = result;
+            if (!sqliteResult.Success) {
+                wxRichMessageDialog dialog(this,
+                    Messages::FilterByDateRangeTaskMessage,
+                    Common::GetProgramName(),
+                    wxCENTER | wxCANCEL_DEFAULT | wxOK | wxCANCEL | wxICON_ERROR);
+                dialog.SetExtendedMessage(sqliteResult.FriendlyErrorMessage);
+                dialog.ShowDetailedText(sqliteResult.GetReturnCodeAndMessage());
 
-        // Status Bar durations
-        CalculateStatusBarTaskDurations();
-    }
+                dialog.ShowModal();
+                return;
+            }
+
+            pTaskRangeCache->Store(tasksGroupedByWorkday, generation);
+            PrefetchAdjacentDates(dates);
+
+            for (auto& [workdayDate, tasks] : tasksGroupedByWorkday) {
+                pTaskTreeModel->InsertChildNodes(workdayDate, tasks);
+            }
+            pDataViewCtrl->Expand(
+                pTaskTreeModel->TryExpandTodayDateNode(pDateStore->PrintTodayDate));
+
+            // Status Bar durations
+            CalculateStatusBarTaskDurations();
+        });
 }
 
 void MainFrame::OnClose(wxCloseEvent& event)
@@ -872,49 +916,52 @@ void MainFrame::OnExit(wxCommandEvent& WXUNUSED(event))
 void MainFrame::OnEditEmployer(wxCommandEvent& WXUNUSED(event))
 {
     UI::dlg::EditListDialog editEmployer(
-        this, pLogger, mDatabaseFilePath, EditListEntityType::Employers);
+        this, pLogger, mDatabaseFilePath, pDatabaseExecutor, EditListEntityType::Employers);
     editEmployer.ShowModal();
 }
 
 void MainFrame::OnEditClient(wxCommandEvent& WXUNUSED(event))
 {
     UI::dlg::EditListDialog editClient(
-        this, pLogger, mDatabaseFilePath, EditListEntityType::Clients);
+        this, pLogger, mDatabaseFilePath, pDatabaseExecutor, EditListEntityType::Clients);
     editClient.ShowModal();
 }
 
 void MainFrame::OnEditProject(wxCommandEvent& WXUNUSED(event))
 {
     UI::dlg::EditListDialog editProject(
-        this, pLogger, mDatabaseFilePath, EditListEntityType::Projects);
+        this, pLogger, mDatabaseFilePath, pDatabaseExecutor, EditListEntityType::Projects);
     editProject.ShowModal();
 }
 
 void MainFrame::OnEditCategory(wxCommandEvent& WXUNUSED(event))
 {
     UI::dlg::EditListDialog editCategory(
-        this, pLogger, mDatabaseFilePath, EditListEntityType::Categories);
+        this, pLogger, mDatabaseFilePath, pDatabaseExecutor, EditListEntityType::Categories);
     editCategory.ShowModal();
 }
 
 void MainFrame::OnEditAttributeGroup(wxCommandEvent& WXUNUSED(event))
 {
     UI::dlg::EditListDialog editAttributeGroup(
-        this, pLogger, mDatabaseFilePath, EditListEntityType::AttributeGroups);
+        this, pLogger, mDatabaseFilePath, pDatabaseExecutor, EditListEntityType::AttributeGroups);
     editAttributeGroup.ShowModal();
 }
 
 void MainFrame::OnEditAttribute(wxCommandEvent& WXUNUSED(event))
 {
     UI::dlg::EditListDialog editAttribute(
-        this, pLogger, mDatabaseFilePath, EditListEntityType::Attributes);
+        this, pLogger, mDatabaseFilePath, pDatabaseExecutor, EditListEntityType::Attributes);
     editAttribute.ShowModal();
 }
 
 void MainFrame::OnEditStaticAttributeValues(wxCommandEvent& WXUNUSED(event))
 {
-    UI::dlg::EditListDialog editAttribute(
-        this, pLogger, mDatabaseFilePath, EditListEntityType::StaticAttributeGroups);
+    UI::dlg::EditListDialog editAttribute(this,
+        pLogger,
+        mDatabaseFilePath,
+        pDatabaseExecutor,
+        EditListEntityType::StaticAttributeGroups);
     editAttribute.ShowModal();
 }
 
@@ -1051,19 +1098,19 @@ void MainFrame::OnContainerCopyTasksToClipboard(wxCommandEvent& WXUNUSED(event))
         for (const auto& column : tasksViewColumns) {
             switch (column.ColumnModelIndex) {
             case TasksViewColumnModelIndex::ColumnModelIndexDate:
-                formattedStringData << taskModel.WorkdayDate << "\t";
+                formattedStringData << taskModel.GetWorkdayDate() << "\t";
                 break;
             case TasksViewColumnModelIndex::ColumnModelIndexEmployer:
-                formattedStringData << taskModel.EmployerName << "\t";
+                formattedStringData << taskModel.GetEmployerName() << "\t";
                 break;
             case TasksViewColumnModelIndex::ColumnModelIndexClient:
-                formattedStringData << taskModel.ClientName << "\t";
+                formattedStringData << taskModel.GetClientName() << "\t";
                 break;
             case TasksViewColumnModelIndex::ColumnModelIndexProject:
-                formattedStringData << taskModel.ProjectName << "\t";
+                formattedStringData << taskModel.GetProjectName() << "\t";
                 break;
             case TasksViewColumnModelIndex::ColumnModelIndexCategory:
-                formattedStringData << taskModel.CategoryName << "\t";
+                formattedStringData << taskModel.GetCategoryName() << "\t";
                 break;
             case TasksViewColumnModelIndex::ColumnModelIndexDuration:
                 formattedStringData << taskModel.GetDuration() << "\t";
@@ -1142,19 +1189,19 @@ void MainFrame::OnContainerCopyTasksWithHeadersToClipboard(wxCommandEvent& WXUNU
         for (const auto& column : tasksViewColumns) {
             switch (column.ColumnModelIndex) {
             case TasksViewColumnModelIndex::ColumnModelIndexDate:
-                formattedStringData << taskModel.WorkdayDate << "\t";
+                formattedStringData << taskModel.GetWorkdayDate() << "\t";
                 break;
             case TasksViewColumnModelIndex::ColumnModelIndexEmployer:
-                formattedStringData << taskModel.EmployerName << "\t";
+                formattedStringData << taskModel.GetEmployerName() << "\t";
                 break;
             case TasksViewColumnModelIndex::ColumnModelIndexClient:
-                formattedStringData << taskModel.ClientName << "\t";
+                formattedStringData << taskModel.GetClientName() << "\t";
                 break;
             case TasksViewColumnModelIndex::ColumnModelIndexProject:
-                formattedStringData << taskModel.ProjectName << "\t";
+                formattedStringData << taskModel.GetProjectName() << "\t";
                 break;
             case TasksViewColumnModelIndex::ColumnModelIndexCategory:
-                formattedStringData << taskModel.CategoryName << "\t";
+                formattedStringData << taskModel.GetCategoryName() << "\t";
                 break;
             case TasksViewColumnModelIndex::ColumnModelIndexDuration:
                 formattedStringData << taskModel.GetDuration() << "\t";
@@ -1344,19 +1391,19 @@ void MainFrame::OnCopyRowTaskToClipboard(wxCommandEvent& event)
     for (const auto& column : tasksViewColumns) {
         switch (column.ColumnModelIndex) {
         case TasksViewColumnModelIndex::ColumnModelIndexDate:
-            formattedStringData << taskModel.WorkdayDate << "\t";
+            formattedStringData << taskModel.GetWorkdayDate() << "\t";
             break;
         case TasksViewColumnModelIndex::ColumnModelIndexEmployer:
-            formattedStringData << taskModel.EmployerName << "\t";
+            formattedStringData << taskModel.GetEmployerName() << "\t";
             break;
         case TasksViewColumnModelIndex::ColumnModelIndexClient:
-            formattedStringData << taskModel.ClientName << "\t";
+            formattedStringData << taskModel.GetClientName() << "\t";
             break;
         case TasksViewColumnModelIndex::ColumnModelIndexProject:
-            formattedStringData << taskModel.ProjectName << "\t";
+            formattedStringData << taskModel.GetProjectName() << "\t";
             break;
         case TasksViewColumnModelIndex::ColumnModelIndexCategory:
-            formattedStringData << taskModel.CategoryName << "\t";
+            formattedStringData << taskModel.GetCategoryName() << "\t";
             break;
         case TasksViewColumnModelIndex::ColumnModelIndexDuration:
             formattedStringData << taskModel.GetDuration() << "\t";
@@ -1481,49 +1528,9 @@ void MainFrame::OnEditTask(wxCommandEvent& WXUNUSED(event))
     assert(!mTaskDate.empty());
     assert(mTaskIdToModify != -1);
 
-    int ret = -1;
-
     dlg::TaskDialog editTaskDialog(
         this, pCfg, pLogger, mDatabaseFilePath, true, mTaskIdToModify, mTaskDate);
-    ret = editTaskDialog.ShowModal();
-
-    if (ret == wxID_OK) {
-        bool isActive = false;
-        Persistence::TasksPersistence taskPersistence(pLogger, mDatabaseFilePath);
-
-        auto sqliteResult = taskPersistence.IsDeleted(mTaskIdToModify, isActive);
-        if (!sqliteResult.Success) {
-            wxRichMessageDialog dialog(this,
-                Messages::GetByIdTaskMessage,
-                Common::GetProgramName(),
-                wxCENTER | wxCANCEL_DEFAULT | wxOK | wxCANCEL | wxICON_ERROR);
-            dialog.SetExtendedMessage(sqliteResult.FriendlyErrorMessage);
-            dialog.ShowDetailedText(sqliteResult.GetReturnCodeAndMessage());
-
-            dialog.ShowModal();
-        }
-
-        if (isActive) {
-            Services::TaskViewModel taskModel;
-            Services::TasksService tasksService(pLogger, mDatabaseFilePath);
-
-            auto sqliteResult = tasksService.GetById(mTaskIdToModify, taskModel);
-            if (!sqliteResult.Success) {
-                wxRichMessageDialog dialog(this,
-                    Messages::GetByIdTaskMessage,
-                    Common::GetProgramName(),
-                    wxCENTER | wxCANCEL_DEFAULT | wxOK | wxCANCEL | wxICON_ERROR);
-                dialog.SetExtendedMessage(sqliteResult.FriendlyErrorMessage);
-                dialog.ShowDetailedText(sqliteResult.GetReturnCodeAndMessage());
-
-                dialog.ShowModal();
-            } else {
-                pTaskTreeModel->ChangeChild(mTaskDate, taskModel);
-
-                TryUpdateSelectedDateAndAllTaskDurations(mTaskDate);
-            }
-        }
-    }
+    editTaskDialog.ShowModal();
 
     ResetTaskContextMenuVariables();
 }
@@ -1591,10 +1598,6 @@ void MainFrame::OnDeleteTask(wxCommandEvent& WXUNUSED(event))
         dialog.ShowDetailedText(sqliteResult.GetReturnCodeAndMessage());
 
         dialog.ShowModal();
-    } else {
-        pTaskTreeModel->DeleteChild(mTaskDate, mTaskIdToModify);
-
-        TryUpdateSelectedDateAndAllTaskDurations(mTaskDate);
     }
 
     ResetTaskContextMenuVariables();
@@ -1630,27 +1633,6 @@ void MainFrame::OnAddMinutes(wxCommandEvent& WXUNUSED(event))
         dialog.ShowDetailedText(sqliteResult.GetReturnCodeAndMessage());
 
         dialog.ShowModal();
-        ResetTaskContextMenuVariables();
-        return;
-    }
-
-    Services::TaskViewModel taskModel;
-    Services::TasksService tasksService(pLogger, mDatabaseFilePath);
-
-    sqliteResult = tasksService.GetById(mTaskIdToModify, taskModel);
-    if (!sqliteResult.Success) {
-        wxRichMessageDialog dialog(this,
-            Messages::GetByIdTaskMessage,
-            Common::GetProgramName(),
-            wxCENTER | wxCANCEL_DEFAULT | wxOK | wxCANCEL | wxICON_ERROR);
-        dialog.SetExtendedMessage(sqliteResult.FriendlyErrorMessage);
-        dialog.ShowDetailedText(sqliteResult.GetReturnCodeAndMessage());
-
-        dialog.ShowModal();
-    } else {
-        pTaskTreeModel->ChangeChild(mTaskDate, taskModel);
-
-        TryUpdateSelectedDateAndAllTaskDurations(mTaskDate);
     }
 
     ResetTaskContextMenuVariables();
@@ -1673,124 +1655,162 @@ void MainFrame::OnMenuHighlight(wxMenuEvent& event)
     }
 }
 
-void MainFrame::OnTaskAddedOnDate(wxCommandEvent& event)
+void MainFrame::OnTaskRowsChanged(const std::vector<Persistence::RowChange>& changes)
 {
-    // A task got inserted for a specific day
-    auto eventTaskDateAdded = event.GetString().ToStdString();
-    auto taskInsertedId = static_cast<std::int64_t>(event.GetExtraLong());
-    pLogger->info(
-        "MainFrame::OnTaskAddedOnDate - Received task added event with date \"{0}\" and ID \"{1}\"",
-        eventTaskDateAdded,
-        taskInsertedId);
-
-    // Check if our current from and to dates encapsulate the date the task was inserted
-    // by calculating _this_ date range
-    std::vector<std::string> dates = pDateStore->CalculateDatesInRange(mFromDate, mToDate);
+    struct ChangedTasks {
+        SqliteResult Result;
+        std::vector<std::string> Dates;
+        std::vector<Services::TaskViewModel> Tasks;
+    };
 
-    // Check if date that the task was inserted for is in the selected range of our wxDateTimeCtrl's
-    auto iterator = std::find_if(dates.begin(), dates.end(), [&](const std::string& date) {
-        return date == eventTaskDateAdded;
-    });
-
-    // If we are in range, refetch the data for our particular date
-    if (iterator != dates.end() && taskInsertedId != 0 && eventTaskDateAdded.size() != 0) {
-        auto& foundDate = *iterator;
-        RefetchTasksForDate(foundDate, taskInsertedId);
-
-        TryUpdateSelectedDateAndAllTaskDurations(foundDate);
+    std::set<std::int64_t> uniqueTaskIds;
+    std::set<std::int64_t> insertedTaskIds;
+    for (const auto& change : changes) {
+        uniqueTaskIds.insert(change.RowId);
+        if (change.Operation == Persistence::RowChangeOperation::Insert) {
+            insertedTaskIds.insert(change.RowId);
+        }
     }
-}
-
-void MainFrame::OnTaskDeletedOnDate(wxCommandEvent& event)
-{
-    // A task got deleted on a specific day
-    auto eventTaskDateDeleted = event.GetString().ToStdString();
-    auto taskDeletedId = static_cast<std::int64_t>(event.GetExtraLong());
 
-    pLogger->info("MainFrame::OnTaskDeletedOnDate - Received task added event with date \"{0}\" "
-                  "and ID \"{1}\"",
-        eventTaskDateDeleted,
-        taskDeletedId);
-
-    // Check if our current from and to dates encapsulate the date the task was inserted
-    // by calculating _this_ date range
-    std::vector<std::string> dates = pDateStore->CalculateDatesInRange(mFromDate, mToDate);
-
-    // Check if date that the task was deleted is in the selected range of our wxDateTimeCtrl's
-    auto iterator = std::find_if(dates.begin(), dates.end(), [&](const std::string& date) {
-        return date == eventTaskDateDeleted;
-    });
-
-    // If we are in range, remove the task data for our particular date
-    if (iterator != dates.end() && taskDeletedId != 0 && eventTaskDateDeleted.size() != 0) {
-        pLogger->info("MainFrame::OnTaskDeletedOnDate - Task deleted on a date within bounds!");
-
-        auto& foundDate = *iterator;
-        pTaskTreeModel->DeleteChild(foundDate, taskDeletedId);
-
-        TryUpdateSelectedDateAndAllTaskDurations(foundDate);
-    }
-}
+    SPDLOG_LOGGER_TRACE(pLogger, "Apply \"{0}\" changed task rows", uniqueTaskIds.size());
+
+    std::vector<std::int64_t> taskIds(uniqueTaskIds.begin(), uniqueTaskIds.end());
+    for (const auto taskId : taskIds) {
+        pTaskRangeCache->InvalidateTask(taskId);
+    }
+
+    // the changed rows are resolved in one query on the worker, a date selection made in the
+    // meantime cancels the view token and the rows are then only dropped from the cache
+    auto viewToken = mDateRangeQueryToken;
+    auto fromDayNumber = DayNumber(mFromDate);
+    auto toDayNumber = DayNumber(mToDate);
+
+    // rows on the dates of the status bar totals are read as well, a task outside the selected
+    // dates still counts towards the week or month
+    auto queryFromDayNumber = fromDayNumber;
+    auto queryToDayNumber = toDayNumber;
+    std::string totalsFromDate = "";
+    std::string totalsToDate = "";
+    DayNumber totalsFromDayNumber;
+    DayNumber totalsToDayNumber;
+    if (pStatusBar->TryGetDateRange(totalsFromDate, totalsToDate) &&
+        DayNumber::TryParse(totalsFromDate, totalsFromDayNumber) &&
+        DayNumber::TryParse(totalsToDate, totalsToDayNumber)) {
+        queryFromDayNumber = std::min(queryFromDayNumber, totalsFromDayNumber);
+        queryToDayNumber = std::max(queryToDayNumber, totalsToDayNumber);
+    }
+
+    pDatabaseExecutor->Post<ChangedTasks>(
+        Services::CancellationToken(),
+        [taskIds, queryFromDayNumber, queryToDayNumber](
+            Services::DatabaseExecutorContext& context) {
+            ChangedTasks changedTasks;
+            changedTasks.Result = context.Tasks.FilterDatesByIds(taskIds, changedTasks.Dates);
+            if (changedTasks.Result.Success) {
+                changedTasks.Result = context.Tasks.FilterByIds(
+                    taskIds, queryFromDayNumber, queryToDayNumber, changedTasks.Tasks);
+            }
+            return changedTasks;
+        },
+        [this, taskIds, insertedTaskIds, fromDayNumber, toDayNumber, viewToken](
+            ChangedTasks& changedTasks) {
+            if (!changedTasks.Result.Success) {
+                pLogger->error(
+                    "MainFrame::OnTaskRowsChanged - Failed to read \"{0}\" changed tasks",
+                    taskIds.size());
+                return;
+            }
 
-void MainFrame::OnTaskDateChangedFrom(wxCommandEvent& event)
-{
-    // A task got moved from one day to another day
-    auto eventTaskDateChanged = event.GetString().ToStdString();
-    auto taskChangedId = static_cast<std::int64_t>(event.GetExtraLong());
+            for (const auto& date : changedTasks.Dates) {
+                pTaskRangeCache->Invalidate(date);
+            }
 
-    pLogger->info("MainFrame::OnTaskDateChangedFrom - Received task date changed event with date "
-                  "\"{0}\" and ID \"{1}\"",
-        eventTaskDateChanged,
-        taskChangedId);
+            // the view no longer holds the rows as they were, so the totals are queried again
+            if (viewToken.IsCancelled()) {
+                pStatusBar->RecalculateDurations();
+                return;
+            }
 
-    // Check if our current from and to dates encapsulate the date the task was inserted
-    // by calculating _this_ date range
-    std::vector<std::string> dates = pDateStore->CalculateDatesInRange(mFromDate, mToDate);
+            // minutes each date gained or lost, default and billable, patched into the totals
+            std::map<std::string, std::pair<int, int>> durationChanges;
+
+            // the view holds the rows as they were before the change
+            bool previousDurationsKnown = true;
+            for (const auto taskId : taskIds) {
+                std::string previousDate = "";
+                int minutes = 0;
+                bool billable = false;
+                if (pTaskTreeModel->TryGetTaskDate(taskId, previousDate) &&
+                    pTaskTreeModel->TryGetTaskDuration(taskId, minutes, billable)) {
+                    auto& durationChange = durationChanges[previousDate];
+                    durationChange.first -= minutes;
+                    durationChange.second -= billable ? minutes : 0;
+                } else if (insertedTaskIds.count(taskId) == 0) {
+                    previousDurationsKnown = false;
+                }
+            }
 
-    // Check if date that the task was changed to is in the selected range of our wxDateTimeCtrl's
-    auto iterator = std::find_if(dates.begin(), dates.end(), [&](const std::string& date) {
-        return date == eventTaskDateChanged;
-    });
+            std::set<std::int64_t> visibleTaskIds;
+            for (auto& taskModel : changedTasks.Tasks) {
+                int minutes = taskModel.Hours * 60 + taskModel.Minutes;
+                auto& durationChange = durationChanges[taskModel.GetWorkdayDate()];
+                durationChange.first += minutes;
+                durationChange.second += taskModel.Billable ? minutes : 0;
+
+                // rows read only for the totals are not part of the view
+                DayNumber dayNumber;
+                if (!DayNumber::TryParse(taskModel.GetWorkdayDate(), dayNumber) ||
+                    dayNumber < fromDayNumber || toDayNumber < dayNumber) {
+                    continue;
+                }
+
+                pTaskTreeModel->ApplyTaskChanged(taskModel);
+                visibleTaskIds.insert(taskModel.TaskId);
+            }
 
-    // If we are in range, remove the item data for our particular date
-    if (iterator != dates.end() && taskChangedId != 0 && eventTaskDateChanged.size() != 0) {
-        pLogger->info("MainFrame::OnTaskDateChangedFrom - Task changed from a date within bounds");
+            // tasks are soft deleted, a task missing from the result was deleted or moved out of
+            // the selected dates
+            for (const auto taskId : taskIds) {
+                if (visibleTaskIds.count(taskId) == 0) {
+                    pTaskTreeModel->ApplyTaskRemoved(taskId);
+                }
+            }
 
-        auto& foundDate = *iterator;
-        pTaskTreeModel->DeleteChild(foundDate, taskChangedId);
+            // an updated task the view did not hold, on a date outside the selection or not yet
+            // loaded, has no previous duration to take away
+            if (!previousDurationsKnown) {
+                pStatusBar->RecalculateDurations();
+                return;
+            }
 
-        TryUpdateSelectedDateAndAllTaskDurations(foundDate);
-    }
+            for (const auto& [date, durationChange] : durationChanges) {
+                pStatusBar->ApplyDurationChange(date, durationChange.first, durationChange.second);
+            }
+        });
 }
 
-void MainFrame::OnTaskDateChangedTo(wxCommandEvent& event)
+void MainFrame::OnTaskRangeChanged(const Persistence::RangeChange& change)
 {
-    // A task got moved from one day to another day
-    auto eventTaskDateChanged = event.GetString().ToStdString();
-    auto taskChangedId = static_cast<std::int64_t>(event.GetExtraLong());
-
-    pLogger->info("MainFrame::OnTaskDateChangedTo - Received task date changed event with date "
-                  "\"{0}\" and ID \"{1}\"",
-        eventTaskDateChanged,
-        taskChangedId);
-
-    // Check if our current from and to dates encapsulate the date the task was inserted
-    // by calculating _this_ date range
-    std::vector<std::string> dates = pDateStore->CalculateDatesInRange(mFromDate, mToDate);
+    SPDLOG_LOGGER_TRACE(pLogger,
+        "Apply range change from \"{0}\" to \"{1}\"",
+        change.FromDayNumber.ToString(),
+        change.ToDayNumber.ToString());
 
-    // Check if date that the task was changed to is in the selected range of our wxDateTimeCtrl's
-    auto iterator = std::find_if(dates.begin(), dates.end(), [&](const std::string& date) {
-        return date == eventTaskDateChanged;
-    });
+    pTaskRangeCache->Invalidate(change.FromDayNumber, change.ToDayNumber);
 
-    // If we are in range, add the task for our particular date
-    if (iterator != dates.end() && taskChangedId != 0 && eventTaskDateChanged.size() != 0) {
-        pLogger->info("MainFrame::OnTaskDateChangedTo - Task date changed to date within bounds!");
+    if (change.ToDayNumber < DayNumber(mFromDate) || DayNumber(mToDate) < change.FromDayNumber) {
+        return;
+    }
 
-        auto& foundDate = *iterator;
-        RefetchTasksForDate(foundDate, taskChangedId);
+    RefetchTasksForSelectedDates();
 
-        TryUpdateSelectedDateAndAllTaskDurations(foundDate);
+    if (bDateRangeChanged) {
+        pStatusBar->UpdateDefaultHoursRange(
+            date::format("%F", mFromDate), date::format("%F", mToDate));
+        pStatusBar->UpdateBillableHoursRange(
+            date::format("%F", mFromDate), date::format("%F", mToDate));
+    } else {
+        CalculateStatusBarTaskDurations();
     }
 }
 
@@ -1835,25 +1855,7 @@ void MainFrame::OnFromDateSelection(wxDateEvent& event)
     mFromDate = newFromDate;
 
     if (mFromDate == mToDate) {
-        auto fromDateString = date::format("%F", mFromDate);
-
-        std::vector<Services::TaskViewModel> tasks;
-        Services::TasksService tasksService(pLogger, mDatabaseFilePath);
-
-        auto sqliteResult = tasksService.FilterByDate(fromDateString, tasks);
-        if (!sqliteResult.Success) {
-            wxRichMessageDialog dialog(this,
-                Messages::FilterByDateTaskMessage,
-                Common::GetProgramName(),
-                wxCENTER | wxCANCEL_DEFAULT | wxOK | wxCANCEL | wxICON_ERROR);
-            dialog.SetExtendedMessage(sqliteResult.FriendlyErrorMessage);
-            dialog.ShowDetailedText(sqliteResult.GetReturnCodeAndMessage());
-
-            dialog.ShowModal();
-        } else {
-            pTaskTreeModel->ClearAll();
-            pTaskTreeModel->InsertRootAndChildNodes(fromDateString, tasks);
-        }
+        RefetchTasksForSelectedDates();
         return;
     }
 
@@ -1862,29 +1864,7 @@ void MainFrame::OnFromDateSelection(wxDateEvent& event)
         date::format("%F", mFromDate),
         date::format("%F", mToDate));
 
-    // Calculate list of dates between from and to date
-    std::vector<std::string> dates = pDateStore->CalculateDatesInRange(mFromDate, mToDate);
-
-    // Fetch all the tasks for said date range
-    std::map<std::string, std::vector<Services::TaskViewModel>> tasksGroupedByWorkday;
-    Services::TasksService tasksService(pLogger, mDatabaseFilePath);
-
-    auto sqliteResult = tasksService.FilterByDateRange(dates, tasksGroupedByWorkday);
-    if (!sqliteResult.Success) {
-        wxRichMessageDialog dialog(this,
-            Messages::FilterByDateRangeTaskMessage,
-            Common::GetProgramName(),
-            wxCENTER | wxCANCEL_DEFAULT | wxOK | wxCANCEL | wxICON_ERROR);
-        dialog.SetExtendedMessage(sqliteResult.FriendlyErrorMessage);
-        dialog.ShowDetailedText(sqliteResult.GetReturnCodeAndMessage());
-
-        dialog.ShowModal();
-    } else {
-        pTaskTreeModel->ClearAll();
-        for (auto& [workdayDate, tasks] : tasksGroupedByWorkday) {
-            pTaskTreeModel->InsertRootAndChildNodes(workdayDate, tasks);
-        }
-    }
+    RefetchTasksForSelectedDates();
 
     // Update status bar hours
     // Check if the week dates have changed
@@ -1939,51 +1919,11 @@ void MainFrame::OnToDateSelection(wxDateEvent& event)
         date::format("%F", mToDate));
 
     if (mFromDate == mToDate) {
-        auto date = date::format("%F", mToDate);
-
-        std::vector<Services::TaskViewModel> tasks;
-        Services::TasksService tasksService(pLogger, mDatabaseFilePath);
-
-        auto sqliteResult = tasksService.FilterByDate(date, tasks);
-        if (!sqliteResult.Success) {
-            wxRichMessageDialog dialog(this,
-                Messages::FilterByDateTaskMessage,
-                Common::GetProgramName(),
-                wxCENTER | wxCANCEL_DEFAULT | wxOK | wxCANCEL | wxICON_ERROR);
-            dialog.SetExtendedMessage(sqliteResult.FriendlyErrorMessage);
-            dialog.ShowDetailedText(sqliteResult.GetReturnCodeAndMessage());
-
-            dialog.ShowModal();
-        } else {
-            pTaskTreeModel->ClearAll();
-            pTaskTreeModel->InsertRootAndChildNodes(date, tasks);
-        }
+        RefetchTasksForSelectedDates();
         return;
     }
 
-    // Calculate list of dates between from and to date
-    std::vector<std::string> dates = pDateStore->CalculateDatesInRange(mFromDate, mToDate);
-
-    // Fetch all the tasks for said date range
-    std::map<std::string, std::vector<Services::TaskViewModel>> tasksGroupedByWorkday;
-    Services::TasksService tasksService(pLogger, mDatabaseFilePath);
-
-    auto sqliteResult = tasksService.FilterByDateRange(dates, tasksGroupedByWorkday);
-    if (!sqliteResult.Success) {
-        wxRichMessageDialog dialog(this,
-            Messages::FilterByDateRangeTaskMessage,
-            Common::GetProgramName(),
-            wxCENTER | wxCANCEL_DEFAULT | wxOK | wxCANCEL | wxICON_ERROR);
-        dialog.SetExtendedMessage(sqliteResult.FriendlyErrorMessage);
-        dialog.ShowDetailedText(sqliteResult.GetReturnCodeAndMessage());
-
-        dialog.ShowModal();
-    } else {
-        pTaskTreeModel->ClearAll();
-        for (auto& [workdayDate, tasks] : tasksGroupedByWorkday) {
-            pTaskTreeModel->InsertRootAndChildNodes(workdayDate, tasks);
-        }
-    }
+    RefetchTasksForSelectedDates();
 
     // Update status bar hours
     // Check if the week dates have changed
@@ -2154,49 +2094,9 @@ void MainFrame::OnDataViewSelectionActivate(wxDataViewEvent& event)
     assert(!mTaskDate.empty());
     assert(mTaskIdToModify != -1);
 
-    int ret = -1;
-
     dlg::TaskDialog editTaskDialog(
         this, pCfg, pLogger, mDatabaseFilePath, true, mTaskIdToModify, mTaskDate);
-    ret = editTaskDialog.ShowModal();
-
-    if (ret == wxID_OK) {
-        bool isActive = false;
-        Persistence::TasksPersistence taskPersistence(pLogger, mDatabaseFilePath);
-
-        auto sqliteResult = taskPersistence.IsDeleted(mTaskIdToModify, isActive);
-        if (!sqliteResult.Success) {
-            wxRichMessageDialog dialog(this,
-                Messages::GetByIdTaskMessage,
-                Common::GetProgramName(),
-                wxCENTER | wxCANCEL_DEFAULT | wxOK | wxCANCEL | wxICON_ERROR);
-            dialog.SetExtendedMessage(sqliteResult.FriendlyErrorMessage);
-            dialog.ShowDetailedText(sqliteResult.GetReturnCodeAndMessage());
-
-            dialog.ShowModal();
-        }
-
-        if (isActive) {
-            Services::TaskViewModel taskModel;
-            Services::TasksService tasksService(pLogger, mDatabaseFilePath);
-
-            auto sqliteResult = tasksService.GetById(mTaskIdToModify, taskModel);
-            if (!sqliteResult.Success) {
-                wxRichMessageDialog dialog(this,
-                    Messages::GetByIdTaskMessage,
-                    Common::GetProgramName(),
-                    wxCENTER | wxCANCEL_DEFAULT | wxOK | wxCANCEL | wxICON_ERROR);
-                dialog.SetExtendedMessage(sqliteResult.FriendlyErrorMessage);
-                dialog.ShowDetailedText(sqliteResult.GetReturnCodeAndMessage());
-
-                dialog.ShowModal();
-            } else {
-                pTaskTreeModel->ChangeChild(mTaskDate, taskModel);
-
-                TryUpdateSelectedDateAndAllTaskDurations(mTaskDate);
-            }
-        }
-    }
+    editTaskDialog.ShowModal();
 
     ResetTaskContextMenuVariables();
 }
@@ -2221,6 +2121,29 @@ void MainFrame::OnPowerResume(wxPowerEvent& WXUNUSED(event))
     pDataViewCtrl->Expand(pTaskTreeModel->TryExpandTodayDateNode(pDateStore->PrintTodayDate));
 }
 
+void MainFrame::OnDataViewItemExpanding(wxDataViewEvent& event)
+{
+    auto item = event.GetItem();
+    if (!item.IsOk()) {
+        return;
+    }
+
+    if (!pTaskTreeModel->RequiresChildNodes(item)) {
+        pTaskTreeModel->TouchDateNode(item);
+        return;
+    }
+
+    if (TryLoadCachedTasksForDateNode(item)) {
+        return;
+    }
+
+    // the node expands once its tasks arrive from the executor
+    event.Veto();
+
+    auto model = (TaskTreeModelNode*) item.GetID();
+    LoadTasksForDateNode(model->GetDate());
+}
+
 void MainFrame::OnOutlookMeetingViewClose(wxCommandEvent& event)
 {
     mOutlookMeetingViewFrameOpenCounter--;
@@ -2291,45 +2214,245 @@ void MainFrame::RefetchTasksForDateRange()
         date::format("%F", mToDate));
 
     // Fetch tasks between mFromDate and mToDate
-    std::map<std::string, std::vector<Services::TaskViewModel>> tasksGroupedByWorkday;
-    Services::TasksService tasksService(pLogger, mDatabaseFilePath);
+    RefetchTasksForDates(pDateStore->MondayToSundayDateRangeList, true);
+}
 
-    auto sqliteResult = tasksService.FilterByDateRange(
-        pDateStore->MondayToSundayDateRangeList, tasksGroupedByWorkday);
-    if (!sqliteResult.Success) {
-        wxRichMessageDialog dialog(this,
-            Messages::FilterByDateRangeTaskMessage,
-            Common::GetProgramName(),
-            wxCENTER | wxCANCEL_DEFAULT | wxOK | wxCANCEL | wxICON_ERROR);
-        dialog.SetExtendedMessage(sqliteResult.FriendlyErrorMessage);
-        dialog.ShowDetailedText(sqliteResult.GetReturnCodeAndMessage());
+void MainFrame::RefetchTasksForSelectedDates()
+{
+    std::vector<std::string> dates = pDateStore->CalculateDatesInRange(mFromDate, mToDate);
 
-        dialog.ShowModal();
+    // Wide ranges only create the date nodes up front, tasks are fetched when a date is expanded
+    if (dates.size() > static_cast<std::size_t>(LAZY_LOAD_DATE_RANGE_THRESHOLD)) {
+        RefetchDateNodesForDates(dates);
     } else {
-        pTaskTreeModel->ClearAll();
-        for (auto& [workdayDate, tasks] : tasksGroupedByWorkday) {
-            pTaskTreeModel->InsertRootAndChildNodes(workdayDate, tasks);
+        RefetchTasksForDates(dates, false);
+    }
+}
+
+Services::CancellationToken MainFrame::RenewDateRangeQueryToken()
+{
+    mDateRangeQueryToken.Cancel();
+    mDateRangeQueryToken = Services::CancellationToken();
+
+    return mDateRangeQueryToken;
+}
+
+void MainFrame::RefetchTasksForDates(const std::vector<std::string>& dates,
+    bool expandTodayDateNode)
+{
+    using TasksGroupedByWorkday = std::map<std::string, std::vector<Services::TaskViewModel>>;
+    using FilterResult = std::pair<SqliteResult, TasksGroupedByWorkday>;
+
+    // a newer selection cancels this token, so stale results never replace what it shows
+    auto token = RenewDateRangeQueryToken();
+
+    TasksGroupedByWorkday cachedTasksGroupedByWorkday;
+    if (pTaskRangeCache->TryGet(dates, cachedTasksGroupedByWorkday)) {
+        SPDLOG_LOGGER_TRACE(pLogger, "Apply \"{0}\" dates from task range cache", dates.size());
+
+        ApplyTasksForDates(cachedTasksGroupedByWorkday, expandTodayDateNode);
+        PrefetchAdjacentDates(dates);
+        return;
+    }
+
+    auto generation = pTaskRangeCache->GetGeneration();
+    pDatabaseExecutor->Post<FilterResult>(
+        token,
+        [dates](Services::DatabaseExecutorContext& context) {
+            FilterResult result;
+            result.first = context.Tasks.FilterByDateRange(dates, result.second);
+            return result;
+        },
+        [this, dates, generation, expandTodayDateNode](FilterResult& result) {
+            auto& [sqliteResult, tasksGroupedByWorkday] = result;
+            if (!sqliteResult.Success) {
+                wxRichMessageDialog dialog(this,
+                    Messages::FilterByDateRangeTaskMessage,
+                    Common::GetProgramName(),
+                    wxCENTER | wxCANCEL_DEFAULT | wxOK | wxCANCEL | wxICON_ERROR);
+                dialog.SetExtendedMessage(sqliteResult.FriendlyErrorMessage);
+                dialog.ShowDetailedText(sqliteResult.GetReturnCodeAndMessage());
+
+                dialog.ShowModal();
+                return;
+            }
+
+            pTaskRangeCache->Store(tasksGroupedByWorkday, generation);
+            ApplyTasksForDates(tasksGroupedByWorkday, expandTodayDateNode);
+            PrefetchAdjacentDates(dates);
+        });
+}
+
+void MainFrame::ApplyTasksForDates(
+    const std::map<std::string, std::vector<Services::TaskViewModel>>& tasksGroupedByWorkday,
+    bool expandTodayDateNode)
+{
+    pTaskTreeModel->ClearAll();
+    for (const auto& [workdayDate, tasks] : tasksGroupedByWorkday) {
+        pTaskTreeModel->InsertRootAndChildNodes(workdayDate, tasks);
+    }
+
+    if (expandTodayDateNode) {
+        pDataViewCtrl->Expand(pTaskTreeModel->TryExpandTodayDateNode(pDateStore->PrintTodayDate));
+    }
+}
+
+void MainFrame::PrefetchAdjacentDates(const std::vector<std::string>& dates)
+{
+    using TasksGroupedByWorkday = std::map<std::string, std::vector<Services::TaskViewModel>>;
+    using FilterResult = std::pair<SqliteResult, TasksGroupedByWorkday>;
+
+    if (dates.empty() || dates.size() > static_cast<std::size_t>(LAZY_LOAD_DATE_RANGE_THRESHOLD)) {
+        return;
+    }
+
+    DayNumber fromDayNumber;
+    DayNumber toDayNumber;
+    if (!DayNumber::TryParse(dates.front(), fromDayNumber) ||
+        !DayNumber::TryParse(dates.back(), toDayNumber)) {
+        return;
+    }
+
+    // the previous and next ranges of the same length are what date navigation moves to next
+    auto rangeLength = static_cast<std::int32_t>(dates.size());
+    auto previousDates = pDateStore->CalculateDatesInRange(
+        (fromDayNumber - rangeLength).ToDate(), (fromDayNumber - 1).ToDate());
+    auto nextDates = pDateStore->CalculateDatesInRange(
+        (toDayNumber + 1).ToDate(), (toDayNumber + rangeLength).ToDate());
+
+    pTaskRangeCache->Retain(fromDayNumber - rangeLength, toDayNumber + rangeLength);
+
+    mPrefetchQueryToken.Cancel();
+    mPrefetchQueryToken = Services::CancellationToken();
+
+    for (const auto& adjacentDates : { previousDates, nextDates }) {
+        if (pTaskRangeCache->Contains(adjacentDates)) {
+            continue;
         }
+
+        SPDLOG_LOGGER_TRACE(pLogger,
+            "Prefetch tasks for dates \"{0}\" - \"{1}\"",
+            adjacentDates.front(),
+            adjacentDates.back());
+
+        auto generation = pTaskRangeCache->GetGeneration();
+        pDatabaseExecutor->Post<FilterResult>(
+            mPrefetchQueryToken,
+            [adjacentDates](Services::DatabaseExecutorContext& context) {
+                FilterResult result;
+                result.first = context.Tasks.FilterByDateRange(adjacentDates, result.second);
+                return result;
+            },
+            [this, generation](FilterResult& result) {
+                auto& [sqliteResult, tasksGroupedByWorkday] = result;
+                // a failed prefetch is not shown, the dates are fetched again when navigated to
+                if (!sqliteResult.Success) {
+                    pLogger->warn("MainFrame::PrefetchAdjacentDates - Failed to prefetch tasks");
+                    return;
+                }
+
+                pTaskRangeCache->Store(tasksGroupedByWorkday, generation);
+            });
+    }
+}
+
+void MainFrame::RefetchDateNodesForDates(const std::vector<std::string>& dates)
+{
+    using CountResult = std::pair<SqliteResult, std::map<std::string, std::int64_t>>;
+
+    pLogger->info("MainFrame::RefetchDateNodesForDates - Lazy load \"{0}\" dates", dates.size());
+
+    auto token = RenewDateRangeQueryToken();
+
+    pDatabaseExecutor->Post<CountResult>(
+        token,
+        [dates](Services::DatabaseExecutorContext& context) {
+            CountResult result;
+            result.first =
+                context.Tasks.CountByDateRange(dates.front(), dates.back(), result.second);
+            return result;
+        },
+        [this, dates](CountResult& result) {
+            auto& [sqliteResult, taskCounts] = result;
+            if (!sqliteResult.Success) {
+                wxRichMessageDialog dialog(this,
+                    Messages::FilterByDateRangeTaskMessage,
+                    Common::GetProgramName(),
+                    wxCENTER | wxCANCEL_DEFAULT | wxOK | wxCANCEL | wxICON_ERROR);
+                dialog.SetExtendedMessage(sqliteResult.FriendlyErrorMessage);
+                dialog.ShowDetailedText(sqliteResult.GetReturnCodeAndMessage());
+
+                dialog.ShowModal();
+                return;
+            }
+
+            pTaskTreeModel->ClearAll();
+            pTaskTreeModel->InsertLazyRootNodes(dates, taskCounts);
+        });
+}
+
+bool MainFrame::TryLoadCachedTasksForDateNode(const wxDataViewItem& item)
+{
+    using TasksGroupedByWorkday = std::map<std::string, std::vector<Services::TaskViewModel>>;
+
+    auto model = (TaskTreeModelNode*) item.GetID();
+
+    TasksGroupedByWorkday tasksGroupedByWorkday;
+    if (!pTaskRangeCache->TryGet({ model->GetDate() }, tasksGroupedByWorkday)) {
+        return false;
     }
+
+    ApplyTasksForDateNode(item, tasksGroupedByWorkday[model->GetDate()]);
+    return true;
 }
 
-void MainFrame::RefetchTasksForDate(const std::string& date, const std::int64_t taskId)
+void MainFrame::LoadTasksForDateNode(const std::string& date)
 {
-    Services::TaskViewModel taskModel;
-    Services::TasksService tasksService(pLogger, mDatabaseFilePath);
+    using TasksGroupedByWorkday = std::map<std::string, std::vector<Services::TaskViewModel>>;
+    using FilterResult = std::pair<SqliteResult, TasksGroupedByWorkday>;
 
-    auto sqliteResult = tasksService.GetById(taskId, taskModel);
-    if (!sqliteResult.Success) {
-        wxRichMessageDialog dialog(this,
-            Messages::GetByIdTaskMessage,
-            Common::GetProgramName(),
-            wxCENTER | wxCANCEL_DEFAULT | wxOK | wxCANCEL | wxICON_ERROR);
-        dialog.SetExtendedMessage(sqliteResult.FriendlyErrorMessage);
-        dialog.ShowDetailedText(sqliteResult.GetReturnCodeAndMessage());
+    // the view token is left as is, the node only goes away when a new selection cancels it
+    auto generation = pTaskRangeCache->GetGeneration();
+    pDatabaseExecutor->Post<FilterResult>(
+        mDateRangeQueryToken,
+        [date](Services::DatabaseExecutorContext& context) {
+            FilterResult result;
+            result.first = context.Tasks.FilterByDateRange({ date }, result.second);
+            return result;
+        },
+        [this, date, generation](FilterResult& result) {
+            auto& [sqliteResult, tasksGroupedByWorkday] = result;
+            if (!sqliteResult.Success) {
+                wxRichMessageDialog dialog(this,
+                    Messages::FilterByDateTaskMessage,
+                    Common::GetProgramName(),
+                    wxCENTER | wxCANCEL_DEFAULT | wxOK | wxCANCEL | wxICON_ERROR);
+                dialog.SetExtendedMessage(sqliteResult.FriendlyErrorMessage);
+                dialog.ShowDetailedText(sqliteResult.GetReturnCodeAndMessage());
 
-        dialog.ShowModal();
-    } else {
-        pTaskTreeModel->InsertChildNode(date, taskModel);
+                dialog.ShowModal();
+                return;
+            }
+
+            pTaskRangeCache->Store(tasksGroupedByWorkday, generation);
+
+            // a second expand of the same node may have been answered first
+            auto item = pTaskTreeModel->FindDateNode(date);
+            if (!pTaskTreeModel->RequiresChildNodes(item)) {
+                return;
+            }
+
+            ApplyTasksForDateNode(item, tasksGroupedByWorkday[date]);
+            pDataViewCtrl->Expand(item);
+        });
+}
+
+void MainFrame::ApplyTasksForDateNode(const wxDataViewItem& item,
+    std::vector<Services::TaskViewModel> tasks)
+{
+    // dates pushed out of the loaded window drop their children and must not stay expanded
+    for (auto& evictedItem : pTaskTreeModel->LoadChildNodes(item, std::move(tasks))) {
+        pDataViewCtrl->Collapse(evictedItem);
     }
 }
 
@@ -20,6 +20,7 @@
 #pragma once
 
 #include <chrono>
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
@@ -48,6 +49,11 @@
 
 #include "../models/taskmodel.h"
 
+#include "../persistence/base/changefeed.h"
+
+#include "../services/executor/databaseexecutor.h"
+#include "../services/tasks/taskrangecache.h"
+
 #include "../utils/datestore.h"
 
 #include "taskbaricon.h"
@@ -139,6 +145,8 @@ static const int ID_POP_COPY_ROW_TASK = static_cast<int>(MenuIds::Pop_CopyRowTas
 static const int ID_POP_COPY_ROW_TASK_PRESET = static_cast<int>(MenuIds::Pop_CopyRowTaskPreset);
 
 static const int MAX_EXPAND_COUNT = 3;
+/* Date ranges with more days than this only load tasks for a date when it is expanded */
+static const int LAZY_LOAD_DATE_RANGE_THRESHOLD = 31;
 
 namespace Core
 {
@@ -220,11 +228,10 @@ class MainFrame : public wxFrame
     void OnAddMinutes(wxCommandEvent& event);
     void OnMenuHighlight(wxMenuEvent& event);
     /* Custom Event Handlers */
-    void OnTaskAddedOnDate(wxCommandEvent& event);
-    void OnTaskDeletedOnDate(wxCommandEvent& event);
-    void OnTaskDateChangedFrom(wxCommandEvent& event);
-    void OnTaskDateChangedTo(wxCommandEvent& event);
     void OnOutlookMeetingViewClose(wxCommandEvent& event);
+    /* Change Feed Handlers */
+    void OnTaskRowsChanged(const std::vector<Persistence::RowChange>& changes);
+    void OnTaskRangeChanged(const Persistence::RangeChange& change);
     /* Control Event Handlers */
     void OnFromDateSelection(wxDateEvent& event);
     void OnToDateSelection(wxDateEvent& event);
@@ -232,6 +239,7 @@ class MainFrame : public wxFrame
     void OnContextMenu(wxDataViewEvent& event);
     void OnDataViewSelectionChanged(wxDataViewEvent& event);
     void OnDataViewSelectionActivate(wxDataViewEvent& event);
+    void OnDataViewItemExpanding(wxDataViewEvent& event);
     /* Notification Event Handlers */
     void OnReminderNotificationClicked(wxCommandEvent& event);
     /* Power Event Handlers */
@@ -241,7 +249,18 @@ class MainFrame : public wxFrame
     void ResetDateRange();
     void ResetDatePickerValues();
     void RefetchTasksForDateRange();
-    void RefetchTasksForDate(const std::string& date, const std::int64_t taskId);
+    void RefetchTasksForSelectedDates();
+    Services::CancellationToken RenewDateRangeQueryToken();
+    void RefetchTasksForDates(const std::vector<std::string>& dates, bool expandTodayDateNode);
+    void ApplyTasksForDates(
+        const std::map<std::string, std::vector<Services::TaskViewModel>>& tasksGroupedByWorkday,
+        bool expandTodayDateNode);
+    void PrefetchAdjacentDates(const std::vector<std::string>& dates);
+    void RefetchDateNodesForDates(const std::vector<std::string>& dates);
+    bool TryLoadCachedTasksForDateNode(const wxDataViewItem& item);
+    void LoadTasksForDateNode(const std::string& date);
+    void ApplyTasksForDateNode(const wxDataViewItem& item,
+        std::vector<Services::TaskViewModel> tasks);
 
     void CalculateStatusBarTaskDurations();
     void CalculateDefaultTaskDurations();
@@ -266,6 +285,8 @@ class MainFrame : public wxFrame
     std::shared_ptr<Core::Environment> pEnv;
     std::shared_ptr<Core::Configuration> pCfg;
     std::string mDatabaseFilePath;
+    std::shared_ptr<Services::DatabaseExecutor> pDatabaseExecutor;
+    std::shared_ptr<Services::TaskRangeCache> pTaskRangeCache;
 
     frames::OutlookMeetingsViewFrame* pMeetingsViewFrame;
 
@@ -295,6 +316,11 @@ class MainFrame : public wxFrame
     std::string mTaskDate;
     int mExpandCounter;
     bool bDateRangeChanged;
+    /* cancelled whenever a newer date range replaces the tasks shown in the tree */
+    Services::CancellationToken mDateRangeQueryToken;
+    /* cancelled whenever a newer date range moves the neighbouring dates to prefetch */
+    Services::CancellationToken mPrefetchQueryToken;
+    std::uint64_t mTaskChangesSubscriptionId;
 
     /*
      * this variable ensures that only one dialog is opened at a time from the thumb bar actions
@@ -19,6 +19,9 @@
 
 #include "statusbar.h"
 
+#include <utility>
+#include <vector>
+
 #include <wx/richmsgdlg.h>
 
 #include <fmt/format.h>
@@ -31,6 +34,8 @@
 
 #include "../services/taskduration/taskdurationviewmodel.h"
 
+#include "../utils/utils.h"
+
 namespace tks::UI
 {
 std::string StatusBar::HoursDayFormat = "[D] {0}";
@@ -41,18 +46,35 @@ std::string StatusBar::BillableDayFormat = "[D] {0}";
 std::string StatusBar::BillableWeekMonthFormat = "[W] {0} | [M] {1}";
 std::string StatusBar::BillableRangeFormat = "[R] {0}";
 
+StatusBar::DurationTotal::DurationTotal(TaskDurationType type)
+    : Type(type)
+    , FromDate()
+    , ToDate()
+    , Minutes(0)
+    , PendingQueries(0)
+    , Show()
+{
+}
+
 StatusBar::StatusBar(wxWindow* parent,
     std::shared_ptr<spdlog::logger> logger,
-    const std::string& databaseFilePath)
+    std::shared_ptr<Services::DatabaseExecutor> databaseExecutor,
+    std::shared_ptr<Services::TaskRangeCache> taskRangeCache)
     : wxStatusBar(parent, wxID_ANY, wxSTB_DEFAULT_STYLE, "tksstatusbar")
     , pParent(parent)
     , pLogger(logger)
-    , mDatabaseFilePath(databaseFilePath)
-    , mTaskDurationService(pLogger, mDatabaseFilePath)
-    , mDefaultHoursWeek()
-    , mDefaultHoursMonth()
-    , mBillableHoursWeek()
-    , mBillableHoursMonth()
+    , pDatabaseExecutor(databaseExecutor)
+    , pTaskRangeCache(taskRangeCache)
+    , mDefaultHoursDay(TaskDurationType::Default)
+    , mDefaultHoursWeek(TaskDurationType::Default)
+    , mDefaultHoursMonth(TaskDurationType::Default)
+    , mDefaultHoursRange(TaskDurationType::Default)
+    , mBillableHoursDay(TaskDurationType::Billable)
+    , mBillableHoursWeek(TaskDurationType::Billable)
+    , mBillableHoursMonth(TaskDurationType::Billable)
+    , mBillableHoursRange(TaskDurationType::Billable)
+    , bDefaultHoursRangeShown(false)
+    , bBillableHoursRangeShown(false)
 {
     int widths[] = {
         -1, FromDIP(56), FromDIP(64), FromDIP(136), FromDIP(56), FromDIP(64), FromDIP(136)
@@ -74,191 +96,247 @@ StatusBar::StatusBar(wxWindow* parent,
     SetStatusText("Billable", Fields::BillableText);
     SetStatusText("[D] 00:00", Fields::BillableDay);
     SetStatusText("[W] 00:00 | [M] 00:00", Fields::BillableWeekMonthOrRange);
+
+    mDefaultHoursDay.Show = [this]() {
+        auto durationStatusBarFormat =
+            fmt::format(StatusBar::HoursDayFormat, FormatDuration(mDefaultHoursDay.Minutes));
+        SetStatusText(durationStatusBarFormat, Fields::HoursDay);
+    };
+    mDefaultHoursWeek.Show = [this]() { UpdateDefaultHoursWeekMonth(); };
+    mDefaultHoursMonth.Show = [this]() { UpdateDefaultHoursWeekMonth(); };
+    mDefaultHoursRange.Show = [this]() {
+        if (bDefaultHoursRangeShown) {
+            auto durationStatusBarFormat = fmt::format(
+                StatusBar::HoursRangeFormat, FormatDuration(mDefaultHoursRange.Minutes));
+            SetStatusText(durationStatusBarFormat, Fields::HoursWeekMonthOrRange);
+        }
+    };
+
+    mBillableHoursDay.Show = [this]() {
+        auto durationStatusBarFormat =
+            fmt::format(StatusBar::BillableDayFormat, FormatDuration(mBillableHoursDay.Minutes));
+        SetStatusText(durationStatusBarFormat, Fields::BillableDay);
+    };
+    mBillableHoursWeek.Show = [this]() { UpdateBillableHoursWeekMonth(); };
+    mBillableHoursMonth.Show = [this]() { UpdateBillableHoursWeekMonth(); };
+    mBillableHoursRange.Show = [this]() {
+        if (bBillableHoursRangeShown) {
+            auto durationStatusBarFormat = fmt::format(
+                StatusBar::BillableRangeFormat, FormatDuration(mBillableHoursRange.Minutes));
+            SetStatusText(durationStatusBarFormat, Fields::BillableWeekMonthOrRange);
+        }
+    };
 }
 
 void StatusBar::UpdateDefaultHoursDay(const std::string& fromDate, const std::string& toDate)
 {
-    std::string duration = "";
-
-    auto sqliteResult = mTaskDurationService.CalculateAndFormatDuration(
-        fromDate, toDate, TaskDurationType::Default, duration);
-    if (!sqliteResult.Success) {
-        wxRichMessageDialog dialog(this,
-            Messages::DurationCalculationMessage,
-            Common::GetProgramName(),
-            wxCENTER | wxCANCEL_DEFAULT | wxOK | wxCANCEL | wxICON_ERROR);
-        dialog.SetExtendedMessage(sqliteResult.FriendlyErrorMessage);
-        dialog.ShowDetailedText(sqliteResult.GetReturnCodeAndMessage());
-
-        dialog.ShowModal();
-    } else {
-        auto durationStatusBarFormat = fmt::format(StatusBar::HoursDayFormat, duration);
-        SetStatusText(durationStatusBarFormat, Fields::HoursDay);
-    }
+    CalculateDuration(mDefaultHoursDay, fromDate, toDate);
 }
 
 void StatusBar::UpdateDefaultHoursWeek(const std::string& fromDate, const std::string& toDate)
 {
-    std::string duration = "";
-
-    auto sqliteResult = mTaskDurationService.CalculateAndFormatDuration(
-        fromDate, toDate, TaskDurationType::Default, duration);
-    if (!sqliteResult.Success) {
-        wxRichMessageDialog dialog(this,
-            Messages::DurationCalculationMessage,
-            Common::GetProgramName(),
-            wxCENTER | wxCANCEL_DEFAULT | wxOK | wxCANCEL | wxICON_ERROR);
-        dialog.SetExtendedMessage(sqliteResult.FriendlyErrorMessage);
-        dialog.ShowDetailedText(sqliteResult.GetReturnCodeAndMessage());
-
-        dialog.ShowModal();
-    } else {
-        mDefaultHoursWeek = duration;
-
-        UpdateDefaultHoursWeekMonth();
-    }
+    bDefaultHoursRangeShown = false;
+    CalculateDuration(mDefaultHoursWeek, fromDate, toDate);
 }
 
 void StatusBar::UpdateDefaultHoursMonth(const std::string& fromDate, const std::string& toDate)
 {
-    std::string duration = "";
-
-    auto sqliteResult = mTaskDurationService.CalculateAndFormatDuration(
-        fromDate, toDate, TaskDurationType::Default, duration);
-    if (!sqliteResult.Success) {
-        wxRichMessageDialog dialog(this,
-            Messages::DurationCalculationMessage,
-            Common::GetProgramName(),
-            wxCENTER | wxCANCEL_DEFAULT | wxOK | wxCANCEL | wxICON_ERROR);
-        dialog.SetExtendedMessage(sqliteResult.FriendlyErrorMessage);
-        dialog.ShowDetailedText(sqliteResult.GetReturnCodeAndMessage());
-
-        dialog.ShowModal();
-    } else {
-        mDefaultHoursMonth = duration;
-
-        UpdateDefaultHoursWeekMonth();
-    }
+    bDefaultHoursRangeShown = false;
+    CalculateDuration(mDefaultHoursMonth, fromDate, toDate);
 }
 
 void StatusBar::UpdateDefaultHoursRange(const std::string& fromDate, const std::string& toDate)
 {
-    std::string duration = "";
-
-    auto sqliteResult = mTaskDurationService.CalculateAndFormatDuration(
-        fromDate, toDate, TaskDurationType::Default, duration);
-    if (!sqliteResult.Success) {
-        wxRichMessageDialog dialog(this,
-            Messages::DurationCalculationMessage,
-            Common::GetProgramName(),
-            wxCENTER | wxCANCEL_DEFAULT | wxOK | wxCANCEL | wxICON_ERROR);
-        dialog.SetExtendedMessage(sqliteResult.FriendlyErrorMessage);
-        dialog.ShowDetailedText(sqliteResult.GetReturnCodeAndMessage());
-
-        dialog.ShowModal();
-    } else {
-        auto durationStatusBarFormat = fmt::format(StatusBar::HoursRangeFormat, duration);
-        SetStatusText(durationStatusBarFormat, Fields::HoursWeekMonthOrRange);
-    }
+    bDefaultHoursRangeShown = true;
+    CalculateDuration(mDefaultHoursRange, fromDate, toDate);
 }
 
 void StatusBar::UpdateBillableHoursDay(const std::string& fromDate, const std::string& toDate)
 {
-    std::string duration = "";
-
-    auto sqliteResult = mTaskDurationService.CalculateAndFormatDuration(
-        fromDate, toDate, TaskDurationType::Billable, duration);
-    if (!sqliteResult.Success) {
-        wxRichMessageDialog dialog(this,
-            Messages::DurationCalculationMessage,
-            Common::GetProgramName(),
-            wxCENTER | wxCANCEL_DEFAULT | wxOK | wxCANCEL | wxICON_ERROR);
-        dialog.SetExtendedMessage(sqliteResult.FriendlyErrorMessage);
-        dialog.ShowDetailedText(sqliteResult.GetReturnCodeAndMessage());
-
-        dialog.ShowModal();
-    } else {
-        auto durationStatusBarFormat = fmt::format(StatusBar::BillableDayFormat, duration);
-        SetStatusText(durationStatusBarFormat, Fields::BillableDay);
-    }
+    CalculateDuration(mBillableHoursDay, fromDate, toDate);
 }
 
 void StatusBar::UpdateBillableHoursWeek(const std::string& fromDate, const std::string& toDate)
 {
-    std::string duration = "";
-
-    auto sqliteResult = mTaskDurationService.CalculateAndFormatDuration(
-        fromDate, toDate, TaskDurationType::Billable, duration);
-    if (!sqliteResult.Success) {
-        wxRichMessageDialog dialog(this,
-            Messages::DurationCalculationMessage,
-            Common::GetProgramName(),
-            wxCENTER | wxCANCEL_DEFAULT | wxOK | wxCANCEL | wxICON_ERROR);
-        dialog.SetExtendedMessage(sqliteResult.FriendlyErrorMessage);
-        dialog.ShowDetailedText(sqliteResult.GetReturnCodeAndMessage());
-
-        dialog.ShowModal();
-    } else {
-        mBillableHoursWeek = duration;
-
-        UpdateBillableHoursWeekMonth();
-    }
+    bBillableHoursRangeShown = false;
+    CalculateDuration(mBillableHoursWeek, fromDate, toDate);
 }
 
 void StatusBar::UpdateBillableHoursMonth(const std::string& fromDate, const std::string& toDate)
 {
-    std::string duration = "";
-
-    auto sqliteResult = mTaskDurationService.CalculateAndFormatDuration(
-        fromDate, toDate, TaskDurationType::Billable, duration);
-    if (!sqliteResult.Success) {
-        wxRichMessageDialog dialog(this,
-            Messages::DurationCalculationMessage,
-            Common::GetProgramName(),
-            wxCENTER | wxCANCEL_DEFAULT | wxOK | wxCANCEL | wxICON_ERROR);
-        dialog.SetExtendedMessage(sqliteResult.FriendlyErrorMessage);
-        dialog.ShowDetailedText(sqliteResult.GetReturnCodeAndMessage());
-
-        dialog.ShowModal();
-    } else {
-        mBillableHoursMonth = duration;
-
-        UpdateBillableHoursWeekMonth();
-    }
+    bBillableHoursRangeShown = false;
+    CalculateDuration(mBillableHoursMonth, fromDate, toDate);
 }
 
 void StatusBar::UpdateBillableHoursRange(const std::string& fromDate, const std::string& toDate)
 {
-    std::string duration = "";
-
-    auto sqliteResult = mTaskDurationService.CalculateAndFormatDuration(
-        fromDate, toDate, TaskDurationType::Billable, duration);
-    if (!sqliteResult.Success) {
-        wxRichMessageDialog dialog(this,
-            Messages::DurationCalculationMessage,
-            Common::GetProgramName(),
-            wxCENTER | wxCANCEL_DEFAULT | wxOK | wxCANCEL | wxICON_ERROR);
-        dialog.SetExtendedMessage(sqliteResult.FriendlyErrorMessage);
-        dialog.ShowDetailedText(sqliteResult.GetReturnCodeAndMessage());
-
-        dialog.ShowModal();
-    } else {
-        auto durationStatusBarFormat = fmt::format(StatusBar::BillableRangeFormat, duration);
-        SetStatusText(durationStatusBarFormat, Fields::BillableWeekMonthOrRange);
+    bBillableHoursRangeShown = true;
+    CalculateDuration(mBillableHoursRange, fromDate, toDate);
+}
+
+void StatusBar::ApplyDurationChange(const std::string& date,
+    int defaultMinutes,
+    int billableMinutes)
+{
+    for (auto total :
+        { &mDefaultHoursDay, &mDefaultHoursWeek, &mDefaultHoursMonth, &mDefaultHoursRange }) {
+        ApplyDurationChangeToTotal(*total, date, defaultMinutes);
+    }
+
+    for (auto total :
+        { &mBillableHoursDay, &mBillableHoursWeek, &mBillableHoursMonth, &mBillableHoursRange }) {
+        ApplyDurationChangeToTotal(*total, date, billableMinutes);
+    }
+}
+
+void StatusBar::RecalculateDurations()
+{
+    for (auto total : { &mDefaultHoursDay,
+             &mDefaultHoursWeek,
+             &mDefaultHoursMonth,
+             &mDefaultHoursRange,
+             &mBillableHoursDay,
+             &mBillableHoursWeek,
+             &mBillableHoursMonth,
+             &mBillableHoursRange }) {
+        if (!total->FromDate.empty()) {
+            CalculateDuration(*total, total->FromDate, total->ToDate);
+        }
+    }
+}
+
+bool StatusBar::TryGetDateRange(std::string& fromDate, std::string& toDate) const
+{
+    bool found = false;
+    for (auto total : { &mDefaultHoursDay,
+             &mDefaultHoursWeek,
+             &mDefaultHoursMonth,
+             &mDefaultHoursRange,
+             &mBillableHoursDay,
+             &mBillableHoursWeek,
+             &mBillableHoursMonth,
+             &mBillableHoursRange }) {
+        if (total->FromDate.empty()) {
+            continue;
+        }
+
+        // dates are formatted as %F, so they compare in date order
+        if (!found || total->FromDate < fromDate) {
+            fromDate = total->FromDate;
+        }
+        if (!found || toDate < total->ToDate) {
+            toDate = total->ToDate;
+        }
+        found = true;
     }
+
+    return found;
+}
+
+void StatusBar::CalculateDuration(DurationTotal& total,
+    const std::string& fromDate,
+    const std::string& toDate)
+{
+    using DurationResult = std::pair<SqliteResult, int>;
+
+    total.FromDate = fromDate;
+    total.ToDate = toDate;
+    total.PendingQueries++;
+
+    // a fully cached range is summed here, but still goes through the executor so that it is
+    // applied in the same order as the durations that do need a query
+    int cachedMinutes = 0;
+    bool isCached =
+        pTaskRangeCache->TryCalculateDuration(fromDate, toDate, total.Type, cachedMinutes);
+
+    // the executor runs jobs in submission order, so the last requested duration is applied last
+    pDatabaseExecutor->Post<DurationResult>(
+        Services::CancellationToken(),
+        [fromDate, toDate, type = total.Type, isCached, cachedMinutes](
+            Services::DatabaseExecutorContext& context) {
+            if (isCached) {
+                return std::make_pair(SqliteResult::OK(), cachedMinutes);
+            }
+
+            std::vector<Services::TaskDurationViewModel> taskDurations;
+            auto sqliteResult = context.TaskDurations.GetTaskDurationsForDateRange(
+                fromDate, toDate, type, taskDurations);
+
+            int totalMinutes = 0;
+            for (const auto& taskDuration : taskDurations) {
+                totalMinutes += taskDuration.Hours * 60 + taskDuration.Minutes;
+            }
+            return std::make_pair(sqliteResult, totalMinutes);
+        },
+        [this, &total](DurationResult& result) {
+            total.PendingQueries--;
+
+            auto& [sqliteResult, totalMinutes] = result;
+            if (!sqliteResult.Success) {
+                wxRichMessageDialog dialog(this,
+                    Messages::DurationCalculationMessage,
+                    Common::GetProgramName(),
+                    wxCENTER | wxCANCEL_DEFAULT | wxOK | wxCANCEL | wxICON_ERROR);
+                dialog.SetExtendedMessage(sqliteResult.FriendlyErrorMessage);
+                dialog.ShowDetailedText(sqliteResult.GetReturnCodeAndMessage());
+
+                dialog.ShowModal();
+            } else {
+                total.Minutes = totalMinutes;
+                total.Show();
+            }
+        });
+}
+
+void StatusBar::ApplyDurationChangeToTotal(DurationTotal& total,
+    const std::string& date,
+    int minutes)
+{
+    if (minutes == 0 || total.FromDate.empty() || date < total.FromDate || total.ToDate < date) {
+        return;
+    }
+
+    // a query in flight may have read the tasks before or after the change, so the total is
+    // queried again instead and the executor applies the newer query last
+    if (total.PendingQueries > 0) {
+        CalculateDuration(total, total.FromDate, total.ToDate);
+        return;
+    }
+
+    total.Minutes += minutes;
+    total.Show();
 }
 
 void StatusBar::UpdateDefaultHoursWeekMonth()
 {
-    auto durationStatusBarFormat =
-        fmt::format(StatusBar::HoursWeekMonthFormat, mDefaultHoursWeek, mDefaultHoursMonth);
+    if (bDefaultHoursRangeShown) {
+        return;
+    }
+
+    auto durationStatusBarFormat = fmt::format(StatusBar::HoursWeekMonthFormat,
+        FormatDuration(mDefaultHoursWeek.Minutes),
+        FormatDuration(mDefaultHoursMonth.Minutes));
     SetStatusText(durationStatusBarFormat, Fields::HoursWeekMonthOrRange);
 }
 
 void StatusBar::UpdateBillableHoursWeekMonth()
 {
-    auto durationStatusBarFormat =
-        fmt::format(StatusBar::BillableWeekMonthFormat, mBillableHoursWeek, mBillableHoursMonth);
+    if (bBillableHoursRangeShown) {
+        return;
+    }
+
+    auto durationStatusBarFormat = fmt::format(StatusBar::BillableWeekMonthFormat,
+        FormatDuration(mBillableHoursWeek.Minutes),
+        FormatDuration(mBillableHoursMonth.Minutes));
     SetStatusText(durationStatusBarFormat, Fields::BillableWeekMonthOrRange);
 }
+
+std::string StatusBar::FormatDuration(const int totalMinutes)
+{
+    int hours = 0;
+    int minutes = 0;
+    Utils::DeconstructDurationTimePeriod(totalMinutes, hours, minutes);
+
+    return fmt::format("{0:02}:{1:02}", hours, minutes);
+}
 } // namespace tks::UI
@@ -19,6 +19,7 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <string>
 
@@ -29,7 +30,10 @@
 #include <wx/wx.h>
 #endif
 
-#include "../services/taskduration/taskdurationservice.h"
+#include "../common/enums.h"
+
+#include "../services/executor/databaseexecutor.h"
+#include "../services/tasks/taskrangecache.h"
 
 namespace tks::UI
 {
@@ -39,7 +43,8 @@ class StatusBar : public wxStatusBar
     StatusBar() = delete;
     StatusBar(wxWindow* parent,
         std::shared_ptr<spdlog::logger> logger,
-        const std::string& databaseFilePath);
+        std::shared_ptr<Services::DatabaseExecutor> databaseExecutor,
+        std::shared_ptr<Services::TaskRangeCache> taskRangeCache);
     virtual ~StatusBar() = default;
 
     void UpdateDefaultHoursDay(const std::string& fromDate, const std::string& toDate);
@@ -54,6 +59,22 @@ class StatusBar : public wxStatusBar
 
     void UpdateBillableHoursRange(const std::string& fromDate, const std::string& toDate);
 
+    /// <summary>
+    /// Add the minutes that changed tasks on a date gained or lost to every total covering the
+    /// date, without querying the totals again
+    /// </summary>
+    void ApplyDurationChange(const std::string& date, int defaultMinutes, int billableMinutes);
+
+    /// <summary>
+    /// Query every total again for the dates it covers
+    /// </summary>
+    void RecalculateDurations();
+
+    /// <summary>
+    /// The earliest and latest date covered by any of the totals
+    /// </summary>
+    bool TryGetDateRange(/*out*/ std::string& fromDate, /*out*/ std::string& toDate) const;
+
     enum Fields {
         Default = 0,
         HoursText = 1,
@@ -66,20 +87,47 @@ class StatusBar : public wxStatusBar
     };
 
 private:
+    struct DurationTotal {
+        DurationTotal(TaskDurationType type);
+
+        TaskDurationType Type;
+        std::string FromDate;
+        std::string ToDate;
+        int Minutes;
+        // queries still in flight, a change applied meanwhile may be missing from their result
+        int PendingQueries;
+        // sets the total into its field, if the field currently shows it
+        std::function<void()> Show;
+    };
+
+    void CalculateDuration(DurationTotal& total,
+        const std::string& fromDate,
+        const std::string& toDate);
+    void ApplyDurationChangeToTotal(DurationTotal& total, const std::string& date, int minutes);
+
     void UpdateDefaultHoursWeekMonth();
     void UpdateBillableHoursWeekMonth();
 
+    static std::string FormatDuration(const int totalMinutes);
+
     wxWindow* pParent;
 
     std::shared_ptr<spdlog::logger> pLogger;
-    std::string mDatabaseFilePath;
-
-    Services::TaskDurationService mTaskDurationService;
-
-    std::string mDefaultHoursWeek;
-    std::string mDefaultHoursMonth;
-    std::string mBillableHoursWeek;
-    std::string mBillableHoursMonth;
+    std::shared_ptr<Services::DatabaseExecutor> pDatabaseExecutor;
+    std::shared_ptr<Services::TaskRangeCache> pTaskRangeCache;
+
+    DurationTotal mDefaultHoursDay;
+    DurationTotal mDefaultHoursWeek;
+    DurationTotal mDefaultHoursMonth;
+    DurationTotal mDefaultHoursRange;
+    DurationTotal mBillableHoursDay;
+    DurationTotal mBillableHoursWeek;
+    DurationTotal mBillableHoursMonth;
+    DurationTotal mBillableHoursRange;
+
+    // the week and month, or the range, share a field, whichever was requested last is shown
+    bool bDefaultHoursRangeShown;
+    bool bBillableHoursRangeShown;
 
     static std::string HoursDayFormat;
     static std::string HoursWeekMonthFormat;
@@ -0,0 +1,129 @@
+// Productivity tool to help you track the time you spend on tasks
+// Copyright (C) 2026 Szymon Welgus
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+// Contact:
+//     szymonwelgus at gmail dot com
+
+#include "daynumber.h"
+
+namespace tks
+{
+DayNumber::DayNumber()
+    : Value(0)
+{
+}
+
+DayNumber::DayNumber(std::int32_t value)
+    : Value(value)
+{
+}
+
+DayNumber::DayNumber(std::chrono::time_point<std::chrono::system_clock, date::days> date)
+    : Value(static_cast<std::int32_t>(date.time_since_epoch().count()))
+{
+}
+
+bool DayNumber::TryParse(const std::string& isoDate, DayNumber& dayNumber)
+{
+    // "%F" dates only, parsed by hand as this sits on every date key conversion
+    if (isoDate.size() != 10 || isoDate[4] != '-' || isoDate[7] != '-') {
+        return false;
+    }
+
+    auto parseDigits = [&isoDate](std::size_t position, std::size_t count, int& value) {
+        value = 0;
+        for (std::size_t i = position; i < position + count; i++) {
+            if (isoDate[i] < '0' || isoDate[i] > '9') {
+                return false;
+            }
+            value = value * 10 + (isoDate[i] - '0');
+        }
+        return true;
+    };
+
+    int year = 0;
+    int month = 0;
+    int day = 0;
+    if (!parseDigits(0, 4, year) || !parseDigits(5, 2, month) || !parseDigits(8, 2, day)) {
+        return false;
+    }
+
+    date::year_month_day yearMonthDay{ date::year{ year },
+        date::month{ static_cast<unsigned>(month) },
+        date::day{ static_cast<unsigned>(day) } };
+    if (!yearMonthDay.ok()) {
+        return false;
+    }
+
+    dayNumber = DayNumber(date::sys_days{ yearMonthDay });
+    return true;
+}
+
+std::chrono::time_point<std::chrono::system_clock, date::days> DayNumber::ToDate() const
+{
+    return std::chrono::time_point<std::chrono::system_clock, date::days>(date::days{ Value });
+}
+
+std::string DayNumber::ToString() const
+{
+    return date::format("%F", ToDate());
+}
+
+DayNumber DayNumber::operator+(std::int32_t days) const
+{
+    return DayNumber(Value + days);
+}
+
+DayNumber DayNumber::operator-(std::int32_t days) const
+{
+    return DayNumber(Value - days);
+}
+
+std::int32_t DayNumber::operator-(const DayNumber& other) const
+{
+    return Value - other.Value;
+}
+
+bool DayNumber::operator==(const DayNumber& other) const
+{
+    return Value == other.Value;
+}
+
+bool DayNumber::operator!=(const DayNumber& other) const
+{
+    return Value != other.Value;
+}
+
+bool DayNumber::operator<(const DayNumber& other) const
+{
+    return Value < other.Value;
+}
+
+bool DayNumber::operator<=(const DayNumber& other) const
+{
+    return Value <= other.Value;
+}
+
+bool DayNumber::operator>(const DayNumber& other) const
+{
+    return Value > other.Value;
+}
+
+bool DayNumber::operator>=(const DayNumber& other) const
+{
+    return Value >= other.Value;
+}
+} // namespace tks
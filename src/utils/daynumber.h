@@ -0,0 +1,66 @@
+// Productivity tool to help you track the time you spend on tasks
+// Copyright (C) 2026 Szymon Welgus
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+// Contact:
+//     szymonwelgus at gmail dot com
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+
+#include <date/date.h>
+
+namespace tks
+{
+/// <summary>
+/// A calendar date as the count of days since the unix epoch, matches workdays.day_number
+/// </summary>
+struct DayNumber final {
+    DayNumber();
+    explicit DayNumber(std::int32_t value);
+    explicit DayNumber(std::chrono::time_point<std::chrono::system_clock, date::days> date);
+
+    static bool TryParse(const std::string& isoDate, /*out*/ DayNumber& dayNumber);
+
+    std::int32_t Value;
+
+    std::chrono::time_point<std::chrono::system_clock, date::days> ToDate() const;
+    std::string ToString() const;
+
+    DayNumber operator+(std::int32_t days) const;
+    DayNumber operator-(std::int32_t days) const;
+    std::int32_t operator-(const DayNumber& other) const;
+
+    bool operator==(const DayNumber& other) const;
+    bool operator!=(const DayNumber& other) const;
+    bool operator<(const DayNumber& other) const;
+    bool operator<=(const DayNumber& other) const;
+    bool operator>(const DayNumber& other) const;
+    bool operator>=(const DayNumber& other) const;
+};
+} // namespace tks
+
+template<>
+struct std::hash<tks::DayNumber> {
+    std::size_t operator()(const tks::DayNumber& dayNumber) const noexcept
+    {
+        return std::hash<std::int32_t>{}(dayNumber.Value);
+    }
+};
@@ -22,6 +22,7 @@
 #include <chrono>
 #include <numeric>
 #include <random>
+#include <sstream>
 
 #include <date/date.h>
 
@@ -223,6 +224,42 @@ std::string FormatSqlSearchTerm(const std::string& source)
     return "%" + source + "%";
 }
 
+std::string FormatFtsSearchTerm(const std::string& source)
+{
+    std::string term;
+    std::istringstream ssSource{ source };
+
+    std::string word;
+    while (ssSource >> word) {
+        if (!term.empty()) {
+            term += " ";
+        }
+
+        term += FormatFtsPhraseTerm(word);
+    }
+
+    if (!term.empty()) {
+        term += "*";
+    }
+
+    return term;
+}
+
+std::string FormatFtsPhraseTerm(const std::string& source)
+{
+    std::string term = "\"";
+    for (const char c : source) {
+        // a double quote inside an FTS5 string is escaped by doubling it
+        if (c == '"') {
+            term += "\"";
+        }
+        term += c;
+    }
+    term += "\"";
+
+    return term;
+}
+
 // clang-format off
 std::string ConvertListIdsToCommaDelimitedString(const std::vector<std::int64_t> ids)
 {
@@ -249,6 +286,16 @@ std::string ConvertListStringToCommaDelimitedString(const std::vector<std::strin
 }
 // clang-format on
 
+std::string FormatSqlPlaceholders(std::size_t count)
+{
+    std::string placeholders;
+    for (std::size_t i = 0; i < count; i++) {
+        placeholders += i == 0 ? "?" : ", ?";
+    }
+
+    return placeholders;
+}
+
 // This method and the subsequent one below was generated using CoPilot
 // https://github.com/copilot/c/f8e039ed-8725-4130-a8c2-830c2c5e020a
 static bool IsEmoji(wchar_t ch)
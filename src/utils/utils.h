@@ -19,6 +19,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <string>
 #include <vector>
@@ -66,8 +67,20 @@ std::string ToExcelColumnName(int columnNumber);
 // to the string so the parameterization takes effect
 std::string FormatSqlSearchTerm(const std::string& source);
 
+// FTS5 treats characters such as '-', '"' and ':' in a MATCH argument as query syntax.
+// Quotes every whitespace separated word of the input as a string so it is matched literally,
+// the last word as a prefix so partially typed words still match
+std::string FormatFtsSearchTerm(const std::string& source);
+
+// Quotes the whole input as a single FTS5 string, which a trigram index matches as a substring
+// the way LIKE '%source%' does
+std::string FormatFtsPhraseTerm(const std::string& source);
+
 std::string ConvertListIdsToCommaDelimitedString(const std::vector<std::int64_t> ids);
 
+// "?, ?, ?" with count parameters, for binding a list of values to an IN (...) clause
+std::string FormatSqlPlaceholders(std::size_t count);
+
 std::string ConvertListStringToCommaDelimitedString(const std::vector<std::string> inputs);
 
 std::string RemoveEmoticons(const std::wstring& value);